@@ -0,0 +1,105 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace FieaGameEngine::Benchmarks
+{
+	/// <summary>
+	/// Measures the part of a benchmark that should count towards its result. Setup that happens before Start or after Stop is not timed.
+	/// </summary>
+	class Stopwatch final
+	{
+	public:
+		void Start();
+		void Stop();
+		/// <summary>
+		/// Returns the total time between every Start and Stop pair in nanoseconds.
+		/// </summary>
+		/// <returns>double</returns>
+		double Nanoseconds() const;
+
+	private:
+		std::chrono::steady_clock::time_point _start{};
+		std::chrono::steady_clock::duration _elapsed{};
+	};
+
+	/// <summary>
+	/// A benchmark body is handed the element count to work on and a Stopwatch, and returns the number of operations it timed. Returning zero skips that size.
+	/// </summary>
+	using BenchmarkFunction = std::function<std::size_t(std::size_t, Stopwatch&)>;
+
+	struct Benchmark final
+	{
+		std::string Group;
+		std::string Name;
+		BenchmarkFunction Function;
+	};
+
+	/// <summary>
+	/// Returns every benchmark registered through RegisterBenchmark or BENCHMARK.
+	/// </summary>
+	/// <returns>Vector of Benchmark</returns>
+	std::vector<Benchmark>& Registry();
+	/// <summary>
+	/// Adds a benchmark to the registry. Returns true so it can initialize a static at namespace scope.
+	/// </summary>
+	bool RegisterBenchmark(std::string group, std::string name, BenchmarkFunction function);
+
+	/// <summary>
+	/// A report prints measurements that are not timings, such as how evenly a hash spreads a set of keys.
+	/// </summary>
+	struct Report final
+	{
+		std::string Name;
+		std::function<void()> Function;
+	};
+
+	/// <summary>
+	/// Returns every report registered through RegisterReport or REPORT. They only run when the executable is given --reports.
+	/// </summary>
+	/// <returns>Vector of Report</returns>
+	std::vector<Report>& Reports();
+	/// <summary>
+	/// Adds a report to the registry. Returns true so it can initialize a static at namespace scope.
+	/// </summary>
+	bool RegisterReport(std::string name, std::function<void()> function);
+
+	/// <summary>
+	/// A linear search costs time proportional to the size of the container, so benchmarks of one search for at most this many values.
+	/// That keeps the largest sizes practical while still reporting the time of a single search.
+	/// </summary>
+	constexpr std::size_t MaximumSearches{ 100 };
+
+	/// <summary>
+	/// Maps 0, 1, 2... onto positions spread across a container of the given size, so that access patterns do not simply walk memory in order.
+	/// </summary>
+	inline std::size_t ScatteredIndex(std::size_t index, std::size_t size)
+	{
+		return static_cast<std::size_t>((static_cast<unsigned long long>(index) * 2'654'435'761ULL) % size);
+	}
+
+	/// <summary>
+	/// Keeps the compiler from discarding a value that a benchmark computes but never uses.
+	/// </summary>
+	template <typename T>
+	inline void DoNotOptimize(const T& value)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "r,m"(value) : "memory");
+#else
+		static const void* volatile sink;
+		sink = &value;
+#endif
+	}
+}
+
+#define BENCHMARK_CONCAT_INNER(a, b) a##b
+#define BENCHMARK_CONCAT(a, b) BENCHMARK_CONCAT_INNER(a, b)
+#define BENCHMARK(group, name, function) \
+	static const bool BENCHMARK_CONCAT(_benchmarkRegistered, __LINE__){ FieaGameEngine::Benchmarks::RegisterBenchmark(group, name, function) }
+#define REPORT(name, function) \
+	static const bool BENCHMARK_CONCAT(_reportRegistered, __LINE__){ FieaGameEngine::Benchmarks::RegisterReport(name, function) }
@@ -0,0 +1,515 @@
+#include "Benchmark.h"
+#include <algorithm>
+#include <array>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Datum.h"
+
+using namespace FieaGameEngine;
+using namespace FieaGameEngine::Benchmarks;
+
+namespace
+{
+	/// <summary>
+	/// Datum grows its storage with realloc, which moves strings by copying their bytes. That is only sound under libstdc++ for strings whose
+	/// characters live on the heap, so every string pushed here is longer than the small string buffer.
+	/// </summary>
+	std::string MakeString(std::size_t index)
+	{
+		return "a value long enough to live on the heap " + std::to_string(index);
+	}
+
+	void FillInts(Datum& datum, std::size_t size)
+	{
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			datum.PushBack(static_cast<int>(index));
+		}
+	}
+
+	void FillStrings(Datum& datum, std::size_t size)
+	{
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			datum.PushBack(MakeString(index));
+		}
+	}
+
+	std::size_t PushBackInt(std::size_t size, Stopwatch& stopwatch)
+	{
+		Datum datum{ Datum::DatumTypes::Integer };
+		stopwatch.Start();
+		FillInts(datum, size);
+		stopwatch.Stop();
+
+		DoNotOptimize(datum.Size());
+		return size;
+	}
+
+	std::size_t PushBackString(std::size_t size, Stopwatch& stopwatch)
+	{
+		std::vector<std::string> values;
+		values.reserve(size);
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			values.push_back(MakeString(index));
+		}
+
+		Datum datum{ Datum::DatumTypes::String };
+		stopwatch.Start();
+		for (const std::string& value : values)
+		{
+			datum.PushBack(value);
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(datum.Size());
+		return size;
+	}
+
+	/// <summary>
+	/// Appends a whole array in one call, which grows the storage at most once.
+	/// </summary>
+	std::size_t AppendInt(std::size_t size, Stopwatch& stopwatch)
+	{
+		std::vector<int> values(size);
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			values[index] = static_cast<int>(index);
+		}
+
+		Datum datum{ Datum::DatumTypes::Integer };
+		stopwatch.Start();
+		datum.Append(std::span<const int>{ values });
+		stopwatch.Stop();
+
+		DoNotOptimize(datum.Size());
+		return size;
+	}
+
+	/// <summary>
+	/// Assigns a single value to each of many Datums, the way the attributes of a Scope tree are filled in as it loads.
+	/// Values that fit in the Datum itself are stored without touching the heap.
+	/// </summary>
+	std::size_t ScalarInt(std::size_t size, Stopwatch& stopwatch)
+	{
+		std::vector<Datum> datums(size);
+		stopwatch.Start();
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			datums[index] = static_cast<int>(index);
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(datums.back().BackAsInt());
+		return size;
+	}
+
+	std::size_t ScalarVector(std::size_t size, Stopwatch& stopwatch)
+	{
+		std::vector<Datum> datums(size);
+		stopwatch.Start();
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			datums[index] = glm::vec4{ static_cast<float>(index) };
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(datums.back().BackAsVector());
+		return size;
+	}
+
+	/// <summary>
+	/// Reads values at scattered positions through the typed accessor, which checks the type and the bounds on every call.
+	/// </summary>
+	std::size_t GetInt(std::size_t size, Stopwatch& stopwatch)
+	{
+		Datum datum{ Datum::DatumTypes::Integer };
+		FillInts(datum, size);
+
+		long long sum{ 0 };
+		stopwatch.Start();
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			sum += datum.GetAsInt(ScatteredIndex(index, size));
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(sum);
+		return size;
+	}
+
+	std::size_t IterateInt(std::size_t size, Stopwatch& stopwatch)
+	{
+		Datum datum{ Datum::DatumTypes::Integer };
+		FillInts(datum, size);
+
+		long long sum{ 0 };
+		stopwatch.Start();
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			sum += datum.GetAsInt(index);
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(sum);
+		return size;
+	}
+
+	/// <summary>
+	/// Walks the same values through a span, which checks the type once instead of on every access.
+	/// </summary>
+	std::size_t IterateIntSpan(std::size_t size, Stopwatch& stopwatch)
+	{
+		Datum datum{ Datum::DatumTypes::Integer };
+		FillInts(datum, size);
+
+		long long sum{ 0 };
+		stopwatch.Start();
+		for (int value : datum.AsSpan<int>())
+		{
+			sum += value;
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(sum);
+		return size;
+	}
+
+	std::size_t IterateString(std::size_t size, Stopwatch& stopwatch)
+	{
+		Datum datum{ Datum::DatumTypes::String };
+		FillStrings(datum, size);
+
+		std::size_t length{ 0 };
+		stopwatch.Start();
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			length += datum.GetAsString(index).size();
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(length);
+		return size;
+	}
+
+	/// <summary>
+	/// Searches for values spread evenly through the Datum, so on average each search reads half of it.
+	/// </summary>
+	std::size_t FindInt(std::size_t size, Stopwatch& stopwatch)
+	{
+		Datum datum{ Datum::DatumTypes::Integer };
+		FillInts(datum, size);
+		const std::size_t searches{ std::min(size, MaximumSearches) };
+
+		std::size_t found{ 0 };
+		stopwatch.Start();
+		for (std::size_t search{ 0 }; search < searches; ++search)
+		{
+			found += datum.Find(static_cast<int>(ScatteredIndex(search, size))) < size;
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(found);
+		return searches;
+	}
+
+	/// <summary>
+	/// The pointer searches only compare addresses, so the objects pointed at need nothing beyond being RTTI.
+	/// </summary>
+	class Element final : public RTTI
+	{
+	public:
+		IdType TypeIdInstance() const override { return 0; }
+	};
+
+	std::size_t FindPointer(std::size_t size, Stopwatch& stopwatch)
+	{
+		std::vector<Element> elements(size);
+		Datum datum{ Datum::DatumTypes::Pointer };
+		for (Element& element : elements)
+		{
+			datum.PushBack(&element);
+		}
+		const std::size_t searches{ std::min(size, MaximumSearches) };
+
+		std::size_t found{ 0 };
+		stopwatch.Start();
+		for (std::size_t search{ 0 }; search < searches; ++search)
+		{
+			found += datum.Find(&elements[ScatteredIndex(search, size)]) < size;
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(found);
+		return searches;
+	}
+
+	/// <summary>
+	/// Every eighth value matches, and one FindAll collects them all, so this reports the time per element scanned.
+	/// </summary>
+	std::size_t FindAllInt(std::size_t size, Stopwatch& stopwatch)
+	{
+		Datum datum{ Datum::DatumTypes::Integer };
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			datum.PushBack(static_cast<int>(index % 8));
+		}
+
+		stopwatch.Start();
+		const Vector<std::size_t> indices{ datum.FindAll(7) };
+		stopwatch.Stop();
+
+		DoNotOptimize(indices.Size());
+		return size;
+	}
+
+	std::size_t FindString(std::size_t size, Stopwatch& stopwatch)
+	{
+		Datum datum{ Datum::DatumTypes::String };
+		FillStrings(datum, size);
+		const std::size_t searches{ std::min(size, MaximumSearches) };
+		std::vector<std::string> values;
+		for (std::size_t search{ 0 }; search < searches; ++search)
+		{
+			values.push_back(MakeString(ScatteredIndex(search, size)));
+		}
+
+		std::size_t found{ 0 };
+		stopwatch.Start();
+		for (const std::string& value : values)
+		{
+			found += datum.Find(value) < size;
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(found);
+		return searches;
+	}
+
+	void FillVectors(Datum& datum, std::size_t size)
+	{
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			const float value{ static_cast<float>(index) };
+			datum.PushBack(glm::vec4{ value, value * 0.5f, -value, 1.0f });
+		}
+	}
+
+	/// <summary>
+	/// Writes every vector as text through ToString, which returns a new string for each one.
+	/// </summary>
+	std::size_t ToStringVector(std::size_t size, Stopwatch& stopwatch)
+	{
+		Datum datum{ Datum::DatumTypes::Vector };
+		FillVectors(datum, size);
+
+		std::size_t length{ 0 };
+		stopwatch.Start();
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			length += datum.ToString(index).size();
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(length);
+		return size;
+	}
+
+	/// <summary>
+	/// Writes the same text into one reused buffer.
+	/// </summary>
+	std::size_t ToCharsVector(std::size_t size, Stopwatch& stopwatch)
+	{
+		Datum datum{ Datum::DatumTypes::Vector };
+		FillVectors(datum, size);
+
+		std::array<char, Datum::CharsBufferSize> buffer;
+		std::size_t length{ 0 };
+		stopwatch.Start();
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			length += static_cast<std::size_t>(datum.ToChars(buffer.data(), buffer.data() + buffer.size(), index).ptr - buffer.data());
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(length);
+		return size;
+	}
+
+	/// <summary>
+	/// Reads back the text of every vector, the way the JSON loader fills vector attributes.
+	/// </summary>
+	std::size_t FromStringVector(std::size_t size, Stopwatch& stopwatch)
+	{
+		Datum source{ Datum::DatumTypes::Vector };
+		FillVectors(source, size);
+		std::vector<std::string> values;
+		values.reserve(size);
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			values.push_back(source.ToString(index));
+		}
+
+		Datum datum{ Datum::DatumTypes::Vector };
+		stopwatch.Start();
+		for (const std::string& value : values)
+		{
+			datum.PushBackFromString(value);
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(datum.Size());
+		return size;
+	}
+
+	std::size_t FromStringInt(std::size_t size, Stopwatch& stopwatch)
+	{
+		std::vector<std::string> values;
+		values.reserve(size);
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			values.push_back(std::to_string(index));
+		}
+
+		Datum datum{ Datum::DatumTypes::Integer };
+		datum.Resize(size);
+		stopwatch.Start();
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			datum.SetFromString(values[index], index);
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(datum.BackAsInt());
+		return size;
+	}
+
+	std::size_t PopBackInt(std::size_t size, Stopwatch& stopwatch)
+	{
+		Datum datum{ Datum::DatumTypes::Integer };
+		FillInts(datum, size);
+
+		stopwatch.Start();
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			datum.PopBack();
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(datum.Size());
+		return size;
+	}
+
+	/// <summary>
+	/// Removes values from scattered positions, each of which shifts everything after it down by one.
+	/// </summary>
+	std::size_t RemoveInt(std::size_t size, Stopwatch& stopwatch)
+	{
+		Datum datum{ Datum::DatumTypes::Integer };
+		FillInts(datum, size);
+		const std::size_t removals{ std::min(size, MaximumSearches) };
+
+		stopwatch.Start();
+		for (std::size_t removal{ 0 }; removal < removals; ++removal)
+		{
+			datum.Remove(static_cast<int>(ScatteredIndex(removal, size)));
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(datum.Size());
+		return removals;
+	}
+
+	std::size_t CopyInt(std::size_t size, Stopwatch& stopwatch)
+	{
+		Datum datum{ Datum::DatumTypes::Integer };
+		FillInts(datum, size);
+
+		stopwatch.Start();
+		Datum copy{ datum };
+		stopwatch.Stop();
+
+		DoNotOptimize(copy.Size());
+		return size;
+	}
+
+	std::size_t CopyString(std::size_t size, Stopwatch& stopwatch)
+	{
+		Datum datum{ Datum::DatumTypes::String };
+		FillStrings(datum, size);
+
+		stopwatch.Start();
+		Datum copy{ datum };
+		stopwatch.Stop();
+
+		DoNotOptimize(copy.Size());
+		return size;
+	}
+
+	/// <summary>
+	/// A copy-on-write copy only takes a reference to the storage, so the time should not depend on the size until one side writes.
+	/// </summary>
+	std::size_t CopyStringShared(std::size_t size, Stopwatch& stopwatch)
+	{
+		Datum datum{ Datum::DatumTypes::String };
+		FillStrings(datum, size);
+		datum.SetCopyOnWrite(true);
+
+		stopwatch.Start();
+		Datum copy{ datum };
+		stopwatch.Stop();
+
+		DoNotOptimize(copy.Size());
+		return size;
+	}
+
+	/// <summary>
+	/// Moves a full Datum back and forth. A move only hands over the storage, so the time should not depend on the size.
+	/// </summary>
+	std::size_t Move(std::size_t size, Stopwatch& stopwatch)
+	{
+		constexpr std::size_t moves{ 1'000 };
+		Datum datum{ Datum::DatumTypes::Integer };
+		FillInts(datum, size);
+
+		stopwatch.Start();
+		for (std::size_t move{ 0 }; move < moves; move += 2)
+		{
+			Datum other{ std::move(datum) };
+			DoNotOptimize(other);
+			datum = std::move(other);
+			DoNotOptimize(datum);
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(datum.Size());
+		return moves;
+	}
+}
+
+BENCHMARK("Datum", "PushBack/Int", PushBackInt);
+BENCHMARK("Datum", "PushBack/String", PushBackString);
+BENCHMARK("Datum", "Append/Int", AppendInt);
+BENCHMARK("Datum", "Scalar/Int", ScalarInt);
+BENCHMARK("Datum", "Scalar/Vector", ScalarVector);
+BENCHMARK("Datum", "Get/Int", GetInt);
+BENCHMARK("Datum", "Iterate/Int", IterateInt);
+BENCHMARK("Datum", "Iterate/IntSpan", IterateIntSpan);
+BENCHMARK("Datum", "Iterate/String", IterateString);
+BENCHMARK("Datum", "Find/Int", FindInt);
+BENCHMARK("Datum", "Find/Pointer", FindPointer);
+BENCHMARK("Datum", "Find/String", FindString);
+BENCHMARK("Datum", "FindAll/Int", FindAllInt);
+BENCHMARK("Datum", "ToString/Vector", ToStringVector);
+BENCHMARK("Datum", "ToChars/Vector", ToCharsVector);
+BENCHMARK("Datum", "FromString/Vector", FromStringVector);
+BENCHMARK("Datum", "FromString/Int", FromStringInt);
+BENCHMARK("Datum", "PopBack/Int", PopBackInt);
+BENCHMARK("Datum", "Remove/Int", RemoveInt);
+BENCHMARK("Datum", "Copy/Int", CopyInt);
+BENCHMARK("Datum", "Copy/String", CopyString);
+BENCHMARK("Datum", "Copy/StringShared", CopyStringShared);
+BENCHMARK("Datum", "Move/Int", Move);
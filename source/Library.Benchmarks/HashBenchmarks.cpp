@@ -0,0 +1,215 @@
+#include "Benchmark.h"
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <set>
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include "DefaultHash.h"
+
+using namespace FieaGameEngine;
+using namespace FieaGameEngine::Benchmarks;
+
+namespace
+{
+	/// <summary>
+	/// The string hash DefaultHash used before it was replaced, kept so the two can be compared.
+	/// </summary>
+	std::size_t CharacterSum(const std::string& key)
+	{
+		std::size_t total{};
+		for (auto& character : key)
+		{
+			total += static_cast<std::size_t>(character);
+		}
+		return total;
+	}
+
+	std::size_t Default(const std::string& key)
+	{
+		return DefaultHash<std::string>{}(key);
+	}
+
+	std::size_t Standard(const std::string& key)
+	{
+		return std::hash<std::string>{}(key);
+	}
+
+	struct HashFunction final
+	{
+		const char* Name;
+		std::size_t(*Function)(const std::string&);
+	};
+
+	constexpr HashFunction HashFunctions[]{ { "CharacterSum", CharacterSum }, { "DefaultHash", Default }, { "std::hash", Standard } };
+
+	/// <summary>
+	/// Collects the attribute names used by the level files. Object keys are written as "Class Name" or just "Name", and only the name is hashed by a Scope.
+	/// </summary>
+	std::vector<std::string> ContentAttributeNames()
+	{
+		std::set<std::string> names;
+		std::error_code error;
+		for (const auto& entry : std::filesystem::directory_iterator{ CONTENT_DIRECTORY, error })
+		{
+			if (entry.path().extension() != ".json")
+			{
+				continue;
+			}
+
+			std::ifstream file{ entry.path() };
+			std::string text{ std::istreambuf_iterator<char>{ file }, std::istreambuf_iterator<char>{} };
+			std::size_t position{ 0 };
+			while ((position = text.find('"', position)) != std::string::npos)
+			{
+				std::size_t end{ text.find('"', position + 1) };
+				if (end == std::string::npos)
+				{
+					break;
+				}
+
+				std::size_t next{ text.find_first_not_of(" \t\r\n", end + 1) };
+				if (next != std::string::npos && text[next] == ':')
+				{
+					std::string key{ text.substr(position + 1, end - position - 1) };
+					std::size_t space{ key.rfind(' ') };
+					names.insert(space == std::string::npos ? key : key.substr(space + 1));
+				}
+				position = end + 1;
+			}
+		}
+		return std::vector<std::string>{ names.begin(), names.end() };
+	}
+
+	std::vector<std::string> SyntheticKeys(std::size_t count)
+	{
+		std::vector<std::string> keys;
+		keys.reserve(count);
+		for (std::size_t index{ 0 }; index < count; ++index)
+		{
+			keys.push_back("Attribute" + std::to_string(index));
+		}
+		return keys;
+	}
+
+	/// <summary>
+	/// Prints how many keys share a full hash value, and how the keys spread over a table with as many buckets as keys, for both
+	/// a prime bucket count (as used by the chained HashMap) and a power of two (as used by OpenHashMap before it mixes the hash).
+	/// The quality column is the expected probe cost relative to a perfectly random hash, so 1.00 is ideal.
+	/// </summary>
+	void PrintDistribution(const char* setName, const std::vector<std::string>& keys)
+	{
+		std::size_t primeBuckets{ keys.size() | 1 };
+		auto isPrime = [](std::size_t value)
+		{
+			for (std::size_t divisor{ 3 }; divisor * divisor <= value; divisor += 2)
+			{
+				if (value % divisor == 0)
+				{
+					return false;
+				}
+			}
+			return true;
+		};
+		while (!isPrime(primeBuckets))
+		{
+			primeBuckets += 2;
+		}
+		std::size_t powerBuckets{ 1 };
+		while (powerBuckets < keys.size())
+		{
+			powerBuckets <<= 1;
+		}
+
+		auto quality = [&keys](const std::vector<std::size_t>& buckets, std::size_t& longest)
+		{
+			double sum{ 0.0 };
+			longest = 0;
+			for (std::size_t count : buckets)
+			{
+				sum += static_cast<double>(count) * static_cast<double>(count + 1) / 2.0;
+				longest = std::max(longest, count);
+			}
+			double n{ static_cast<double>(keys.size()) };
+			double m{ static_cast<double>(buckets.size()) };
+			return sum / ((n / (2.0 * m)) * (n + 2.0 * m - 1.0));
+		};
+
+		std::printf("%s: %zu keys\n", setName, keys.size());
+		std::printf("  %-14s %12s %14s %10s %14s %10s\n", "Hash", "Collisions", "PrimeQuality", "PrimeMax", "Pow2Quality", "Pow2Max");
+		for (const HashFunction& hash : HashFunctions)
+		{
+			std::unordered_set<std::size_t> distinct;
+			std::vector<std::size_t> prime(primeBuckets);
+			std::vector<std::size_t> power(powerBuckets);
+			for (const std::string& key : keys)
+			{
+				std::size_t value{ hash.Function(key) };
+				distinct.insert(value);
+				++prime[value % primeBuckets];
+				++power[value & (powerBuckets - 1)];
+			}
+
+			std::size_t primeLongest, powerLongest;
+			double primeQuality{ quality(prime, primeLongest) };
+			double powerQuality{ quality(power, powerLongest) };
+			std::printf("  %-14s %12zu %14.2f %10zu %14.2f %10zu\n", hash.Name, keys.size() - distinct.size(), primeQuality, primeLongest, powerQuality, powerLongest);
+		}
+	}
+
+	void Distribution()
+	{
+		std::vector<std::string> content{ ContentAttributeNames() };
+		if (content.empty())
+		{
+			std::printf("No attribute names found under %s\n", CONTENT_DIRECTORY);
+		}
+		else
+		{
+			PrintDistribution("Content attribute names", content);
+		}
+		PrintDistribution("Synthetic", SyntheticKeys(1'000'000));
+	}
+
+	template <std::size_t(*Function)(const std::string&)>
+	std::size_t HashStrings(std::size_t size, Stopwatch& stopwatch)
+	{
+		std::vector<std::string> keys{ SyntheticKeys(size) };
+		std::size_t combined{ 0 };
+
+		stopwatch.Start();
+		for (const std::string& key : keys)
+		{
+			combined ^= Function(key);
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(combined);
+		return size;
+	}
+
+	std::size_t HashIntegers(std::size_t size, Stopwatch& stopwatch)
+	{
+		DefaultHash<int> hash;
+		std::size_t combined{ 0 };
+
+		stopwatch.Start();
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			combined ^= hash(static_cast<int>(index));
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(combined);
+		return size;
+	}
+}
+
+BENCHMARK("Hash", "String/CharacterSum", HashStrings<CharacterSum>);
+BENCHMARK("Hash", "String/DefaultHash", HashStrings<Default>);
+BENCHMARK("Hash", "String/std::hash", HashStrings<Standard>);
+BENCHMARK("Hash", "Integer/DefaultHash", HashIntegers);
+REPORT("Hash distribution", Distribution);
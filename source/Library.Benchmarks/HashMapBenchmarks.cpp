@@ -0,0 +1,235 @@
+#include "Benchmark.h"
+#include <string>
+#include <vector>
+#include "HashMap.h"
+#include "OpenHashMap.h"
+
+using namespace FieaGameEngine;
+using namespace FieaGameEngine::Benchmarks;
+
+namespace
+{
+	/// <summary>
+	/// Both engines are given the same well distributed hash so these numbers compare storage strategies rather than hash quality.
+	/// </summary>
+	struct StringHash final
+	{
+		std::size_t operator()(const std::string& key) const
+		{
+			return std::hash<std::string>{}(key);
+		}
+	};
+
+	std::vector<std::string> MakeKeys(std::size_t count, const char* prefix)
+	{
+		std::vector<std::string> keys;
+		keys.reserve(count);
+		for (std::size_t index{ 0 }; index < count; ++index)
+		{
+			keys.push_back(prefix + std::to_string(index));
+		}
+		return keys;
+	}
+
+	/// <summary>
+	/// The chained map grows by itself as pairs are inserted, so it is measured both that way and with its chains reserved up front.
+	/// </summary>
+	struct ChainedGrowing
+	{
+		using Map = HashMap<std::string, int>;
+		static Map Make(std::size_t) { return Map{ StringHash{} }; }
+	};
+
+	struct ChainedReserved
+	{
+		using Map = HashMap<std::string, int>;
+		static Map Make(std::size_t count)
+		{
+			Map map{ StringHash{} };
+			map.Reserve(count);
+			return map;
+		}
+	};
+
+	struct OpenAddressed
+	{
+		using Map = OpenHashMap<std::string, int>;
+		static Map Make(std::size_t) { return Map{ StringHash{} }; }
+	};
+
+	template <typename Engine>
+	std::size_t Insert(std::size_t size, Stopwatch& stopwatch)
+	{
+		std::vector<std::string> keys{ MakeKeys(size, "attribute") };
+		auto map{ Engine::Make(size) };
+
+		stopwatch.Start();
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			map.Insert(std::pair<const std::string, int>{ keys[index], static_cast<int>(index) });
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(map.Size());
+		return size;
+	}
+
+	template <typename Engine>
+	std::size_t FindHit(std::size_t size, Stopwatch& stopwatch)
+	{
+		std::vector<std::string> keys{ MakeKeys(size, "attribute") };
+		auto map{ Engine::Make(size) };
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			map.Insert(std::pair<const std::string, int>{ keys[index], static_cast<int>(index) });
+		}
+
+		std::size_t found{ 0 };
+		stopwatch.Start();
+		for (const std::string& key : keys)
+		{
+			found += map.Find(key) != map.end();
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(found);
+		return size;
+	}
+
+	template <typename Engine>
+	std::size_t FindMiss(std::size_t size, Stopwatch& stopwatch)
+	{
+		std::vector<std::string> keys{ MakeKeys(size, "attribute") };
+		std::vector<std::string> missing{ MakeKeys(size, "missing") };
+		auto map{ Engine::Make(size) };
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			map.Insert(std::pair<const std::string, int>{ keys[index], static_cast<int>(index) });
+		}
+
+		std::size_t found{ 0 };
+		stopwatch.Start();
+		for (const std::string& key : missing)
+		{
+			found += map.ContainsKey(key);
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(found);
+		return size;
+	}
+
+	template <typename Engine>
+	std::size_t Iterate(std::size_t size, Stopwatch& stopwatch)
+	{
+		std::vector<std::string> keys{ MakeKeys(size, "attribute") };
+		auto map{ Engine::Make(size) };
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			map.Insert(std::pair<const std::string, int>{ keys[index], static_cast<int>(index) });
+		}
+
+		long long sum{ 0 };
+		stopwatch.Start();
+		for (auto& pair : map)
+		{
+			sum += pair.second;
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(sum);
+		return size;
+	}
+
+	/// <summary>
+	/// Removes every key, in a different order from the one they were inserted in.
+	/// </summary>
+	template <typename Engine>
+	std::size_t Remove(std::size_t size, Stopwatch& stopwatch)
+	{
+		std::vector<std::string> keys{ MakeKeys(size, "attribute") };
+		auto map{ Engine::Make(size) };
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			map.Insert(std::pair<const std::string, int>{ keys[index], static_cast<int>(index) });
+		}
+
+		stopwatch.Start();
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			map.Remove(keys[ScatteredIndex(index, size)]);
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(map.Size());
+		return size;
+	}
+
+	/// <summary>
+	/// Copies a full map, which allocates and copies every key. Reported per pair.
+	/// </summary>
+	template <typename Engine>
+	std::size_t Copy(std::size_t size, Stopwatch& stopwatch)
+	{
+		std::vector<std::string> keys{ MakeKeys(size, "attribute") };
+		auto map{ Engine::Make(size) };
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			map.Insert(std::pair<const std::string, int>{ keys[index], static_cast<int>(index) });
+		}
+
+		stopwatch.Start();
+		typename Engine::Map copy{ map };
+		stopwatch.Stop();
+
+		DoNotOptimize(copy.Size());
+		return size;
+	}
+
+	/// <summary>
+	/// Moves a full map back and forth. A move only hands over the storage, so the time should not depend on the size.
+	/// </summary>
+	template <typename Engine>
+	std::size_t Move(std::size_t size, Stopwatch& stopwatch)
+	{
+		constexpr std::size_t moves{ 1'000 };
+		std::vector<std::string> keys{ MakeKeys(size, "attribute") };
+		auto map{ Engine::Make(size) };
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			map.Insert(std::pair<const std::string, int>{ keys[index], static_cast<int>(index) });
+		}
+
+		stopwatch.Start();
+		for (std::size_t move{ 0 }; move < moves; move += 2)
+		{
+			typename Engine::Map other{ std::move(map) };
+			DoNotOptimize(other);
+			map = std::move(other);
+			DoNotOptimize(map);
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(map.Size());
+		return moves;
+	}
+}
+
+BENCHMARK("HashMap", "Insert/ChainedGrowing", Insert<ChainedGrowing>);
+BENCHMARK("HashMap", "Insert/ChainedReserved", Insert<ChainedReserved>);
+BENCHMARK("HashMap", "Insert/OpenAddressed", Insert<OpenAddressed>);
+BENCHMARK("HashMap", "FindHit/ChainedGrowing", FindHit<ChainedGrowing>);
+BENCHMARK("HashMap", "FindHit/ChainedReserved", FindHit<ChainedReserved>);
+BENCHMARK("HashMap", "FindHit/OpenAddressed", FindHit<OpenAddressed>);
+BENCHMARK("HashMap", "FindMiss/ChainedGrowing", FindMiss<ChainedGrowing>);
+BENCHMARK("HashMap", "FindMiss/ChainedReserved", FindMiss<ChainedReserved>);
+BENCHMARK("HashMap", "FindMiss/OpenAddressed", FindMiss<OpenAddressed>);
+BENCHMARK("HashMap", "Iterate/ChainedGrowing", Iterate<ChainedGrowing>);
+BENCHMARK("HashMap", "Iterate/ChainedReserved", Iterate<ChainedReserved>);
+BENCHMARK("HashMap", "Iterate/OpenAddressed", Iterate<OpenAddressed>);
+BENCHMARK("HashMap", "Remove/ChainedGrowing", Remove<ChainedGrowing>);
+BENCHMARK("HashMap", "Remove/OpenAddressed", Remove<OpenAddressed>);
+BENCHMARK("HashMap", "Copy/ChainedGrowing", Copy<ChainedGrowing>);
+BENCHMARK("HashMap", "Copy/OpenAddressed", Copy<OpenAddressed>);
+BENCHMARK("HashMap", "Move/ChainedGrowing", Move<ChainedGrowing>);
+BENCHMARK("HashMap", "Move/OpenAddressed", Move<OpenAddressed>);
@@ -0,0 +1,221 @@
+#include "Benchmark.h"
+#include <span>
+#include <vector>
+#include "Datum.h"
+#include "SimdMath.h"
+
+using namespace FieaGameEngine;
+using namespace FieaGameEngine::Benchmarks;
+
+namespace
+{
+	using InstructionSet = SimdMath::InstructionSet;
+
+	/// <summary>
+	/// Datum's copy and move constructors are explicit, so it cannot be returned by value from a helper and is filled in place instead.
+	/// </summary>
+	void FillFloats(Datum& datum, std::size_t size, float seed)
+	{
+		std::vector<float> values(size);
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			values[index] = seed + static_cast<float>(index % 17) * 0.5f;
+		}
+
+		datum.Append(std::span<const float>{ values });
+	}
+
+	void FillVectors(Datum& datum, std::size_t size, float seed)
+	{
+		std::vector<glm::vec4> values(size);
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			values[index] = glm::vec4{ seed + static_cast<float>(index % 17) };
+		}
+
+		datum.Append(std::span<const glm::vec4>{ values });
+	}
+
+	/// <summary>
+	/// Runs the kernels with one instruction set, then puts back the one the processor would have picked. A set the processor lacks falls back to the best it has,
+	/// so on such a machine the faster rows repeat the slower ones.
+	/// </summary>
+	class ScopedInstructionSet final
+	{
+	public:
+		explicit ScopedInstructionSet(InstructionSet instructionSet) { SimdMath::SetInstructionSet(instructionSet); }
+		~ScopedInstructionSet() { SimdMath::SetInstructionSet(SimdMath::Supported()); }
+	};
+
+	/// <summary>
+	/// Adds two arrays one element at a time through the Datum accessors, the way the expression and reaction code touches arrays today.
+	/// </summary>
+	std::size_t AddDatum(std::size_t size, Stopwatch& stopwatch)
+	{
+		Datum lhs{ Datum::DatumTypes::Float };
+		FillFloats(lhs, size, 1.0f);
+		Datum rhs{ Datum::DatumTypes::Float };
+		FillFloats(rhs, size, 2.0f);
+		Datum result{ Datum::DatumTypes::Float };
+		FillFloats(result, size, 0.0f);
+
+		stopwatch.Start();
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			result.Set(lhs.GetAsFloat(index) + rhs.GetAsFloat(index), index);
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(result.AsSpan<float>().data());
+		return size;
+	}
+
+	template <InstructionSet Set>
+	std::size_t Add(std::size_t size, Stopwatch& stopwatch)
+	{
+		ScopedInstructionSet instructionSet{ Set };
+		Datum lhs{ Datum::DatumTypes::Float };
+		FillFloats(lhs, size, 1.0f);
+		Datum rhs{ Datum::DatumTypes::Float };
+		FillFloats(rhs, size, 2.0f);
+		Datum result{ Datum::DatumTypes::Float };
+		FillFloats(result, size, 0.0f);
+
+		stopwatch.Start();
+		SimdMath::Add(lhs.AsSpan<float>(), rhs.AsSpan<float>(), result.AsSpan<float>());
+		stopwatch.Stop();
+
+		DoNotOptimize(result.AsSpan<float>().data());
+		return size;
+	}
+
+	std::size_t LerpDatum(std::size_t size, Stopwatch& stopwatch)
+	{
+		Datum from{ Datum::DatumTypes::Vector };
+		FillVectors(from, size, 1.0f);
+		Datum to{ Datum::DatumTypes::Vector };
+		FillVectors(to, size, 5.0f);
+		Datum result{ Datum::DatumTypes::Vector };
+		FillVectors(result, size, 0.0f);
+
+		stopwatch.Start();
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			const glm::vec4& start{ from.GetAsVector(index) };
+			result.Set(start + (to.GetAsVector(index) - start) * 0.25f, index);
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(result.AsSpan<glm::vec4>().data());
+		return size;
+	}
+
+	template <InstructionSet Set>
+	std::size_t Lerp(std::size_t size, Stopwatch& stopwatch)
+	{
+		ScopedInstructionSet instructionSet{ Set };
+		Datum from{ Datum::DatumTypes::Vector };
+		FillVectors(from, size, 1.0f);
+		Datum to{ Datum::DatumTypes::Vector };
+		FillVectors(to, size, 5.0f);
+		Datum result{ Datum::DatumTypes::Vector };
+		FillVectors(result, size, 0.0f);
+
+		stopwatch.Start();
+		SimdMath::Lerp(from.AsSpan<glm::vec4>(), to.AsSpan<glm::vec4>(), 0.25f, result.AsSpan<glm::vec4>());
+		stopwatch.Stop();
+
+		DoNotOptimize(result.AsSpan<glm::vec4>().data());
+		return size;
+	}
+
+	std::size_t DotDatum(std::size_t size, Stopwatch& stopwatch)
+	{
+		Datum lhs{ Datum::DatumTypes::Float };
+		FillFloats(lhs, size, 1.0f);
+		Datum rhs{ Datum::DatumTypes::Float };
+		FillFloats(rhs, size, 2.0f);
+
+		float sum{ 0.0f };
+		stopwatch.Start();
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			sum += lhs.GetAsFloat(index) * rhs.GetAsFloat(index);
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(sum);
+		return size;
+	}
+
+	template <InstructionSet Set>
+	std::size_t Dot(std::size_t size, Stopwatch& stopwatch)
+	{
+		ScopedInstructionSet instructionSet{ Set };
+		Datum lhs{ Datum::DatumTypes::Float };
+		FillFloats(lhs, size, 1.0f);
+		Datum rhs{ Datum::DatumTypes::Float };
+		FillFloats(rhs, size, 2.0f);
+
+		stopwatch.Start();
+		const float sum{ SimdMath::Dot(lhs.AsSpan<float>(), rhs.AsSpan<float>()) };
+		stopwatch.Stop();
+
+		DoNotOptimize(sum);
+		return size;
+	}
+
+	std::size_t TransformDatum(std::size_t size, Stopwatch& stopwatch)
+	{
+		const glm::mat4 matrix{ 1.0f, 2.0f, 3.0f, 0.0f, 0.5f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 2.0f, 0.0f, 4.0f, 5.0f, 6.0f, 1.0f };
+		Datum values{ Datum::DatumTypes::Vector };
+		FillVectors(values, size, 1.0f);
+		Datum result{ Datum::DatumTypes::Vector };
+		FillVectors(result, size, 0.0f);
+
+		stopwatch.Start();
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			result.Set(matrix * values.GetAsVector(index), index);
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(result.AsSpan<glm::vec4>().data());
+		return size;
+	}
+
+	template <InstructionSet Set>
+	std::size_t Transform(std::size_t size, Stopwatch& stopwatch)
+	{
+		ScopedInstructionSet instructionSet{ Set };
+		const glm::mat4 matrix{ 1.0f, 2.0f, 3.0f, 0.0f, 0.5f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 2.0f, 0.0f, 4.0f, 5.0f, 6.0f, 1.0f };
+		Datum values{ Datum::DatumTypes::Vector };
+		FillVectors(values, size, 1.0f);
+		Datum result{ Datum::DatumTypes::Vector };
+		FillVectors(result, size, 0.0f);
+
+		stopwatch.Start();
+		SimdMath::Transform(matrix, values.AsSpan<glm::vec4>(), result.AsSpan<glm::vec4>());
+		stopwatch.Stop();
+
+		DoNotOptimize(result.AsSpan<glm::vec4>().data());
+		return size;
+	}
+}
+
+BENCHMARK("Kernels", "Add/Datum", AddDatum);
+BENCHMARK("Kernels", "Add/Scalar", Add<InstructionSet::Scalar>);
+BENCHMARK("Kernels", "Add/SSE", Add<InstructionSet::SSE>);
+BENCHMARK("Kernels", "Add/AVX2", Add<InstructionSet::AVX2>);
+BENCHMARK("Kernels", "Lerp/Datum", LerpDatum);
+BENCHMARK("Kernels", "Lerp/Scalar", Lerp<InstructionSet::Scalar>);
+BENCHMARK("Kernels", "Lerp/SSE", Lerp<InstructionSet::SSE>);
+BENCHMARK("Kernels", "Lerp/AVX2", Lerp<InstructionSet::AVX2>);
+BENCHMARK("Kernels", "Dot/Datum", DotDatum);
+BENCHMARK("Kernels", "Dot/Scalar", Dot<InstructionSet::Scalar>);
+BENCHMARK("Kernels", "Dot/SSE", Dot<InstructionSet::SSE>);
+BENCHMARK("Kernels", "Dot/AVX2", Dot<InstructionSet::AVX2>);
+BENCHMARK("Kernels", "Transform/Datum", TransformDatum);
+BENCHMARK("Kernels", "Transform/Scalar", Transform<InstructionSet::Scalar>);
+BENCHMARK("Kernels", "Transform/SSE", Transform<InstructionSet::SSE>);
+BENCHMARK("Kernels", "Transform/AVX2", Transform<InstructionSet::AVX2>);
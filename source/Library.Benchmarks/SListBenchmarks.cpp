@@ -0,0 +1,210 @@
+#include "Benchmark.h"
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include "SList.h"
+
+using namespace FieaGameEngine;
+using namespace FieaGameEngine::Benchmarks;
+
+namespace
+{
+	/// <summary>
+	/// The list with its default allocator, which keeps removed nodes for reuse, and the same list allocating every node from the heap.
+	/// </summary>
+	using Pooled = SList<int>;
+	using Heap = SList<int, std::allocator<int>>;
+
+	/// <summary>
+	/// SList's copy and move constructors are explicit, so it cannot be returned by value from a helper and is filled in place instead.
+	/// </summary>
+	template <typename List>
+	void Fill(List& list, std::size_t size)
+	{
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			list.PushBack(static_cast<int>(index));
+		}
+	}
+
+	template <typename List>
+	std::size_t PushBack(std::size_t size, Stopwatch& stopwatch)
+	{
+		List list{};
+		stopwatch.Start();
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			list.PushBack(static_cast<int>(index));
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(list.Size());
+		return size;
+	}
+
+	template <typename List>
+	std::size_t PushFront(std::size_t size, Stopwatch& stopwatch)
+	{
+		List list{};
+		stopwatch.Start();
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			list.PushFront(static_cast<int>(index));
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(list.Size());
+		return size;
+	}
+
+	/// <summary>
+	/// Empties a full list from the front and fills it again, the way a queue of pending work is used every frame.
+	/// Only the first fill allocates when nodes are pooled.
+	/// </summary>
+	template <typename List>
+	std::size_t Refill(std::size_t size, Stopwatch& stopwatch)
+	{
+		List list{};
+		Fill(list, size);
+		stopwatch.Start();
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			list.PopFront();
+		}
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			list.PushBack(static_cast<int>(index));
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(list.Size());
+		return size * 2;
+	}
+
+	template <typename List>
+	std::size_t PopFront(std::size_t size, Stopwatch& stopwatch)
+	{
+		List list{};
+		Fill(list, size);
+		stopwatch.Start();
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			list.PopFront();
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(list.Size());
+		return size;
+	}
+
+	template <typename List>
+	std::size_t Iterate(std::size_t size, Stopwatch& stopwatch)
+	{
+		List list{};
+		Fill(list, size);
+
+		long long sum{ 0 };
+		stopwatch.Start();
+		for (int value : list)
+		{
+			sum += value;
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(sum);
+		return size;
+	}
+
+	/// <summary>
+	/// Searches for values spread evenly through the list, so on average each search follows half of its links.
+	/// </summary>
+	template <typename List>
+	std::size_t Find(std::size_t size, Stopwatch& stopwatch)
+	{
+		List list{};
+		Fill(list, size);
+		const std::size_t searches{ std::min(size, MaximumSearches) };
+
+		std::size_t found{ 0 };
+		stopwatch.Start();
+		for (std::size_t search{ 0 }; search < searches; ++search)
+		{
+			found += list.Find(static_cast<int>(ScatteredIndex(search, size))) != list.end();
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(found);
+		return searches;
+	}
+
+	template <typename List>
+	std::size_t Remove(std::size_t size, Stopwatch& stopwatch)
+	{
+		List list{};
+		Fill(list, size);
+		const std::size_t removals{ std::min(size, MaximumSearches) };
+
+		stopwatch.Start();
+		for (std::size_t removal{ 0 }; removal < removals; ++removal)
+		{
+			list.Remove(static_cast<int>(ScatteredIndex(removal, size)));
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(list.Size());
+		return removals;
+	}
+
+	template <typename List>
+	std::size_t Copy(std::size_t size, Stopwatch& stopwatch)
+	{
+		List list{};
+		Fill(list, size);
+
+		stopwatch.Start();
+		List copy{ list };
+		stopwatch.Stop();
+
+		DoNotOptimize(copy.Size());
+		return size;
+	}
+
+	/// <summary>
+	/// Moves a full list back and forth. A move only hands over the links, so the time should not depend on the size.
+	/// </summary>
+	template <typename List>
+	std::size_t Move(std::size_t size, Stopwatch& stopwatch)
+	{
+		constexpr std::size_t moves{ 1'000 };
+		List list{};
+		Fill(list, size);
+
+		stopwatch.Start();
+		for (std::size_t move{ 0 }; move < moves; move += 2)
+		{
+			List other{ std::move(list) };
+			DoNotOptimize(other);
+			list = std::move(other);
+			DoNotOptimize(list);
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(list.Size());
+		return moves;
+	}
+}
+
+BENCHMARK("SList", "PushBack/Pooled", PushBack<Pooled>);
+BENCHMARK("SList", "PushBack/Heap", PushBack<Heap>);
+BENCHMARK("SList", "PushFront/Pooled", PushFront<Pooled>);
+BENCHMARK("SList", "PushFront/Heap", PushFront<Heap>);
+BENCHMARK("SList", "Refill/Pooled", Refill<Pooled>);
+BENCHMARK("SList", "Refill/Heap", Refill<Heap>);
+BENCHMARK("SList", "PopFront/Pooled", PopFront<Pooled>);
+BENCHMARK("SList", "PopFront/Heap", PopFront<Heap>);
+BENCHMARK("SList", "Iterate/Pooled", Iterate<Pooled>);
+BENCHMARK("SList", "Find/Pooled", Find<Pooled>);
+BENCHMARK("SList", "Remove/Pooled", Remove<Pooled>);
+BENCHMARK("SList", "Copy/Pooled", Copy<Pooled>);
+BENCHMARK("SList", "Copy/Heap", Copy<Heap>);
+BENCHMARK("SList", "Move/Pooled", Move<Pooled>);
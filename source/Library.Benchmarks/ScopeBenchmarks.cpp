@@ -0,0 +1,348 @@
+#include "Benchmark.h"
+#include <memory_resource>
+#include "Scope.h"
+
+using namespace FieaGameEngine;
+using namespace FieaGameEngine::Benchmarks;
+
+namespace
+{
+	/// <summary>
+	/// Every simulated entity is a few hundred bytes of scopes, tables and Datums, so past this many of them a level no longer fits in the memory of a typical build machine.
+	/// </summary>
+	constexpr std::size_t MaximumEntities{ 1'000'000 };
+
+	/// <summary>
+	/// Fills a level with one nested scope per entity, each holding a handful of attributes and a path long enough to spill out of the Datum onto the heap.
+	/// </summary>
+	void BuildLevel(Scope& root, std::size_t size)
+	{
+		Scope& level{ root.AppendScope("Level") };
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			Scope& entity{ level.AppendScope("Entities") };
+			entity["Health"] = static_cast<int>(index);
+			entity["Position"] = glm::vec4{ static_cast<float>(index) };
+			Datum& path{ entity.Append("Path", Datum::DatumTypes::Float) };
+			for (int point{ 0 }; point < 8; ++point)
+			{
+				path.PushBack(static_cast<float>(point));
+			}
+		}
+	}
+
+	/// <summary>
+	/// Loads a level and throws it away again, each piece coming from and going back to the global heap.
+	/// </summary>
+	std::size_t LevelHeap(std::size_t size, Stopwatch& stopwatch)
+	{
+		if (size > MaximumEntities)
+		{
+			return 0;
+		}
+
+		stopwatch.Start();
+		{
+			Scope root{};
+			BuildLevel(root, size);
+			DoNotOptimize(root.Size());
+		}
+		stopwatch.Stop();
+		return size;
+	}
+
+	/// <summary>
+	/// Loads the same level into an arena, then frees it all at once when the arena is released.
+	/// </summary>
+	std::size_t LevelArena(std::size_t size, Stopwatch& stopwatch)
+	{
+		if (size > MaximumEntities)
+		{
+			return 0;
+		}
+
+		std::pmr::monotonic_buffer_resource arena;
+		stopwatch.Start();
+		{
+			Scope root{ &arena };
+			BuildLevel(root, size);
+			DoNotOptimize(root.Size());
+		}
+		arena.release();
+		stopwatch.Stop();
+		return size;
+	}
+
+	/// <summary>
+	/// How far an action sits below the scope holding the variable it reads, about as deep as a game object hierarchy gets.
+	/// </summary>
+	constexpr std::size_t SearchDepth{ 16 };
+
+	/// <summary>
+	/// Builds a chain of nested scopes, each with a few attributes of its own, with the searched for variable at the root. Returns the deepest scope.
+	/// </summary>
+	Scope& BuildChain(Scope& root)
+	{
+		root["Health"] = 100;
+		Scope* scope{ &root };
+		for (std::size_t depth{ 0 }; depth < SearchDepth; ++depth)
+		{
+			scope = &scope->AppendScope("Child");
+			(*scope)["Name"] = std::string{ "Node" };
+			(*scope)["Position"] = glm::vec4{ 0.0f };
+		}
+		return *scope;
+	}
+
+	/// <summary>
+	/// Resolves a variable from the bottom of the chain with a fresh lookup at every level, as expressions did every time they read one.
+	/// </summary>
+	std::size_t SearchSymbol(std::size_t size, Stopwatch& stopwatch)
+	{
+		Scope root{};
+		Scope& leaf{ BuildChain(root) };
+		const Symbol name{ "Health" };
+
+		stopwatch.Start();
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			DoNotOptimize(leaf.Search(name));
+		}
+		stopwatch.Stop();
+		return size;
+	}
+
+	/// <summary>
+	/// Resolves the same variable through a Binding, which only walks the chain again when a scope on it changes.
+	/// </summary>
+	std::size_t SearchBinding(std::size_t size, Stopwatch& stopwatch)
+	{
+		Scope root{};
+		Scope& leaf{ BuildChain(root) };
+		Scope::Binding binding{ Symbol{ "Health" } };
+
+		stopwatch.Start();
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			DoNotOptimize(leaf.Search(binding));
+		}
+		stopwatch.Stop();
+		return size;
+	}
+
+	/// <summary>
+	/// Destroys the children of one scope oldest first, each leaving its parent on the way out, as when entities spawned in order are despawned in the same order.
+	/// </summary>
+	std::size_t DestroyChildren(std::size_t size, Stopwatch& stopwatch)
+	{
+		if (size > MaximumEntities)
+		{
+			return 0;
+		}
+
+		Scope root{};
+		Vector<Scope*> children{};
+		children.Reserve(size);
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			children.PushBack(&root.AppendScope("Children"));
+		}
+
+		stopwatch.Start();
+		for (Scope* child : children)
+		{
+			delete child;
+		}
+		stopwatch.Stop();
+		DoNotOptimize(root.Find("Children")->Size());
+		return size;
+	}
+
+	/// <summary>
+	/// Builds one scope with the given number of integer attributes, named so that none of them share a Symbol.
+	/// </summary>
+	void BuildAttributes(Scope& scope, std::size_t size)
+	{
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			scope.Append("Attribute" + std::to_string(index)) = static_cast<int>(index);
+		}
+	}
+
+	/// <summary>
+	/// Appends attributes to a scope that has none yet, interning their names beforehand.
+	/// </summary>
+	std::size_t AppendAttributes(std::size_t size, Stopwatch& stopwatch)
+	{
+		if (size > MaximumEntities)
+		{
+			return 0;
+		}
+
+		Vector<Symbol> names{};
+		names.Reserve(size);
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			names.PushBack(Symbol{ "Attribute" + std::to_string(index) });
+		}
+
+		stopwatch.Start();
+		{
+			Scope scope{};
+			for (const Symbol& name : names)
+			{
+				scope.Append(name, Datum::DatumTypes::Integer);
+			}
+			DoNotOptimize(scope.Size());
+		}
+		stopwatch.Stop();
+		return size;
+	}
+
+	/// <summary>
+	/// Visits every attribute of a scope in the order they were added, as Attributed and the equality operator do.
+	/// </summary>
+	std::size_t IterateAttributes(std::size_t size, Stopwatch& stopwatch)
+	{
+		if (size > MaximumEntities)
+		{
+			return 0;
+		}
+
+		Scope scope{};
+		BuildAttributes(scope, size);
+
+		stopwatch.Start();
+		int sum{ 0 };
+		for (std::size_t index{ 0 }; index < scope.Size(); ++index)
+		{
+			sum += scope[index].GetAsInt();
+		}
+		DoNotOptimize(sum);
+		stopwatch.Stop();
+		return size;
+	}
+
+	/// <summary>
+	/// Compares two equal scopes, which walks both in order.
+	/// </summary>
+	std::size_t CompareAttributes(std::size_t size, Stopwatch& stopwatch)
+	{
+		if (size > MaximumEntities)
+		{
+			return 0;
+		}
+
+		Scope scope{};
+		BuildAttributes(scope, size);
+		Scope copy{ scope };
+
+		stopwatch.Start();
+		DoNotOptimize(scope == copy);
+		stopwatch.Stop();
+		return size;
+	}
+
+	/// <summary>
+	/// Builds a scope shaped like a prefab game object: a few attributes of its own and a handful of nested actions with attributes of theirs.
+	/// </summary>
+	void BuildPrefab(Scope& prefab)
+	{
+		prefab["Name"] = std::string{ "Monster" };
+		prefab["Health"] = 100;
+		prefab["Position"] = glm::vec4{ 0.0f };
+		prefab["Velocity"] = glm::vec4{ 1.0f };
+		prefab["Transform"] = glm::mat4{ 1.0f };
+		for (int index{ 0 }; index < 4; ++index)
+		{
+			Scope& action{ prefab.AppendScope("Actions") };
+			action["Name"] = std::string{ "Action" } + std::to_string(index);
+			action["Target"] = std::string{ "Health" };
+			action["Step"] = index;
+		}
+	}
+
+	/// <summary>
+	/// Spawns copies of one prefab and destroys them again, as a level load does for every placed instance.
+	/// A copy-on-write prefab, as Prefab keeps its template, shares the storage of its strings and matrices with every instance instead of copying it.
+	/// </summary>
+	std::size_t ClonePrefab(std::size_t size, Stopwatch& stopwatch, bool copyOnWrite)
+	{
+		if (size > MaximumEntities)
+		{
+			return 0;
+		}
+
+		Scope prefab{};
+		BuildPrefab(prefab);
+		prefab.SetCopyOnWrite(copyOnWrite);
+		Vector<Scope*> instances{};
+		instances.Reserve(size);
+
+		stopwatch.Start();
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			instances.PushBack(prefab.Clone());
+		}
+		for (Scope* instance : instances)
+		{
+			delete instance;
+		}
+		stopwatch.Stop();
+		return size;
+	}
+
+	std::size_t ClonePrefabCopied(std::size_t size, Stopwatch& stopwatch)
+	{
+		return ClonePrefab(size, stopwatch, false);
+	}
+
+	std::size_t ClonePrefabShared(std::size_t size, Stopwatch& stopwatch)
+	{
+		return ClonePrefab(size, stopwatch, true);
+	}
+
+	/// <summary>
+	/// Spawns instances of one prefab the way Prefab does, each holding only its own clones of the prefab's actions and reading every other attribute from it.
+	/// </summary>
+	std::size_t InstancePrefab(std::size_t size, Stopwatch& stopwatch)
+	{
+		if (size > MaximumEntities)
+		{
+			return 0;
+		}
+
+		Scope prefab{};
+		BuildPrefab(prefab);
+		prefab.SetCopyOnWrite(true);
+		Vector<Scope*> instances{};
+		instances.Reserve(size);
+
+		stopwatch.Start();
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			Scope* instance{ new Scope{} };
+			instance->Append("Actions", Datum::DatumTypes::Table);
+			instance->SetPrototype(prefab);
+			instances.PushBack(instance);
+		}
+		for (Scope* instance : instances)
+		{
+			delete instance;
+		}
+		stopwatch.Stop();
+		return size;
+	}
+}
+
+BENCHMARK("Scope", "Level/Heap", LevelHeap);
+BENCHMARK("Scope", "Level/Arena", LevelArena);
+BENCHMARK("Scope", "Search/Symbol", SearchSymbol);
+BENCHMARK("Scope", "Search/Binding", SearchBinding);
+BENCHMARK("Scope", "Destroy/Children", DestroyChildren);
+BENCHMARK("Scope", "Append/Symbol", AppendAttributes);
+BENCHMARK("Scope", "Iterate/Index", IterateAttributes);
+BENCHMARK("Scope", "Equality", CompareAttributes);
+BENCHMARK("Scope", "Clone/Prefab", ClonePrefabCopied);
+BENCHMARK("Scope", "Clone/Shared", ClonePrefabShared);
+BENCHMARK("Scope", "Clone/Instance", InstancePrefab);
@@ -0,0 +1,164 @@
+#include "Benchmark.h"
+#include <stack>
+#include <utility>
+#include <vector>
+#include "SList.h"
+#include "Stack.h"
+
+using namespace FieaGameEngine;
+using namespace FieaGameEngine::Benchmarks;
+
+namespace
+{
+	struct Fiea
+	{
+		using Container = Stack<int>;
+		static void Push(Container& container, int value) { container.Push(value); }
+		static void Pop(Container& container) { container.Pop(); }
+		static int Top(Container& container) { return container.Top(); }
+		static std::size_t Size(const Container& container) { return container.Size(); }
+	};
+
+	/// <summary>
+	/// A stack on a linked list, the way Stack was built before it moved to an array, with nodes from the heap.
+	/// </summary>
+	struct Linked
+	{
+		using Container = SList<int, std::allocator<int>>;
+		static void Push(Container& container, int value) { container.PushFront(value); }
+		static void Pop(Container& container) { container.PopFront(); }
+		static int Top(Container& container) { return container.Front(); }
+		static std::size_t Size(const Container& container) { return container.Size(); }
+	};
+
+	struct Standard
+	{
+		using Container = std::stack<int, std::vector<int>>;
+		static void Push(Container& container, int value) { container.push(value); }
+		static void Pop(Container& container) { container.pop(); }
+		static int Top(Container& container) { return container.top(); }
+		static std::size_t Size(const Container& container) { return container.size(); }
+	};
+
+	/// <summary>
+	/// SList's copy and move constructors are explicit, so containers are filled in place rather than returned from a helper.
+	/// </summary>
+	template <typename Engine>
+	void Fill(typename Engine::Container& container, std::size_t size)
+	{
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			Engine::Push(container, static_cast<int>(index));
+		}
+	}
+
+	template <typename Engine>
+	std::size_t Push(std::size_t size, Stopwatch& stopwatch)
+	{
+		typename Engine::Container container{};
+		stopwatch.Start();
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			Engine::Push(container, static_cast<int>(index));
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(Engine::Size(container));
+		return size;
+	}
+
+	/// <summary>
+	/// Reads and pops every item, the way the expression evaluator and the event queue drain their stacks.
+	/// </summary>
+	template <typename Engine>
+	std::size_t Drain(std::size_t size, Stopwatch& stopwatch)
+	{
+		typename Engine::Container container{};
+		Fill<Engine>(container, size);
+
+		long long sum{ 0 };
+		stopwatch.Start();
+		while (Engine::Size(container) > 0)
+		{
+			sum += Engine::Top(container);
+			Engine::Pop(container);
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(sum);
+		return size;
+	}
+
+	/// <summary>
+	/// Drains a stack and fills it again to the same depth, as happens once a frame. An array keeps its capacity, so only the first fill allocates.
+	/// </summary>
+	template <typename Engine>
+	std::size_t Refill(std::size_t size, Stopwatch& stopwatch)
+	{
+		typename Engine::Container container{};
+		Fill<Engine>(container, size);
+
+		stopwatch.Start();
+		while (Engine::Size(container) > 0)
+		{
+			Engine::Pop(container);
+		}
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			Engine::Push(container, static_cast<int>(index));
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(Engine::Size(container));
+		return size * 2;
+	}
+
+	template <typename Engine>
+	std::size_t Copy(std::size_t size, Stopwatch& stopwatch)
+	{
+		typename Engine::Container container{};
+		Fill<Engine>(container, size);
+
+		stopwatch.Start();
+		typename Engine::Container copy{ container };
+		stopwatch.Stop();
+
+		DoNotOptimize(Engine::Size(copy));
+		return size;
+	}
+
+	template <typename Engine>
+	std::size_t Move(std::size_t size, Stopwatch& stopwatch)
+	{
+		constexpr std::size_t moves{ 1'000 };
+		typename Engine::Container container{};
+		Fill<Engine>(container, size);
+
+		stopwatch.Start();
+		for (std::size_t move{ 0 }; move < moves; move += 2)
+		{
+			typename Engine::Container other{ std::move(container) };
+			DoNotOptimize(other);
+			container = std::move(other);
+			DoNotOptimize(container);
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(Engine::Size(container));
+		return moves;
+	}
+}
+
+BENCHMARK("Stack", "Push/Fiea", Push<Fiea>);
+BENCHMARK("Stack", "Push/Linked", Push<Linked>);
+BENCHMARK("Stack", "Push/std::stack", Push<Standard>);
+BENCHMARK("Stack", "Drain/Fiea", Drain<Fiea>);
+BENCHMARK("Stack", "Drain/Linked", Drain<Linked>);
+BENCHMARK("Stack", "Drain/std::stack", Drain<Standard>);
+BENCHMARK("Stack", "Refill/Fiea", Refill<Fiea>);
+BENCHMARK("Stack", "Refill/Linked", Refill<Linked>);
+BENCHMARK("Stack", "Refill/std::stack", Refill<Standard>);
+BENCHMARK("Stack", "Copy/Fiea", Copy<Fiea>);
+BENCHMARK("Stack", "Copy/std::stack", Copy<Standard>);
+BENCHMARK("Stack", "Move/Fiea", Move<Fiea>);
+BENCHMARK("Stack", "Move/std::stack", Move<Standard>);
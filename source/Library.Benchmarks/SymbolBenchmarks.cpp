@@ -0,0 +1,159 @@
+#include "Benchmark.h"
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "OpenHashMap.h"
+#include "Symbol.h"
+
+using namespace FieaGameEngine;
+using namespace FieaGameEngine::Benchmarks;
+
+namespace
+{
+	/// <summary>
+	/// The attribute names every GameObject in a level repeats, plus a few longer ones that do not fit in a small string buffer.
+	/// </summary>
+	constexpr const char* AttributeNames[]{ "this", "Name", "Position", "Rotation", "Scale", "Children", "Actions", "CurrentHealthPointsRemaining", "MovementSpeedMultiplier" };
+
+	/// <summary>
+	/// Every simulated GameObject owns a table of its own, so past this many of them the tables no longer fit in the memory of a typical build machine.
+	/// </summary>
+	constexpr std::size_t MaximumObjects{ 1'000'000 };
+
+	/// <summary>
+	/// Each benchmark builds one table per simulated GameObject, then looks every attribute up in every table, the way an expression or reaction resolves names.
+	/// </summary>
+	std::size_t StringKeys(std::size_t size, Stopwatch& stopwatch)
+	{
+		if (size > MaximumObjects)
+		{
+			return 0;
+		}
+
+		std::vector<OpenHashMap<std::string, int>> objects(size);
+		for (auto& object : objects)
+		{
+			for (const char* name : AttributeNames)
+			{
+				object.Insert(std::pair<const std::string, int>{ name, 1 });
+			}
+		}
+		std::vector<std::string> names{ std::begin(AttributeNames), std::end(AttributeNames) };
+
+		std::size_t found{ 0 };
+		stopwatch.Start();
+		for (auto& object : objects)
+		{
+			for (const std::string& name : names)
+			{
+				found += object.At(name);
+			}
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(found);
+		return size * std::size(AttributeNames);
+	}
+
+	std::size_t SymbolKeys(std::size_t size, Stopwatch& stopwatch)
+	{
+		if (size > MaximumObjects)
+		{
+			return 0;
+		}
+
+		std::vector<OpenHashMap<Symbol, int>> objects(size);
+		for (auto& object : objects)
+		{
+			for (const char* name : AttributeNames)
+			{
+				object.Insert(std::pair<const Symbol, int>{ Symbol{ name }, 1 });
+			}
+		}
+		std::vector<Symbol> names;
+		for (const char* name : AttributeNames)
+		{
+			names.emplace_back(name);
+		}
+
+		std::size_t found{ 0 };
+		stopwatch.Start();
+		for (auto& object : objects)
+		{
+			for (const Symbol& name : names)
+			{
+				found += object.At(name);
+			}
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(found);
+		return size * std::size(AttributeNames);
+	}
+
+	/// <summary>
+	/// Looks names up by view in Symbol keyed tables, which hashes the characters but never interns or allocates.
+	/// </summary>
+	std::size_t SymbolKeysByName(std::size_t size, Stopwatch& stopwatch)
+	{
+		if (size > MaximumObjects)
+		{
+			return 0;
+		}
+
+		std::vector<OpenHashMap<Symbol, int>> objects(size);
+		for (auto& object : objects)
+		{
+			for (const char* name : AttributeNames)
+			{
+				object.Insert(std::pair<const Symbol, int>{ Symbol{ name }, 1 });
+			}
+		}
+		std::vector<std::string_view> names{ std::begin(AttributeNames), std::end(AttributeNames) };
+
+		std::size_t found{ 0 };
+		stopwatch.Start();
+		for (auto& object : objects)
+		{
+			for (std::string_view name : names)
+			{
+				found += object.At(name);
+			}
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(found);
+		return size * std::size(AttributeNames);
+	}
+
+	/// <summary>
+	/// Prints what the keys of one table cost. A std::string key is stored per table, and allocates when the name is longer than its small buffer,
+	/// while a Symbol key is a single pointer into the shared table.
+	/// </summary>
+	void KeyMemory()
+	{
+		std::size_t stringBytes{ 0 };
+		std::size_t internedBytes{ 0 };
+		for (const char* name : AttributeNames)
+		{
+			std::string key{ name };
+			stringBytes += sizeof(std::string) + (key.capacity() > std::string{}.capacity() ? key.capacity() + 1 : 0);
+			internedBytes += sizeof(Symbol::PairType) + key.capacity() + 1;
+		}
+		std::size_t symbolBytes{ sizeof(Symbol) * std::size(AttributeNames) };
+
+		std::printf("Keys for %zu attributes\n", std::size(AttributeNames));
+		std::printf("  %-28s %10zu bytes per table\n", "std::string", stringBytes);
+		std::printf("  %-28s %10zu bytes per table\n", "Symbol", symbolBytes);
+		std::printf("  %-28s %10zu bytes once\n", "Symbol table entries", internedBytes);
+		for (std::size_t tables : { std::size_t{ 1'000 }, std::size_t{ 100'000 } })
+		{
+			std::printf("  %7zu tables: %12zu bytes as std::string, %12zu bytes as Symbol\n", tables, stringBytes * tables, symbolBytes * tables + internedBytes);
+		}
+	}
+}
+
+BENCHMARK("Symbol", "Lookup/StringKeys", StringKeys);
+BENCHMARK("Symbol", "Lookup/SymbolKeys", SymbolKeys);
+BENCHMARK("Symbol", "Lookup/SymbolKeysByName", SymbolKeysByName);
+REPORT("Symbol key memory", KeyMemory);
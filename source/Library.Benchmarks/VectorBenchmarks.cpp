@@ -0,0 +1,368 @@
+#include "Benchmark.h"
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Vector.h"
+
+using namespace FieaGameEngine;
+using namespace FieaGameEngine::Benchmarks;
+
+namespace
+{
+	/// <summary>
+	/// The growth policy Vector used before it grew geometrically, kept here so the two can be compared.
+	/// </summary>
+	template <typename T>
+	struct LinearIncrement final
+	{
+		std::size_t operator()(std::size_t capacity, std::size_t) const
+		{
+			return capacity + 5;
+		}
+	};
+
+	/// <summary>
+	/// A small value the size of a position or color, which is what most engine code pushes into a vector.
+	/// </summary>
+	struct Element final
+	{
+		float X{ 0.0f };
+		float Y{ 0.0f };
+		float Z{ 0.0f };
+		float W{ 0.0f };
+	};
+
+	template <typename T>
+	struct FieaGeometric
+	{
+		using Container = Vector<T>;
+		static void Push(Container& container, const T& value) { container.PushBack(value); }
+		template <typename... Args>
+		static void Emplace(Container& container, Args&&... args) { container.EmplaceBack(std::forward<Args>(args)...); }
+		static std::size_t Size(const Container& container) { return container.Size(); }
+		static bool Contains(Container& container, const T& value) { return container.Find(value) != container.end(); }
+		static const T& At(Container& container, std::size_t index) { return container[index]; }
+		static void PopBack(Container& container) { container.PopBack(); }
+	};
+
+	template <typename T>
+	struct FieaLinear
+	{
+		using Container = Vector<T, LinearIncrement<T>>;
+		static void Push(Container& container, const T& value) { container.PushBack(value); }
+		template <typename... Args>
+		static void Emplace(Container& container, Args&&... args) { container.EmplaceBack(std::forward<Args>(args)...); }
+		static std::size_t Size(const Container& container) { return container.Size(); }
+		static bool Contains(Container& container, const T& value) { return container.Find(value) != container.end(); }
+		static const T& At(Container& container, std::size_t index) { return container[index]; }
+		static void PopBack(Container& container) { container.PopBack(); }
+	};
+
+	template <typename T>
+	struct Standard
+	{
+		using Container = std::vector<T>;
+		static void Push(Container& container, const T& value) { container.push_back(value); }
+		template <typename... Args>
+		static void Emplace(Container& container, Args&&... args) { container.emplace_back(std::forward<Args>(args)...); }
+		static std::size_t Size(const Container& container) { return container.size(); }
+		static bool Contains(Container& container, const T& value) { return std::find(container.begin(), container.end(), value) != container.end(); }
+		static const T& At(Container& container, std::size_t index) { return container[index]; }
+		static void PopBack(Container& container) { container.pop_back(); }
+	};
+
+	/// <summary>
+	/// Linear growth copies the whole array every five insertions, so past this size it takes too long to be worth measuring.
+	/// </summary>
+	constexpr std::size_t LinearLimit{ 100'000 };
+
+	template <typename Engine>
+	constexpr bool IsLinear{ std::is_same_v<Engine, FieaLinear<typename Engine::Container::value_type>> };
+
+	/// <summary>
+	/// Each round starts from an empty container, so the time includes every reallocation on the way to the final size.
+	/// </summary>
+	template <typename Engine>
+	std::size_t PushBackInt(std::size_t size, Stopwatch& stopwatch)
+	{
+		if (IsLinear<Engine> && size > LinearLimit)
+		{
+			return 0;
+		}
+
+		typename Engine::Container container{};
+		stopwatch.Start();
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			Engine::Push(container, static_cast<int>(index));
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(Engine::Size(container));
+		return size;
+	}
+
+	template <typename Engine>
+	std::size_t EmplaceBackElement(std::size_t size, Stopwatch& stopwatch)
+	{
+		if (IsLinear<Engine> && size > LinearLimit)
+		{
+			return 0;
+		}
+
+		typename Engine::Container container{};
+		stopwatch.Start();
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			float value{ static_cast<float>(index) };
+			Engine::Emplace(container, value, value, value, 1.0f);
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(Engine::Size(container));
+		return size;
+	}
+
+	/// <summary>
+	/// Strings cannot be moved with realloc, so each growth move constructs every element into the new array.
+	/// </summary>
+	template <typename Engine>
+	std::size_t PushBackString(std::size_t size, Stopwatch& stopwatch)
+	{
+		if (IsLinear<Engine> && size > LinearLimit)
+		{
+			return 0;
+		}
+
+		const std::string value{ "a name long enough to live on the heap" };
+		typename Engine::Container container{};
+		stopwatch.Start();
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			Engine::Push(container, value);
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(Engine::Size(container));
+		return size;
+	}
+
+	/// <summary>
+	/// Creating and destroying empty containers, as a Scope or Datum does for members that never receive a value.
+	/// </summary>
+	template <typename Engine>
+	std::size_t ConstructEmpty(std::size_t size, Stopwatch& stopwatch)
+	{
+		stopwatch.Start();
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			typename Engine::Container container{};
+			DoNotOptimize(container);
+		}
+		stopwatch.Stop();
+
+		return size;
+	}
+
+	template <typename Engine>
+	typename Engine::Container MakeFilled(std::size_t size)
+	{
+		typename Engine::Container container{};
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			Engine::Push(container, static_cast<int>(index));
+		}
+		return container;
+	}
+
+	/// <summary>
+	/// Reads elements at scattered positions, which measures bounds checking and cache misses rather than the loop.
+	/// </summary>
+	template <typename Engine>
+	std::size_t Index(std::size_t size, Stopwatch& stopwatch)
+	{
+		auto container{ MakeFilled<Engine>(size) };
+
+		long long sum{ 0 };
+		stopwatch.Start();
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			sum += Engine::At(container, ScatteredIndex(index, size));
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(sum);
+		return size;
+	}
+
+	template <typename Engine>
+	std::size_t Iterate(std::size_t size, Stopwatch& stopwatch)
+	{
+		auto container{ MakeFilled<Engine>(size) };
+
+		long long sum{ 0 };
+		stopwatch.Start();
+		for (int value : container)
+		{
+			sum += value;
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(sum);
+		return size;
+	}
+
+	/// <summary>
+	/// Searches for values spread evenly through the container, so on average each search reads half of it.
+	/// </summary>
+	template <typename Engine>
+	std::size_t Find(std::size_t size, Stopwatch& stopwatch)
+	{
+		auto container{ MakeFilled<Engine>(size) };
+		const std::size_t searches{ std::min(size, MaximumSearches) };
+
+		std::size_t found{ 0 };
+		stopwatch.Start();
+		for (std::size_t search{ 0 }; search < searches; ++search)
+		{
+			found += Engine::Contains(container, static_cast<int>(ScatteredIndex(search, size)));
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(found);
+		return searches;
+	}
+
+	template <typename Engine>
+	std::size_t PopBack(std::size_t size, Stopwatch& stopwatch)
+	{
+		auto container{ MakeFilled<Engine>(size) };
+
+		stopwatch.Start();
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			Engine::PopBack(container);
+			DoNotOptimize(container);
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(Engine::Size(container));
+		return size;
+	}
+
+	/// <summary>
+	/// Copies a container of strings, which allocates the new array and copy constructs every element into it. Reported per element.
+	/// </summary>
+	template <typename Engine>
+	std::size_t CopyString(std::size_t size, Stopwatch& stopwatch)
+	{
+		typename Engine::Container container{};
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			Engine::Push(container, "a name long enough to live on the heap " + std::to_string(index));
+		}
+
+		stopwatch.Start();
+		typename Engine::Container copy{ container };
+		stopwatch.Stop();
+
+		DoNotOptimize(Engine::Size(copy));
+		return size;
+	}
+
+	template <typename Engine>
+	std::size_t CopyInt(std::size_t size, Stopwatch& stopwatch)
+	{
+		auto container{ MakeFilled<Engine>(size) };
+
+		stopwatch.Start();
+		typename Engine::Container copy{ container };
+		stopwatch.Stop();
+
+		DoNotOptimize(Engine::Size(copy));
+		return size;
+	}
+
+	/// <summary>
+	/// Moves a full container back and forth. A move only hands over the array, so the time should not depend on the size.
+	/// </summary>
+	template <typename Engine>
+	std::size_t Move(std::size_t size, Stopwatch& stopwatch)
+	{
+		constexpr std::size_t moves{ 1'000 };
+		auto container{ MakeFilled<Engine>(size) };
+
+		stopwatch.Start();
+		for (std::size_t move{ 0 }; move < moves; move += 2)
+		{
+			typename Engine::Container other{ std::move(container) };
+			DoNotOptimize(other);
+			container = std::move(other);
+			DoNotOptimize(container);
+		}
+		stopwatch.Stop();
+
+		DoNotOptimize(Engine::Size(container));
+		return moves;
+	}
+
+	/// <summary>
+	/// Prints how many times each policy reallocates, and how many elements it moves in doing so, to reach a given size.
+	/// </summary>
+	template <typename TGrowth>
+	void CountGrowth(const char* name, std::size_t size)
+	{
+		std::size_t capacity{ 0 };
+		std::size_t reallocations{ 0 };
+		std::size_t moved{ 0 };
+		for (std::size_t count{ 1 }; count <= size; ++count)
+		{
+			if (count > capacity)
+			{
+				moved += count - 1;
+				capacity = std::max(TGrowth{}(capacity, count - 1), capacity + 1);
+				++reallocations;
+			}
+		}
+		std::printf("  %-12s %10zu elements: %8zu reallocations, %14zu elements moved, final capacity %zu\n", name, size, reallocations, moved, capacity);
+	}
+
+	void GrowthReport()
+	{
+		std::printf("Vector growth\n");
+		for (std::size_t size : { std::size_t{ 100 }, std::size_t{ 10'000 }, std::size_t{ 1'000'000 } })
+		{
+			CountGrowth<LinearIncrement<int>>("linear", size);
+			CountGrowth<DefaultIncrement<int>>("geometric", size);
+		}
+	}
+}
+
+BENCHMARK("Vector", "PushBack/Int/Geometric", PushBackInt<FieaGeometric<int>>);
+BENCHMARK("Vector", "PushBack/Int/Linear", PushBackInt<FieaLinear<int>>);
+BENCHMARK("Vector", "PushBack/Int/std::vector", PushBackInt<Standard<int>>);
+BENCHMARK("Vector", "EmplaceBack/Element/Geometric", EmplaceBackElement<FieaGeometric<Element>>);
+BENCHMARK("Vector", "EmplaceBack/Element/Linear", EmplaceBackElement<FieaLinear<Element>>);
+BENCHMARK("Vector", "EmplaceBack/Element/std::vector", EmplaceBackElement<Standard<Element>>);
+BENCHMARK("Vector", "PushBack/String/Geometric", PushBackString<FieaGeometric<std::string>>);
+BENCHMARK("Vector", "PushBack/String/std::vector", PushBackString<Standard<std::string>>);
+BENCHMARK("Vector", "ConstructEmpty/Geometric", ConstructEmpty<FieaGeometric<int>>);
+BENCHMARK("Vector", "ConstructEmpty/std::vector", ConstructEmpty<Standard<int>>);
+BENCHMARK("Vector", "Index/Geometric", Index<FieaGeometric<int>>);
+BENCHMARK("Vector", "Index/std::vector", Index<Standard<int>>);
+BENCHMARK("Vector", "Iterate/Geometric", Iterate<FieaGeometric<int>>);
+BENCHMARK("Vector", "Iterate/std::vector", Iterate<Standard<int>>);
+BENCHMARK("Vector", "Find/Geometric", Find<FieaGeometric<int>>);
+BENCHMARK("Vector", "Find/std::vector", Find<Standard<int>>);
+BENCHMARK("Vector", "PopBack/Geometric", PopBack<FieaGeometric<int>>);
+BENCHMARK("Vector", "PopBack/std::vector", PopBack<Standard<int>>);
+BENCHMARK("Vector", "Copy/Int/Geometric", CopyInt<FieaGeometric<int>>);
+BENCHMARK("Vector", "Copy/Int/std::vector", CopyInt<Standard<int>>);
+BENCHMARK("Vector", "Copy/String/Geometric", CopyString<FieaGeometric<std::string>>);
+BENCHMARK("Vector", "Copy/String/std::vector", CopyString<Standard<std::string>>);
+BENCHMARK("Vector", "Move/Geometric", Move<FieaGeometric<int>>);
+BENCHMARK("Vector", "Move/std::vector", Move<Standard<int>>);
+REPORT("Vector growth", GrowthReport);
@@ -0,0 +1,293 @@
+#include "Benchmark.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace FieaGameEngine::Benchmarks
+{
+	void Stopwatch::Start()
+	{
+		_start = std::chrono::steady_clock::now();
+	}
+
+	void Stopwatch::Stop()
+	{
+		_elapsed += std::chrono::steady_clock::now() - _start;
+	}
+
+	double Stopwatch::Nanoseconds() const
+	{
+		return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(_elapsed).count());
+	}
+
+	std::vector<Benchmark>& Registry()
+	{
+		static std::vector<Benchmark> benchmarks;
+		return benchmarks;
+	}
+
+	bool RegisterBenchmark(std::string group, std::string name, BenchmarkFunction function)
+	{
+		Registry().push_back(Benchmark{ std::move(group), std::move(name), std::move(function) });
+		return true;
+	}
+
+	std::vector<Report>& Reports()
+	{
+		static std::vector<Report> reports;
+		return reports;
+	}
+
+	bool RegisterReport(std::string name, std::function<void()> function)
+	{
+		Reports().push_back(Report{ std::move(name), std::move(function) });
+		return true;
+	}
+}
+
+using namespace FieaGameEngine::Benchmarks;
+
+namespace
+{
+	constexpr std::size_t MinimumRuns{ 3 };
+	constexpr std::size_t MaximumRuns{ 50 };
+	constexpr double MinimumTotalNanoseconds{ 50'000'000.0 };
+
+	std::vector<std::size_t> ParseSizes(const std::string& list)
+	{
+		std::vector<std::size_t> sizes;
+		std::size_t start{ 0 };
+		while (start < list.size())
+		{
+			std::size_t end{ list.find(',', start) };
+			if (end == std::string::npos)
+			{
+				end = list.size();
+			}
+			sizes.push_back(static_cast<std::size_t>(std::strtoull(list.substr(start, end - start).c_str(), nullptr, 10)));
+			start = end + 1;
+		}
+		return sizes;
+	}
+
+	/// <summary>
+	/// Every power of ten from ten to ten million, selected with --full.
+	/// </summary>
+	const std::vector<std::size_t> FullSizes{ 10, 100, 1'000, 10'000, 100'000, 1'000'000, 10'000'000 };
+
+	/// <summary>
+	/// The outcome of running one benchmark at one size. A benchmark that skips the size has no runs.
+	/// </summary>
+	struct Result final
+	{
+		std::string Name;
+		std::size_t Size{ 0 };
+		std::size_t Runs{ 0 };
+		std::size_t Operations{ 0 };
+		double Best{ 0.0 };
+		double Mean{ 0.0 };
+	};
+
+	/// <summary>
+	/// Runs a benchmark until it has enough samples. The best time per operation is the one least disturbed by the rest of the machine, and is what the table shows;
+	/// the mean is kept alongside it so a noisy run can be told apart from a real change.
+	/// </summary>
+	Result Run(const Benchmark& benchmark, std::string name, std::size_t size)
+	{
+		Result result{ std::move(name), size };
+		double best{ std::numeric_limits<double>::max() };
+		double total{ 0.0 };
+		double totalPerOperation{ 0.0 };
+		for (std::size_t run{ 0 }; run < MaximumRuns && (run < MinimumRuns || total < MinimumTotalNanoseconds); ++run)
+		{
+			Stopwatch stopwatch;
+			std::size_t operations{ benchmark.Function(size, stopwatch) };
+			if (operations == 0)
+			{
+				return result;
+			}
+			double nanoseconds{ stopwatch.Nanoseconds() };
+			double perOperation{ nanoseconds / static_cast<double>(operations) };
+			total += nanoseconds;
+			totalPerOperation += perOperation;
+			best = std::min(best, perOperation);
+			result.Operations = operations;
+			++result.Runs;
+		}
+		result.Best = best;
+		result.Mean = totalPerOperation / static_cast<double>(result.Runs);
+		return result;
+	}
+
+	void WriteJsonString(std::FILE* file, const std::string& string)
+	{
+		std::fputc('"', file);
+		for (char character : string)
+		{
+			if (character == '"' || character == '\\')
+			{
+				std::fputc('\\', file);
+				std::fputc(character, file);
+			}
+			else if (static_cast<unsigned char>(character) < 0x20)
+			{
+				std::fprintf(file, "\\u%04x", static_cast<unsigned int>(static_cast<unsigned char>(character)));
+			}
+			else
+			{
+				std::fputc(character, file);
+			}
+		}
+		std::fputc('"', file);
+	}
+
+	/// <summary>
+	/// Writes every result as one JSON document, so runs on different commits can be compared by a script. Times are in nanoseconds per operation,
+	/// and a skipped size is written with zero runs and null times.
+	/// </summary>
+	bool WriteJson(const std::string& path, const std::vector<Result>& results)
+	{
+		std::FILE* file{ path == "-" ? stdout : std::fopen(path.c_str(), "w") };
+		if (file == nullptr)
+		{
+			std::fprintf(stderr, "Could not open %s for writing.\n", path.c_str());
+			return false;
+		}
+
+#if defined(__clang__)
+		const char* compiler{ "clang " __clang_version__ };
+#elif defined(__GNUC__)
+		const char* compiler{ "gcc " __VERSION__ };
+#elif defined(_MSC_VER)
+		const std::string compilerVersion{ "msvc " + std::to_string(_MSC_FULL_VER) };
+		const char* compiler{ compilerVersion.c_str() };
+#else
+		const char* compiler{ "unknown" };
+#endif
+#ifdef NDEBUG
+		const char* configuration{ "Release" };
+#else
+		const char* configuration{ "Debug" };
+#endif
+
+		std::fprintf(file, "{\n  \"context\": { \"compiler\": ");
+		WriteJsonString(file, compiler);
+		std::fprintf(file, ", \"configuration\": \"%s\", \"unit\": \"ns/op\" },\n  \"benchmarks\": [", configuration);
+		for (std::size_t index{ 0 }; index < results.size(); ++index)
+		{
+			const Result& result{ results[index] };
+			std::fprintf(file, "%s\n    { \"name\": ", index == 0 ? "" : ",");
+			WriteJsonString(file, result.Name);
+			std::fprintf(file, ", \"size\": %zu, \"runs\": %zu, \"operations\": %zu, ", result.Size, result.Runs, result.Operations);
+			if (result.Runs == 0)
+			{
+				std::fprintf(file, "\"best\": null, \"mean\": null }");
+			}
+			else
+			{
+				std::fprintf(file, "\"best\": %.4f, \"mean\": %.4f }", result.Best, result.Mean);
+			}
+		}
+		std::fprintf(file, "\n  ]\n}\n");
+
+		if (file != stdout)
+		{
+			std::fclose(file);
+		}
+		return true;
+	}
+}
+
+/// <summary>
+/// Usage: Benchmarks [filter] [--sizes 10,100,1000 | --full] [--json results.json] [--reports]
+/// Only benchmarks whose "Group/Name" contains the filter are run. With --reports, the matching reports are run instead.
+/// --full runs every power of ten up to ten million. --json also writes the results to a file, or to standard output in place of the table when given "-".
+/// </summary>
+int main(int argc, char* argv[])
+{
+	std::string filter;
+	std::vector<std::size_t> sizes{ 10, 100, 1'000, 10'000, 100'000 };
+	bool reports{ false };
+	std::string jsonPath;
+
+	for (int index{ 1 }; index < argc; ++index)
+	{
+		std::string argument{ argv[index] };
+		if (argument == "--sizes" && index + 1 < argc)
+		{
+			sizes = ParseSizes(argv[++index]);
+		}
+		else if (argument == "--full")
+		{
+			sizes = FullSizes;
+		}
+		else if (argument == "--json" && index + 1 < argc)
+		{
+			jsonPath = argv[++index];
+		}
+		else if (argument == "--reports")
+		{
+			reports = true;
+		}
+		else
+		{
+			filter = argument;
+		}
+	}
+
+	if (reports)
+	{
+		for (const Report& report : Reports())
+		{
+			if (report.Name.find(filter) != std::string::npos)
+			{
+				std::printf("== %s ==\n", report.Name.c_str());
+				report.Function();
+				std::printf("\n");
+			}
+		}
+		return 0;
+	}
+
+	const bool printTable{ jsonPath != "-" };
+	std::vector<Result> results;
+	if (printTable)
+	{
+		std::printf("%-48s %10s %14s\n", "Benchmark", "Size", "ns/op");
+	}
+	for (const Benchmark& benchmark : Registry())
+	{
+		std::string fullName{ benchmark.Group + "/" + benchmark.Name };
+		if (fullName.find(filter) == std::string::npos)
+		{
+			continue;
+		}
+
+		for (std::size_t size : sizes)
+		{
+			Result result{ Run(benchmark, fullName, size) };
+			if (printTable)
+			{
+				if (result.Runs == 0)
+				{
+					std::printf("%-48s %10zu %14s\n", fullName.c_str(), size, "skipped");
+				}
+				else
+				{
+					std::printf("%-48s %10zu %14.2f\n", fullName.c_str(), size, result.Best);
+				}
+				std::fflush(stdout);
+			}
+			results.push_back(std::move(result));
+		}
+	}
+
+	if (!jsonPath.empty() && !WriteJson(jsonPath, results))
+	{
+		return EXIT_FAILURE;
+	}
+	return 0;
+}
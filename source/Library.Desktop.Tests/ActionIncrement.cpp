@@ -7,20 +7,37 @@ namespace UnitTests
 
 	void ActionIncrement::Update(const FieaGameEngine::GameTime&)
 	{
-		FieaGameEngine::Datum* operand = Search(_operand);
+		if (_binding.Name().IsNull())
+		{
+			Rebind();
+		}
+
+		FieaGameEngine::Datum* operand = Search(_binding);
 		assert(operand != nullptr);
 		assert(operand->Type() == FieaGameEngine::Datum::DatumTypes::Integer);
 		operand->GetAsInt() += _step;
 	}
 
+	void ActionIncrement::Rebind()
+	{
+		FieaGameEngine::Symbol operand{ FieaGameEngine::Symbol::Find(_operand) };
+		assert(!operand.IsNull());
+		_binding = FieaGameEngine::Scope::Binding{ std::move(operand) };
+	}
+
 	ActionIncrement::ActionIncrement() :
 		Action(ActionIncrement::TypeIdClass())
 	{
 	}
 
-	FieaGameEngine::Vector<FieaGameEngine::Signature> ActionIncrement::Signatures()
+	gsl::owner<ActionIncrement*> ActionIncrement::Clone() const
+	{
+		return new ActionIncrement(*this);
+	}
+
+	FieaGameEngine::SignatureList ActionIncrement::Signatures()
 	{
-		FieaGameEngine::Vector<FieaGameEngine::Signature> signatures
+		FieaGameEngine::SignatureList signatures
 		{
 			FieaGameEngine::Signature{ "Operand", FieaGameEngine::Datum::DatumTypes::String, 1, offsetof(ActionIncrement, _operand) },
 			FieaGameEngine::Signature{ "Step", FieaGameEngine::Datum::DatumTypes::Integer, 1, offsetof(ActionIncrement, _step) },
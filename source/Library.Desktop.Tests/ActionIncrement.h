@@ -12,9 +12,17 @@ namespace UnitTests
 		int _step{};
 
 		virtual void Update(const FieaGameEngine::GameTime&) override;
+		/// <summary>
+		/// Binds the increment to the attribute named by Operand. Update binds on its first call, so this only needs calling after Operand is changed later on.
+		/// </summary>
+		void Rebind();
 		ActionIncrement();
+		gsl::owner<ActionIncrement*> Clone() const override;
 
-		static FieaGameEngine::Vector<FieaGameEngine::Signature> Signatures();
+		static FieaGameEngine::SignatureList Signatures();
+
+	private:
+		FieaGameEngine::Scope::Binding _binding{};
 	};
 
 	ConcreteFactory(ActionIncrement, FieaGameEngine::Scope);
@@ -15,6 +15,7 @@
 #include "ActionIncrement.h"
 #include "ExpressionParser.h"
 #include "ActionExpression.h"
+#include "Prefab.h"
 #include <any>
 #include "Factory.h"
 #include "GameTime.h"
@@ -139,6 +140,39 @@ namespace LibraryDesktopTests
 			TypeManager::DestroyInstance();
 		}
 
+		TEST_METHOD(ActionIncrementRebind)
+		{
+			TypeManager::CreateInstance();
+			auto _typeManager = TypeManager::Instance();
+			_typeManager->AddSignature(Monster::TypeIdClass(), Monster::Signatures());
+			_typeManager->AddSignature(ActionIncrement::TypeIdClass(), ActionIncrement::Signatures());
+			Factory<Scope>::Add(std::make_unique<const ActionIncrementFactory>());
+
+			{
+				GameTime gameTime{};
+				Monster monster{};
+				monster._health = 100;
+				monster._damage = 10;
+				ActionIncrement* increment = static_cast<ActionIncrement*>(monster.CreateAction("ActionIncrement"s));
+				Assert::IsNotNull(increment);
+				increment->_operand = "Health"s;
+				increment->_step = 5;
+
+				monster.Update(gameTime);
+				monster.Update(gameTime);
+				Assert::AreEqual(110, monster._health);
+
+				increment->_operand = "Damage"s;
+				increment->Rebind();
+				monster.Update(gameTime);
+				Assert::AreEqual(110, monster._health);
+				Assert::AreEqual(15, monster._damage);
+			}
+
+			Factory<Scope>::Clear();
+			TypeManager::DestroyInstance();
+		}
+
 		TEST_METHOD(ExpressionParsing)
 		{
 			TypeManager::CreateInstance();
@@ -301,6 +335,223 @@ namespace LibraryDesktopTests
 			Assert::AreEqual(200, monster._health);
 		}
 
+		TEST_METHOD(ActionExpressionsExtendedTypes)
+		{
+			TypeManager::CreateInstance();
+			auto _typeManager = TypeManager::Instance();
+			_typeManager->AddSignature(Monster::TypeIdClass(), Monster::Signatures());
+			_typeManager->AddSignature(ActionExpression::TypeIdClass(), ActionExpression::Signatures());
+			Factory<Scope>::Add(std::make_unique<const ActionExpressionFactory>());
+
+			GameTime gameTime{};
+			Monster monster;
+			monster.AppendAuxillaryAttribute("Distance") = std::int64_t{ 3'000'000'000 };
+			monster.AppendAuxillaryAttribute("Ratio") = 0.25;
+			monster.AppendAuxillaryAttribute("Hidden") = false;
+			monster.AppendAuxillaryAttribute("Offset") = glm::vec2{ 1.0f, 2.0f };
+			monster.AppendAuxillaryAttribute("Velocity") = glm::vec3{ 1.0f, 2.0f, 3.0f };
+			monster.AppendAuxillaryAttribute("Spin") = glm::quat{ 1.0f, 0.0f, 0.0f, 0.0f };
+			monster.AppendAuxillaryAttribute("Farther") = 0;
+
+			const std::array<std::string, 7> expressions
+			{
+				"Distance = ( Distance * 2_l + 1_l )"s,
+				"Ratio = ( Ratio / 0.5_d )"s,
+				"Hidden = ! Hidden"s,
+				"Offset = ( Offset + vec2(1,1) )"s,
+				"Velocity = ( Velocity * vec3(2,2,2) )"s,
+				"Spin = ( Spin * quat(0,{1,0,0}) )"s,
+				"Farther = ( Distance > 5000000000_l )"s
+			};
+
+			for (const auto& expression : expressions)
+			{
+				auto actionExpression = static_cast<ActionExpression*>(monster.CreateAction("ActionExpression"));
+				actionExpression->Append("Expression") = expression;
+				actionExpression->Reparse();
+			}
+
+			monster.Update(gameTime);
+
+			Factory<Scope>::Clear();
+			TypeManager::DestroyInstance();
+
+			Assert::AreEqual(std::int64_t{ 6'000'000'001 }, monster["Distance"].GetAsInt64());
+			Assert::AreEqual(0.5, monster["Ratio"].GetAsDouble());
+			Assert::IsTrue(monster["Hidden"].GetAsBool());
+			Assert::AreEqual(glm::vec2{ 2.0f, 3.0f }, monster["Offset"].GetAsVector2());
+			Assert::AreEqual(glm::vec3{ 2.0f, 4.0f, 6.0f }, monster["Velocity"].GetAsVector3());
+			Assert::AreEqual(glm::quat{ 0.0f, 1.0f, 0.0f, 0.0f }, monster["Spin"].GetAsQuaternion());
+			Assert::AreEqual(1, monster["Farther"].GetAsInt());
+		}
+
+		TEST_METHOD(Prefabs)
+		{
+			TypeManager::CreateInstance();
+			auto _typeManager = TypeManager::Instance();
+			_typeManager->AddSignature(Monster::TypeIdClass(), Monster::Signatures());
+			_typeManager->AddSignature(ActionIncrement::TypeIdClass(), ActionIncrement::Signatures());
+			Factory<Scope>::Add(std::make_unique<const MonsterFactory>());
+			Factory<Scope>::Add(std::make_unique<const ActionIncrementFactory>());
+
+			const std::string filename = "TestFile.json"s;
+			{
+				std::ofstream outputFile(filename);
+				Assert::IsTrue(outputFile.good());
+				outputFile << R"({"Monster Zombie": {
+						"Health": 100,
+						"Gait": "Shamble",
+						"Taunts": [ "Braaains", "Grr" ],
+						"Lament": "a moan long enough that its characters live on the heap",
+						"Transform": { "X": 1, "Y": 2 },
+						"Actions": [ { "ActionIncrement Heal": { "Name": "Heal", "Operand": "Health", "Step": 5 } } ]
+					}})";
+			}
+
+			{
+				std::shared_ptr<FieaGameEngine::JsonParseCoordinator::Wrapper> wrapper = std::make_shared<JsonTableParseHelper::Wrapper>();
+				JsonParseCoordinator parseCoordinator{ wrapper };
+				parseCoordinator.AddHelper(std::make_shared<JsonTableParseHelper>());
+				parseCoordinator.Initialize();
+				parseCoordinator.DeserializeObjectFromFile(filename);
+
+				JsonTableParseHelper::Wrapper* rawWrapper = static_cast<JsonTableParseHelper::Wrapper*>(wrapper.get());
+				Factory<Scope>::Add(std::make_unique<const Prefab>("Zombie"s, std::unique_ptr<Scope>{ rawWrapper->_scope->Clone() }));
+			}
+
+			const Prefab* prefab = static_cast<const Prefab*>(Factory<Scope>::Find("Zombie"));
+			Assert::IsNotNull(prefab);
+			const Monster* prototype = prefab->Prototype().As<Monster>();
+			Assert::IsNotNull(prototype);
+			Assert::IsTrue(prototype->Find("Gait")->IsCopyOnWrite());
+			Assert::IsTrue(prefab->CreatesFromTemplate());
+			Assert::IsFalse(Factory<Scope>::Find("Monster")->CreatesFromTemplate());
+
+			{
+				std::ofstream outputFile(filename);
+				Assert::IsTrue(outputFile.good());
+				outputFile << R"({"Horde": { "Zombies": [
+						{ "Zombie First": { "Health": 50, "Gait": "Sprint", "Transform": { "X": 10 } } },
+						{ "Zombie Second": { "Taunts": [ "Hungry" ], "Extras": { "Z": 3 } } },
+						{ "Zombie Third": { "Damage": 3 } }
+					]}})";
+			}
+
+			{
+				std::shared_ptr<FieaGameEngine::JsonParseCoordinator::Wrapper> wrapper = std::make_shared<JsonTableParseHelper::Wrapper>();
+				JsonParseCoordinator parseCoordinator{ wrapper };
+				parseCoordinator.AddHelper(std::make_shared<JsonTableParseHelper>());
+				parseCoordinator.Initialize();
+				parseCoordinator.DeserializeObjectFromFile(filename);
+
+				JsonTableParseHelper::Wrapper* rawWrapper = static_cast<JsonTableParseHelper::Wrapper*>(wrapper.get());
+				Datum* zombies = rawWrapper->_scope->Find("Zombies");
+				Assert::IsNotNull(zombies);
+				Assert::AreEqual(std::size_t{ 3 }, zombies->Size());
+
+				// An instance holds its prescribed attributes and reads every other one from the template until it writes to it.
+				Monster* third = zombies->GetAsScope(2)->As<Monster>();
+				Assert::IsNotNull(third);
+				Assert::IsTrue(third->Prototype() == prototype);
+				Assert::AreEqual(100, third->_health);
+				Assert::AreEqual(3, third->_damage);
+				Assert::AreEqual(third->AuxillaryAttributes().first, third->AuxillaryAttributes().second);
+				Assert::IsTrue(std::as_const(*third).Find("Gait") == prototype->Find("Gait"));
+				Assert::IsTrue(std::as_const(*third).Find("Transform") == prototype->Find("Transform"));
+				Assert::IsTrue(third->IsAttribute("Taunts"));
+				Assert::IsTrue(third->IsAuxillaryAttribute("Taunts"));
+				Assert::IsFalse(third->IsPrescribedAttribute("Taunts"));
+				Assert::IsNull(std::as_const(*third).Find("Missing"));
+				Assert::IsNull(third->Find("Missing"));
+				Assert::AreEqual(third->AuxillaryAttributes().first, third->AuxillaryAttributes().second);
+
+				Monster* first = zombies->GetAsScope(0)->As<Monster>();
+				Assert::IsNotNull(first);
+				Assert::AreEqual(50, first->_health);
+				Assert::AreEqual(std::size_t{ 2 }, first->AuxillaryAttributes().second - first->AuxillaryAttributes().first);
+				Assert::AreEqual("Sprint"s, std::as_const(*first).Find("Gait")->GetAsString());
+				Assert::AreEqual(std::size_t{ 1 }, std::as_const(*first).Find("Gait")->Size());
+				Assert::AreEqual("Shamble"s, prototype->Find("Gait")->GetAsString());
+				Assert::IsTrue(std::as_const(*first).Find("Taunts") == prototype->Find("Taunts"));
+
+				Monster* second = zombies->GetAsScope(1)->As<Monster>();
+				Assert::IsNotNull(second);
+				Assert::AreEqual(std::size_t{ 2 }, second->AuxillaryAttributes().second - second->AuxillaryAttributes().first);
+				Assert::AreEqual(std::size_t{ 1 }, std::as_const(*second).Find("Taunts")->Size());
+				Assert::AreEqual("Hungry"s, std::as_const(*second).Find("Taunts")->GetAsString());
+				Assert::AreEqual(std::size_t{ 2 }, prototype->Find("Taunts")->Size());
+
+				// A lookup that could write copies the attribute into the instance, sharing the template's heap payload until it is written to.
+				const Datum& prototypeTaunts = *prototype->Find("Taunts");
+				const Datum& prototypeLament = *prototype->Find("Lament");
+				Datum* taunts = third->Find("Taunts");
+				Assert::IsTrue(taunts != &prototypeTaunts);
+				Assert::IsTrue(taunts->IsShared());
+				Assert::AreEqual(std::size_t{ 2 }, taunts->Size());
+				Assert::AreEqual(std::size_t{ 1 }, third->AuxillaryAttributes().second - third->AuxillaryAttributes().first);
+				Assert::IsTrue(third->Find("Taunts") == taunts);
+				Assert::IsTrue(std::as_const(*taunts).AsSpan<std::string>().data() == prototypeTaunts.AsSpan<std::string>().data());
+				Assert::IsTrue(std::as_const(*third->Find("Lament")).GetAsString().data() == prototypeLament.GetAsString().data());
+				Assert::IsTrue(std::as_const(*second->Find("Lament")).GetAsString().data() == prototypeLament.GetAsString().data());
+				Assert::IsTrue(std::as_const(*second).Find("Taunts")->AsSpan<std::string>().data() != prototypeTaunts.AsSpan<std::string>().data());
+
+				second->Find("Lament")->Set("a different moan, also long enough to live on the heap"s);
+				Assert::IsTrue(std::as_const(*second).Find("Lament")->GetAsString().data() != prototypeLament.GetAsString().data());
+				Assert::IsTrue(std::as_const(*third).Find("Lament")->GetAsString().data() == prototypeLament.GetAsString().data());
+				Assert::AreEqual("a moan long enough that its characters live on the heap"s, prototypeLament.GetAsString());
+
+				third->Append("Gait").Set("Lurch"s);
+				Assert::IsFalse(std::as_const(*third).Find("Gait")->IsShared());
+				Assert::AreEqual("Shamble"s, prototype->Find("Gait")->GetAsString());
+				third->AppendAuxillaryAttribute("Limp") = 1;
+				Assert::IsNull(prototype->Find("Limp"));
+
+				// A plain nested object overrides the instance's copy of the table the template holds under that name rather than adding a second one.
+				const Datum* transform = std::as_const(*first).Find("Transform");
+				Assert::IsNotNull(transform);
+				Assert::IsTrue(transform != prototype->Find("Transform"));
+				Assert::AreEqual(std::size_t{ 1 }, transform->Size());
+				Assert::AreEqual(std::size_t{ 1 }, std::as_const(*transform->GetAsScope()).Find("X")->Size());
+				Assert::AreEqual(10, std::as_const(*transform->GetAsScope()).Find("X")->GetAsInt());
+				Assert::AreEqual(2, std::as_const(*transform->GetAsScope()).Find("Y")->GetAsInt());
+				Assert::AreEqual(1, prototype->Find("Transform")->GetAsScope()->Find("X")->GetAsInt());
+				Assert::AreEqual(1, std::as_const(*third).Find("Transform")->GetAsScope()->Find("X")->GetAsInt());
+				Assert::AreEqual(3, std::as_const(*second).Find("Extras")->GetAsScope()->Find("Z")->GetAsInt());
+				Assert::IsNull(prototype->Find("Extras"));
+
+				// Actions search upward from the scope holding them, so every instance has its own.
+				Datum& actions = third->Actions();
+				Assert::AreEqual(std::size_t{ 1 }, actions.Size());
+				Assert::IsFalse(actions.GetAsScope() == prototype->Find("Actions")->GetAsScope());
+				Assert::IsTrue(actions.GetAsScope()->GetParent() == third);
+
+				GameTime gameTime{};
+				third->Update(gameTime);
+				Assert::AreEqual(105, third->_health);
+				Assert::AreEqual(50, first->_health);
+				Assert::AreEqual(100, prototype->_health);
+
+				// Copies of an instance read from the same template.
+				std::unique_ptr<Scope> copy{ third->Clone() };
+				Assert::IsTrue(copy->Prototype() == prototype);
+				Assert::AreEqual(105, copy->As<Monster>()->_health);
+				Assert::AreEqual("Lurch"s, std::as_const(*copy).Find("Gait")->GetAsString());
+				Assert::IsTrue(std::as_const(*copy).Find("Transform") == prototype->Find("Transform"));
+				Assert::IsTrue(copy->As<Monster>()->Actions().GetAsScope()->GetParent() == copy.get());
+
+				// Clearing an instance drops what it wrote, leaving it as a new instance of the template.
+				third->Clear();
+				Assert::IsTrue(std::as_const(*third).Find("Gait") == prototype->Find("Gait"));
+				Assert::IsNull(std::as_const(*third).Find("Limp"));
+				Assert::AreEqual(third->AuxillaryAttributes().first, third->AuxillaryAttributes().second);
+				Assert::AreEqual(std::size_t{ 1 }, third->Actions().Size());
+				Assert::IsTrue(third->Actions().GetAsScope()->GetParent() == third);
+			}
+
+			Factory<Scope>::Clear();
+			TypeManager::DestroyInstance();
+		}
+
 	private:
 		inline static _CrtMemState _startMemState;
 	};
@@ -13,9 +13,9 @@ namespace UnitTests
 
 	}
 
-	Vector<Signature> AttributedFoo::Signatures()
+	SignatureList AttributedFoo::Signatures()
 	{
-		return Vector<Signature>
+		return SignatureList
 		{
 			{ "ExternalInteger", Datum::DatumTypes::Integer, 1, offsetof(AttributedFoo, externalInteger) },
 			{ "ExternalFloat", Datum::DatumTypes::Float, 1, offsetof(AttributedFoo, externalFloat) },
@@ -33,7 +33,7 @@ namespace UnitTests
 		bool Equals(const RTTI* rhs) const override;
 		std::string ToString() const override;
 
-		static FieaGameEngine::Vector<FieaGameEngine::Signature> Signatures();
+		static FieaGameEngine::SignatureList Signatures();
 
 		
 	};
@@ -313,6 +313,53 @@ namespace LibraryDesktopTests
 			TypeManager::DestroyInstance();
 		}
 
+		TEST_METHOD(CopyAssignmentIntoPopulated)
+		{
+			TypeManager::CreateInstance();
+			auto _typeManager = TypeManager::Instance();
+			_typeManager->AddSignature(AttributedFoo::TypeIdClass(), AttributedFoo::Signatures());
+
+			{
+				AttributedFoo foo;
+				for (int index{ 0 }; index < 4; ++index)
+				{
+					foo.AppendScope("NestedScopeArray").Append("Index") = index;
+				}
+				foo.AppendScope("NestedScope");
+
+				AttributedFoo copiedFoo;
+				for (int index{ 0 }; index < 3; ++index)
+				{
+					copiedFoo.AppendScope("NestedScopeArray").Append("Stale") = index;
+				}
+				copiedFoo.AppendScope("Auxiliary");
+
+				copiedFoo = foo;
+				Datum& children = *copiedFoo.Find("NestedScopeArray");
+				Assert::AreEqual(std::size_t{ 4 }, children.Size());
+				Assert::IsNull(copiedFoo.Find("Auxiliary"));
+				for (std::size_t index{ 0 }; index < children.Size(); ++index)
+				{
+					Scope* child = children.GetAsScope(index);
+					Assert::IsTrue(child->GetParent() == &copiedFoo);
+					Assert::AreEqual(static_cast<int>(index), child->Find("Index")->GetAsInt());
+					std::pair<Datum*, std::size_t> found = copiedFoo.FindContainedScope(child);
+					Assert::IsTrue(found.first == &children);
+					Assert::AreEqual(index, found.second);
+				}
+				Assert::IsTrue(copiedFoo.Find("NestedScope")->GetAsScope()->GetParent() == &copiedFoo);
+
+				Scope* orphan = children.GetAsScope(1)->Orphan();
+				Assert::IsNotNull(orphan);
+				delete orphan;
+				Assert::AreEqual(std::size_t{ 3 }, children.Size());
+				Assert::AreEqual(3, children.GetAsScope(1)->Find("Index")->GetAsInt());
+				Assert::IsTrue(copiedFoo.FindContainedScope(children.GetAsScope(1)).second == 1);
+			}
+
+			TypeManager::DestroyInstance();
+		}
+
 		TEST_METHOD(MoveConstructor)
 		{
 			TypeManager::CreateInstance();
@@ -6,6 +6,12 @@
 #include "Foo.h"
 #include "Bar.h"
 #include "Datum.h"
+#include <array>
+#include <charconv>
+#include <memory_resource>
+#include <numeric>
+#include <utility>
+#include <string_view>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace FieaGameEngine;
@@ -878,7 +884,7 @@ namespace LibraryDesktopTests
 				datum.PushBack(2);
 				datum.PushBack(3);
 				Assert::AreEqual(std::size_t{ 3 }, datum.Size());
-				Assert::AreEqual(std::size_t{ 3 }, datum.Capacity());
+				Assert::AreEqual(std::size_t{ 4 }, datum.Capacity());
 
 				const Datum constDatum{ datum };
 				Assert::AreEqual(1, constDatum.FrontAsInt());
@@ -892,7 +898,7 @@ namespace LibraryDesktopTests
 				datum.PushBack(1.3f);
 				datum.PushBack(1.4f);
 				Assert::AreEqual(std::size_t{ 3 }, datum.Size());
-				Assert::AreEqual(std::size_t{ 3 }, datum.Capacity());
+				Assert::AreEqual(std::size_t{ 4 }, datum.Capacity());
 
 				const Datum constDatum{ datum };
 				Assert::AreEqual(1.2f, constDatum.FrontAsFloat());
@@ -906,7 +912,7 @@ namespace LibraryDesktopTests
 				datum.PushBack(std::string{ "String2" });
 				datum.PushBack(std::string{ "String3" });
 				Assert::AreEqual(std::size_t{ 3 }, datum.Size());
-				Assert::AreEqual(std::size_t{ 3 }, datum.Capacity());
+				Assert::AreEqual(std::size_t{ 4 }, datum.Capacity());
 
 				const Datum constDatum{ datum };
 				Assert::AreEqual(std::string{ "String1" }, constDatum.FrontAsString());
@@ -929,7 +935,7 @@ namespace LibraryDesktopTests
 				datum.PushBack(glm::vec4{ 1,1,1,1 });
 				datum.PushBack(glm::vec4{ 2,2,2,2 });
 				Assert::AreEqual(std::size_t{ 3 }, datum.Size());
-				Assert::AreEqual(std::size_t{ 3 }, datum.Capacity());
+				Assert::AreEqual(std::size_t{ 4 }, datum.Capacity());
 
 				const Datum constDatum{ datum };
 				Assert::AreEqual(glm::vec4{ 0,0,0,0 }, constDatum.FrontAsVector());
@@ -952,7 +958,7 @@ namespace LibraryDesktopTests
 				datum.PushBack(glm::mat4{ 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 });
 				datum.PushBack(glm::mat4{ 2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2 });
 				Assert::AreEqual(std::size_t{ 3 }, datum.Size());
-				Assert::AreEqual(std::size_t{ 3 }, datum.Capacity());
+				Assert::AreEqual(std::size_t{ 4 }, datum.Capacity());
 
 				const Datum constDatum{ datum };
 				Assert::AreEqual(glm::mat4{ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 }, constDatum.FrontAsMatrix());
@@ -980,7 +986,7 @@ namespace LibraryDesktopTests
 				datum.PushBack(fooPointer2);
 				datum.PushBack(fooPointer3);
 				Assert::AreEqual(std::size_t{ 3 }, datum.Size());
-				Assert::AreEqual(std::size_t{ 3 }, datum.Capacity());
+				Assert::AreEqual(std::size_t{ 4 }, datum.Capacity());
 
 				const Datum constDatum{ datum };
 				Assert::AreEqual(true, fooPointer == constDatum.FrontAsRTTI());
@@ -1572,6 +1578,267 @@ namespace LibraryDesktopTests
 
 		}
 
+		TEST_METHOD(FindAll)
+		{
+			{
+				Datum datum{ Datum::DatumTypes::Integer };
+				for (int index{ 0 }; index < 40; ++index)
+				{
+					datum.PushBack(index % 3);
+				}
+				const auto indices{ datum.FindAll(2) };
+				Assert::AreEqual(std::size_t{ 13 }, indices.Size());
+				for (std::size_t index{ 0 }; index < indices.Size(); ++index)
+				{
+					Assert::AreEqual(index * 3 + 2, indices[index]);
+				}
+				Assert::AreEqual(std::size_t{ 2 }, datum.Find(2));
+				Assert::IsTrue(datum.FindAll(3).IsEmpty());
+				Assert::AreEqual(datum.Size(), datum.Find(3));
+			}
+
+			{
+				Datum datum{ Datum::DatumTypes::Float };
+				datum.PushBack(-0.0f);
+				datum.PushBack(1.0f);
+				datum.PushBack(0.0f);
+				const auto indices{ datum.FindAll(0.0f) };
+				Assert::AreEqual(std::size_t{ 2 }, indices.Size());
+				Assert::AreEqual(std::size_t{ 0 }, indices[0]);
+				Assert::AreEqual(std::size_t{ 2 }, indices[1]);
+			}
+
+			{
+				Datum datum{ Datum::DatumTypes::String };
+				datum.PushBack(std::string{ "String" });
+				datum.PushBack(std::string{ "AnotherString" });
+				datum.PushBack(std::string{ "String" });
+				const auto indices{ datum.FindAll(std::string{ "String" }) };
+				Assert::AreEqual(std::size_t{ 2 }, indices.Size());
+				Assert::AreEqual(std::size_t{ 2 }, indices[1]);
+			}
+
+			{
+				Datum datum{ Datum::DatumTypes::Vector };
+				datum.PushBack(glm::vec4{ 1,1,1,1 });
+				datum.PushBack(glm::vec4{ 1,1,1,0 });
+				datum.PushBack(glm::vec4{ 1,1,1,1 });
+				const auto indices{ datum.FindAll(glm::vec4{ 1,1,1,1 }) };
+				Assert::AreEqual(std::size_t{ 2 }, indices.Size());
+				Assert::AreEqual(std::size_t{ 0 }, indices[0]);
+				Assert::AreEqual(std::size_t{ 2 }, indices[1]);
+				Assert::AreEqual(std::size_t{ 1 }, datum.Find(glm::vec4{ 1,1,1,0 }));
+			}
+
+			{
+				Datum datum{ Datum::DatumTypes::Matrix };
+				datum.PushBack(glm::mat4{ 2 });
+				datum.PushBack(glm::mat4{ 1 });
+				datum.PushBack(glm::mat4{ 1 });
+				const auto indices{ datum.FindAll(glm::mat4{ 1 }) };
+				Assert::AreEqual(std::size_t{ 2 }, indices.Size());
+				Assert::AreEqual(std::size_t{ 1 }, indices[0]);
+				Assert::AreEqual(std::size_t{ 2 }, indices[1]);
+			}
+
+			{
+				Foo foo{};
+				Foo otherFoo{ 1 };
+				RTTI* fooPointer{ &foo };
+				RTTI* fooPointer2{ &otherFoo };
+				Datum datum{ Datum::DatumTypes::Pointer };
+				datum.PushBack(fooPointer2);
+				datum.PushBack(fooPointer);
+				datum.PushBack(fooPointer2);
+				datum.PushBack(fooPointer);
+				datum.PushBack(fooPointer);
+				const auto indices{ datum.FindAll(fooPointer) };
+				Assert::AreEqual(std::size_t{ 3 }, indices.Size());
+				Assert::AreEqual(std::size_t{ 1 }, indices[0]);
+				Assert::AreEqual(std::size_t{ 4 }, indices[2]);
+				Assert::AreEqual(std::size_t{ 1 }, datum.Find(fooPointer));
+			}
+		}
+
+		TEST_METHOD(CopyOnWrite)
+		{
+			{
+				Datum datum{ Datum::DatumTypes::Integer };
+				for (int index{ 0 }; index < 20; ++index)
+				{
+					datum.PushBack(index);
+				}
+				Datum copy{ datum };
+				Assert::IsFalse(copy.IsShared());
+				Assert::IsFalse(copy.IsCopyOnWrite());
+
+				datum.SetCopyOnWrite(true);
+				Datum shared{ datum };
+				Assert::IsTrue(shared.IsCopyOnWrite());
+				Assert::IsTrue(datum.IsShared());
+				Assert::IsTrue(shared.IsShared());
+				Assert::IsTrue(std::as_const(datum).AsSpan<int>().data() == std::as_const(shared).AsSpan<int>().data());
+				Assert::IsTrue(datum == shared);
+
+				shared.Set(100, 3);
+				Assert::IsFalse(datum.IsShared());
+				Assert::IsFalse(shared.IsShared());
+				Assert::AreEqual(3, datum.GetAsInt(3));
+				Assert::AreEqual(100, shared.GetAsInt(3));
+
+				copy = datum;
+				Assert::IsTrue(copy.IsShared());
+				copy.PushBack(20);
+				Assert::AreEqual(std::size_t{ 20 }, datum.Size());
+				Assert::AreEqual(std::size_t{ 21 }, copy.Size());
+				Assert::IsFalse(datum.IsShared());
+
+				Datum moved{ Datum::DatumTypes::Integer };
+				moved = datum;
+				Datum destination{ std::move(moved) };
+				Assert::IsTrue(destination.IsShared());
+				destination.SetCopyOnWrite(false);
+				Assert::IsFalse(destination.IsShared());
+				Assert::IsFalse(datum.IsShared());
+				Assert::IsTrue(datum == destination);
+			}
+
+			{
+				Datum datum{ Datum::DatumTypes::String };
+				datum.SetCopyOnWrite(true);
+				datum.PushBack(std::string{ "a string long enough to be stored on the heap" });
+				datum.PushBack(std::string{ "another string long enough to be stored on the heap" });
+				{
+					Datum first{ datum };
+					Datum second{ Datum::DatumTypes::String };
+					second = first;
+					Assert::IsTrue(second.IsShared());
+
+					second.GetAsString(1) = "changed";
+					Assert::AreEqual(std::string{ "another string long enough to be stored on the heap" }, std::as_const(datum).GetAsString(1));
+					Assert::AreEqual(std::string{ "changed" }, second.GetAsString(1));
+					Assert::IsTrue(first.IsShared());
+
+					first.Clear();
+					Assert::AreEqual(std::size_t{ 0 }, first.Size());
+					Assert::AreEqual(std::size_t{ 2 }, datum.Size());
+					Assert::IsFalse(datum.IsShared());
+				}
+
+				Datum copy{ datum };
+				copy.PopBack();
+				Assert::AreEqual(std::size_t{ 2 }, datum.Size());
+				Assert::AreEqual(std::string{ "a string long enough to be stored on the heap" }, copy.BackAsString());
+			}
+
+			{
+				Datum datum{ Datum::DatumTypes::Vector };
+				datum.SetCopyOnWrite(true);
+				datum.PushBack(glm::vec4{ 1.0f });
+				Datum copy{ datum };
+				Assert::IsTrue(datum.IsInline());
+				Assert::IsFalse(copy.IsShared());
+				Assert::IsTrue(copy.IsCopyOnWrite());
+
+				copy.PushBack(glm::vec4{ 2.0f });
+				Datum shared{ copy };
+				Assert::IsTrue(shared.IsShared());
+				shared.RemoveAt(0);
+				Assert::AreEqual(std::size_t{ 2 }, copy.Size());
+				Assert::AreEqual(glm::vec4{ 2.0f }, shared.FrontAsVector());
+			}
+		}
+
+		TEST_METHOD(CopyOnWriteFlag)
+		{
+			Datum source{ Datum::DatumTypes::Integer };
+			for (int index{ 0 }; index < 20; ++index)
+			{
+				source.PushBack(index);
+			}
+			Datum plain{ source };
+			source.SetCopyOnWrite(true);
+
+			Datum constructed{ source };
+			Assert::IsTrue(constructed.IsCopyOnWrite());
+			Assert::IsTrue(constructed.IsShared());
+			Datum constructedFromPlain{ plain };
+			Assert::IsFalse(constructedFromPlain.IsCopyOnWrite());
+
+			Datum assigned{ Datum::DatumTypes::Integer };
+			assigned = source;
+			Assert::IsTrue(assigned.IsCopyOnWrite());
+			Assert::IsTrue(assigned.IsShared());
+			Assert::IsTrue(std::as_const(assigned).AsSpan<int>().data() == std::as_const(source).AsSpan<int>().data());
+
+			assigned = plain;
+			Assert::IsFalse(assigned.IsCopyOnWrite());
+			Assert::IsFalse(assigned.IsShared());
+			Assert::IsTrue(std::as_const(assigned).AsSpan<int>().data() != std::as_const(plain).AsSpan<int>().data());
+			Assert::IsTrue(assigned == plain);
+
+			constructed = plain;
+			Assert::IsFalse(constructed.IsCopyOnWrite());
+			Datum copy{ constructed };
+			Assert::IsFalse(copy.IsShared());
+			Assert::IsTrue(std::as_const(copy).AsSpan<int>().data() != std::as_const(constructed).AsSpan<int>().data());
+		}
+
+		TEST_METHOD(MemoryResource)
+		{
+			std::array<std::byte, 4096> buffer{};
+			std::pmr::monotonic_buffer_resource arena{ buffer.data(), buffer.size(), std::pmr::null_memory_resource() };
+			const auto isInArena = [&buffer](const void* pointer)
+			{
+				const std::byte* byte{ static_cast<const std::byte*>(pointer) };
+				return byte >= buffer.data() && byte < buffer.data() + buffer.size();
+			};
+
+			Datum datum{ Datum::DatumTypes::Integer, &arena };
+			Assert::IsTrue(datum.Resource() == &arena);
+			for (int index{ 0 }; index < 50; ++index)
+			{
+				datum.PushBack(index);
+			}
+			Assert::IsTrue(isInArena(std::as_const(datum).AsSpan<int>().data()));
+			Assert::AreEqual(49, datum.GetAsInt(49));
+
+			Datum copy{ datum };
+			Assert::IsNull(copy.Resource());
+			Assert::IsFalse(isInArena(std::as_const(copy).AsSpan<int>().data()));
+			Assert::IsTrue(copy == datum);
+
+			Datum moved{ std::move(datum) };
+			Assert::IsTrue(moved.Resource() == &arena);
+			Assert::IsTrue(isInArena(std::as_const(moved).AsSpan<int>().data()));
+			Assert::AreEqual(49, moved.GetAsInt(49));
+
+			Datum heap{ Datum::DatumTypes::Integer };
+			heap = std::move(moved);
+			Assert::IsNull(heap.Resource());
+			Assert::IsFalse(isInArena(std::as_const(heap).AsSpan<int>().data()));
+			Assert::IsTrue(heap == copy);
+
+			Datum strings{ Datum::DatumTypes::String, &arena };
+			strings.SetCopyOnWrite(true);
+			strings.PushBack(std::string{ "a string long enough to be stored on the heap" });
+			strings.PushBack(std::string{ "short" });
+			Assert::IsTrue(isInArena(std::as_const(strings).AsSpan<std::string>().data()));
+
+			Datum sameArena{ Datum::DatumTypes::String, &arena };
+			sameArena = strings;
+			Assert::IsTrue(sameArena.IsShared());
+
+			Datum otherResource{ strings };
+			Assert::IsFalse(otherResource.IsShared());
+			Assert::IsTrue(otherResource == strings);
+
+			sameArena.PushBack(std::string{ "third" });
+			Assert::IsFalse(strings.IsShared());
+			Assert::IsTrue(isInArena(std::as_const(sameArena).AsSpan<std::string>().data()));
+			Assert::AreEqual(std::string{ "third" }, sameArena.GetAsString(2));
+		}
+
 		TEST_METHOD(RemoveAt)
 		{
 			{
@@ -1873,6 +2140,513 @@ namespace LibraryDesktopTests
 			}
 		}
 
+		TEST_METHOD(ToCharsAndFromChars)
+		{
+			{
+				Datum datum{ Datum::DatumTypes::Integer };
+				datum.PushBack(-42);
+				std::array<char, Datum::CharsBufferSize> buffer;
+				std::to_chars_result written{ datum.ToChars(buffer.data(), buffer.data() + buffer.size()) };
+				Assert::IsTrue(written.ec == std::errc{});
+				Assert::AreEqual(datum.ToString(), std::string{ buffer.data(), written.ptr });
+
+				written = datum.ToChars(buffer.data(), buffer.data() + 2);
+				Assert::IsTrue(written.ec == std::errc::value_too_large);
+
+				const std::string_view text{ " +17 apples" };
+				std::from_chars_result parsed{ datum.FromChars(text.data(), text.data() + text.size()) };
+				Assert::IsTrue(parsed.ec == std::errc{});
+				Assert::AreEqual(17, datum.FrontAsInt());
+				Assert::AreEqual(std::string{ " apples" }, std::string{ parsed.ptr, text.data() + text.size() });
+
+				const std::string_view invalid{ "apples" };
+				parsed = datum.FromChars(invalid.data(), invalid.data() + invalid.size());
+				Assert::IsTrue(parsed.ec == std::errc::invalid_argument);
+				Assert::IsTrue(parsed.ptr == invalid.data());
+				Assert::AreEqual(17, datum.FrontAsInt());
+
+				parsed = datum.PushBackFromChars(text.data(), text.data() + 4);
+				Assert::IsTrue(parsed.ec == std::errc{});
+				Assert::AreEqual(std::size_t{ 2 }, datum.Size());
+				Assert::AreEqual(17, datum.BackAsInt());
+			}
+
+			{
+				Datum datum{ Datum::DatumTypes::Float };
+				datum.PushBack(1.5f);
+				std::array<char, Datum::CharsBufferSize> buffer;
+				const std::to_chars_result written{ datum.ToChars(buffer.data(), buffer.data() + buffer.size()) };
+				Assert::AreEqual(std::string{ "1.500000" }, std::string{ buffer.data(), written.ptr });
+
+				datum.PushBackFromString("2.25");
+				Assert::AreEqual(2.25f, datum.BackAsFloat());
+			}
+
+			{
+				Datum datum{ Datum::DatumTypes::String };
+				datum.PushBack(std::string{ "Hello" });
+				std::array<char, 8> buffer;
+				std::to_chars_result written{ datum.ToChars(buffer.data(), buffer.data() + buffer.size()) };
+				Assert::AreEqual(std::string{ "Hello" }, std::string{ buffer.data(), written.ptr });
+				written = datum.ToChars(buffer.data(), buffer.data() + 3);
+				Assert::IsTrue(written.ec == std::errc::value_too_large);
+
+				const std::string_view text{ "vec4(1, 2, 3, 4)" };
+				const std::from_chars_result parsed{ datum.PushBackFromChars(text.data(), text.data() + text.size()) };
+				Assert::IsTrue(parsed.ptr == text.data() + text.size());
+				Assert::AreEqual(std::string{ text }, datum.BackAsString());
+			}
+
+			{
+				const glm::vec4 value{ -1.5f, 0.0f, 2.25f, 1000.125f };
+				Datum datum{ Datum::DatumTypes::Vector };
+				datum.PushBack(value);
+				std::array<char, Datum::CharsBufferSize> buffer;
+				const std::to_chars_result written{ datum.ToChars(buffer.data(), buffer.data() + buffer.size()) };
+				Assert::AreEqual(glm::to_string(value), std::string{ buffer.data(), written.ptr });
+
+				Datum copy{ Datum::DatumTypes::Vector };
+				Assert::IsTrue(copy.PushBackFromChars(buffer.data(), written.ptr).ec == std::errc{});
+				Assert::AreEqual(value, copy.FrontAsVector());
+
+				const std::string_view spaced{ "  vec4 ( 1,2 ,  3 , 4 )" };
+				const std::from_chars_result parsed{ copy.FromChars(spaced.data(), spaced.data() + spaced.size()) };
+				Assert::IsTrue(parsed.ec == std::errc{});
+				Assert::IsTrue(parsed.ptr == spaced.data() + spaced.size());
+				Assert::AreEqual(glm::vec4{ 1, 2, 3, 4 }, copy.FrontAsVector());
+
+				const std::string_view truncated{ "vec4(1, 2, 3)" };
+				Assert::IsTrue(copy.FromChars(truncated.data(), truncated.data() + truncated.size()).ec == std::errc::invalid_argument);
+				Assert::AreEqual(glm::vec4{ 1, 2, 3, 4 }, copy.FrontAsVector());
+
+				Assert::IsTrue(datum.ToChars(buffer.data(), buffer.data() + 10).ec == std::errc::value_too_large);
+			}
+
+			{
+				const glm::mat4 value{ glm::vec4{ 1, 2, 3, 4 }, glm::vec4{ -5, 6, 7, 8 }, glm::vec4{ 9, 10.5f, 11, 12 }, glm::vec4{ 13, 14, 15, -16.75f } };
+				Datum datum{ Datum::DatumTypes::Matrix };
+				datum.PushBack(value);
+				std::array<char, Datum::CharsBufferSize> buffer;
+				const std::to_chars_result written{ datum.ToChars(buffer.data(), buffer.data() + buffer.size()) };
+				Assert::AreEqual(glm::to_string(value), std::string{ buffer.data(), written.ptr });
+
+				glm::mat4 parsed{};
+				Assert::IsTrue(Datum::Parse(buffer.data(), written.ptr, parsed).ec == std::errc{});
+				Assert::AreEqual(value, parsed);
+
+				const std::string_view invalid{ "mat4x4((1, 2, 3, 4), (5, 6, 7, 8))" };
+				Assert::IsTrue(Datum::Parse(invalid.data(), invalid.data() + invalid.size(), parsed).ec == std::errc::invalid_argument);
+				Assert::AreEqual(value, parsed);
+			}
+		}
+
+		TEST_METHOD(AsSpan)
+		{
+			{
+				Datum datum{ Datum::DatumTypes::Integer };
+				Assert::IsTrue(datum.AsSpan<int>().empty());
+
+				const int values[]{ 1, 2, 3, 4, 5 };
+				datum.Append(std::span<const int>{ values });
+				std::span<int> span{ datum.AsSpan<int>() };
+				Assert::AreEqual(std::size_t{ 5 }, span.size());
+				for (int& value : span)
+				{
+					value *= 2;
+				}
+				Assert::AreEqual(2, datum.FrontAsInt());
+				Assert::AreEqual(10, datum.BackAsInt());
+
+				const Datum& constDatum{ datum };
+				std::span<const int> constSpan{ constDatum.AsSpan<int>() };
+				Assert::AreEqual(30, std::accumulate(constSpan.begin(), constSpan.end(), 0));
+			}
+
+			{
+				Datum datum;
+				datum = 1.5f;
+				Assert::AreEqual(1.5f, datum.AsSpan<float>()[0]);
+
+				Datum strings;
+				strings.PushBack(std::string{ "String1" });
+				strings.PushBack(std::string{ "String2" });
+				Assert::AreEqual(std::string{ "String2" }, strings.AsSpan<std::string>().back());
+
+				Datum vectors;
+				vectors = glm::vec4{ 1,2,3,4 };
+				Assert::AreEqual(glm::vec4{ 1,2,3,4 }, vectors.AsSpan<glm::vec4>().front());
+
+				Datum matrices;
+				matrices = glm::mat4{ 2 };
+				Assert::AreEqual(glm::mat4{ 2 }, matrices.AsSpan<glm::mat4>().front());
+
+				Foo foo{ 1 };
+				Datum pointers{ Datum::DatumTypes::Pointer };
+				pointers.PushBack(&foo);
+				Assert::IsTrue(pointers.AsSpan<RTTI*>().front() == &foo);
+			}
+
+			{
+				glm::vec4 external[]{ glm::vec4{ 1 }, glm::vec4{ 2 } };
+				Datum datum;
+				datum.SetStorage(external, 2);
+				Assert::IsTrue(datum.AsSpan<glm::vec4>().data() == external);
+				Assert::AreEqual(std::size_t{ 2 }, datum.AsSpan<glm::vec4>().size());
+			}
+		}
+
+		TEST_METHOD(Growth)
+		{
+			Datum datum{ Datum::DatumTypes::Integer };
+			datum.PushBack(0);
+			Assert::AreEqual(std::size_t{ 4 }, datum.Capacity());
+
+			std::size_t reallocations{ 0 };
+			std::size_t capacity{ datum.Capacity() };
+			for (int value{ 1 }; value < 1000; ++value)
+			{
+				datum.PushBack(value);
+				if (datum.Capacity() != capacity)
+				{
+					capacity = datum.Capacity();
+					++reallocations;
+				}
+			}
+			Assert::AreEqual(std::size_t{ 1000 }, datum.Size());
+			Assert::IsTrue(reallocations < 20);
+			Assert::AreEqual(999, datum.BackAsInt());
+		}
+
+		TEST_METHOD(Append)
+		{
+			{
+				const int values[]{ 1, 2, 3, 4, 5 };
+				Datum datum;
+				datum.PushBack(0);
+				datum.Append(std::span<const int>{ values });
+				Assert::IsTrue(Datum::DatumTypes::Integer == datum.Type());
+				Assert::AreEqual(std::size_t{ 6 }, datum.Size());
+				Assert::AreEqual(0, datum.FrontAsInt());
+				Assert::AreEqual(5, datum.BackAsInt());
+
+				datum.Append(std::span<const int>{});
+				Assert::AreEqual(std::size_t{ 6 }, datum.Size());
+			}
+
+			{
+				const float values[]{ 1.5f, 2.5f };
+				Datum datum;
+				datum.Append(std::span<const float>{ values });
+				Assert::IsTrue(Datum::DatumTypes::Float == datum.Type());
+				Assert::AreEqual(2.5f, datum.BackAsFloat());
+			}
+
+			{
+				const std::vector<std::string> values{ "String1", "String2", "String3" };
+				Datum datum;
+				datum.PushBack(std::string{ "String0" });
+				datum.Append(values);
+				Assert::AreEqual(std::size_t{ 4 }, datum.Size());
+				Assert::AreEqual(std::string{ "String0" }, datum.FrontAsString());
+				Assert::AreEqual(std::string{ "String3" }, datum.BackAsString());
+			}
+
+			{
+				const glm::vec4 values[]{ glm::vec4{ 1 }, glm::vec4{ 2 } };
+				Datum datum;
+				datum.Append(std::span<const glm::vec4>{ values });
+				Assert::AreEqual(std::size_t{ 2 }, datum.Size());
+				Assert::AreEqual(glm::vec4{ 2 }, datum.BackAsVector());
+			}
+
+			{
+				const glm::mat4 values[]{ glm::mat4{ 1 }, glm::mat4{ 2 } };
+				Datum datum;
+				datum.Append(std::span<const glm::mat4>{ values });
+				Assert::AreEqual(std::size_t{ 2 }, datum.Size());
+				Assert::AreEqual(glm::mat4{ 2 }, datum.BackAsMatrix());
+			}
+
+			{
+				int external[]{ 1, 2 };
+				const int values[]{ 3 };
+				Datum datum;
+				datum.SetStorage(external, 2);
+				datum.Append(std::span<const int>{ values });
+				Assert::AreEqual(std::size_t{ 2 }, datum.Size());
+			}
+		}
+
+		TEST_METHOD(AppendToItself)
+		{
+			{
+				Datum datum{ Datum::DatumTypes::Integer };
+				for (int index{ 0 }; index < 10; ++index)
+				{
+					datum.PushBack(index);
+				}
+				datum.ShrinkToFit();
+				Assert::AreEqual(datum.Size(), datum.Capacity());
+
+				datum.Append(std::as_const(datum).AsSpan<int>());
+				Assert::AreEqual(std::size_t{ 20 }, datum.Size());
+				for (int index{ 0 }; index < 20; ++index)
+				{
+					Assert::AreEqual(index % 10, datum.GetAsInt(index));
+				}
+
+				datum.ShrinkToFit();
+				datum.Append(std::as_const(datum).AsSpan<int>().subspan(15, 3));
+				Assert::AreEqual(std::size_t{ 23 }, datum.Size());
+				Assert::AreEqual(5, datum.GetAsInt(20));
+				Assert::AreEqual(7, datum.BackAsInt());
+			}
+
+			{
+				Datum datum{ Datum::DatumTypes::String };
+				datum.PushBack(std::string{ "a string long enough to be stored on the heap" });
+				datum.PushBack(std::string{ "another string long enough to be stored on the heap" });
+				datum.ShrinkToFit();
+				Assert::AreEqual(datum.Size(), datum.Capacity());
+
+				datum.Append(std::as_const(datum).AsSpan<std::string>());
+				Assert::AreEqual(std::size_t{ 4 }, datum.Size());
+				Assert::AreEqual(std::string{ "a string long enough to be stored on the heap" }, datum.GetAsString(2));
+				Assert::AreEqual(std::string{ "another string long enough to be stored on the heap" }, datum.BackAsString());
+			}
+
+			{
+				Datum datum{ Datum::DatumTypes::Integer };
+				datum.SetCopyOnWrite(true);
+				for (int index{ 0 }; index < 10; ++index)
+				{
+					datum.PushBack(index);
+				}
+				Datum shared{ datum };
+				datum.Append(std::as_const(datum).AsSpan<int>());
+				Assert::AreEqual(std::size_t{ 20 }, datum.Size());
+				Assert::AreEqual(9, datum.BackAsInt());
+				Assert::AreEqual(std::size_t{ 10 }, shared.Size());
+			}
+		}
+
+		TEST_METHOD(SetRangeAndCopyTo)
+		{
+			{
+				Datum datum{ Datum::DatumTypes::Integer };
+				datum.Resize(5);
+				const int values[]{ 7, 8, 9 };
+				datum.SetRange(std::span<const int>{ values }, 1);
+				Assert::AreEqual(0, datum.FrontAsInt());
+				Assert::AreEqual(7, datum.GetAsInt(1));
+				Assert::AreEqual(9, datum.GetAsInt(3));
+				Assert::AreEqual(0, datum.BackAsInt());
+
+				int destination[4]{};
+				Assert::AreEqual(std::size_t{ 4 }, datum.CopyTo(std::span<int>{ destination }));
+				Assert::AreEqual(8, destination[2]);
+				Assert::AreEqual(std::size_t{ 2 }, datum.CopyTo(std::span<int>{ destination }, 3));
+				Assert::AreEqual(9, destination[0]);
+				Assert::AreEqual(0, destination[1]);
+				Assert::AreEqual(std::size_t{ 0 }, datum.CopyTo(std::span<int>{ destination }, 5));
+			}
+
+			{
+				Datum datum{ Datum::DatumTypes::String };
+				datum.Resize(2);
+				const std::string values[]{ "String1", "String2" };
+				datum.SetRange(std::span<const std::string>{ values });
+				Assert::AreEqual(std::string{ "String2" }, datum.BackAsString());
+
+				std::string destination[3];
+				Assert::AreEqual(std::size_t{ 2 }, datum.CopyTo(std::span<std::string>{ destination }));
+				Assert::AreEqual(std::string{ "String1" }, destination[0]);
+				Assert::AreEqual(std::string{}, destination[2]);
+			}
+
+			{
+				float external[3]{};
+				Datum datum;
+				datum.SetStorage(external, 3);
+				const float values[]{ 1.5f, 2.5f };
+				datum.SetRange(std::span<const float>{ values }, 1);
+				Assert::AreEqual(2.5f, external[2]);
+
+				Datum payload;
+				payload.PushBack(4.5f);
+				payload.PushBack(5.5f);
+				Assert::AreEqual(std::size_t{ 2 }, payload.CopyTo(datum));
+				Assert::AreEqual(4.5f, external[0]);
+				Assert::AreEqual(5.5f, external[1]);
+				Assert::AreEqual(2.5f, external[2]);
+			}
+
+			{
+				Datum datum{ Datum::DatumTypes::Vector };
+				datum.Resize(2);
+				const glm::vec4 values[]{ glm::vec4{ 1 }, glm::vec4{ 2 } };
+				datum.SetRange(std::span<const glm::vec4>{ values });
+				glm::vec4 destination[2];
+				datum.CopyTo(std::span<glm::vec4>{ destination });
+				Assert::AreEqual(glm::vec4{ 2 }, destination[1]);
+
+				Datum matrices{ Datum::DatumTypes::Matrix };
+				matrices.Resize(1);
+				const glm::mat4 matrix{ 3 };
+				matrices.SetRange(std::span<const glm::mat4>{ &matrix, 1 });
+				glm::mat4 copy{};
+				matrices.CopyTo(std::span<glm::mat4>{ &copy, 1 });
+				Assert::AreEqual(matrix, copy);
+			}
+		}
+
+		TEST_METHOD(InlineStorage)
+		{
+			{
+				Datum datum;
+				datum = 5;
+				Assert::IsTrue(datum.IsInline());
+				Assert::AreEqual(5, datum.FrontAsInt());
+
+				datum.PushBack(6);
+				datum.PushBack(7);
+				datum.PushBack(8);
+				Assert::IsTrue(datum.IsInline());
+
+				datum.PushBack(9);
+				Assert::IsFalse(datum.IsInline());
+				Assert::AreEqual(5, datum.FrontAsInt());
+				Assert::AreEqual(9, datum.BackAsInt());
+
+				datum.Resize(2);
+				Assert::IsTrue(datum.IsInline());
+				Assert::AreEqual(std::size_t{ 2 }, datum.Capacity());
+				Assert::AreEqual(5, datum.FrontAsInt());
+				Assert::AreEqual(6, datum.BackAsInt());
+			}
+
+			{
+				Datum datum;
+				datum = glm::vec4{ 1,2,3,4 };
+				Assert::IsTrue(datum.IsInline());
+
+				Datum copy{ datum };
+				Assert::IsTrue(copy.IsInline());
+				Assert::AreEqual(glm::vec4{ 1,2,3,4 }, copy.FrontAsVector());
+
+				Datum moved{ std::move(datum) };
+				Assert::IsTrue(moved.IsInline());
+				Assert::AreEqual(glm::vec4{ 1,2,3,4 }, moved.FrontAsVector());
+				Assert::AreEqual(std::size_t{ 0 }, datum.Size());
+
+				Datum assigned;
+				assigned = std::move(moved);
+				Assert::IsTrue(assigned.IsInline());
+				Assert::AreEqual(glm::vec4{ 1,2,3,4 }, assigned.FrontAsVector());
+
+				assigned = glm::vec4{ 5,6,7,8 };
+				Assert::AreEqual(glm::vec4{ 5,6,7,8 }, assigned.FrontAsVector());
+			}
+
+			{
+				Datum datum;
+				datum = glm::mat4{ 1 };
+				Assert::IsFalse(datum.IsInline());
+
+				Datum stringDatum;
+				stringDatum = std::string{ "String" };
+				Assert::IsFalse(stringDatum.IsInline());
+			}
+		}
+
+		TEST_METHOD(ExtendedTypes)
+		{
+			{
+				Datum datum;
+				datum = std::int64_t{ 5'000'000'000 };
+				Assert::AreEqual(true, Datum::DatumTypes::Int64 == datum.Type());
+				datum.PushBack(std::int64_t{ -7 });
+				datum.PushBack(std::int64_t{ 5'000'000'000 });
+				Assert::AreEqual(std::int64_t{ 5'000'000'000 }, datum.FrontAsInt64());
+				Assert::AreEqual(std::int64_t{ -7 }, datum.GetAsInt64(1));
+				Assert::AreEqual(std::size_t{ 1 }, datum.Find(std::int64_t{ -7 }));
+				Assert::AreEqual(std::size_t{ 2 }, datum.FindAll(std::int64_t{ 5'000'000'000 }).Size());
+				Assert::AreEqual(std::string{ "5000000000" }, datum.ToString());
+				datum.SetFromString("-9000000000", 1);
+				Assert::AreEqual(std::int64_t{ -9'000'000'000 }, datum.GetAsInt64(1));
+				datum.Remove(std::int64_t{ -9'000'000'000 });
+				Assert::AreEqual(std::size_t{ 2 }, datum.Size());
+			}
+
+			{
+				Datum datum;
+				datum = 0.1;
+				Assert::AreEqual(true, Datum::DatumTypes::Double == datum.Type());
+				datum.PushBack(1.0 / 3.0);
+				Assert::AreEqual(std::string{ "0.1" }, datum.ToString());
+				Datum copy{ Datum::DatumTypes::Double };
+				copy.PushBackFromString(datum.ToString(1));
+				Assert::AreEqual(1.0 / 3.0, copy.FrontAsDouble());
+				Assert::AreEqual(std::size_t{ 1 }, datum.Find(1.0 / 3.0));
+				datum.Remove(0.1);
+				Assert::AreEqual(1.0 / 3.0, datum.FrontAsDouble());
+			}
+
+			{
+				Datum datum;
+				datum = true;
+				Assert::AreEqual(true, Datum::DatumTypes::Bool == datum.Type());
+				datum.PushBack(false);
+				datum.PushBack(true);
+				Assert::IsTrue(datum.FrontAsBool());
+				Assert::IsFalse(datum.GetAsBool(1));
+				datum.GetAsBool(1) = true;
+				Assert::AreEqual(std::size_t{ 3 }, datum.FindAll(true).Size());
+				Assert::AreEqual(datum.Size(), datum.Find(false));
+				Assert::AreEqual(std::string{ "true" }, datum.ToString());
+				datum.SetFromString("false", 2);
+				Assert::IsFalse(datum.BackAsBool());
+				Assert::AreEqual(std::size_t{ 3 }, datum.AsSpan<bool>().size());
+				Assert::IsTrue(datum == datum);
+
+				Datum text;
+				text = "true";
+				Assert::AreEqual(true, Datum::DatumTypes::String == text.Type());
+			}
+
+			{
+				Datum datum;
+				datum = glm::vec2{ 1.5f, -2.0f };
+				Assert::AreEqual(true, Datum::DatumTypes::Vector2 == datum.Type());
+				datum.PushBack(glm::vec2{ 3.0f, 4.0f });
+				Assert::AreEqual(std::size_t{ 1 }, datum.Find(glm::vec2{ 3.0f, 4.0f }));
+				Assert::AreEqual(std::string{ "vec2(1.500000, -2.000000)" }, datum.ToString());
+				datum.SetFromString("vec2(5, 6)", 1);
+				Assert::AreEqual(glm::vec2{ 5.0f, 6.0f }, datum.BackAsVector2());
+			}
+
+			{
+				Datum datum;
+				datum = glm::vec3{ 1.0f, 2.0f, 3.0f };
+				Assert::AreEqual(true, Datum::DatumTypes::Vector3 == datum.Type());
+				Assert::AreEqual(std::string{ "vec3(1.000000, 2.000000, 3.000000)" }, datum.ToString());
+				datum.PushBackFromString("vec3(4, 5, 6)");
+				Assert::AreEqual(glm::vec3{ 4.0f, 5.0f, 6.0f }, datum.BackAsVector3());
+				datum.Remove(glm::vec3{ 1.0f, 2.0f, 3.0f });
+				Assert::AreEqual(glm::vec3{ 4.0f, 5.0f, 6.0f }, datum.FrontAsVector3());
+			}
+
+			{
+				Datum datum;
+				datum = glm::quat{ 1.0f, 0.0f, 0.5f, 0.25f };
+				Assert::AreEqual(true, Datum::DatumTypes::Quaternion == datum.Type());
+				Assert::AreEqual(std::string{ "quat(1.000000, {0.000000, 0.500000, 0.250000})" }, datum.ToString());
+				datum.PushBackFromString(datum.ToString());
+				Assert::AreEqual(datum.FrontAsQuaternion(), datum.BackAsQuaternion());
+				Assert::AreEqual(std::size_t{ 0 }, datum.Find(glm::quat{ 1.0f, 0.0f, 0.5f, 0.25f }));
+			}
+		}
+
 	private:
 		inline static _CrtMemState _startMemState;
 	};
@@ -0,0 +1,116 @@
+#include "pch.h"
+#include "ToStringSpecializations.h"
+#include "CppUnitTest.h"
+#include <crtdbg.h>
+#include <cstddef>
+#include <cstdint>
+#include "FreeListAllocator.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+
+namespace
+{
+	struct alignas(64) Aligned final
+	{
+		std::byte data[64];
+	};
+}
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(FreeListAllocatorTests)
+	{
+	public:
+
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(Recycling)
+		{
+			FreeListAllocator<double> allocator;
+			double* first{ allocator.allocate(1) };
+			double* second{ allocator.allocate(1) };
+			Assert::AreEqual(std::size_t{ 0 }, allocator.CachedCount());
+
+			allocator.deallocate(first, 1);
+			allocator.deallocate(second, 1);
+			Assert::AreEqual(std::size_t{ 2 }, allocator.CachedCount());
+			Assert::IsTrue(second == allocator.allocate(1));
+			Assert::IsTrue(first == allocator.allocate(1));
+			Assert::AreEqual(std::size_t{ 0 }, allocator.CachedCount());
+
+			double* array{ allocator.allocate(4) };
+			allocator.deallocate(array, 4);
+			Assert::AreEqual(std::size_t{ 0 }, allocator.CachedCount());
+
+			allocator.deallocate(first, 1);
+			allocator.deallocate(second, 1);
+			allocator.Release();
+			Assert::AreEqual(std::size_t{ 0 }, allocator.CachedCount());
+		}
+
+		TEST_METHOD(CopyAndMove)
+		{
+			FreeListAllocator<double> allocator;
+			allocator.deallocate(allocator.allocate(1), 1);
+
+			FreeListAllocator<double> copy{ allocator };
+			FreeListAllocator<char> rebound{ allocator };
+			Assert::AreEqual(std::size_t{ 0 }, copy.CachedCount());
+			Assert::IsTrue(copy == allocator);
+			Assert::IsTrue(rebound == allocator);
+
+			FreeListAllocator<double> moved{ std::move(allocator) };
+			Assert::AreEqual(std::size_t{ 1 }, moved.CachedCount());
+#pragma warning(push)
+#pragma warning(disable : 26800)
+			Assert::AreEqual(std::size_t{ 0 }, allocator.CachedCount());
+#pragma warning(pop)
+
+			copy.deallocate(moved.allocate(1), 1);
+			Assert::AreEqual(std::size_t{ 1 }, copy.CachedCount());
+			moved = std::move(copy);
+			Assert::AreEqual(std::size_t{ 1 }, moved.CachedCount());
+
+			char* character{ rebound.allocate(1) };
+			rebound.deallocate(character, 1);
+			Assert::AreEqual(std::size_t{ 0 }, rebound.CachedCount());
+		}
+
+		TEST_METHOD(OverAligned)
+		{
+			FreeListAllocator<Aligned> allocator;
+			Aligned* first{ allocator.allocate(1) };
+			Aligned* array{ allocator.allocate(3) };
+			Assert::AreEqual(std::uintptr_t{ 0 }, reinterpret_cast<std::uintptr_t>(first) % alignof(Aligned));
+			Assert::AreEqual(std::uintptr_t{ 0 }, reinterpret_cast<std::uintptr_t>(array) % alignof(Aligned));
+
+			allocator.deallocate(array, 3);
+			allocator.deallocate(first, 1);
+			Assert::IsTrue(first == allocator.allocate(1));
+			allocator.deallocate(first, 1);
+		}
+
+	private:
+		inline static _CrtMemState _startMemState;
+	};
+}
@@ -18,6 +18,11 @@ bool BarEquality(const Bar& lhs, const Bar& rhs)
 	return lhs.Data() == rhs.Data();
 }
 
+std::size_t IdentityHash(const int& key)
+{
+	return static_cast<std::size_t>(key);
+}
+
 namespace LibraryDesktopTests
 {
 	TEST_CLASS(HashMapTests)
@@ -63,7 +68,7 @@ namespace LibraryDesktopTests
 			}
 
 			{
-				HashMap<int, Foo> map{};
+				HashMap<int, Foo> map{ IdentityHash };
 				map.Insert(std::pair(0, Foo{1}));
 				map.Insert(std::pair(1, Foo{2}));
 				map.Insert(std::pair(6, Foo{3}));
@@ -144,21 +149,41 @@ namespace LibraryDesktopTests
 		TEST_METHOD(Hash)
 		{
 			{
-				const int a{ 7 };
 				auto hashFunctor = DefaultHash<int>{};
-				Assert::AreEqual(std::size_t{ 7 }, hashFunctor(a));
+				Assert::AreEqual(hashFunctor(7), hashFunctor(7));
+				Assert::AreNotEqual(hashFunctor(7), hashFunctor(8));
+				Assert::AreNotEqual(hashFunctor(0), hashFunctor(1));
 			}
 
 			{
 				const char* string{ "MyString" };
-				auto hashFunctor = DefaultHash<char>{};
-				Assert::AreEqual(std::size_t{ 77 + 121 + 83 + 116 + 114 + 105 + 110 + 103 }, hashFunctor(string));
+				const std::string stdString{ "MyString" };
+				auto charHash = DefaultHash<char>{};
+				auto stringHash = DefaultHash<std::string>{};
+				auto pointerHash = DefaultHash<const char*>{};
+				Assert::AreEqual(stringHash(stdString), charHash(string));
+				Assert::AreEqual(stringHash(stdString), pointerHash(string));
+				Assert::AreEqual(stringHash(std::string{ "MyString" }), stringHash(stdString));
 			}
 
 			{
-				const std::string string {"MyString"};
 				auto hashFunctor = DefaultHash<std::string>{};
-				Assert::AreEqual(std::size_t{ 77 + 121 + 83 + 116 + 114 + 105 + 110 + 103 }, hashFunctor(string));
+				Assert::AreNotEqual(hashFunctor("Name"), hashFunctor("Mane"));
+				Assert::AreNotEqual(hashFunctor("ab"), hashFunctor("ba"));
+				Assert::AreNotEqual(hashFunctor(""), hashFunctor(std::string(1, '\0')));
+				Assert::AreNotEqual(hashFunctor("AttributeNameLongerThanSixteen"), hashFunctor("AttributeNameLongerThanSixteeN"));
+				Assert::AreNotEqual(hashFunctor(std::string(100, 'a')), hashFunctor(std::string(101, 'a')));
+			}
+
+			{
+				struct Point final
+				{
+					std::int32_t x;
+					std::int32_t y;
+				};
+				auto hashFunctor = DefaultHash<Point>{};
+				Assert::AreEqual(hashFunctor(Point{ 1, 2 }), hashFunctor(Point{ 1, 2 }));
+				Assert::AreNotEqual(hashFunctor(Point{ 1, 2 }), hashFunctor(Point{ 2, 1 }));
 			}
 
 			{
@@ -173,7 +198,7 @@ namespace LibraryDesktopTests
 		TEST_METHOD(Iterators)
 		{
 			{
-				HashMap<int, Foo> map{10};
+				HashMap<int, Foo> map{ 10, IdentityHash };
 				map.Insert(std::pair(0, Foo{}));
 				map.Insert(std::pair(0, Foo{}));
 				map.Insert(std::pair(0, Foo{}));
@@ -244,7 +269,7 @@ namespace LibraryDesktopTests
 			}
 
 			{
-				HashMap<int, Foo> map{10};
+				HashMap<int, Foo> map{ 10, IdentityHash };
 				map.Insert(std::pair(1, Foo{}));
 				map.Insert(std::pair(6, Foo{}));
 				map.Insert(std::pair(61, Foo{ 1 }));
@@ -287,7 +312,7 @@ namespace LibraryDesktopTests
 
 		TEST_METHOD(Find)
 		{
-			HashMap<int, Foo> map{10};
+			HashMap<int, Foo> map{ 10, IdentityHash };
 			map.Insert(std::pair(7, Foo{}));
 			map.Insert(std::pair(0, Foo{}));
 			map.Insert(std::pair(10, Foo{}));
@@ -324,6 +349,45 @@ namespace LibraryDesktopTests
 			Assert::AreEqual(std::size_t{ 5 }, map.Size());
 		}
 
+		TEST_METHOD(Growth)
+		{
+			HashMap<int, int> map{};
+			Assert::AreEqual(1.0f, map.max_load_factor());
+
+			for (int key{ 0 }; key < 500; ++key)
+			{
+				map.Insert(std::pair(key, key));
+			}
+			int* address{ &map.At(250) };
+			Assert::AreEqual(std::size_t{ 500 }, map.Size());
+			Assert::IsTrue(map.GetLoadFactor() <= 1.0f);
+
+			map.max_load_factor(0.5f);
+			Assert::IsTrue(map.GetLoadFactor() <= 0.5f);
+			Assert::IsTrue(address == &map.At(250));
+			for (int key{ 0 }; key < 500; ++key)
+			{
+				Assert::AreEqual(key, map.At(key));
+			}
+		}
+
+		TEST_METHOD(Reserve)
+		{
+			HashMap<int, Foo> map{};
+			map.Reserve(100);
+			float loadFactor{ map.GetLoadFactor() };
+			for (int key{ 0 }; key < 100; ++key)
+			{
+				map.Insert(std::pair(key, Foo{ key }));
+			}
+			Assert::IsTrue(map.GetLoadFactor() > loadFactor);
+			Assert::IsTrue(map.GetLoadFactor() <= 1.0f);
+
+			map.Reserve(10);
+			Assert::AreEqual(std::size_t{ 100 }, map.Size());
+			Assert::AreEqual(Foo{ 42 }, map.At(42));
+		}
+
 		TEST_METHOD(At)
 		{
 			HashMap<int, Foo> map{};
@@ -390,6 +454,49 @@ namespace LibraryDesktopTests
 			Assert::AreEqual(3, map.At("three"));
 		}
 
+		TEST_METHOD(HeterogeneousLookup)
+		{
+			using namespace std::string_literals;
+			HashMap<std::string, int> map{};
+			map.Insert(std::pair("one"s, 1));
+			map.Insert(std::pair("two"s, 2));
+			map.Insert(std::pair("three"s, 3));
+
+			std::string_view expression{ "one two three four" };
+			Assert::AreEqual(1, map.At(expression.substr(0, 3)));
+			Assert::AreEqual(2, map.At(expression.substr(4, 3)));
+			Assert::IsTrue(map.ContainsKey(expression.substr(8, 5)));
+			Assert::IsFalse(map.ContainsKey(expression.substr(14)));
+			Assert::IsTrue(map.Find(expression.substr(14)) == map.end());
+			Assert::AreEqual(3, map.Find("three")->second);
+
+			const HashMap<std::string, int>& constMap{ map };
+			Assert::AreEqual(2, constMap.At(std::string_view{ "two" }));
+			Assert::IsTrue(constMap.Find(std::string_view{ "four" }) == constMap.end());
+
+			map.Remove(expression.substr(0, 3));
+			Assert::AreEqual(std::size_t{ 2 }, map.Size());
+			Assert::IsFalse(map.ContainsKey("one"));
+
+			auto caseInsensitive = [](const std::string& key)
+			{
+				std::size_t hash{ 0 };
+				for (char character : key)
+				{
+					hash += static_cast<std::size_t>(std::tolower(static_cast<unsigned char>(character)));
+				}
+				return hash;
+			};
+			auto caseInsensitiveEquality = [](const std::string& lhs, const std::string& rhs)
+			{
+				return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), [](char left, char right) { return std::tolower(static_cast<unsigned char>(left)) == std::tolower(static_cast<unsigned char>(right)); });
+			};
+			HashMap<std::string, int> custom{ caseInsensitiveEquality, caseInsensitive };
+			custom.Insert(std::pair("One"s, 1));
+			Assert::AreEqual(1, custom.At(std::string_view{ "ONE" }));
+			Assert::IsTrue(custom.ContainsKey("one"));
+		}
+
 		TEST_METHOD(CStringKey)
 		{
 			HashMap<const char*, int> map{};
@@ -18,9 +18,9 @@ namespace UnitTests
 		_hasUpdated = true;
 	}
 
-	Vector<Signature> Monster::Signatures()
+	SignatureList Monster::Signatures()
 	{
-		return Vector<Signature>
+		return SignatureList
 		{
 			{ "Name", Datum::DatumTypes::String, 1, offsetof(GameObject, _name) },
 			{ "Position", Datum::DatumTypes::Vector, 1, offsetof(GameObject, _position) },
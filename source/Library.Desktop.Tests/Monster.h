@@ -39,7 +39,7 @@ namespace UnitTests
 		void IncreaseHealth(int);
 		void DecreaseHealth(int);
 
-		static FieaGameEngine::Vector<FieaGameEngine::Signature> Signatures();
+		static FieaGameEngine::SignatureList Signatures();
 	};
 
 	ConcreteFactory(Monster, FieaGameEngine::Scope);
@@ -0,0 +1,421 @@
+#include "pch.h"
+#include "ToStringSpecializations.h"
+#include "CppUnitTest.h"
+#include <crtdbg.h>
+#include <memory_resource>
+#include <gsl/gsl>
+#include "OpenHashMap.h"
+#include "Foo.h"
+#include "Bar.h"
+#include "DefaultHash.h"
+#include "UserSuppliedHash.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace UnitTests;
+
+namespace
+{
+	/// <summary>
+	/// Passes allocations on to the global heap, counting them so a test can see when a map allocates.
+	/// </summary>
+	class CountingResource final : public std::pmr::memory_resource
+	{
+	public:
+		std::size_t _allocations{ 0 };
+
+	private:
+		void* do_allocate(std::size_t bytes, std::size_t alignment) override
+		{
+			++_allocations;
+			return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+		}
+
+		void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override
+		{
+			std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+		}
+
+		bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+		{
+			return this == &other;
+		}
+	};
+}
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(OpenHashMapTests)
+	{
+	public:
+
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(Constructor)
+		{
+			{
+				OpenHashMap<int, Foo> map{};
+				Assert::AreEqual(std::size_t{ 0 }, map.Size());
+				Assert::IsTrue(map.begin() == map.end());
+				Assert::IsFalse(map.ContainsKey(7));
+				map.Insert(std::pair<const int, Foo>(7, Foo{}));
+				Assert::AreEqual(Foo{}, map.At(7));
+				Assert::IsTrue(map.ContainsKey(7));
+				map.Clear();
+				Assert::IsFalse(map.ContainsKey(7));
+				map.Insert(std::pair<const int, Foo>(7, Foo{}));
+				Assert::IsTrue(map.ContainsKey(7));
+			}
+
+			{
+				OpenHashMap<int, Foo> map{ 5 };
+				map.Insert(std::pair(0, Foo{ 1 }));
+				map.Insert(std::pair(1, Foo{ 2 }));
+				map.Insert(std::pair(6, Foo{ 3 }));
+
+				OpenHashMap<int, Foo> copy{ map };
+				Assert::AreEqual(std::size_t{ 3 }, copy.Size());
+				Assert::AreEqual(Foo{ 3 }, copy.At(6));
+				Assert::IsTrue(&copy.At(6) != &map.At(6));
+
+				OpenHashMap<int, Foo> assigned{};
+				assigned.Insert(std::pair(99, Foo{ 99 }));
+				assigned = copy;
+				Assert::AreEqual(std::size_t{ 3 }, assigned.Size());
+				Assert::IsFalse(assigned.ContainsKey(99));
+
+				const OpenHashMap<int, Foo> moved{ std::move(copy) };
+				Assert::AreEqual(std::size_t{ 3 }, moved.Size());
+				Assert::AreEqual(Foo{ 1 }, moved.At(0));
+
+				assigned = std::move(map);
+				Assert::AreEqual(Foo{ 2 }, assigned.At(1));
+			}
+
+			{
+				auto barEquality = [](const Bar& lhs, const Bar& rhs) { return lhs.Data() == rhs.Data(); };
+				OpenHashMap<Bar, Foo> barMap{ barEquality, UserHash<Bar>{} };
+				barMap.Insert(std::pair(Bar{}, Foo{}));
+				barMap.Insert(std::pair(Bar{ 1 }, Foo{ 1 }));
+				barMap.Insert(std::pair(Bar{ 2 }, Foo{ 2 }));
+
+				OpenHashMap<Bar, Foo> barMapSized{ 64, barEquality, UserHash<Bar>{} };
+				barMapSized.Insert(std::pair(Bar{}, Foo{}));
+				barMapSized.Insert(std::pair(Bar{ 1 }, Foo{ 1 }));
+				barMapSized.Insert(std::pair(Bar{ 2 }, Foo{ 2 }));
+
+				Assert::AreEqual(Foo{ 2 }, (*barMap.Find(Bar{ 2 })).second);
+				Assert::AreEqual(Foo{ 2 }, (*barMapSized.Find(Bar{ 2 })).second);
+				Assert::IsTrue(barMap.GetLoadFactor() > barMapSized.GetLoadFactor());
+			}
+		}
+
+		TEST_METHOD(InitializerListConstruction)
+		{
+			OpenHashMap<std::string, int> map{ {"String1", 1}, {"String2", 2}, {"String3", 3}, {"String4", 4}, {"String5", 5} };
+
+			Assert::AreEqual(std::size_t{ 5 }, map.Size());
+			Assert::AreEqual(1, map.At("String1"));
+			Assert::AreEqual(3, map.At("String3"));
+			Assert::AreEqual(5, map.At("String5"));
+		}
+
+		TEST_METHOD(Iterators)
+		{
+			OpenHashMap<int, Foo> map{};
+			map.Insert(std::pair(0, Foo{}));
+			map.Insert(std::pair(0, Foo{}));
+			map.Insert(std::pair(1, Foo{}));
+			map.Insert(std::pair(6, Foo{}));
+			map.Insert(std::pair(60, Foo{ 1 }));
+			map.Insert(std::pair(70, Foo{ 1 }));
+
+			std::size_t size{};
+			int keySum{};
+			for (auto iterator = map.begin(); iterator != map.end(); ++iterator)
+			{
+				++size;
+				keySum += iterator->first;
+			}
+			Assert::AreEqual(std::size_t{ 5 }, size);
+			Assert::AreEqual(137, keySum);
+
+			auto found{ map.Find(6) };
+			auto previous{ found++ };
+			Assert::AreEqual(6, previous->first);
+			Assert::IsTrue(previous != found);
+
+			map.Remove(6);
+			map.Remove(88);
+			size = 0;
+			for (auto& pair : map)
+			{
+				Assert::IsTrue(pair.first != 6);
+				++size;
+			}
+			Assert::AreEqual(std::size_t{ 4 }, size);
+
+			auto constIterator{ OpenHashMap<int, Foo>::ConstIterator(map.begin()) };
+			Assert::AreEqual(map.begin()->first, constIterator->first);
+
+			const OpenHashMap<int, Foo> constMap{ map };
+			size = 0;
+			for (auto iterator = constMap.cbegin(); iterator != constMap.cend(); iterator++)
+			{
+				Assert::IsTrue((*iterator).second == Foo{ 1 } || (*iterator).second == Foo{});
+				++size;
+			}
+			Assert::AreEqual(std::size_t{ 4 }, size);
+
+			OpenHashMap<int, Foo>::Iterator defaultIterator{};
+			++defaultIterator;
+			Assert::IsTrue(defaultIterator != map.end());
+		}
+
+		TEST_METHOD(Insert)
+		{
+			auto barEquality = [](const Bar& lhs, const Bar& rhs) { return lhs.Data() == rhs.Data(); };
+			OpenHashMap<Bar, Foo>::PairType movedItem{ Bar{}, Foo{} };
+			OpenHashMap<Bar, Foo>::PairType item{ Bar{1}, Foo{1} };
+
+			OpenHashMap<Bar, Foo> barMap{ 10, barEquality, UserHash<Bar>{} };
+			barMap.Insert(std::move(movedItem));
+			auto first{ barMap.Insert(item) };
+			auto second{ barMap.Insert(item) };
+			barMap.Emplace(Bar{ 7 }, Foo{ 6 });
+
+			Assert::IsTrue(first == second);
+			Assert::AreEqual(Foo{}, barMap.At(Bar{}));
+			Assert::AreEqual(Foo{ 6 }, barMap.At(Bar{ 7 }));
+			Assert::AreEqual(std::size_t{ 3 }, barMap.Size());
+		}
+
+		TEST_METHOD(EmplaceExistingKey)
+		{
+			using namespace std::string_literals;
+			CountingResource resource;
+			{
+				OpenHashMap<std::string, std::string> map{};
+				map.SetResource(&resource);
+				map.Reserve(8);
+				map.Emplace("key"s, "first"s);
+				map.Emplace("pair"s, "second"s);
+				const std::size_t allocations{ resource._allocations };
+
+				std::string value{ "replacement"s };
+				auto position{ map.Emplace("key"s, std::move(value)) };
+				Assert::AreEqual("first"s, position->second);
+				Assert::AreEqual("replacement"s, value);
+				map.Emplace("key", "literal");
+				map.Insert(OpenHashMap<std::string, std::string>::PairType{ "pair"s, "other"s });
+				map.TryEmplace("key"s, 5, 'x');
+				map["pair"];
+				Assert::AreEqual(allocations, resource._allocations);
+				Assert::AreEqual(std::size_t{ 2 }, map.Size());
+
+				position = map.TryEmplace("new"s, 3, 'x');
+				Assert::AreEqual("xxx"s, position->second);
+				Assert::AreEqual(allocations + 1, resource._allocations);
+				map["empty"];
+				Assert::AreEqual(std::string{}, map.At("empty"s));
+				Assert::AreEqual(std::size_t{ 4 }, map.Size());
+			}
+		}
+
+		TEST_METHOD(Find)
+		{
+			OpenHashMap<int, Foo> map{};
+			Assert::IsTrue(map.end() == map.Find(8));
+			map.Insert(std::pair(7, Foo{}));
+			map.Insert(std::pair(0, Foo{}));
+			map.Insert(std::pair(10, Foo{ 10 }));
+
+			Assert::IsTrue(map.end() != map.Find(0));
+			Assert::IsTrue(map.end() == map.Find(8));
+
+			const OpenHashMap<int, Foo> constMap{ map };
+			Assert::IsTrue(constMap.cend() != constMap.Find(7));
+			Assert::IsTrue(constMap.end() == constMap.Find(8));
+			Assert::AreEqual(Foo{ 10 }, (*constMap.Find(10)).second);
+		}
+
+		TEST_METHOD(Growth)
+		{
+			OpenHashMap<int, int> map{};
+			Vector<int*> addresses{};
+			for (int key{ 0 }; key < 1000; ++key)
+			{
+				map.Insert(std::pair(key, key * 2));
+				addresses.PushBack(&map.At(key));
+			}
+
+			Assert::AreEqual(std::size_t{ 1000 }, map.Size());
+			Assert::IsTrue(map.GetLoadFactor() <= 0.875f);
+			for (int key{ 0 }; key < 1000; ++key)
+			{
+				Assert::AreEqual(key * 2, map.At(key));
+				Assert::IsTrue(addresses[key] == &map.At(key));
+			}
+		}
+
+		TEST_METHOD(Reserve)
+		{
+			OpenHashMap<int, int> map{};
+			Assert::AreEqual(0.875f, map.max_load_factor());
+			map.Reserve(100);
+			float loadFactor{ map.GetLoadFactor() };
+			int* address{ nullptr };
+			for (int key{ 0 }; key < 100; ++key)
+			{
+				map.Insert(std::pair(key, key));
+				if (key == 0)
+				{
+					address = &map.At(0);
+				}
+			}
+			Assert::IsTrue(map.GetLoadFactor() > loadFactor);
+
+			map.max_load_factor(0.25f);
+			Assert::IsTrue(map.GetLoadFactor() <= 0.25f);
+			Assert::IsTrue(address == &map.At(0));
+			Assert::AreEqual(99, map.At(99));
+		}
+
+		TEST_METHOD(RemoveAndReinsert)
+		{
+			OpenHashMap<int, int> map{};
+			for (int round{ 0 }; round < 50; ++round)
+			{
+				for (int key{ 0 }; key < 100; ++key)
+				{
+					map.Insert(std::pair(round * 100 + key, key));
+				}
+				for (int key{ 0 }; key < 100; ++key)
+				{
+					map.Remove(round * 100 + key);
+				}
+			}
+
+			Assert::AreEqual(std::size_t{ 0 }, map.Size());
+			Assert::IsTrue(map.begin() == map.end());
+
+			map.Insert(std::pair(3, 3));
+			Assert::IsTrue(map.ContainsKey(3));
+			Assert::IsFalse(map.ContainsKey(4903));
+		}
+
+		TEST_METHOD(Rehash)
+		{
+			OpenHashMap<int, Foo> map{};
+			map.Insert(std::pair(0, Foo{}));
+			map.Insert(std::pair(1, Foo{}));
+			map.Insert(std::pair(6, Foo{}));
+			map.Insert(std::pair(60, Foo{}));
+			map.Insert(std::pair(70, Foo{ 70 }));
+
+			Foo* address{ &map.At(70) };
+			map.Rehash(2000);
+			Assert::AreEqual(std::size_t{ 5 }, map.Size());
+			Assert::IsTrue(address == &map.At(70));
+			float loadFactor{ map.GetLoadFactor() };
+			map.Rehash(2);
+			Assert::AreEqual(std::size_t{ 5 }, map.Size());
+			Assert::IsTrue(map.GetLoadFactor() > loadFactor);
+			Assert::AreEqual(Foo{ 70 }, map.At(70));
+		}
+
+		TEST_METHOD(BracketOperator)
+		{
+			OpenHashMap<int, Foo> map{};
+			map.Insert(std::pair(0, Foo{ 1 }));
+			map[77];
+			map[0] = Foo{ 5 };
+			Assert::AreEqual(std::size_t{ 2 }, map.Size());
+			Assert::AreEqual(Foo{ 5 }, map.At(0));
+			Assert::AreEqual(Foo{}, map.At(77));
+		}
+
+		TEST_METHOD(HeterogeneousLookup)
+		{
+			using namespace std::string_literals;
+			OpenHashMap<std::string, int> map{};
+			map.Insert(std::pair("one"s, 1));
+			map.Insert(std::pair("two"s, 2));
+			map.Insert(std::pair("three"s, 3));
+
+			std::string_view expression{ "one two three four" };
+			Assert::AreEqual(1, map.At(expression.substr(0, 3)));
+			Assert::AreEqual(2, map.At(expression.substr(4, 3)));
+			Assert::IsTrue(map.ContainsKey(expression.substr(8, 5)));
+			Assert::IsFalse(map.ContainsKey(expression.substr(14)));
+			Assert::IsTrue(map.Find(expression.substr(14)) == map.end());
+			Assert::AreEqual(3, map.Find("three")->second);
+
+			const OpenHashMap<std::string, int>& constMap{ map };
+			Assert::AreEqual(2, constMap.At(std::string_view{ "two" }));
+			Assert::IsTrue(constMap.Find(std::string_view{ "four" }) == constMap.end());
+
+			map.Remove(expression.substr(0, 3));
+			Assert::AreEqual(std::size_t{ 2 }, map.Size());
+			Assert::IsFalse(map.ContainsKey("one"));
+
+			OpenHashMap<std::string, int> copy{ map };
+			Assert::AreEqual(2, copy.At(std::string_view{ "two" }));
+
+			auto firstCharacter = [](const std::string& key) { return key.empty() ? std::size_t{ 0 } : static_cast<std::size_t>(key.front()); };
+			auto sameFirstCharacter = [](const std::string& lhs, const std::string& rhs) { return lhs.substr(0, 1) == rhs.substr(0, 1); };
+			OpenHashMap<std::string, int> custom{ sameFirstCharacter, firstCharacter };
+			custom.Insert(std::pair("alpha"s, 1));
+			Assert::AreEqual(1, custom.At(std::string_view{ "apple" }));
+			Assert::IsFalse(custom.ContainsKey("beta"));
+		}
+
+		TEST_METHOD(KeyTypes)
+		{
+			{
+				OpenHashMap<std::string, int> map{};
+				map.Insert(std::pair("one", 1));
+				map.Insert(std::pair("two", 2));
+				Assert::AreEqual(1, map.At("one"));
+				Assert::AreEqual(2, map.At("two"));
+			}
+
+			{
+				OpenHashMap<const char*, int> map{};
+				map.Insert(std::pair("one", 1));
+				map.Insert(std::pair("two", 2));
+				Assert::AreEqual(1, map.At("one"));
+				Assert::AreEqual(2, map.At("two"));
+			}
+
+			{
+				OpenHashMap<Foo, int> map{ UserHash<Foo>{} };
+				map.Insert(std::pair(Foo{ 0 }, 0));
+				map.Insert(std::pair(Foo{ 1 }, 1));
+				Assert::AreEqual(0, map.At(Foo{ 0 }));
+				Assert::AreEqual(1, map.At(Foo{ 1 }));
+			}
+		}
+	private:
+		inline static _CrtMemState _startMemState;
+	};
+}
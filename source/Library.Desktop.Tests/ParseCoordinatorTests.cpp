@@ -268,6 +268,45 @@ namespace LibraryDesktopTests
 			Assert::AreEqual(glm::mat4{ 1.2, 3.2, 4.7, 0.2, 1.2, 3.2, 4.7, 0.2, 1.2, 3.2, 4.7, 0.2, 1.2, 3.2, 4.7, 0.2 }, nestedEnemy["PreviousLocations"].GetAsMatrix());
 		}
 
+		TEST_METHOD(TableHelperExtendedTypes)
+		{
+			const std::string filename = "TestFile.json";
+			const std::string inputString =
+				R"({"Scope Enemy": {
+						"Alive": true,
+						"Flags": [ true, false, true ],
+						"Score": 5000000000,
+						"Lives": 3,
+						"Offset": " vec2(1.5, 2.5) ",
+						"Velocity": " vec3(1.0, 0.0, -1.0) ",
+						"Facing": " quat(1.0, {0.0, 0.5, 0.0}) "
+					}})";
+			std::ofstream outputFile(filename);
+			Assert::IsTrue(outputFile.good());
+
+			outputFile << inputString;
+			outputFile.close();
+
+			std::shared_ptr<FieaGameEngine::JsonParseCoordinator::Wrapper> wrapper = std::make_shared<JsonTableParseHelper::Wrapper>();
+			JsonParseCoordinator parseCoordinator{ wrapper };
+			parseCoordinator.AddHelper(std::make_shared<JsonTableParseHelper>());
+			parseCoordinator.Initialize();
+
+			parseCoordinator.DeserializeObjectFromFile(filename);
+
+			JsonTableParseHelper::Wrapper* rawWrapper = static_cast<JsonTableParseHelper::Wrapper*>(wrapper.get());
+			Scope& enemy = *rawWrapper->_scope;
+			Assert::IsTrue(enemy["Alive"].GetAsBool());
+			Assert::AreEqual(std::size_t{ 3 }, enemy["Flags"].Size());
+			Assert::IsFalse(enemy["Flags"].GetAsBool(1));
+			Assert::IsTrue(enemy["Flags"].GetAsBool(2));
+			Assert::AreEqual(std::int64_t{ 5'000'000'000 }, enemy["Score"].GetAsInt64());
+			Assert::AreEqual(true, Datum::DatumTypes::Integer == enemy["Lives"].Type());
+			Assert::AreEqual(glm::vec2{ 1.5f, 2.5f }, enemy["Offset"].GetAsVector2());
+			Assert::AreEqual(glm::vec3{ 1.0f, 0.0f, -1.0f }, enemy["Velocity"].GetAsVector3());
+			Assert::AreEqual(glm::quat{ 1.0f, 0.0f, 0.5f, 0.0f }, enemy["Facing"].GetAsQuaternion());
+		}
+
 		TEST_METHOD(TableHelperObjectArrays)
 		{
 			const std::string filename = "TestFile.json";
@@ -47,6 +47,7 @@ namespace LibraryDesktopTests
 
 		TEST_METHOD_CLEANUP(Cleanup)
 		{
+			GameState::Reset();
 #if defined(DEBUG) || defined(_DEBUG)
 			_CrtMemState endMemState, diffMemState;
 			_CrtMemCheckpoint(&endMemState);
@@ -180,6 +180,31 @@ namespace LibraryDesktopTests
 			Assert::AreEqual(std::size_t{ 0 }, list.Size());
 		}
 
+		TEST_METHOD(SpliceFront)
+		{
+			SList<Foo> source;
+			source.PushBack(expectedFoo);
+			source.PushBack(additionalFoo);
+			const Foo* address{ &source.Front() };
+
+			SList<Foo> destination;
+			destination.SpliceFront(source);
+			Assert::AreEqual(std::size_t{ 1 }, source.Size());
+			Assert::AreEqual(std::size_t{ 1 }, destination.Size());
+			Assert::IsTrue(address == &destination.Front());
+			Assert::IsTrue(address == &destination.Back());
+
+			destination.SpliceFront(source);
+			Assert::IsTrue(source.IsEmpty());
+			Assert::AreEqual(additionalFoo, destination.Front());
+			Assert::AreEqual(expectedFoo, destination.Back());
+
+			destination.SpliceFront(source);
+			Assert::AreEqual(std::size_t{ 2 }, destination.Size());
+			source.PushBack(expectedFoo);
+			Assert::AreEqual(expectedFoo, source.Back());
+		}
+
 		TEST_METHOD(PopBack)
 		{
 			SList<Foo> list;
@@ -212,6 +237,68 @@ namespace LibraryDesktopTests
 #endif
 		}
 
+		TEST_METHOD(NodeReuse)
+		{
+			SList<Foo> list;
+			list.PushFront(expectedFoo);
+			const Foo* address{ &list.Front() };
+			list.PopFront();
+			list.PushBack(additionalFoo);
+			Assert::IsTrue(address == &list.Front());
+			Assert::AreEqual(additionalFoo, list.Front());
+
+			list.PushBack(expectedFoo);
+			const Foo* back{ &list.Back() };
+			list.Clear();
+			list.EmplaceFront(3);
+			Assert::IsTrue(back == &list.Front());
+			Assert::IsTrue(back == &list.Back());
+			Assert::AreEqual(Foo{ 3 }, list.Front());
+
+			list.Remove(Foo{ 3 });
+			Assert::IsTrue(list.IsEmpty());
+			list.PushFront(expectedFoo);
+			Assert::IsTrue(back == &list.Front());
+		}
+
+		TEST_METHOD(ShrinkToFit)
+		{
+			SList<Foo> list{ expectedFoo, additionalFoo };
+			list.Clear();
+			list.ShrinkToFit();
+			Assert::IsTrue(list.IsEmpty());
+			Assert::AreEqual(std::size_t{ 0 }, list.GetAllocator().CachedCount());
+
+			list.PushBack(expectedFoo);
+			list.PushBack(additionalFoo);
+			Assert::AreEqual(expectedFoo, list.Front());
+			Assert::AreEqual(additionalFoo, list.Back());
+		}
+
+		TEST_METHOD(Allocator)
+		{
+			SList<Foo, std::allocator<Foo>> list{ std::allocator<Foo>{} };
+			list.PushBack(expectedFoo);
+			list.PushFront(additionalFoo);
+			list.InsertAfter(Foo{ 3 }, list.begin());
+			Assert::AreEqual(std::size_t{ 3 }, list.Size());
+			Assert::AreEqual(additionalFoo, list.Front());
+			Assert::AreEqual(Foo{ 3 }, list.At(1));
+			Assert::AreEqual(expectedFoo, list.Back());
+
+			SList<Foo, std::allocator<Foo>> copy{ list };
+			list.PopBack();
+			list.Remove(Foo{ 3 });
+			Assert::AreEqual(std::size_t{ 1 }, list.Size());
+			Assert::AreEqual(std::size_t{ 3 }, copy.Size());
+
+			list = std::move(copy);
+			Assert::AreEqual(std::size_t{ 3 }, list.Size());
+			Assert::AreEqual(expectedFoo, list.Back());
+			list.ShrinkToFit();
+			Assert::AreEqual(std::size_t{ 3 }, list.Size());
+		}
+
 		TEST_METHOD(At)
 		{
 			SList<Foo> list;
@@ -446,6 +533,8 @@ namespace LibraryDesktopTests
 				list.PushBack(expectedFoo);
 				auto iterator = list.begin();
 				list.Remove(iterator);
+				Assert::AreEqual(std::size_t{ 2 }, list.Size());
+				Assert::AreEqual(additionalFoo, list.Front());
 			}
 
 			{
@@ -456,6 +545,17 @@ namespace LibraryDesktopTests
 				auto iterator = list.begin();
 				++iterator;
 				list.Remove(iterator);
+				Assert::AreEqual(std::size_t{ 2 }, list.Size());
+				Assert::AreEqual(expectedFoo, list.Back());
+
+				list.Remove(list.begin());
+				Assert::AreEqual(std::size_t{ 1 }, list.Size());
+				Assert::AreEqual(expectedFoo, list.Front());
+				Assert::AreEqual(expectedFoo, list.Back());
+
+				list.PushBack(additionalFoo);
+				Assert::AreEqual(std::size_t{ 2 }, list.Size());
+				Assert::AreEqual(additionalFoo, list.Back());
 			}
 
 			{
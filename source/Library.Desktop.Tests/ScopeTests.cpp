@@ -2,6 +2,8 @@
 #include "ToStringSpecializations.h"
 #include "CppUnitTest.h"
 #include <crtdbg.h>
+#include <array>
+#include <memory_resource>
 #include <gsl/gsl>
 #include "Foo.h"
 #include "Bar.h"
@@ -11,6 +13,38 @@ using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace FieaGameEngine;
 using namespace UnitTests;
 
+namespace
+{
+	/// <summary>
+	/// Passes allocations on to the global heap, keeping track of how many bytes are still out so a test can see that everything came back with the size it was taken with.
+	/// </summary>
+	class CountingResource final : public std::pmr::memory_resource
+	{
+	public:
+		std::size_t _allocations{ 0 };
+		std::size_t _outstanding{ 0 };
+
+	private:
+		void* do_allocate(std::size_t bytes, std::size_t alignment) override
+		{
+			++_allocations;
+			_outstanding += bytes;
+			return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+		}
+
+		void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override
+		{
+			_outstanding -= bytes;
+			std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+		}
+
+		bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+		{
+			return this == &other;
+		}
+	};
+}
+
 namespace LibraryDesktopTests
 {
 	TEST_CLASS(ScopeTests)
@@ -457,8 +491,237 @@ namespace LibraryDesktopTests
 				Scope movedNestedScope{};
 				movedNestedScope = std::move(*nestedScopePtr);
 				Assert::IsTrue(movedNestedScope == copiedNestedScope);
-				
+
+			}
+		}
+
+		TEST_METHOD(Clone)
+		{
+			Scope prefab{};
+			for (int index{ 0 }; index < 100; ++index)
+			{
+				prefab["Attribute" + std::to_string(index)] = index;
+			}
+			Scope& action{ prefab.AppendScope("Actions") };
+			action["Name"] = std::string{ "Action" };
+			Scope& nestedAction{ action.AppendScope("Actions") };
+			nestedAction["Step"] = 2;
+
+			gsl::owner<Scope*> instance{ prefab.Clone() };
+			Assert::IsTrue(*instance == prefab);
+			for (int index{ 0 }; index < 100; ++index)
+			{
+				Datum* datum{ instance->Find("Attribute" + std::to_string(index)) };
+				Assert::IsNotNull(datum);
+				Assert::AreSame(*datum, (*instance)[index]);
+				Assert::AreEqual(index, datum->GetAsInt());
+			}
+
+			Scope* clonedAction{ instance->Find("Actions")->GetAsScope() };
+			Assert::AreNotSame(action, *clonedAction);
+			Assert::IsTrue(clonedAction->GetParent() == instance);
+			Assert::IsTrue(instance->FindContainedScope(clonedAction).first == instance->Find("Actions"));
+			Scope* clonedNestedAction{ clonedAction->Find("Actions")->GetAsScope() };
+			Assert::IsTrue(clonedNestedAction->GetParent() == clonedAction);
+			Assert::AreEqual(2, clonedNestedAction->Find("Step")->GetAsInt());
+
+			Datum& added{ instance->Append("Added", Datum::DatumTypes::Integer) };
+			Assert::AreSame(added, (*instance)[instance->Size() - 1]);
+			Assert::AreSame(added, *instance->Find("Added"));
+			Assert::IsNull(prefab.Find("Added"));
+			(*instance)["Attribute0"] = 50;
+			Assert::AreEqual(0, prefab.Find("Attribute0")->GetAsInt());
+
+			Scope assigned{};
+			assigned["Attribute50"] = 5;
+			assigned["Other"] = 1;
+			assigned = *instance;
+			Assert::IsTrue(assigned == *instance);
+			Assert::IsNull(assigned.Find("Other"));
+			Assert::AreEqual(50, assigned.Find("Attribute50")->GetAsInt());
+			Assert::IsTrue(assigned.Find("Actions")->GetAsScope()->GetParent() == &assigned);
+
+			delete instance;
+		}
+
+		TEST_METHOD(Prototype)
+		{
+			Scope prototype{};
+			prototype["Health"] = 100;
+			prototype["Name"] = std::string{ "a name long enough that its characters live on the heap" };
+			prototype.AppendScope("Transform")["X"] = 1;
+			prototype.SetCopyOnWrite(true);
+
+			Scope instance{};
+			instance.Append("Actions", Datum::DatumTypes::Table);
+			prototype.AppendScope("Actions")["Step"] = 2;
+			instance.SetPrototype(prototype);
+			Assert::IsTrue(instance.Prototype() == &prototype);
+
+			// Tables the instance already held receive clones of the prototype's scopes, and nothing else is copied.
+			Assert::AreEqual(std::size_t{ 1 }, instance.Size());
+			Scope* action{ instance[0].GetAsScope() };
+			Assert::IsTrue(action->GetParent() == &instance);
+			Assert::IsTrue(action != prototype.Find("Actions")->GetAsScope());
+			Assert::AreEqual(2, action->Find("Step")->GetAsInt());
+
+			const Scope& constInstance{ instance };
+			Assert::IsTrue(constInstance.Find("Health") == prototype.Find("Health"));
+			Assert::IsTrue(constInstance.Find(Symbol{ "Name" }) == prototype.Find("Name"));
+			Assert::IsNull(constInstance.Find("Missing"));
+			Assert::IsNull(instance.Find("Missing"));
+			Assert::IsNull(instance.Find("NeverInterned"));
+			Assert::AreEqual(std::size_t{ 1 }, instance.Size());
+
+			// Searching from the action reaches the instance, which copies Health in.
+			Assert::IsNotNull(action->Search("Health"));
+			Assert::AreEqual(std::size_t{ 2 }, instance.Size());
+			Datum* health{ instance.Find("Health") };
+			Assert::IsTrue(health != prototype.Find("Health"));
+			Assert::AreEqual(100, health->GetAsInt());
+			*health = 50;
+			Assert::AreEqual(100, prototype.Find("Health")->GetAsInt());
+
+			Datum& name{ instance.Append("Name") };
+			Assert::AreEqual(std::size_t{ 3 }, instance.Size());
+			Assert::IsTrue(name.IsShared());
+			Assert::IsTrue(std::as_const(name).GetAsString().data() == std::as_const(*prototype.Find("Name")).GetAsString().data());
+
+			Datum* transform{ instance.Find(Symbol{ "Transform" }) };
+			Assert::IsNotNull(transform);
+			Assert::IsTrue(transform->GetAsScope() != prototype.Find("Transform")->GetAsScope());
+			Assert::IsTrue(transform->GetAsScope()->GetParent() == &instance);
+			(*transform->GetAsScope())["X"] = 3;
+			Assert::AreEqual(1, prototype.Find("Transform")->GetAsScope()->Find("X")->GetAsInt());
+
+			instance.AppendScope("Transform");
+			Assert::AreEqual(std::size_t{ 2 }, transform->Size());
+			Assert::AreEqual(std::size_t{ 1 }, prototype.Find("Transform")->Size());
+
+			Scope copy{ instance };
+			Assert::IsTrue(copy.Prototype() == &prototype);
+			Assert::IsTrue(copy == instance);
+
+			instance.Clear();
+			Assert::IsTrue(instance.IsEmpty());
+			Assert::AreEqual(100, constInstance.Find("Health")->GetAsInt());
+		}
+
+		TEST_METHOD(SegmentBoundaries)
+		{
+			for (std::size_t count : std::initializer_list<std::size_t>{ 4, 5, 12, 13, 28, 29 })
+			{
+				Scope scope{};
+				std::array<Datum*, 29> datums{};
+				for (std::size_t index{ 0 }; index < count; ++index)
+				{
+					datums[index] = &scope.Append("Entry" + std::to_string(index));
+					*datums[index] = static_cast<int>(index);
+				}
+
+				Assert::AreEqual(count, scope.Size());
+				for (std::size_t index{ 0 }; index < count; ++index)
+				{
+					Assert::IsTrue(datums[index] == &scope[index]);
+					Assert::IsTrue(datums[index] == scope.Find("Entry" + std::to_string(index)));
+					Assert::AreEqual(static_cast<int>(index), datums[index]->GetAsInt());
+				}
+			}
+		}
+
+		TEST_METHOD(IndexGrowth)
+		{
+			Scope scope{};
+			for (std::size_t index{ 0 }; index < 100; ++index)
+			{
+				scope.Append("Key" + std::to_string(index)) = static_cast<int>(index);
+				for (std::size_t found{ 0 }; found <= index; ++found)
+				{
+					Datum* datum{ scope.Find("Key" + std::to_string(found)) };
+					Assert::IsNotNull(datum);
+					Assert::AreEqual(static_cast<int>(found), datum->GetAsInt());
+				}
+				Assert::IsNull(scope.Find("Missing"));
+			}
+
+			Scope reserved{ 5 };
+			for (std::size_t index{ 0 }; index < 40; ++index)
+			{
+				reserved.Append("Key" + std::to_string(index)) = static_cast<int>(index);
+			}
+			for (std::size_t index{ 0 }; index < 40; ++index)
+			{
+				Assert::AreEqual(static_cast<int>(index), reserved.Find("Key" + std::to_string(index))->GetAsInt());
+			}
+		}
+
+		TEST_METHOD(ClearAndReuse)
+		{
+			Scope scope{};
+			for (std::size_t index{ 0 }; index < 20; ++index)
+			{
+				scope.Append("Old" + std::to_string(index)) = static_cast<int>(index);
+			}
+			scope.AppendScope("Child").Append("Nested") = 1;
+
+			scope.Clear();
+			Assert::IsTrue(scope.IsEmpty());
+			Assert::IsNull(scope.Find("Old0"));
+			Assert::IsNull(scope.Find("Child"));
+
+			for (std::size_t index{ 0 }; index < 30; ++index)
+			{
+				scope.Append("New" + std::to_string(index)) = static_cast<int>(index * 2);
+			}
+			Assert::AreEqual(std::size_t{ 30 }, scope.Size());
+			Assert::IsNull(scope.Find("Old5"));
+			for (std::size_t index{ 0 }; index < 30; ++index)
+			{
+				Assert::AreEqual(static_cast<int>(index * 2), scope[index].GetAsInt());
+				Assert::IsTrue(&scope[index] == scope.Find("New" + std::to_string(index)));
+			}
+		}
+
+		TEST_METHOD(MultipleSegmentCopyAndMove)
+		{
+			Scope source{};
+			for (std::size_t index{ 0 }; index < 29; ++index)
+			{
+				source.Append("Entry" + std::to_string(index)) = static_cast<int>(index);
+			}
+			source.AppendScope("Child").Append("Nested") = 7;
+
+			Scope copy{ source };
+			Assert::IsTrue(copy == source);
+			Assert::AreEqual(std::size_t{ 30 }, copy.Size());
+			for (std::size_t index{ 0 }; index < 29; ++index)
+			{
+				Datum* datum{ copy.Find("Entry" + std::to_string(index)) };
+				Assert::IsTrue(datum == &copy[index]);
+				Assert::IsTrue(datum != &source[index]);
 			}
+			Assert::IsTrue(copy.Find("Child")->GetAsScope()->GetParent() == &copy);
+
+			Scope assigned{};
+			assigned.Append("Existing");
+			assigned = source;
+			Assert::IsTrue(assigned == source);
+			Assert::IsNull(assigned.Find("Existing"));
+
+			Datum* last{ &source[28] };
+			Scope moved{ std::move(source) };
+			Assert::IsTrue(&moved[28] == last);
+			Assert::IsTrue(moved.Find("Entry28") == last);
+			Assert::IsTrue(moved.Find("Child")->GetAsScope()->GetParent() == &moved);
+			Assert::IsTrue(moved == copy);
+
+			Scope moveAssigned{};
+			moveAssigned.Append("Existing");
+			moveAssigned = std::move(moved);
+			Assert::IsTrue(moveAssigned.Find("Entry28") == last);
+			Assert::IsNull(moveAssigned.Find("Existing"));
+			Assert::IsTrue(moveAssigned.Find("Child")->GetAsScope()->GetParent() == &moveAssigned);
+			Assert::IsTrue(moveAssigned == copy);
 		}
 
 		TEST_METHOD(Equality)
@@ -565,6 +828,12 @@ namespace LibraryDesktopTests
 			Assert::IsNotNull(scope.Find("DPS"));
 			Assert::IsNotNull(scope.Find("Stamina"));
 			Assert::IsNull(scope.Find("Invalid"));
+
+			std::string_view names{ "Health DPS Mana" };
+			Assert::IsTrue(scope.Find("Health") == scope.Find(names.substr(0, 6)));
+			Assert::IsTrue(scope.Find("DPS") == scope.Find(names.substr(7, 3)));
+			Assert::IsNull(scope.Find(names.substr(11)));
+			Assert::IsTrue(&scope[names.substr(7, 3)] == scope.Find("DPS"));
 		}
 
 		TEST_METHOD(Search)
@@ -705,6 +974,49 @@ namespace LibraryDesktopTests
 			}
 		}
 
+		TEST_METHOD(SearchBinding)
+		{
+			Scope root{};
+			root["Health"] = 100;
+			Scope& middle = root.AppendScope("Middle");
+			Scope& leaf = middle.AppendScope("Leaf");
+
+			Scope::Binding binding{ Symbol{ "Health" } };
+			Assert::IsNull(binding.FoundScope());
+			Datum* health = leaf.Search(binding);
+			Assert::IsTrue(health == root.Find("Health"));
+			Assert::IsTrue(binding.FoundScope() == &root);
+			Assert::IsTrue(health == leaf.Search(binding));
+
+			leaf["Unrelated"] = 1;
+			root["Other"] = 2;
+			Assert::IsTrue(health == leaf.Search(binding));
+
+			Datum& shadow = middle.Append("Health");
+			Assert::IsTrue(&shadow == leaf.Search(binding));
+			Assert::IsTrue(binding.FoundScope() == &middle);
+
+			middle.Clear();
+			Scope* orphan{ new Scope };
+			orphan->Append("Speed") = 3.0f;
+			Scope::Binding speed{ Symbol{ "Speed" } };
+			Assert::IsNull(root.Search(speed));
+			root.Adopt(*orphan, "Orphan");
+			Assert::IsNotNull(orphan->Search(speed));
+			Assert::IsTrue(orphan->Search(binding) == root.Find("Health"));
+
+			Scope other{};
+			other["Health"] = 5;
+			other.Adopt(*orphan, "Orphan");
+			Assert::IsTrue(orphan->Search(binding) == other.Find("Health"));
+			Assert::IsTrue(root.Search(binding) == root.Find("Health"));
+
+			Scope* orphaned{ orphan->Orphan() };
+			Assert::IsTrue(orphaned == orphan);
+			Assert::IsNull(orphan->Search(binding));
+			delete orphan;
+		}
+
 		TEST_METHOD(FindContainedScope)
 		{
 			Scope scope{};
@@ -778,6 +1090,66 @@ namespace LibraryDesktopTests
 			Assert::IsTrue(scope.Find("Scope")->GetAsScope()->GetParent() == &scope);
 		}
 
+		TEST_METHOD(MemoryResource)
+		{
+			{
+				CountingResource resource;
+				{
+					Scope root{ &resource };
+					Assert::IsTrue(root.Resource() == &resource);
+					Scope& child{ root.AppendScope("Child") };
+					Scope& grandchild{ child.AppendScope("Grandchild") };
+					Assert::IsTrue(child.Resource() == &resource);
+					Assert::IsTrue(grandchild.Resource() == &resource);
+
+					Datum& values{ grandchild.Append("Values", Datum::DatumTypes::Integer) };
+					Assert::IsTrue(values.Resource() == &resource);
+					for (int index{ 0 }; index < 100; ++index)
+					{
+						values.PushBack(index);
+					}
+					Assert::AreEqual(99, values.GetAsInt(99));
+					Assert::IsTrue(resource._allocations > 0);
+
+					Scope copy{ root };
+					Assert::IsNull(copy.Resource());
+					Assert::IsTrue(copy == root);
+
+					Scope* orphan{ child.Orphan() };
+					Assert::IsTrue(orphan == &child);
+					delete orphan;
+					Assert::AreEqual(std::size_t{ 0 }, root.Find("Child")->Size());
+				}
+				Assert::AreEqual(std::size_t{ 0 }, resource._outstanding);
+			}
+
+			{
+				std::array<std::byte, 16384> buffer{};
+				std::pmr::monotonic_buffer_resource arena{ buffer.data(), buffer.size(), std::pmr::null_memory_resource() };
+				const auto isInArena = [&buffer](const void* pointer)
+				{
+					const std::byte* byte{ static_cast<const std::byte*>(pointer) };
+					return byte >= buffer.data() && byte < buffer.data() + buffer.size();
+				};
+
+				Scope* root{ new (&arena) Scope{ &arena } };
+				Assert::IsTrue(isInArena(root));
+				Scope& level{ root->AppendScope("Level") };
+				Assert::IsTrue(isInArena(&level));
+				for (int index{ 0 }; index < 8; ++index)
+				{
+					Scope& entity{ level.AppendScope("Entities") };
+					Assert::IsTrue(isInArena(&entity));
+					entity["Health"] = index;
+					Assert::IsTrue(isInArena(entity.Find("Health")));
+				}
+				Assert::AreEqual(std::size_t{ 8 }, level.Find("Entities")->Size());
+
+				delete root;
+				arena.release();
+			}
+		}
+
 		TEST_METHOD(Orphan)
 		{
 			Scope scope{};
@@ -785,7 +1157,97 @@ namespace LibraryDesktopTests
 			Assert::IsTrue(scope.Find("Scope")->GetAsScope()->GetParent() == &scope);
 			Scope* nestedScope = scope.Find("Scope")->GetAsScope();
 			Scope* capturedScope = nestedScope->Orphan();
+			Assert::IsNull(capturedScope->GetParent());
+			Assert::IsNull(scope.Orphan(capturedScope));
 			delete capturedScope;
+
+			{
+				Scope parent{};
+				std::array<Scope*, 5> children{};
+				for (std::size_t index{ 0 }; index < children.size(); ++index)
+				{
+					children[index] = &parent.AppendScope("Children");
+					children[index]->Append("Index") = static_cast<int>(index);
+				}
+
+				Datum& siblings = *parent.Find("Children");
+				Assert::IsTrue(children[1] == children[1]->Orphan());
+				Assert::AreEqual(std::size_t{ 4 }, siblings.Size());
+				Assert::IsTrue(children[4] == siblings.GetAsScope(1));
+
+				for (Scope* child : { children[0], children[2], children[3], children[4] })
+				{
+					std::pair<Datum*, std::size_t> found = parent.FindContainedScope(child);
+					Assert::IsTrue(found.first == &siblings);
+					Assert::IsTrue(child == siblings.GetAsScope(found.second));
+				}
+
+				delete children[1];
+				delete children[0];
+				Assert::AreEqual(std::size_t{ 3 }, siblings.Size());
+				Scope other{};
+				other.Adopt(*children[4], "Adopted");
+				Assert::AreEqual(std::size_t{ 2 }, siblings.Size());
+				Assert::IsTrue(children[4]->GetParent() == &other);
+				Assert::IsTrue(parent.FindContainedScope(children[4]).first == nullptr);
+				Assert::IsTrue(other.FindContainedScope(children[4]).first == other.Find("Adopted"));
+
+				delete children[3];
+				Assert::IsTrue(children[2] == siblings.GetAsScope());
+				Assert::AreEqual(2, siblings.GetAsScope()->Find("Index")->GetAsInt());
+			}
+		}
+
+		TEST_METHOD(TableRemoval)
+		{
+			Scope parent{};
+			std::array<Scope*, 6> children{};
+			for (std::size_t index{ 0 }; index < children.size(); ++index)
+			{
+				children[index] = &parent.AppendScope("Children");
+			}
+			Datum& siblings = *parent.Find("Children");
+
+			siblings.RemoveAt(1);
+			Assert::IsNull(children[1]->GetParent());
+			Assert::IsTrue(parent.FindContainedScope(children[1]).first == nullptr);
+			delete children[1];
+			for (std::size_t index{ 0 }; index < siblings.Size(); ++index)
+			{
+				std::pair<Datum*, std::size_t> found = parent.FindContainedScope(siblings.GetAsScope(index));
+				Assert::IsTrue(found.first == &siblings);
+				Assert::AreEqual(index, found.second);
+			}
+
+			siblings.PopBack();
+			Assert::IsNull(children[5]->GetParent());
+			delete children[5];
+
+			siblings.RemoveAt(0);
+			Assert::IsNull(children[0]->GetParent());
+			delete children[0];
+			Assert::AreEqual(std::size_t{ 3 }, siblings.Size());
+			Assert::IsTrue(children[2] == siblings.GetAsScope(0));
+
+			Assert::IsTrue(children[3] == children[3]->Orphan());
+			delete children[3];
+			Assert::AreEqual(std::size_t{ 2 }, siblings.Size());
+			Assert::IsTrue(children[4] == siblings.GetAsScope(1));
+			delete children[4];
+			Assert::AreEqual(std::size_t{ 1 }, siblings.Size());
+
+			Scope* extra = &parent.AppendScope("Children");
+			siblings.Resize(1);
+			Assert::IsNull(extra->GetParent());
+			delete extra;
+
+			Datum copy{ siblings };
+			copy.Clear();
+			Assert::IsTrue(children[2]->GetParent() == &parent);
+
+			siblings.Clear();
+			Assert::IsNull(children[2]->GetParent());
+			delete children[2];
 		}
 
 		TEST_METHOD(Adopt)
@@ -0,0 +1,358 @@
+#include "pch.h"
+#include "ToStringSpecializations.h"
+#include "CppUnitTest.h"
+#include <crtdbg.h>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+#include "Datum.h"
+#include "SimdMath.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+
+namespace
+{
+	/// <summary>
+	/// Sizes on either side of the SSE and AVX2 widths, so both the vector loops and their scalar tails run.
+	/// </summary>
+	constexpr std::size_t Sizes[]{ 0, 1, 3, 4, 7, 8, 9, 17, 64 };
+	constexpr float Tolerance{ 1e-4f };
+
+	std::vector<float> MakeFloats(std::size_t size, float seed)
+	{
+		std::vector<float> values(size);
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			values[index] = seed + static_cast<float>(index % 13) * 0.25f - static_cast<float>(index % 5);
+		}
+
+		return values;
+	}
+
+	std::vector<glm::vec4> MakeVectors(std::size_t size, float seed)
+	{
+		std::vector<glm::vec4> values(size);
+		for (std::size_t index{ 0 }; index < size; ++index)
+		{
+			const float base{ seed + static_cast<float>(index % 7) };
+			values[index] = glm::vec4{ base, -base * 0.5f, base + 1.0f, 0.25f * static_cast<float>(index % 3) };
+		}
+
+		return values;
+	}
+
+	glm::mat4 MakeMatrix(float seed)
+	{
+		glm::mat4 matrix{};
+		for (int column{ 0 }; column < 4; ++column)
+		{
+			for (int row{ 0 }; row < 4; ++row)
+			{
+				matrix[column][row] = seed + static_cast<float>(column * 4 + row) * 0.5f - 3.0f;
+			}
+		}
+
+		return matrix;
+	}
+
+	bool Near(float lhs, float rhs)
+	{
+		return std::fabs(lhs - rhs) <= Tolerance * (1.0f + std::fabs(rhs));
+	}
+
+	bool Near(const glm::vec4& lhs, const glm::vec4& rhs)
+	{
+		return Near(lhs.x, rhs.x) && Near(lhs.y, rhs.y) && Near(lhs.z, rhs.z) && Near(lhs.w, rhs.w);
+	}
+
+	template <typename T>
+	bool AllNear(const std::vector<T>& lhs, const std::vector<T>& rhs)
+	{
+		if (lhs.size() != rhs.size())
+		{
+			return false;
+		}
+
+		for (std::size_t index{ 0 }; index < lhs.size(); ++index)
+		{
+			if (!Near(lhs[index], rhs[index]))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	/// <summary>
+	/// Every instruction set the processor supports, from the scalar fallback up.
+	/// </summary>
+	std::vector<SimdMath::InstructionSet> InstructionSets()
+	{
+		std::vector<SimdMath::InstructionSet> sets;
+		for (int set{ 0 }; set <= static_cast<int>(SimdMath::Supported()); ++set)
+		{
+			sets.push_back(static_cast<SimdMath::InstructionSet>(set));
+		}
+
+		return sets;
+	}
+}
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(SimdMathTests)
+	{
+	public:
+
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+			SimdMath::SetInstructionSet(SimdMath::Supported());
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(Dispatch)
+		{
+			Assert::IsTrue(SimdMath::Active() == SimdMath::Supported());
+
+			SimdMath::SetInstructionSet(SimdMath::InstructionSet::Scalar);
+			Assert::IsTrue(SimdMath::Active() == SimdMath::InstructionSet::Scalar);
+
+			SimdMath::SetInstructionSet(SimdMath::InstructionSet::AVX2);
+			Assert::IsTrue(SimdMath::Active() == SimdMath::Supported());
+		}
+
+		TEST_METHOD(ElementWise)
+		{
+			for (SimdMath::InstructionSet set : InstructionSets())
+			{
+				SimdMath::SetInstructionSet(set);
+				for (std::size_t size : Sizes)
+				{
+					const std::vector<float> lhs{ MakeFloats(size, 1.5f) };
+					const std::vector<float> rhs{ MakeFloats(size, -2.0f) };
+					const std::vector<float> addend{ MakeFloats(size, 0.75f) };
+					std::vector<float> expected(size);
+					std::vector<float> result(size);
+
+					for (std::size_t index{ 0 }; index < size; ++index) { expected[index] = lhs[index] + rhs[index]; }
+					SimdMath::Add(lhs, rhs, result);
+					Assert::IsTrue(AllNear(result, expected));
+
+					for (std::size_t index{ 0 }; index < size; ++index) { expected[index] = lhs[index] - rhs[index]; }
+					SimdMath::Subtract(lhs, rhs, result);
+					Assert::IsTrue(AllNear(result, expected));
+
+					for (std::size_t index{ 0 }; index < size; ++index) { expected[index] = lhs[index] * rhs[index]; }
+					SimdMath::Multiply(lhs, rhs, result);
+					Assert::IsTrue(AllNear(result, expected));
+
+					for (std::size_t index{ 0 }; index < size; ++index) { expected[index] = lhs[index] * rhs[index] + addend[index]; }
+					SimdMath::MultiplyAdd(lhs, rhs, addend, result);
+					Assert::IsTrue(AllNear(result, expected));
+
+					for (std::size_t index{ 0 }; index < size; ++index) { expected[index] = lhs[index] * 3.5f; }
+					SimdMath::Scale(lhs, 3.5f, result);
+					Assert::IsTrue(AllNear(result, expected));
+
+					for (std::size_t index{ 0 }; index < size; ++index) { expected[index] = lhs[index] + (rhs[index] - lhs[index]) * 0.3f; }
+					SimdMath::Lerp(lhs, rhs, 0.3f, result);
+					Assert::IsTrue(AllNear(result, expected));
+				}
+			}
+		}
+
+		TEST_METHOD(ElementWiseVector)
+		{
+			for (SimdMath::InstructionSet set : InstructionSets())
+			{
+				SimdMath::SetInstructionSet(set);
+				for (std::size_t size : Sizes)
+				{
+					const std::vector<glm::vec4> lhs{ MakeVectors(size, 2.0f) };
+					const std::vector<glm::vec4> rhs{ MakeVectors(size, -1.0f) };
+					const std::vector<glm::vec4> addend{ MakeVectors(size, 0.5f) };
+					std::vector<glm::vec4> expected(size);
+					std::vector<glm::vec4> result(size);
+
+					for (std::size_t index{ 0 }; index < size; ++index) { expected[index] = lhs[index] + rhs[index]; }
+					SimdMath::Add(lhs, rhs, result);
+					Assert::IsTrue(AllNear(result, expected));
+
+					for (std::size_t index{ 0 }; index < size; ++index) { expected[index] = lhs[index] - rhs[index]; }
+					SimdMath::Subtract(lhs, rhs, result);
+					Assert::IsTrue(AllNear(result, expected));
+
+					for (std::size_t index{ 0 }; index < size; ++index) { expected[index] = lhs[index] * rhs[index]; }
+					SimdMath::Multiply(lhs, rhs, result);
+					Assert::IsTrue(AllNear(result, expected));
+
+					for (std::size_t index{ 0 }; index < size; ++index) { expected[index] = lhs[index] * rhs[index] + addend[index]; }
+					SimdMath::MultiplyAdd(lhs, rhs, addend, result);
+					Assert::IsTrue(AllNear(result, expected));
+
+					for (std::size_t index{ 0 }; index < size; ++index) { expected[index] = lhs[index] * -0.5f; }
+					SimdMath::Scale(lhs, -0.5f, result);
+					Assert::IsTrue(AllNear(result, expected));
+
+					for (std::size_t index{ 0 }; index < size; ++index) { expected[index] = lhs[index] + (rhs[index] - lhs[index]) * 0.8f; }
+					SimdMath::Lerp(lhs, rhs, 0.8f, result);
+					Assert::IsTrue(AllNear(result, expected));
+				}
+			}
+		}
+
+		TEST_METHOD(InPlace)
+		{
+			for (SimdMath::InstructionSet set : InstructionSets())
+			{
+				SimdMath::SetInstructionSet(set);
+				const std::vector<glm::vec4> offsets{ MakeVectors(17, 1.0f) };
+				std::vector<glm::vec4> values{ MakeVectors(17, 4.0f) };
+				std::vector<glm::vec4> expected(values.size());
+				for (std::size_t index{ 0 }; index < values.size(); ++index) { expected[index] = values[index] + offsets[index]; }
+
+				SimdMath::Add(values, offsets, values);
+				Assert::IsTrue(AllNear(values, expected));
+
+				const glm::mat4 matrix{ MakeMatrix(1.0f) };
+				for (std::size_t index{ 0 }; index < values.size(); ++index) { expected[index] = matrix * values[index]; }
+				SimdMath::Transform(matrix, values, values);
+				Assert::IsTrue(AllNear(values, expected));
+			}
+		}
+
+		TEST_METHOD(Dot)
+		{
+			for (SimdMath::InstructionSet set : InstructionSets())
+			{
+				SimdMath::SetInstructionSet(set);
+				for (std::size_t size : Sizes)
+				{
+					const std::vector<float> lhs{ MakeFloats(size, 1.0f) };
+					const std::vector<float> rhs{ MakeFloats(size, 0.5f) };
+					float expected{ 0.0f };
+					for (std::size_t index{ 0 }; index < size; ++index) { expected += lhs[index] * rhs[index]; }
+					Assert::IsTrue(Near(SimdMath::Dot(lhs, rhs), expected));
+
+					const std::vector<glm::vec4> left{ MakeVectors(size, 1.0f) };
+					const std::vector<glm::vec4> right{ MakeVectors(size, -3.0f) };
+					std::vector<float> expectedDots(size);
+					std::vector<float> dots(size);
+					for (std::size_t index{ 0 }; index < size; ++index) { expectedDots[index] = glm::dot(left[index], right[index]); }
+					SimdMath::Dot(left, right, dots);
+					Assert::IsTrue(AllNear(dots, expectedDots));
+				}
+			}
+		}
+
+		TEST_METHOD(Transform)
+		{
+			for (SimdMath::InstructionSet set : InstructionSets())
+			{
+				SimdMath::SetInstructionSet(set);
+				for (std::size_t size : Sizes)
+				{
+					const glm::mat4 matrix{ MakeMatrix(0.5f) };
+					const std::vector<glm::vec4> values{ MakeVectors(size, 1.0f) };
+					std::vector<glm::vec4> expected(size);
+					std::vector<glm::vec4> result(size);
+					for (std::size_t index{ 0 }; index < size; ++index) { expected[index] = matrix * values[index]; }
+					SimdMath::Transform(matrix, values, result);
+					Assert::IsTrue(AllNear(result, expected));
+
+					std::vector<glm::mat4> matrices(size);
+					for (std::size_t index{ 0 }; index < size; ++index)
+					{
+						matrices[index] = MakeMatrix(static_cast<float>(index));
+						expected[index] = matrices[index] * values[index];
+					}
+					SimdMath::Transform(matrices, values, result);
+					Assert::IsTrue(AllNear(result, expected));
+				}
+			}
+		}
+
+		TEST_METHOD(Find)
+		{
+			for (SimdMath::InstructionSet set : InstructionSets())
+			{
+				SimdMath::SetInstructionSet(set);
+				for (std::size_t size : Sizes)
+				{
+					std::vector<int> integers(size);
+					std::vector<float> floats(size);
+					std::vector<glm::vec4> vectors(size);
+					std::vector<glm::mat4> matrices(size);
+					std::vector<const void*> pointers(size);
+					for (std::size_t index{ 0 }; index < size; ++index)
+					{
+						integers[index] = static_cast<int>(index);
+						floats[index] = static_cast<float>(index);
+						vectors[index] = glm::vec4{ 1.0f, 2.0f, 3.0f, static_cast<float>(index) };
+						matrices[index] = MakeMatrix(0.0f);
+						matrices[index][3][3] = static_cast<float>(index);
+						pointers[index] = &integers[index];
+					}
+
+					Assert::AreEqual(size, SimdMath::Find(integers, -1));
+					Assert::AreEqual(size, SimdMath::Find(floats, -1.0f));
+					Assert::AreEqual(size, SimdMath::Find(vectors, glm::vec4{ 1.0f, 2.0f, 3.0f, -1.0f }));
+					Assert::AreEqual(size, SimdMath::Find(matrices, MakeMatrix(1.0f)));
+					Assert::AreEqual(size, SimdMath::Find(pointers, static_cast<const void*>(&size)));
+					for (std::size_t index{ 0 }; index < size; ++index)
+					{
+						const float value{ static_cast<float>(index) };
+						Assert::AreEqual(index, SimdMath::Find(integers, static_cast<int>(index)));
+						Assert::AreEqual(index, SimdMath::Find(floats, value));
+						Assert::AreEqual(index, SimdMath::Find(vectors, glm::vec4{ 1.0f, 2.0f, 3.0f, value }));
+						Assert::AreEqual(index, SimdMath::Find(matrices, matrices[index]));
+						Assert::AreEqual(index, SimdMath::Find(pointers, pointers[index]));
+					}
+				}
+
+				const std::vector<float> signedZeros{ 1.0f, std::nanf(""), -0.0f };
+				Assert::AreEqual(std::size_t{ 2 }, SimdMath::Find(signedZeros, 0.0f));
+				Assert::AreEqual(signedZeros.size(), SimdMath::Find(signedZeros, std::nanf("")));
+			}
+		}
+
+		TEST_METHOD(DatumSpans)
+		{
+			Datum positions{ Datum::DatumTypes::Vector };
+			Datum velocities{ Datum::DatumTypes::Vector };
+			for (int index{ 0 }; index < 10; ++index)
+			{
+				positions.PushBack(glm::vec4{ static_cast<float>(index) });
+				velocities.PushBack(glm::vec4{ 1.0f, 2.0f, 3.0f, 0.0f });
+			}
+
+			SimdMath::MultiplyAdd(velocities.AsSpan<glm::vec4>(), std::vector<glm::vec4>(10, glm::vec4{ 0.5f }), positions.AsSpan<glm::vec4>(), positions.AsSpan<glm::vec4>());
+			for (std::size_t index{ 0 }; index < positions.Size(); ++index)
+			{
+				const float start{ static_cast<float>(index) };
+				Assert::AreEqual(glm::vec4{ start + 0.5f, start + 1.0f, start + 1.5f, start }, positions.GetAsVector(index));
+			}
+		}
+
+	private:
+		inline static _CrtMemState _startMemState;
+	};
+}
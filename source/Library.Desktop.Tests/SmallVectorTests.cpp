@@ -0,0 +1,205 @@
+#include "pch.h"
+#include "ToStringSpecializations.h"
+#include "CppUnitTest.h"
+#include <crtdbg.h>
+#include <cstddef>
+#include <string>
+#include "Vector.h"
+#include "Foo.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace UnitTests;
+using namespace std::string_literals;
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(SmallVectorTests)
+	{
+	public:
+
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(Constructor)
+		{
+			{
+				SmallVector<Foo, 4> vector;
+				Assert::AreEqual(std::size_t{ 0 }, vector.Size());
+				Assert::AreEqual(std::size_t{ 4 }, vector.Capacity());
+				Assert::IsTrue(vector.begin() == vector.end());
+			}
+
+			{
+				SmallVector<Foo, 4> vector{ Foo{ 1 }, Foo{ 2 }, Foo{ 3 } };
+				Assert::AreEqual(std::size_t{ 3 }, vector.Size());
+				Assert::AreEqual(std::size_t{ 4 }, vector.Capacity());
+				Assert::IsTrue(IsStoredInline(vector));
+				Assert::AreEqual(Foo{ 1 }, vector.Front());
+				Assert::AreEqual(Foo{ 3 }, vector.Back());
+			}
+
+			{
+				SmallVector<Foo, 2> vector{ Foo{ 1 }, Foo{ 2 }, Foo{ 3 } };
+				Assert::AreEqual(std::size_t{ 3 }, vector.Size());
+				Assert::AreEqual(std::size_t{ 3 }, vector.Capacity());
+				Assert::IsFalse(IsStoredInline(vector));
+			}
+		}
+
+		TEST_METHOD(Spill)
+		{
+			SmallVector<Foo, 4> vector;
+			for (std::int32_t value{ 0 }; value < 4; ++value)
+			{
+				vector.PushBack(Foo{ value });
+			}
+			Assert::IsTrue(IsStoredInline(vector));
+			Assert::AreEqual(std::size_t{ 4 }, vector.Capacity());
+
+			vector.EmplaceBack(4);
+			Assert::IsFalse(IsStoredInline(vector));
+			Assert::AreEqual(std::size_t{ 6 }, vector.Capacity());
+			for (std::int32_t value{ 0 }; value < 5; ++value)
+			{
+				Assert::AreEqual(Foo{ value }, vector[value]);
+			}
+
+			vector.PushBack(vector.Front());
+			vector.PushBack(vector.Front());
+			Assert::AreEqual(std::size_t{ 7 }, vector.Size());
+			Assert::AreEqual(Foo{ 0 }, vector.Back());
+		}
+
+		TEST_METHOD(ShrinkToFit)
+		{
+			SmallVector<std::string, 2> vector{ "a string long enough to be stored on the heap"s, "second"s, "third"s };
+			Assert::IsFalse(IsStoredInline(vector));
+
+			vector.ShrinkToFit();
+			Assert::AreEqual(std::size_t{ 3 }, vector.Capacity());
+			Assert::IsFalse(IsStoredInline(vector));
+
+			vector.PopBack();
+			vector.ShrinkToFit();
+			Assert::IsTrue(IsStoredInline(vector));
+			Assert::AreEqual(std::size_t{ 2 }, vector.Capacity());
+			Assert::AreEqual("a string long enough to be stored on the heap"s, vector[0]);
+			Assert::AreEqual("second"s, vector[1]);
+
+			vector.Clear();
+			vector.ShrinkToFit();
+			Assert::IsTrue(IsStoredInline(vector));
+			Assert::AreEqual(std::size_t{ 2 }, vector.Capacity());
+		}
+
+		TEST_METHOD(CopySemantics)
+		{
+			SmallVector<Foo, 4> inlineVector{ Foo{ 1 }, Foo{ 2 } };
+			SmallVector<Foo, 4> heapVector{ Foo{ 1 }, Foo{ 2 }, Foo{ 3 }, Foo{ 4 }, Foo{ 5 } };
+
+			SmallVector<Foo, 4> inlineCopy{ inlineVector };
+			SmallVector<Foo, 4> heapCopy{ heapVector };
+			Assert::IsTrue(IsStoredInline(inlineCopy));
+			Assert::IsFalse(IsStoredInline(heapCopy));
+			Assert::AreEqual(inlineVector.Capacity(), inlineCopy.Capacity());
+			Assert::AreEqual(heapVector.Capacity(), heapCopy.Capacity());
+
+			inlineCopy = heapVector;
+			heapCopy = inlineVector;
+			Assert::AreEqual(std::size_t{ 5 }, inlineCopy.Size());
+			Assert::AreEqual(std::size_t{ 2 }, heapCopy.Size());
+			for (std::size_t position{ 0 }; position < heapVector.Size(); ++position)
+			{
+				Assert::AreEqual(heapVector[position], inlineCopy[position]);
+			}
+			Assert::AreEqual(inlineVector.Back(), heapCopy.Back());
+		}
+
+		TEST_METHOD(MoveSemantics)
+		{
+			{
+				SmallVector<std::string, 4> vector{ "a string long enough to be stored on the heap"s, "short"s };
+				SmallVector<std::string, 4> moved{ std::move(vector) };
+				Assert::IsTrue(IsStoredInline(moved));
+				Assert::AreEqual(std::size_t{ 2 }, moved.Size());
+				Assert::AreEqual("a string long enough to be stored on the heap"s, moved.Front());
+				Assert::AreEqual("short"s, moved.Back());
+#pragma warning(push)
+#pragma warning(disable : 26800)
+				Assert::AreEqual(std::size_t{ 0 }, vector.Size());
+				Assert::AreEqual(std::size_t{ 4 }, vector.Capacity());
+#pragma warning(pop)
+			}
+
+			{
+				SmallVector<Foo, 2> vector{ Foo{ 1 }, Foo{ 2 }, Foo{ 3 } };
+				const Foo* elements{ &vector[0] };
+				SmallVector<Foo, 2> moved{ std::move(vector) };
+				Assert::IsTrue(elements == &moved[0]);
+				Assert::AreEqual(std::size_t{ 3 }, moved.Size());
+
+				SmallVector<Foo, 2> assigned{ Foo{ 7 } };
+				assigned = std::move(moved);
+				Assert::IsTrue(elements == &assigned[0]);
+				Assert::AreEqual(Foo{ 3 }, assigned.Back());
+
+				SmallVector<Foo, 2> small{ Foo{ 8 } };
+				assigned = std::move(small);
+				Assert::IsTrue(IsStoredInline(assigned));
+				Assert::AreEqual(std::size_t{ 1 }, assigned.Size());
+				Assert::AreEqual(Foo{ 8 }, assigned.Front());
+#pragma warning(push)
+#pragma warning(disable : 26800)
+				Assert::AreEqual(std::size_t{ 0 }, moved.Size());
+				Assert::AreEqual(std::size_t{ 2 }, moved.Capacity());
+				Assert::AreEqual(std::size_t{ 0 }, small.Size());
+#pragma warning(pop)
+			}
+		}
+
+		TEST_METHOD(RemoveAndFind)
+		{
+			SmallVector<Foo, 4> vector{ Foo{ 1 }, Foo{ 2 }, Foo{ 3 } };
+			Assert::AreEqual(Foo{ 2 }, *vector.Find(Foo{ 2 }));
+			Assert::IsTrue(vector.Find(Foo{ 9 }) == vector.end());
+
+			vector.Remove(Foo{ 2 });
+			Assert::AreEqual(std::size_t{ 2 }, vector.Size());
+			Assert::AreEqual(Foo{ 3 }, vector.Back());
+
+			vector.Remove(vector.begin(), vector.end());
+			Assert::IsTrue(vector.IsEmpty());
+			Assert::IsTrue(IsStoredInline(vector));
+		}
+
+	private:
+		template <typename T, std::size_t N>
+		static bool IsStoredInline(const SmallVector<T, N>& vector)
+		{
+			const std::byte* object{ reinterpret_cast<const std::byte*>(&vector) };
+			const std::byte* elements{ reinterpret_cast<const std::byte*>(&(*vector.begin())) };
+			return elements >= object && elements < object + sizeof(vector);
+		}
+
+		inline static _CrtMemState _startMemState;
+	};
+}
@@ -54,6 +54,51 @@ namespace LibraryDesktopTests
 			Assert::AreEqual(Foo{ 1 }, stack.Top());
 		}
 
+		TEST_METHOD(Top)
+		{
+			Stack<Foo> stack{};
+			stack.Emplace(1);
+			stack.Top() = Foo{ 2 };
+			const Stack<Foo>& constStack{ stack };
+			Assert::AreEqual(Foo{ 2 }, constStack.Top());
+			Assert::AreEqual(std::size_t{ 1 }, constStack.Size());
+			Assert::IsFalse(constStack.IsEmpty());
+
+			stack.Pop();
+			Assert::IsTrue(stack.IsEmpty());
+			stack.Pop();
+			Assert::IsTrue(stack.IsEmpty());
+		}
+
+		TEST_METHOD(Capacity)
+		{
+			Stack<Foo> stack{};
+			stack.Reserve(8);
+			Assert::AreEqual(std::size_t{ 8 }, stack.Capacity());
+
+			for (std::int32_t frame{ 0 }; frame < 3; ++frame)
+			{
+				for (std::int32_t value{ 0 }; value < 8; ++value)
+				{
+					stack.Push(Foo{ value });
+				}
+				Assert::AreEqual(Foo{ 7 }, stack.Top());
+				while (!stack.IsEmpty())
+				{
+					stack.Pop();
+				}
+				Assert::AreEqual(std::size_t{ 8 }, stack.Capacity());
+			}
+
+			stack.Push(Foo{ 1 });
+			stack.Clear();
+			Assert::IsTrue(stack.IsEmpty());
+			Assert::AreEqual(std::size_t{ 8 }, stack.Capacity());
+
+			stack.ShrinkToFit();
+			Assert::AreEqual(std::size_t{ 0 }, stack.Capacity());
+		}
+
 
 	private:
 		inline static _CrtMemState _startMemState;
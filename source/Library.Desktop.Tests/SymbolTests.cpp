@@ -0,0 +1,126 @@
+#include "pch.h"
+#include "ToStringSpecializations.h"
+#include "CppUnitTest.h"
+#include <crtdbg.h>
+#include "Symbol.h"
+#include "Scope.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std::string_literals;
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(SymbolTests)
+	{
+	public:
+
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(Interning)
+		{
+			std::size_t startCount{ Symbol::Count() };
+			{
+				Symbol health{ "Health" };
+				Symbol sameHealth{ "Health"s };
+				Symbol stamina{ std::string_view{ "Stamina Health" }.substr(0, 7) };
+
+				Assert::IsTrue(health == sameHealth);
+				Assert::IsFalse(health == stamina);
+				Assert::IsTrue(health == "Health");
+				Assert::IsTrue(stamina == "Stamina");
+				Assert::AreEqual("Health"s, health.Name());
+				Assert::AreEqual(health.Id(), sameHealth.Id());
+				Assert::AreNotEqual(health.Id(), stamina.Id());
+				Assert::AreEqual(DefaultHash<std::string>{}("Health"s), health.Hash());
+				Assert::AreEqual(startCount + 2, Symbol::Count());
+
+				Symbol copy{ health };
+				Symbol moved{ std::move(sameHealth) };
+				Assert::IsTrue(moved == health);
+				Assert::IsTrue(sameHealth.IsNull());
+				copy = stamina;
+				Assert::IsTrue(copy == stamina);
+				Assert::AreEqual(startCount + 2, Symbol::Count());
+			}
+			Assert::AreEqual(startCount, Symbol::Count());
+		}
+
+		TEST_METHOD(NullSymbol)
+		{
+			Symbol null{};
+			Assert::IsTrue(null.IsNull());
+			Assert::IsTrue(Symbol{ "" }.IsNull());
+			Assert::IsTrue(null == Symbol{ "" });
+			Assert::AreEqual(std::uint32_t{ 0 }, null.Id());
+			Assert::AreEqual(""s, null.Name());
+			Assert::AreEqual(DefaultHash<std::string>{}(""s), null.Hash());
+		}
+
+		TEST_METHOD(Find)
+		{
+			Assert::IsTrue(Symbol::Find("NeverInterned").IsNull());
+			Assert::AreEqual(std::size_t{ 0 }, Symbol::Count());
+
+			Symbol position{ "Position" };
+			Symbol found{ Symbol::Find("Position") };
+			Assert::IsTrue(found == position);
+
+			std::uint32_t id{ position.Id() };
+			position = Symbol{};
+			found = Symbol{};
+			Assert::IsTrue(Symbol::Find("Position").IsNull());
+			Assert::AreNotEqual(id, Symbol{ "Position" }.Id());
+		}
+
+		TEST_METHOD(ScopeKeys)
+		{
+			{
+				Scope first{};
+				Scope second{};
+				first.Append("Name"s) = "First"s;
+				second.Append(Symbol{ "Name" }) = "Second"s;
+				Assert::AreEqual(std::size_t{ 1 }, Symbol::Count());
+
+				Symbol name{ Symbol::Find("Name") };
+				Assert::AreEqual("First"s, first.Find(name)->GetAsString());
+				Assert::AreEqual("Second"s, second[name].GetAsString());
+				Assert::IsTrue(first.Find("Name") == first.Find(name));
+
+				Scope& child = first.AppendScope(Symbol{ "Children" });
+				Scope* foundScope{ nullptr };
+				Assert::IsTrue(child.Search(name, foundScope) == first.Find("Name"));
+				Assert::IsTrue(foundScope == &first);
+				Assert::IsNull(child.Search("NeverInterned"s, foundScope));
+				Assert::IsNull(foundScope);
+
+				Scope copy{ first };
+				Assert::IsTrue(copy == first);
+				Assert::AreEqual(std::size_t{ 2 }, Symbol::Count());
+			}
+			Assert::AreEqual(std::size_t{ 0 }, Symbol::Count());
+		}
+
+	private:
+		inline static _CrtMemState _startMemState;
+	};
+}
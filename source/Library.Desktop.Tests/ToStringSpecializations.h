@@ -184,6 +184,36 @@ namespace Microsoft::VisualStudio::CppUnitTestFramework
 		return string;
 	}
 
+	template<>
+	inline std::wstring ToString<glm::vec2>(const glm::vec2& vec)
+	{
+		std::wstring string = L"X: " + std::to_wstring(vec.x);
+		string.append(L" Y: " + std::to_wstring(vec.y));
+
+		return string;
+	}
+
+	template<>
+	inline std::wstring ToString<glm::vec3>(const glm::vec3& vec)
+	{
+		std::wstring string = L"X: " + std::to_wstring(vec.x);
+		string.append(L" Y: " + std::to_wstring(vec.y));
+		string.append(L" Z: " + std::to_wstring(vec.z));
+
+		return string;
+	}
+
+	template<>
+	inline std::wstring ToString<glm::quat>(const glm::quat& quat)
+	{
+		std::wstring string = L"W: " + std::to_wstring(quat.w);
+		string.append(L" X: " + std::to_wstring(quat.x));
+		string.append(L" Y: " + std::to_wstring(quat.y));
+		string.append(L" Z: " + std::to_wstring(quat.z));
+
+		return string;
+	}
+
 	template<>
 	inline std::wstring ToString<glm::mat4>(const glm::mat4& mat)
 	{
@@ -2,6 +2,8 @@
 #include "ToStringSpecializations.h"
 #include "CppUnitTest.h"
 #include <crtdbg.h>
+#include <cassert>
+#include <string>
 #include "Vector.h"
 #include "Foo.h"
 #include "UserSuppliedIncrement.h"
@@ -9,6 +11,28 @@
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace FieaGameEngine;
 using namespace UnitTests;
+using namespace std::string_literals;
+
+namespace
+{
+	/// <summary>
+	/// Holds a pointer to itself, so copying its bytes to a new address leaves it pointing at the old one.
+	/// </summary>
+	struct Anchored final
+	{
+		Anchored* _self{ this };
+		int _value{ 0 };
+
+		Anchored(int value = 0) : _value{ value } {}
+		Anchored(const Anchored& other) : _value{ other._value } {}
+		Anchored(Anchored&& other) noexcept : _value{ other._value } { other._value = -1; }
+		Anchored& operator=(const Anchored& other) { _value = other._value; return *this; }
+		Anchored& operator=(Anchored&& other) noexcept { _value = other._value; other._value = -1; return *this; }
+		~Anchored() { assert(_self == this); }
+
+		bool IsValid() const { return _self == this; }
+	};
+}
 
 namespace LibraryDesktopTests
 {
@@ -43,8 +67,9 @@ namespace LibraryDesktopTests
 		TEST_METHOD(Constructor)
 		{
 			{
-				Vector<Foo> vector{ UserIncrement<Foo>{} };
+				Vector<Foo, UserIncrement<Foo>> vector{};
 				Assert::AreEqual(size_t{ 0 }, vector.Size());
+				Assert::AreEqual(size_t{ 0 }, vector.Capacity());
 			}
 
 			{
@@ -57,14 +82,14 @@ namespace LibraryDesktopTests
 			}
 
 			{
-				Vector<Foo> vector{ std::initializer_list{expectedFoo, additionalFoo, additionalFoo, expectedFoo}, UserIncrement<Foo>{} };
+				Vector<Foo, UserIncrement<Foo>> vector{ expectedFoo, additionalFoo, additionalFoo, expectedFoo };
 				vector.EmplaceBack();
 				Assert::AreEqual(std::size_t{ 14 }, vector.Capacity());
 				Assert::AreEqual(std::size_t{ 5 }, vector.Size());
 			}
 
 			{
-				const Vector<Foo> vector{ std::initializer_list{expectedFoo, additionalFoo, additionalFoo, expectedFoo}, UserIncrement<Foo>{} };
+				const Vector<Foo, UserIncrement<Foo>> vector{ expectedFoo, additionalFoo, additionalFoo, expectedFoo };
 				Assert::AreEqual(std::size_t{ 4 }, vector.Size());
 				Assert::AreEqual(expectedFoo, vector.Front());
 				Assert::AreEqual(additionalFoo, vector[1]);
@@ -167,9 +192,15 @@ namespace LibraryDesktopTests
 			vector.PushBack(expectedFoo);
 			vector.PushBack(expectedFoo);
 
-			Assert::AreEqual(std::size_t{ 15 }, vector.Capacity());
+			Assert::AreEqual(std::size_t{ 13 }, vector.Capacity());
 			vector.ShrinkToFit();
 			Assert::AreEqual(std::size_t{ 11 }, vector.Capacity());
+
+			vector.Clear();
+			vector.ShrinkToFit();
+			Assert::AreEqual(std::size_t{ 0 }, vector.Capacity());
+			vector.PushBack(expectedFoo);
+			Assert::AreEqual(std::size_t{ 4 }, vector.Capacity());
 		}	
 
 		TEST_METHOD(IteratorEquality)
@@ -277,7 +308,7 @@ namespace LibraryDesktopTests
 		TEST_METHOD(Capacity)
 		{
 			Vector<Foo> vector;
-			Assert::AreEqual(size_t{ 5 }, vector.Capacity());
+			Assert::AreEqual(size_t{ 0 }, vector.Capacity());
 
 			vector.PushBack(expectedFoo);
 			vector.PushBack(expectedFoo);
@@ -286,7 +317,7 @@ namespace LibraryDesktopTests
 			vector.PushBack(expectedFoo);
 			vector.PushBack(expectedFoo);
 
-			Assert::AreEqual(size_t{ 10 }, vector.Capacity());
+			Assert::AreEqual(size_t{ 6 }, vector.Capacity());
 		}
 
 		TEST_METHOD(Clear)
@@ -304,7 +335,7 @@ namespace LibraryDesktopTests
 			vector.Clear();
 
 			Assert::AreEqual(size_t{ 0 }, vector.Size());
-			Assert::AreEqual(size_t{ 10 }, vector.Capacity());
+			Assert::AreEqual(size_t{ 9 }, vector.Capacity());
 
 			vector.PushBack(expectedFoo);
 			vector.PushBack(expectedFoo);
@@ -315,7 +346,7 @@ namespace LibraryDesktopTests
 			vector.PushBack(expectedFoo);
 
 			Assert::AreEqual(size_t{ 7 }, vector.Size());
-			Assert::AreEqual(size_t{ 10 }, vector.Capacity());
+			Assert::AreEqual(size_t{ 9 }, vector.Capacity());
 		}
 
 		TEST_METHOD(Find)
@@ -399,7 +430,7 @@ namespace LibraryDesktopTests
 				auto end{ fullRemoveVector.end() };
 				fullRemoveVector.Remove(begin, end);
 				Assert::AreEqual(std::size_t{ 0 }, fullRemoveVector.Size());
-				Assert::AreEqual(std::size_t{ 10 }, fullRemoveVector.Capacity());
+				Assert::AreEqual(std::size_t{ 6 }, fullRemoveVector.Capacity());
 			}
 
 			{
@@ -410,7 +441,7 @@ namespace LibraryDesktopTests
 				--end;
 				partialRemoveVector.Remove(begin, end);
 				Assert::AreEqual(std::size_t{ 3 }, partialRemoveVector.Size());
-				Assert::AreEqual(std::size_t{ 10 }, partialRemoveVector.Capacity());
+				Assert::AreEqual(std::size_t{ 6 }, partialRemoveVector.Capacity());
 			}
 
 			{
@@ -422,7 +453,7 @@ namespace LibraryDesktopTests
 				failedRemoveVector.Remove(failedRemoveVector.begin(), failedRemoveVector.end() + 1);
 
 				Assert::AreEqual(std::size_t{ 6 }, failedRemoveVector.Size());
-				Assert::AreEqual(std::size_t{ 10 }, failedRemoveVector.Capacity());
+				Assert::AreEqual(std::size_t{ 6 }, failedRemoveVector.Capacity());
 			}
 
 			{
@@ -430,7 +461,7 @@ namespace LibraryDesktopTests
 				valueRemoveVector.PushBack(additionalFoo);
 				valueRemoveVector.Remove(additionalFoo);
 				Assert::AreEqual(std::size_t{ 6 }, valueRemoveVector.Size());
-				Assert::AreEqual(std::size_t{ 10 }, valueRemoveVector.Capacity());
+				Assert::AreEqual(std::size_t{ 9 }, valueRemoveVector.Capacity());
 			}
 		}
 
@@ -450,7 +481,7 @@ namespace LibraryDesktopTests
 			Assert::AreEqual(std::size_t{ 0 }, vector.Size());
 			Assert::AreEqual(std::size_t{ 0 }, vector.Capacity());
 			Assert::AreEqual(std::size_t{ 5 }, newVector.Size());
-			Assert::AreEqual(std::size_t{ 5 }, newVector.Capacity());
+			Assert::AreEqual(std::size_t{ 6 }, newVector.Capacity());
 			Vector<Foo> assignedVector{};
 			assignedVector = std::move(newVector);
 
@@ -459,7 +490,7 @@ namespace LibraryDesktopTests
 			Assert::AreEqual(std::size_t{ 0 }, newVector.Size());
 			Assert::AreEqual(std::size_t{ 0 }, newVector.Capacity());
 			Assert::AreEqual(std::size_t{ 5 }, assignedVector.Size());
-			Assert::AreEqual(std::size_t{ 5 }, assignedVector.Capacity());
+			Assert::AreEqual(std::size_t{ 6 }, assignedVector.Capacity());
 #pragma warning(pop)
 		}
 
@@ -607,25 +638,76 @@ namespace LibraryDesktopTests
 			Assert::AreEqual(Foo{}, vector.Back());
 		}
 
-		TEST_METHOD(IncrementFunctor)
+		TEST_METHOD(GrowthPolicy)
 		{
 			Vector<Foo> vector{ Foo{0}, Foo{0}, Foo{0} };
-			auto originalFunctor = vector.GetIncrementStrategy();
-			vector.SetIncrementStrategy(UserIncrement<Foo>{});
-			vector.EmplaceBack();
-			Assert::AreEqual(std::size_t{ 13 }, vector.Capacity());
-			vector.SetIncrementStrategy(originalFunctor);
-			vector.EmplaceBack();
-			vector.EmplaceBack();
+			Assert::AreEqual(std::size_t{ 3 }, vector.Capacity());
 			vector.EmplaceBack();
+			Assert::AreEqual(std::size_t{ 4 }, vector.Capacity());
 			vector.EmplaceBack();
+			Assert::AreEqual(std::size_t{ 6 }, vector.Capacity());
 			vector.EmplaceBack();
 			vector.EmplaceBack();
 			vector.EmplaceBack();
-			vector.EmplaceBack();
-			vector.EmplaceBack();
-			vector.EmplaceBack();
-			Assert::AreEqual(std::size_t{ 18 }, vector.Capacity());
+			Assert::AreEqual(std::size_t{ 9 }, vector.Capacity());
+
+			Vector<Foo, UserIncrement<Foo>> userVector{ Foo{0}, Foo{0}, Foo{0} };
+			userVector.EmplaceBack();
+			Assert::AreEqual(std::size_t{ 13 }, userVector.Capacity());
+			for (std::size_t count{ 0 }; count < 10; ++count)
+			{
+				userVector.EmplaceBack();
+			}
+			Assert::AreEqual(std::size_t{ 23 }, userVector.Capacity());
+		}
+		TEST_METHOD(Relocation)
+		{
+			static_assert(TriviallyRelocatable<int>);
+			static_assert(TriviallyRelocatable<Vector<std::string>>);
+			static_assert(!TriviallyRelocatable<std::string>);
+			static_assert(!TriviallyRelocatable<Anchored>);
+
+			{
+				Vector<Anchored> vector;
+				for (int value{ 0 }; value < 100; ++value)
+				{
+					vector.EmplaceBack(value);
+				}
+				vector.Remove(vector.begin() + 10, vector.begin() + 20);
+				vector.ShrinkToFit();
+				vector.Reserve(200);
+
+				Assert::AreEqual(std::size_t{ 90 }, vector.Size());
+				for (std::size_t position{ 0 }; position < vector.Size(); ++position)
+				{
+					Assert::IsTrue(vector[position].IsValid());
+					Assert::AreEqual(static_cast<int>(position < 10 ? position : position + 10), vector[position]._value);
+				}
+			}
+
+			{
+				Vector<std::string> vector{ "a string long enough to be stored on the heap"s, "short"s };
+				for (std::size_t count{ 0 }; count < 20; ++count)
+				{
+					vector.PushBack(vector.Back());
+				}
+				vector.Remove("a string long enough to be stored on the heap"s);
+				Assert::AreEqual(std::size_t{ 21 }, vector.Size());
+				for (const std::string& value : vector)
+				{
+					Assert::AreEqual("short"s, value);
+				}
+			}
+
+			{
+				Vector<Foo> vector{ Foo{ 1 } };
+				for (std::size_t count{ 0 }; count < 20; ++count)
+				{
+					vector.PushBack(vector.Front());
+				}
+				Assert::AreEqual(std::size_t{ 21 }, vector.Size());
+				Assert::AreEqual(Foo{ 1 }, vector.Back());
+			}
 		}
 	private:
 		inline static _CrtMemState _startMemState;
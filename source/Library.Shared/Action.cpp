@@ -19,9 +19,9 @@ namespace FieaGameEngine
 	{
 		_name = name;
 	}
-	Vector<Signature> Action::Signatures()
+	SignatureList Action::Signatures()
 	{
-		return Vector<Signature>
+		return SignatureList
 		{
 			FieaGameEngine::Signature{ "Name", FieaGameEngine::Datum::DatumTypes::String, 1, offsetof(Action, _name) }
 		};
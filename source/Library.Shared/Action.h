@@ -37,7 +37,7 @@ namespace FieaGameEngine
 		/// A Vector of Signatures to be used when building the object for parsing.
 		/// </summary>
 		/// <returns>The Signatures needed to construct the object.</returns>
-		static Vector<Signature> Signatures();
+		static SignatureList Signatures();
 		virtual ~Action() {};
 	};
 }
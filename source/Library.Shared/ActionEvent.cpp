@@ -12,6 +12,11 @@ namespace FieaGameEngine
 	{
 	}
 
+	gsl::owner<ActionEvent*> ActionEvent::Clone() const
+	{
+		return new ActionEvent(*this);
+	}
+
 	void ActionEvent::Update(const GameTime& gameTime)
 	{
 		EventMessageAttributed message{};
@@ -19,15 +24,18 @@ namespace FieaGameEngine
 		auto indices = AuxillaryAttributes();
 		for (std::size_t index{ indices.first }; index < indices.second; ++index)
 		{
-			auto& attribute = message.AppendAuxillaryAttribute(_orderVector[index]->first, _orderVector[index]->second.Type());
-			attribute = _orderVector[index]->second;
+			// The message is copied again for the queue and for every reaction it reaches, so its attributes share this action's storage instead of copying it each time.
+			auto& [name, source] = PairAt(index);
+			source.SetCopyOnWrite(true);
+			auto& attribute = message.AppendAuxillaryAttribute(name, source.Type());
+			attribute = source;
 		}
 
 		GameState::EnqueueEvent(std::make_shared<Event<EventMessageAttributed>>(message), gameTime, std::chrono::milliseconds{ _delay });
 	}
-	Vector<Signature> ActionEvent::Signatures()
+	SignatureList ActionEvent::Signatures()
 	{
-		Vector<Signature> signatures
+		SignatureList signatures
 		{
 			Signature{ "SubType", FieaGameEngine::Datum::DatumTypes::String, 1, offsetof(ActionEvent, _subtype) },
 			Signature{ "Delay", FieaGameEngine::Datum::DatumTypes::Integer, 1, offsetof(ActionEvent, _delay) }
@@ -16,6 +16,11 @@ namespace FieaGameEngine
 		/// </summary>
 		ActionEvent();
 		/// <summary>
+		/// Creates a copy of the action on the heap.
+		/// </summary>
+		/// <returns>A pointer to the newly allocated copy.</returns>
+		gsl::owner<ActionEvent*> Clone() const override;
+		/// <summary>
 		/// Creates the event to be added to the global GameState EventQueue. Copies all auxillary attributes into the payload for delivery. 
 		/// </summary>
 		/// <param name="">const GameTime reference.</param>
@@ -24,7 +29,7 @@ namespace FieaGameEngine
 		/// Returns the Signature of prescribed attributes of the class.
 		/// </summary>
 		/// <returns>A Vector of Signatures describing the prescribed attributes.</returns>
-		static Vector<Signature> Signatures();
+		static SignatureList Signatures();
 	};
 
 	ConcreteFactory(ActionEvent, Scope);
@@ -2,6 +2,21 @@
 
 namespace FieaGameEngine
 {
+	namespace
+	{
+		/// <summary>
+		/// Writes a result as the text of a literal token, formatting into a local buffer so the token's string is the only allocation.
+		/// </summary>
+		template <typename T>
+		std::string ToToken(const T& value)
+		{
+			std::array<char, Datum::CharsBufferSize> buffer;
+			[[maybe_unused]] const std::to_chars_result result{ Datum::Format(buffer.data(), buffer.data() + buffer.size(), value) };
+			assert(result.ec == std::errc{});
+			return std::string{ buffer.data(), result.ptr };
+		}
+	}
+
 	RTTI_DEFINITIONS(ActionExpression);
 
 	ActionExpression::ActionExpression() :
@@ -9,26 +24,40 @@ namespace FieaGameEngine
 	{
 	}
 
-	void ActionExpression::AcceptOutput(Vector<ExpressionParser::Token>&& output)
+	gsl::owner<ActionExpression*> ActionExpression::Clone() const
+	{
+		return new ActionExpression(*this);
+	}
+
+	void ActionExpression::AcceptOutput(ExpressionParser::TokenList&& output)
 	{
 		_output = std::move(output);
 	}
 
-	Vector<ExpressionParser::Token>& ActionExpression::GetOutput()
+	ExpressionParser::TokenList& ActionExpression::GetOutput()
 	{
 		return _output;
 	}
 
 	void ActionExpression::Update(const GameTime& gameTime)
 	{
+		// Resolve the variables on the kept tokens, so the copies executed below start from bindings that are already current.
+		for (auto& token : _output)
+		{
+			if (token._isVariable)
+			{
+				[[maybe_unused]] Datum* variable{ Search(token._binding) };
+			}
+		}
+
 		auto output = _output;
 		ExecuteExpression(output);
 		gameTime;
 	}
 
-	Vector<Signature> ActionExpression::Signatures()
+	SignatureList ActionExpression::Signatures()
 	{
-		Vector<Signature> signatures
+		SignatureList signatures
 		{
 			FieaGameEngine::Signature{ "Expression", Datum::DatumTypes::String, 1, offsetof(ActionExpression, _expression) }
 		};
@@ -48,7 +77,7 @@ namespace FieaGameEngine
 		AcceptOutput(std::move(expressionParser.Output()));
 	}
 
-	void ActionExpression::ExecuteExpression(Vector<ExpressionParser::Token>& output)
+	void ActionExpression::ExecuteExpression(ExpressionParser::TokenList& output)
 	{
 		if (output.Size() > 0)
 		{
@@ -70,7 +99,7 @@ namespace FieaGameEngine
 			output.Remove(output.begin(), ++position);
 			auto operation = _outputStack.Top();
 			_outputStack.Pop();
-			std::array<ArithmeticOperation, 5> functionTable = _functionArrays.At(operation._token);
+			const std::array<ArithmeticOperation, 13>& functionTable = _functionArrays.At(operation._token);
 			ArithmeticOperation func = functionTable.at(std::size_t(_outputStack.Top()._type));
 			assert(func != nullptr);
 			(this->*func)();
@@ -90,7 +119,7 @@ namespace FieaGameEngine
 		assert(lhs._type == Datum::DatumTypes::Integer);
 		assert(lhs._type == rhs._type);
 		int result = lhs.GetAsInt(*this) * rhs.GetAsInt(*this);
-		_outputStack.Push({ std::to_string(result), 0, false, false, Datum::DatumTypes::Integer });
+		_outputStack.Push({ ToToken(result), 0, false, false, Datum::DatumTypes::Integer });
 
 	}
 	void ActionExpression::MultiplyFloats()
@@ -101,7 +130,7 @@ namespace FieaGameEngine
 		assert(lhs._type == Datum::DatumTypes::Float);
 		assert(lhs._type == rhs._type);
 		float result = lhs.GetAsFloat(*this) * rhs.GetAsFloat(*this);
-		_outputStack.Push({ std::to_string(result), 0, false, false, Datum::DatumTypes::Float });
+		_outputStack.Push({ ToToken(result), 0, false, false, Datum::DatumTypes::Float });
 	}
 	void ActionExpression::MultiplyVectors()
 	{
@@ -111,7 +140,7 @@ namespace FieaGameEngine
 		assert(lhs._type == Datum::DatumTypes::Vector);
 		assert(lhs._type == rhs._type);
 		glm::vec4 result = lhs.GetAsVector(*this) * rhs.GetAsVector(*this);
-		_outputStack.Push({ glm::to_string(result), 0, false, false, Datum::DatumTypes::Vector });
+		_outputStack.Push({ ToToken(result), 0, false, false, Datum::DatumTypes::Vector });
 	}
 	void ActionExpression::MultiplyMatrices()
 	{
@@ -121,7 +150,7 @@ namespace FieaGameEngine
 		assert(lhs._type == Datum::DatumTypes::Matrix);
 		assert(lhs._type == rhs._type);
 		glm::mat4 result = lhs.GetAsMatrix(*this) * rhs.GetAsMatrix(*this);
-		_outputStack.Push({ glm::to_string(result), 0, false, false, Datum::DatumTypes::Matrix });
+		_outputStack.Push({ ToToken(result), 0, false, false, Datum::DatumTypes::Matrix });
 	}
 	void ActionExpression::DivideIntegers()
 	{
@@ -131,7 +160,7 @@ namespace FieaGameEngine
 		assert(lhs._type == Datum::DatumTypes::Integer);
 		assert(lhs._type == rhs._type);
 		int result = lhs.GetAsInt(*this) / rhs.GetAsInt(*this);
-		_outputStack.Push({ std::to_string(result), 0, false, false, Datum::DatumTypes::Integer });
+		_outputStack.Push({ ToToken(result), 0, false, false, Datum::DatumTypes::Integer });
 	}
 	void ActionExpression::DivideFloats()
 	{
@@ -141,7 +170,7 @@ namespace FieaGameEngine
 		assert(lhs._type == Datum::DatumTypes::Float);
 		assert(lhs._type == rhs._type);
 		float result = lhs.GetAsFloat(*this) / rhs.GetAsFloat(*this);
-		_outputStack.Push({ std::to_string(result), 0, false, false, Datum::DatumTypes::Float });
+		_outputStack.Push({ ToToken(result), 0, false, false, Datum::DatumTypes::Float });
 	}
 	void ActionExpression::DivideVectors()
 	{
@@ -151,7 +180,7 @@ namespace FieaGameEngine
 		assert(lhs._type == Datum::DatumTypes::Vector);
 		assert(lhs._type == rhs._type);
 		glm::vec4 result = lhs.GetAsVector(*this) / rhs.GetAsVector(*this);
-		_outputStack.Push({ glm::to_string(result), 0, false, false, Datum::DatumTypes::Vector });
+		_outputStack.Push({ ToToken(result), 0, false, false, Datum::DatumTypes::Vector });
 	}
 	void ActionExpression::DivideMatrices()
 	{
@@ -161,7 +190,7 @@ namespace FieaGameEngine
 		assert(lhs._type == Datum::DatumTypes::Matrix);
 		assert(lhs._type == rhs._type);
 		glm::mat4 result = lhs.GetAsMatrix(*this) / rhs.GetAsMatrix(*this);
-		_outputStack.Push({ glm::to_string(result), 0, false, false, Datum::DatumTypes::Matrix });
+		_outputStack.Push({ ToToken(result), 0, false, false, Datum::DatumTypes::Matrix });
 	}
 	void ActionExpression::RemainderIntegers()
 	{
@@ -171,7 +200,7 @@ namespace FieaGameEngine
 		assert(lhs._type == Datum::DatumTypes::Integer);
 		assert(lhs._type == rhs._type);
 		int result = lhs.GetAsInt(*this) % rhs.GetAsInt(*this);
-		_outputStack.Push({ std::to_string(result), 0, false, false, Datum::DatumTypes::Integer });
+		_outputStack.Push({ ToToken(result), 0, false, false, Datum::DatumTypes::Integer });
 	}
 	void ActionExpression::AddIntegers()
 	{
@@ -181,7 +210,7 @@ namespace FieaGameEngine
 		assert(lhs._type == Datum::DatumTypes::Integer);
 		assert(lhs._type == rhs._type);
 		int result = lhs.GetAsInt(*this) + rhs.GetAsInt(*this);
-		_outputStack.Push({ std::to_string(result), 0, false, false, Datum::DatumTypes::Integer });
+		_outputStack.Push({ ToToken(result), 0, false, false, Datum::DatumTypes::Integer });
 	}
 	void ActionExpression::AddFloats()
 	{
@@ -191,7 +220,7 @@ namespace FieaGameEngine
 		assert(lhs._type == Datum::DatumTypes::Float);
 		assert(lhs._type == rhs._type);
 		float result = lhs.GetAsFloat(*this) + rhs.GetAsFloat(*this);
-		_outputStack.Push({ std::to_string(result), 0, false, false, Datum::DatumTypes::Float });
+		_outputStack.Push({ ToToken(result), 0, false, false, Datum::DatumTypes::Float });
 	}
 	void ActionExpression::AddVectors()
 	{
@@ -201,7 +230,7 @@ namespace FieaGameEngine
 		assert(lhs._type == Datum::DatumTypes::Vector);
 		assert(lhs._type == rhs._type);
 		glm::vec4 result = lhs.GetAsVector(*this) + rhs.GetAsVector(*this);
-		_outputStack.Push({ glm::to_string(result), 0, false, false, Datum::DatumTypes::Vector });
+		_outputStack.Push({ ToToken(result), 0, false, false, Datum::DatumTypes::Vector });
 	}
 	void ActionExpression::AddMatrices()
 	{
@@ -211,7 +240,7 @@ namespace FieaGameEngine
 		assert(lhs._type == Datum::DatumTypes::Matrix);
 		assert(lhs._type == rhs._type);
 		glm::mat4 result = lhs.GetAsMatrix(*this) + rhs.GetAsMatrix(*this);
-		_outputStack.Push({ glm::to_string(result), 0, false, false, Datum::DatumTypes::Matrix });
+		_outputStack.Push({ ToToken(result), 0, false, false, Datum::DatumTypes::Matrix });
 	}
 	void ActionExpression::ConcatenateStrings()
 	{
@@ -231,7 +260,7 @@ namespace FieaGameEngine
 		assert(lhs._type == Datum::DatumTypes::Integer);
 		assert(lhs._type == rhs._type);
 		int result = lhs.GetAsInt(*this) - rhs.GetAsInt(*this);
-		_outputStack.Push({ std::to_string(result), 0, false, false, Datum::DatumTypes::Integer });
+		_outputStack.Push({ ToToken(result), 0, false, false, Datum::DatumTypes::Integer });
 	}
 	void ActionExpression::SubtractFloats()
 	{
@@ -241,7 +270,7 @@ namespace FieaGameEngine
 		assert(lhs._type == Datum::DatumTypes::Float);
 		assert(lhs._type == rhs._type);
 		float result = lhs.GetAsFloat(*this) - rhs.GetAsFloat(*this);
-		_outputStack.Push({ std::to_string(result), 0, false, false, Datum::DatumTypes::Float });
+		_outputStack.Push({ ToToken(result), 0, false, false, Datum::DatumTypes::Float });
 	}
 	void ActionExpression::SubtractVectors()
 	{
@@ -251,7 +280,7 @@ namespace FieaGameEngine
 		assert(lhs._type == Datum::DatumTypes::Vector);
 		assert(lhs._type == rhs._type);
 		glm::vec4 result = lhs.GetAsVector(*this) - rhs.GetAsVector(*this);
-		_outputStack.Push({ glm::to_string(result), 0, false, false, Datum::DatumTypes::Vector });
+		_outputStack.Push({ ToToken(result), 0, false, false, Datum::DatumTypes::Vector });
 	}
 	void ActionExpression::SubtractMatrices()
 	{
@@ -261,7 +290,7 @@ namespace FieaGameEngine
 		assert(lhs._type == Datum::DatumTypes::Matrix);
 		assert(lhs._type == rhs._type);
 		glm::mat4 result = lhs.GetAsMatrix(*this) - rhs.GetAsMatrix(*this);
-		_outputStack.Push({ glm::to_string(result), 0, false, false, Datum::DatumTypes::Matrix });
+		_outputStack.Push({ ToToken(result), 0, false, false, Datum::DatumTypes::Matrix });
 	}
 	void ActionExpression::GreaterThanIntegers()
 	{
@@ -271,7 +300,7 @@ namespace FieaGameEngine
 		assert(lhs._type == Datum::DatumTypes::Integer);
 		assert(lhs._type == rhs._type);
 		bool result = lhs.GetAsInt(*this) > rhs.GetAsInt(*this);
-		_outputStack.Push({ std::to_string(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
+		_outputStack.Push({ ToToken(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
 	}
 	void ActionExpression::GreaterThanFloats()
 	{
@@ -281,7 +310,7 @@ namespace FieaGameEngine
 		assert(lhs._type == Datum::DatumTypes::Float);
 		assert(lhs._type == rhs._type);
 		bool result = lhs.GetAsFloat(*this) > rhs.GetAsFloat(*this);
-		_outputStack.Push({ std::to_string(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
+		_outputStack.Push({ ToToken(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
 	}
 	void ActionExpression::GreaterThanString()
 	{
@@ -291,7 +320,7 @@ namespace FieaGameEngine
 		assert(lhs._type == Datum::DatumTypes::String);
 		assert(lhs._type == rhs._type);
 		bool result = lhs.GetAsString(*this) > rhs.GetAsString(*this);
-		_outputStack.Push({ std::to_string(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
+		_outputStack.Push({ ToToken(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
 	}
 	void ActionExpression::GreaterThanEqualToIntegers()
 	{
@@ -301,7 +330,7 @@ namespace FieaGameEngine
 		assert(lhs._type == Datum::DatumTypes::Integer);
 		assert(lhs._type == rhs._type);
 		bool result = lhs.GetAsInt(*this) >= rhs.GetAsInt(*this);
-		_outputStack.Push({ std::to_string(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
+		_outputStack.Push({ ToToken(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
 	}
 	void ActionExpression::GreaterThanEqualToFloats()
 	{
@@ -311,7 +340,7 @@ namespace FieaGameEngine
 		assert(lhs._type == Datum::DatumTypes::Float);
 		assert(lhs._type == rhs._type);
 		bool result = lhs.GetAsFloat(*this) >= rhs.GetAsFloat(*this);
-		_outputStack.Push({ std::to_string(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
+		_outputStack.Push({ ToToken(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
 	}
 	void ActionExpression::GreaterThanEqualToString()
 	{
@@ -321,7 +350,7 @@ namespace FieaGameEngine
 		assert(lhs._type == Datum::DatumTypes::String);
 		assert(lhs._type == rhs._type);
 		bool result = lhs.GetAsString(*this) >= rhs.GetAsString(*this);
-		_outputStack.Push({ std::to_string(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
+		_outputStack.Push({ ToToken(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
 	}
 	void ActionExpression::LessThanIntegers()
 	{
@@ -331,7 +360,7 @@ namespace FieaGameEngine
 		assert(lhs._type == Datum::DatumTypes::Integer);
 		assert(lhs._type == rhs._type);
 		bool result = lhs.GetAsInt(*this) < rhs.GetAsInt(*this);
-		_outputStack.Push({ std::to_string(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
+		_outputStack.Push({ ToToken(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
 	}
 	void ActionExpression::LessThanFloats()
 	{
@@ -341,7 +370,7 @@ namespace FieaGameEngine
 		assert(lhs._type == Datum::DatumTypes::Float);
 		assert(lhs._type == rhs._type);
 		bool result = lhs.GetAsFloat(*this) < rhs.GetAsFloat(*this);
-		_outputStack.Push({ std::to_string(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
+		_outputStack.Push({ ToToken(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
 	}
 	void ActionExpression::LessThanString()
 	{
@@ -351,7 +380,7 @@ namespace FieaGameEngine
 		assert(lhs._type == Datum::DatumTypes::String);
 		assert(lhs._type == rhs._type);
 		bool result = lhs.GetAsString(*this) < rhs.GetAsString(*this);
-		_outputStack.Push({ std::to_string(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
+		_outputStack.Push({ ToToken(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
 	}
 	void ActionExpression::LessThanEqualToIntegers()
 	{
@@ -361,7 +390,7 @@ namespace FieaGameEngine
 		assert(lhs._type == Datum::DatumTypes::Integer);
 		assert(lhs._type == rhs._type);
 		bool result = lhs.GetAsInt(*this) <= rhs.GetAsInt(*this);
-		_outputStack.Push({ std::to_string(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
+		_outputStack.Push({ ToToken(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
 	}
 	void ActionExpression::LessThanEqualToFloats()
 	{
@@ -371,7 +400,7 @@ namespace FieaGameEngine
 		assert(lhs._type == Datum::DatumTypes::Float);
 		assert(lhs._type == rhs._type);
 		bool result = lhs.GetAsFloat(*this) <= rhs.GetAsFloat(*this);
-		_outputStack.Push({ std::to_string(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
+		_outputStack.Push({ ToToken(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
 	}
 	void ActionExpression::LessThanEqualToString()
 	{
@@ -381,7 +410,7 @@ namespace FieaGameEngine
 		assert(lhs._type == Datum::DatumTypes::String);
 		assert(lhs._type == rhs._type);
 		bool result = lhs.GetAsString(*this) <= rhs.GetAsString(*this);
-		_outputStack.Push({ std::to_string(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
+		_outputStack.Push({ ToToken(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
 	}
 	void ActionExpression::EqualToIntegers()
 	{
@@ -391,7 +420,7 @@ namespace FieaGameEngine
 		assert(lhs._type == Datum::DatumTypes::Integer);
 		assert(lhs._type == rhs._type);
 		bool result = lhs.GetAsInt(*this) == rhs.GetAsInt(*this);
-		_outputStack.Push({ std::to_string(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
+		_outputStack.Push({ ToToken(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
 	}
 	void ActionExpression::EqualToFloats()
 	{
@@ -401,7 +430,7 @@ namespace FieaGameEngine
 		assert(lhs._type == Datum::DatumTypes::Float);
 		assert(lhs._type == rhs._type);
 		bool result = lhs.GetAsFloat(*this) == rhs.GetAsFloat(*this);
-		_outputStack.Push({ std::to_string(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
+		_outputStack.Push({ ToToken(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
 	}
 	void ActionExpression::EqualToString()
 	{
@@ -411,7 +440,7 @@ namespace FieaGameEngine
 		assert(lhs._type == Datum::DatumTypes::String);
 		assert(lhs._type == rhs._type);
 		bool result = lhs.GetAsString(*this) == rhs.GetAsString(*this);
-		_outputStack.Push({ std::to_string(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
+		_outputStack.Push({ ToToken(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
 	}
 	void ActionExpression::NotEqualToIntegers()
 	{
@@ -421,7 +450,7 @@ namespace FieaGameEngine
 		assert(lhs._type == Datum::DatumTypes::Integer);
 		assert(lhs._type == rhs._type);
 		bool result = lhs.GetAsInt(*this) != rhs.GetAsInt(*this);
-		_outputStack.Push({ std::to_string(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
+		_outputStack.Push({ ToToken(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
 	}
 	void ActionExpression::NotEqualToFloats()
 	{
@@ -431,7 +460,7 @@ namespace FieaGameEngine
 		assert(lhs._type == Datum::DatumTypes::Float);
 		assert(lhs._type == rhs._type);
 		bool result = lhs.GetAsFloat(*this) != rhs.GetAsFloat(*this);
-		_outputStack.Push({ std::to_string(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
+		_outputStack.Push({ ToToken(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
 	}
 	void ActionExpression::NotEqualToString()
 	{
@@ -441,7 +470,7 @@ namespace FieaGameEngine
 		assert(lhs._type == Datum::DatumTypes::String);
 		assert(lhs._type == rhs._type);
 		bool result = lhs.GetAsString(*this) != rhs.GetAsString(*this);
-		_outputStack.Push({ std::to_string(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
+		_outputStack.Push({ ToToken(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
 	}
 	void ActionExpression::LogicalNot()
 	{
@@ -459,7 +488,354 @@ namespace FieaGameEngine
 			result = 0;
 		}
 
-		_outputStack.Push({ std::to_string(result), 0, false, false, Datum::DatumTypes::Integer });
+		_outputStack.Push({ ToToken(result), 0, false, false, Datum::DatumTypes::Integer });
+	}
+	void ActionExpression::MultiplyInt64s()
+	{
+		auto operands = TwoVariableOperation();
+		auto& lhs = operands.first;
+		auto& rhs = operands.second;
+		assert(lhs._type == Datum::DatumTypes::Int64);
+		assert(lhs._type == rhs._type);
+		std::int64_t result = lhs.GetAsInt64(*this) * rhs.GetAsInt64(*this);
+		_outputStack.Push({ ToToken(result), 0, false, false, Datum::DatumTypes::Int64 });
+	}
+	void ActionExpression::DivideInt64s()
+	{
+		auto operands = TwoVariableOperation();
+		auto& lhs = operands.first;
+		auto& rhs = operands.second;
+		assert(lhs._type == Datum::DatumTypes::Int64);
+		assert(lhs._type == rhs._type);
+		std::int64_t result = lhs.GetAsInt64(*this) / rhs.GetAsInt64(*this);
+		_outputStack.Push({ ToToken(result), 0, false, false, Datum::DatumTypes::Int64 });
+	}
+	void ActionExpression::RemainderInt64s()
+	{
+		auto operands = TwoVariableOperation();
+		auto& lhs = operands.first;
+		auto& rhs = operands.second;
+		assert(lhs._type == Datum::DatumTypes::Int64);
+		assert(lhs._type == rhs._type);
+		std::int64_t result = lhs.GetAsInt64(*this) % rhs.GetAsInt64(*this);
+		_outputStack.Push({ ToToken(result), 0, false, false, Datum::DatumTypes::Int64 });
+	}
+	void ActionExpression::AddInt64s()
+	{
+		auto operands = TwoVariableOperation();
+		auto& lhs = operands.first;
+		auto& rhs = operands.second;
+		assert(lhs._type == Datum::DatumTypes::Int64);
+		assert(lhs._type == rhs._type);
+		std::int64_t result = lhs.GetAsInt64(*this) + rhs.GetAsInt64(*this);
+		_outputStack.Push({ ToToken(result), 0, false, false, Datum::DatumTypes::Int64 });
+	}
+	void ActionExpression::SubtractInt64s()
+	{
+		auto operands = TwoVariableOperation();
+		auto& lhs = operands.first;
+		auto& rhs = operands.second;
+		assert(lhs._type == Datum::DatumTypes::Int64);
+		assert(lhs._type == rhs._type);
+		std::int64_t result = lhs.GetAsInt64(*this) - rhs.GetAsInt64(*this);
+		_outputStack.Push({ ToToken(result), 0, false, false, Datum::DatumTypes::Int64 });
+	}
+	void ActionExpression::GreaterThanInt64s()
+	{
+		auto operands = TwoVariableOperation();
+		auto& lhs = operands.first;
+		auto& rhs = operands.second;
+		assert(lhs._type == Datum::DatumTypes::Int64);
+		assert(lhs._type == rhs._type);
+		bool result = lhs.GetAsInt64(*this) > rhs.GetAsInt64(*this);
+		_outputStack.Push({ ToToken(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
+	}
+	void ActionExpression::GreaterThanEqualToInt64s()
+	{
+		auto operands = TwoVariableOperation();
+		auto& lhs = operands.first;
+		auto& rhs = operands.second;
+		assert(lhs._type == Datum::DatumTypes::Int64);
+		assert(lhs._type == rhs._type);
+		bool result = lhs.GetAsInt64(*this) >= rhs.GetAsInt64(*this);
+		_outputStack.Push({ ToToken(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
+	}
+	void ActionExpression::LessThanInt64s()
+	{
+		auto operands = TwoVariableOperation();
+		auto& lhs = operands.first;
+		auto& rhs = operands.second;
+		assert(lhs._type == Datum::DatumTypes::Int64);
+		assert(lhs._type == rhs._type);
+		bool result = lhs.GetAsInt64(*this) < rhs.GetAsInt64(*this);
+		_outputStack.Push({ ToToken(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
+	}
+	void ActionExpression::LessThanEqualToInt64s()
+	{
+		auto operands = TwoVariableOperation();
+		auto& lhs = operands.first;
+		auto& rhs = operands.second;
+		assert(lhs._type == Datum::DatumTypes::Int64);
+		assert(lhs._type == rhs._type);
+		bool result = lhs.GetAsInt64(*this) <= rhs.GetAsInt64(*this);
+		_outputStack.Push({ ToToken(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
+	}
+	void ActionExpression::EqualToInt64s()
+	{
+		auto operands = TwoVariableOperation();
+		auto& lhs = operands.first;
+		auto& rhs = operands.second;
+		assert(lhs._type == Datum::DatumTypes::Int64);
+		assert(lhs._type == rhs._type);
+		bool result = lhs.GetAsInt64(*this) == rhs.GetAsInt64(*this);
+		_outputStack.Push({ ToToken(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
+	}
+	void ActionExpression::NotEqualToInt64s()
+	{
+		auto operands = TwoVariableOperation();
+		auto& lhs = operands.first;
+		auto& rhs = operands.second;
+		assert(lhs._type == Datum::DatumTypes::Int64);
+		assert(lhs._type == rhs._type);
+		bool result = lhs.GetAsInt64(*this) != rhs.GetAsInt64(*this);
+		_outputStack.Push({ ToToken(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
+	}
+	void ActionExpression::MultiplyDoubles()
+	{
+		auto operands = TwoVariableOperation();
+		auto& lhs = operands.first;
+		auto& rhs = operands.second;
+		assert(lhs._type == Datum::DatumTypes::Double);
+		assert(lhs._type == rhs._type);
+		double result = lhs.GetAsDouble(*this) * rhs.GetAsDouble(*this);
+		_outputStack.Push({ ToToken(result), 0, false, false, Datum::DatumTypes::Double });
+	}
+	void ActionExpression::DivideDoubles()
+	{
+		auto operands = TwoVariableOperation();
+		auto& lhs = operands.first;
+		auto& rhs = operands.second;
+		assert(lhs._type == Datum::DatumTypes::Double);
+		assert(lhs._type == rhs._type);
+		double result = lhs.GetAsDouble(*this) / rhs.GetAsDouble(*this);
+		_outputStack.Push({ ToToken(result), 0, false, false, Datum::DatumTypes::Double });
+	}
+	void ActionExpression::AddDoubles()
+	{
+		auto operands = TwoVariableOperation();
+		auto& lhs = operands.first;
+		auto& rhs = operands.second;
+		assert(lhs._type == Datum::DatumTypes::Double);
+		assert(lhs._type == rhs._type);
+		double result = lhs.GetAsDouble(*this) + rhs.GetAsDouble(*this);
+		_outputStack.Push({ ToToken(result), 0, false, false, Datum::DatumTypes::Double });
+	}
+	void ActionExpression::SubtractDoubles()
+	{
+		auto operands = TwoVariableOperation();
+		auto& lhs = operands.first;
+		auto& rhs = operands.second;
+		assert(lhs._type == Datum::DatumTypes::Double);
+		assert(lhs._type == rhs._type);
+		double result = lhs.GetAsDouble(*this) - rhs.GetAsDouble(*this);
+		_outputStack.Push({ ToToken(result), 0, false, false, Datum::DatumTypes::Double });
+	}
+	void ActionExpression::GreaterThanDoubles()
+	{
+		auto operands = TwoVariableOperation();
+		auto& lhs = operands.first;
+		auto& rhs = operands.second;
+		assert(lhs._type == Datum::DatumTypes::Double);
+		assert(lhs._type == rhs._type);
+		bool result = lhs.GetAsDouble(*this) > rhs.GetAsDouble(*this);
+		_outputStack.Push({ ToToken(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
+	}
+	void ActionExpression::GreaterThanEqualToDoubles()
+	{
+		auto operands = TwoVariableOperation();
+		auto& lhs = operands.first;
+		auto& rhs = operands.second;
+		assert(lhs._type == Datum::DatumTypes::Double);
+		assert(lhs._type == rhs._type);
+		bool result = lhs.GetAsDouble(*this) >= rhs.GetAsDouble(*this);
+		_outputStack.Push({ ToToken(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
+	}
+	void ActionExpression::LessThanDoubles()
+	{
+		auto operands = TwoVariableOperation();
+		auto& lhs = operands.first;
+		auto& rhs = operands.second;
+		assert(lhs._type == Datum::DatumTypes::Double);
+		assert(lhs._type == rhs._type);
+		bool result = lhs.GetAsDouble(*this) < rhs.GetAsDouble(*this);
+		_outputStack.Push({ ToToken(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
+	}
+	void ActionExpression::LessThanEqualToDoubles()
+	{
+		auto operands = TwoVariableOperation();
+		auto& lhs = operands.first;
+		auto& rhs = operands.second;
+		assert(lhs._type == Datum::DatumTypes::Double);
+		assert(lhs._type == rhs._type);
+		bool result = lhs.GetAsDouble(*this) <= rhs.GetAsDouble(*this);
+		_outputStack.Push({ ToToken(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
+	}
+	void ActionExpression::EqualToDoubles()
+	{
+		auto operands = TwoVariableOperation();
+		auto& lhs = operands.first;
+		auto& rhs = operands.second;
+		assert(lhs._type == Datum::DatumTypes::Double);
+		assert(lhs._type == rhs._type);
+		bool result = lhs.GetAsDouble(*this) == rhs.GetAsDouble(*this);
+		_outputStack.Push({ ToToken(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
+	}
+	void ActionExpression::NotEqualToDoubles()
+	{
+		auto operands = TwoVariableOperation();
+		auto& lhs = operands.first;
+		auto& rhs = operands.second;
+		assert(lhs._type == Datum::DatumTypes::Double);
+		assert(lhs._type == rhs._type);
+		bool result = lhs.GetAsDouble(*this) != rhs.GetAsDouble(*this);
+		_outputStack.Push({ ToToken(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
+	}
+	void ActionExpression::EqualToBools()
+	{
+		auto operands = TwoVariableOperation();
+		auto& lhs = operands.first;
+		auto& rhs = operands.second;
+		assert(lhs._type == Datum::DatumTypes::Bool);
+		assert(lhs._type == rhs._type);
+		bool result = lhs.GetAsBool(*this) == rhs.GetAsBool(*this);
+		_outputStack.Push({ ToToken(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
+	}
+	void ActionExpression::NotEqualToBools()
+	{
+		auto operands = TwoVariableOperation();
+		auto& lhs = operands.first;
+		auto& rhs = operands.second;
+		assert(lhs._type == Datum::DatumTypes::Bool);
+		assert(lhs._type == rhs._type);
+		bool result = lhs.GetAsBool(*this) != rhs.GetAsBool(*this);
+		_outputStack.Push({ ToToken(BoolToInt(result)), 0, false, false, Datum::DatumTypes::Integer });
+	}
+	void ActionExpression::LogicalNotBools()
+	{
+		auto operand = SingleVariableOperation();
+		assert(operand._type == Datum::DatumTypes::Bool);
+		bool result = !operand.GetAsBool(*this);
+		_outputStack.Push({ ToToken(result), 0, false, false, Datum::DatumTypes::Bool });
+	}
+	void ActionExpression::MultiplyVector2s()
+	{
+		auto operands = TwoVariableOperation();
+		auto& lhs = operands.first;
+		auto& rhs = operands.second;
+		assert(lhs._type == Datum::DatumTypes::Vector2);
+		assert(lhs._type == rhs._type);
+		glm::vec2 result = lhs.GetAsVector2(*this) * rhs.GetAsVector2(*this);
+		_outputStack.Push({ ToToken(result), 0, false, false, Datum::DatumTypes::Vector2 });
+	}
+	void ActionExpression::DivideVector2s()
+	{
+		auto operands = TwoVariableOperation();
+		auto& lhs = operands.first;
+		auto& rhs = operands.second;
+		assert(lhs._type == Datum::DatumTypes::Vector2);
+		assert(lhs._type == rhs._type);
+		glm::vec2 result = lhs.GetAsVector2(*this) / rhs.GetAsVector2(*this);
+		_outputStack.Push({ ToToken(result), 0, false, false, Datum::DatumTypes::Vector2 });
+	}
+	void ActionExpression::AddVector2s()
+	{
+		auto operands = TwoVariableOperation();
+		auto& lhs = operands.first;
+		auto& rhs = operands.second;
+		assert(lhs._type == Datum::DatumTypes::Vector2);
+		assert(lhs._type == rhs._type);
+		glm::vec2 result = lhs.GetAsVector2(*this) + rhs.GetAsVector2(*this);
+		_outputStack.Push({ ToToken(result), 0, false, false, Datum::DatumTypes::Vector2 });
+	}
+	void ActionExpression::SubtractVector2s()
+	{
+		auto operands = TwoVariableOperation();
+		auto& lhs = operands.first;
+		auto& rhs = operands.second;
+		assert(lhs._type == Datum::DatumTypes::Vector2);
+		assert(lhs._type == rhs._type);
+		glm::vec2 result = lhs.GetAsVector2(*this) - rhs.GetAsVector2(*this);
+		_outputStack.Push({ ToToken(result), 0, false, false, Datum::DatumTypes::Vector2 });
+	}
+	void ActionExpression::MultiplyVector3s()
+	{
+		auto operands = TwoVariableOperation();
+		auto& lhs = operands.first;
+		auto& rhs = operands.second;
+		assert(lhs._type == Datum::DatumTypes::Vector3);
+		assert(lhs._type == rhs._type);
+		glm::vec3 result = lhs.GetAsVector3(*this) * rhs.GetAsVector3(*this);
+		_outputStack.Push({ ToToken(result), 0, false, false, Datum::DatumTypes::Vector3 });
+	}
+	void ActionExpression::DivideVector3s()
+	{
+		auto operands = TwoVariableOperation();
+		auto& lhs = operands.first;
+		auto& rhs = operands.second;
+		assert(lhs._type == Datum::DatumTypes::Vector3);
+		assert(lhs._type == rhs._type);
+		glm::vec3 result = lhs.GetAsVector3(*this) / rhs.GetAsVector3(*this);
+		_outputStack.Push({ ToToken(result), 0, false, false, Datum::DatumTypes::Vector3 });
+	}
+	void ActionExpression::AddVector3s()
+	{
+		auto operands = TwoVariableOperation();
+		auto& lhs = operands.first;
+		auto& rhs = operands.second;
+		assert(lhs._type == Datum::DatumTypes::Vector3);
+		assert(lhs._type == rhs._type);
+		glm::vec3 result = lhs.GetAsVector3(*this) + rhs.GetAsVector3(*this);
+		_outputStack.Push({ ToToken(result), 0, false, false, Datum::DatumTypes::Vector3 });
+	}
+	void ActionExpression::SubtractVector3s()
+	{
+		auto operands = TwoVariableOperation();
+		auto& lhs = operands.first;
+		auto& rhs = operands.second;
+		assert(lhs._type == Datum::DatumTypes::Vector3);
+		assert(lhs._type == rhs._type);
+		glm::vec3 result = lhs.GetAsVector3(*this) - rhs.GetAsVector3(*this);
+		_outputStack.Push({ ToToken(result), 0, false, false, Datum::DatumTypes::Vector3 });
+	}
+	void ActionExpression::MultiplyQuaternions()
+	{
+		auto operands = TwoVariableOperation();
+		auto& lhs = operands.first;
+		auto& rhs = operands.second;
+		assert(lhs._type == Datum::DatumTypes::Quaternion);
+		assert(lhs._type == rhs._type);
+		glm::quat result = lhs.GetAsQuaternion(*this) * rhs.GetAsQuaternion(*this);
+		_outputStack.Push({ ToToken(result), 0, false, false, Datum::DatumTypes::Quaternion });
+	}
+	void ActionExpression::AddQuaternions()
+	{
+		auto operands = TwoVariableOperation();
+		auto& lhs = operands.first;
+		auto& rhs = operands.second;
+		assert(lhs._type == Datum::DatumTypes::Quaternion);
+		assert(lhs._type == rhs._type);
+		glm::quat result = lhs.GetAsQuaternion(*this) + rhs.GetAsQuaternion(*this);
+		_outputStack.Push({ ToToken(result), 0, false, false, Datum::DatumTypes::Quaternion });
+	}
+	void ActionExpression::SubtractQuaternions()
+	{
+		auto operands = TwoVariableOperation();
+		auto& lhs = operands.first;
+		auto& rhs = operands.second;
+		assert(lhs._type == Datum::DatumTypes::Quaternion);
+		assert(lhs._type == rhs._type);
+		glm::quat result = lhs.GetAsQuaternion(*this) - rhs.GetAsQuaternion(*this);
+		_outputStack.Push({ ToToken(result), 0, false, false, Datum::DatumTypes::Quaternion });
 	}
 	void ActionExpression::AssignIntegers()
 	{
@@ -468,7 +844,7 @@ namespace FieaGameEngine
 		auto& rhs = operands.second;
 		assert(lhs._isVariable);
 
-		Datum* target = Search(lhs._token);
+		Datum* target = Search(lhs._binding);
 		assert(target != nullptr);
 		assert(target->Type() == Datum::DatumTypes::Integer);
 
@@ -481,7 +857,7 @@ namespace FieaGameEngine
 		auto& rhs = operands.second;
 		assert(lhs._isVariable);
 
-		Datum* target = Search(lhs._token);
+		Datum* target = Search(lhs._binding);
 		assert(target != nullptr);
 		assert(target->Type() == Datum::DatumTypes::Float);
 
@@ -494,7 +870,7 @@ namespace FieaGameEngine
 		auto& rhs = operands.second;
 		assert(lhs._isVariable);
 
-		Datum* target = Search(lhs._token);
+		Datum* target = Search(lhs._binding);
 		assert(target != nullptr);
 		assert(target->Type() == Datum::DatumTypes::Vector);
 
@@ -507,7 +883,7 @@ namespace FieaGameEngine
 		auto& rhs = operands.second;
 		assert(lhs._isVariable);
 
-		Datum* target = Search(lhs._token);
+		Datum* target = Search(lhs._binding);
 		assert(target != nullptr);
 		assert(target->Type() == Datum::DatumTypes::Matrix);
 
@@ -520,12 +896,90 @@ namespace FieaGameEngine
 		auto& rhs = operands.second;
 		assert(lhs._isVariable);
 
-		Datum* target = Search(lhs._token);
+		Datum* target = Search(lhs._binding);
 		assert(target != nullptr);
 		assert(target->Type() == Datum::DatumTypes::String);
 
 		*target = rhs.GetAsString(*this);
 	}
+	void ActionExpression::AssignInt64s()
+	{
+		auto operands = TwoVariableOperation();
+		auto& lhs = operands.first;
+		auto& rhs = operands.second;
+		assert(lhs._isVariable);
+
+		Datum* target = Search(lhs._binding);
+		assert(target != nullptr);
+		assert(target->Type() == Datum::DatumTypes::Int64);
+
+		*target = rhs.GetAsInt64(*this);
+	}
+	void ActionExpression::AssignDoubles()
+	{
+		auto operands = TwoVariableOperation();
+		auto& lhs = operands.first;
+		auto& rhs = operands.second;
+		assert(lhs._isVariable);
+
+		Datum* target = Search(lhs._binding);
+		assert(target != nullptr);
+		assert(target->Type() == Datum::DatumTypes::Double);
+
+		*target = rhs.GetAsDouble(*this);
+	}
+	void ActionExpression::AssignBools()
+	{
+		auto operands = TwoVariableOperation();
+		auto& lhs = operands.first;
+		auto& rhs = operands.second;
+		assert(lhs._isVariable);
+
+		Datum* target = Search(lhs._binding);
+		assert(target != nullptr);
+		assert(target->Type() == Datum::DatumTypes::Bool);
+
+		*target = rhs.GetAsBool(*this);
+	}
+	void ActionExpression::AssignVector2s()
+	{
+		auto operands = TwoVariableOperation();
+		auto& lhs = operands.first;
+		auto& rhs = operands.second;
+		assert(lhs._isVariable);
+
+		Datum* target = Search(lhs._binding);
+		assert(target != nullptr);
+		assert(target->Type() == Datum::DatumTypes::Vector2);
+
+		*target = rhs.GetAsVector2(*this);
+	}
+	void ActionExpression::AssignVector3s()
+	{
+		auto operands = TwoVariableOperation();
+		auto& lhs = operands.first;
+		auto& rhs = operands.second;
+		assert(lhs._isVariable);
+
+		Datum* target = Search(lhs._binding);
+		assert(target != nullptr);
+		assert(target->Type() == Datum::DatumTypes::Vector3);
+
+		*target = rhs.GetAsVector3(*this);
+	}
+	void ActionExpression::AssignQuaternions()
+	{
+		auto operands = TwoVariableOperation();
+		auto& lhs = operands.first;
+		auto& rhs = operands.second;
+		assert(lhs._isVariable);
+
+		Datum* target = Search(lhs._binding);
+		assert(target != nullptr);
+		assert(target->Type() == Datum::DatumTypes::Quaternion);
+
+		*target = rhs.GetAsQuaternion(*this);
+	}
 	int ActionExpression::BoolToInt(bool result)
 	{
 		return result ? 1 : 0;
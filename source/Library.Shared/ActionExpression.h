@@ -8,7 +8,7 @@ namespace FieaGameEngine
 	{
 		RTTI_DECLARATIONS(ActionExpression, Action);
 
-		Vector<ExpressionParser::Token> _output{};
+		ExpressionParser::TokenList _output{};
 		Stack<ExpressionParser::Token> _outputStack{};
 
 		std::string _expression{};
@@ -16,15 +16,16 @@ namespace FieaGameEngine
 
 	public:
 		ActionExpression();
-		void AcceptOutput(Vector<ExpressionParser::Token>&& output);
-		Vector<ExpressionParser::Token>& GetOutput();
+		gsl::owner<ActionExpression*> Clone() const override;
+		void AcceptOutput(ExpressionParser::TokenList&& output);
+		ExpressionParser::TokenList& GetOutput();
 		virtual void Update(const GameTime& gameTime) override;
-		static Vector<Signature> Signatures();
+		static SignatureList Signatures();
 		void Reparse();
 		virtual ~ActionExpression() {};
 
 	private:
-		void ExecuteExpression(Vector<ExpressionParser::Token>&);
+		void ExecuteExpression(ExpressionParser::TokenList&);
 		void MultiplyIntegers();
 		void MultiplyFloats();
 		void MultiplyVectors();
@@ -67,6 +68,47 @@ namespace FieaGameEngine
 		void AssignVectors();
 		void AssignMatrices();
 		void AssignStrings();
+		void MultiplyInt64s();
+		void DivideInt64s();
+		void RemainderInt64s();
+		void AddInt64s();
+		void SubtractInt64s();
+		void GreaterThanInt64s();
+		void GreaterThanEqualToInt64s();
+		void LessThanInt64s();
+		void LessThanEqualToInt64s();
+		void EqualToInt64s();
+		void NotEqualToInt64s();
+		void MultiplyDoubles();
+		void DivideDoubles();
+		void AddDoubles();
+		void SubtractDoubles();
+		void GreaterThanDoubles();
+		void GreaterThanEqualToDoubles();
+		void LessThanDoubles();
+		void LessThanEqualToDoubles();
+		void EqualToDoubles();
+		void NotEqualToDoubles();
+		void EqualToBools();
+		void NotEqualToBools();
+		void LogicalNotBools();
+		void MultiplyVector2s();
+		void DivideVector2s();
+		void AddVector2s();
+		void SubtractVector2s();
+		void MultiplyVector3s();
+		void DivideVector3s();
+		void AddVector3s();
+		void SubtractVector3s();
+		void MultiplyQuaternions();
+		void AddQuaternions();
+		void SubtractQuaternions();
+		void AssignInt64s();
+		void AssignDoubles();
+		void AssignBools();
+		void AssignVector2s();
+		void AssignVector3s();
+		void AssignQuaternions();
 		int BoolToInt(bool result);
 		std::pair<ExpressionParser::Token, ExpressionParser::Token> TwoVariableOperation();
 		ExpressionParser::Token SingleVariableOperation();
@@ -74,125 +116,229 @@ namespace FieaGameEngine
 		using ArithmeticOperation = void(ActionExpression::*)();
 
 
-		inline static const std::array<ArithmeticOperation, 5> _multiplicationFunctions
+		inline static const std::array<ArithmeticOperation, 13> _multiplicationFunctions
 		{
 			&ActionExpression::MultiplyIntegers,
 			&ActionExpression::MultiplyFloats,
 			nullptr,
 			&ActionExpression::MultiplyVectors,
-			&ActionExpression::MultiplyMatrices
+			&ActionExpression::MultiplyMatrices,
+			nullptr,
+			nullptr,
+			&ActionExpression::MultiplyInt64s,
+			&ActionExpression::MultiplyDoubles,
+			nullptr,
+			&ActionExpression::MultiplyVector2s,
+			&ActionExpression::MultiplyVector3s,
+			&ActionExpression::MultiplyQuaternions
 		};
 
-		inline static const std::array<ArithmeticOperation, 5> _divisionFunctions
+		inline static const std::array<ArithmeticOperation, 13> _divisionFunctions
 		{
 			&ActionExpression::DivideIntegers,
 			&ActionExpression::DivideFloats,
 			nullptr,
 			&ActionExpression::DivideVectors,
-			&ActionExpression::DivideMatrices
+			&ActionExpression::DivideMatrices,
+			nullptr,
+			nullptr,
+			&ActionExpression::DivideInt64s,
+			&ActionExpression::DivideDoubles,
+			nullptr,
+			&ActionExpression::DivideVector2s,
+			&ActionExpression::DivideVector3s,
+			nullptr
 		};
 
-		inline static const std::array<ArithmeticOperation, 5> _additionFunctions
+		inline static const std::array<ArithmeticOperation, 13> _additionFunctions
 		{
 			&ActionExpression::AddIntegers,
 			&ActionExpression::AddFloats,
 			&ActionExpression::ConcatenateStrings,
 			&ActionExpression::AddVectors,
-			&ActionExpression::AddMatrices
+			&ActionExpression::AddMatrices,
+			nullptr,
+			nullptr,
+			&ActionExpression::AddInt64s,
+			&ActionExpression::AddDoubles,
+			nullptr,
+			&ActionExpression::AddVector2s,
+			&ActionExpression::AddVector3s,
+			&ActionExpression::AddQuaternions
 		};
 
-		inline static const std::array<ArithmeticOperation, 5> _subtractionFunctions
+		inline static const std::array<ArithmeticOperation, 13> _subtractionFunctions
 		{
 			&ActionExpression::SubtractIntegers,
 			&ActionExpression::SubtractFloats,
 			nullptr,
 			&ActionExpression::SubtractVectors,
-			&ActionExpression::SubtractMatrices
+			&ActionExpression::SubtractMatrices,
+			nullptr,
+			nullptr,
+			&ActionExpression::SubtractInt64s,
+			&ActionExpression::SubtractDoubles,
+			nullptr,
+			&ActionExpression::SubtractVector2s,
+			&ActionExpression::SubtractVector3s,
+			&ActionExpression::SubtractQuaternions
 		};
 
-		inline static const std::array<ArithmeticOperation, 5> _remainderFunctions
+		inline static const std::array<ArithmeticOperation, 13> _remainderFunctions
 		{
 			&ActionExpression::RemainderIntegers,
 			nullptr,
 			nullptr,
 			nullptr,
+			nullptr,
+			nullptr,
+			nullptr,
+			&ActionExpression::RemainderInt64s,
+			nullptr,
+			nullptr,
+			nullptr,
+			nullptr,
 			nullptr
 		};
 
-		inline static const std::array<ArithmeticOperation, 5> _assignmentFunctions
+		inline static const std::array<ArithmeticOperation, 13> _assignmentFunctions
 		{
 			&ActionExpression::AssignIntegers,
 			&ActionExpression::AssignFloats,
 			&ActionExpression::AssignStrings,
 			&ActionExpression::AssignVectors,
-			&ActionExpression::AssignMatrices
+			&ActionExpression::AssignMatrices,
+			nullptr,
+			nullptr,
+			&ActionExpression::AssignInt64s,
+			&ActionExpression::AssignDoubles,
+			&ActionExpression::AssignBools,
+			&ActionExpression::AssignVector2s,
+			&ActionExpression::AssignVector3s,
+			&ActionExpression::AssignQuaternions
 		};
 
-		inline static const std::array<ArithmeticOperation, 5> _greaterThanFunctions
+		inline static const std::array<ArithmeticOperation, 13> _greaterThanFunctions
 		{
 			&ActionExpression::GreaterThanIntegers,
 			&ActionExpression::GreaterThanFloats,
 			&ActionExpression::GreaterThanString,
 			nullptr,
+			nullptr,
+			nullptr,
+			nullptr,
+			&ActionExpression::GreaterThanInt64s,
+			&ActionExpression::GreaterThanDoubles,
+			nullptr,
+			nullptr,
+			nullptr,
 			nullptr
 		};
 
-		inline static const std::array<ArithmeticOperation, 5> _greaterThanEqualToFunctions
+		inline static const std::array<ArithmeticOperation, 13> _greaterThanEqualToFunctions
 		{
 			&ActionExpression::GreaterThanEqualToIntegers,
 			&ActionExpression::GreaterThanEqualToFloats,
 			&ActionExpression::GreaterThanEqualToString,
 			nullptr,
+			nullptr,
+			nullptr,
+			nullptr,
+			&ActionExpression::GreaterThanEqualToInt64s,
+			&ActionExpression::GreaterThanEqualToDoubles,
+			nullptr,
+			nullptr,
+			nullptr,
 			nullptr
 		};
 
-		inline static const std::array<ArithmeticOperation, 5> _lessThanFunctions
+		inline static const std::array<ArithmeticOperation, 13> _lessThanFunctions
 		{
 			&ActionExpression::LessThanIntegers,
 			&ActionExpression::LessThanFloats,
 			&ActionExpression::LessThanString,
 			nullptr,
+			nullptr,
+			nullptr,
+			nullptr,
+			&ActionExpression::LessThanInt64s,
+			&ActionExpression::LessThanDoubles,
+			nullptr,
+			nullptr,
+			nullptr,
 			nullptr
 		};
 
-		inline static const std::array<ArithmeticOperation, 5> _lessThanEqualToFunctions
+		inline static const std::array<ArithmeticOperation, 13> _lessThanEqualToFunctions
 		{
 			&ActionExpression::LessThanEqualToIntegers,
 			&ActionExpression::LessThanEqualToFloats,
 			&ActionExpression::LessThanEqualToString,
 			nullptr,
+			nullptr,
+			nullptr,
+			nullptr,
+			&ActionExpression::LessThanEqualToInt64s,
+			&ActionExpression::LessThanEqualToDoubles,
+			nullptr,
+			nullptr,
+			nullptr,
 			nullptr
 		};
 
-		inline static const std::array<ArithmeticOperation, 5> _equalToFunctions
+		inline static const std::array<ArithmeticOperation, 13> _equalToFunctions
 		{
 			&ActionExpression::EqualToIntegers,
 			&ActionExpression::EqualToFloats,
 			&ActionExpression::EqualToString,
 			nullptr,
+			nullptr,
+			nullptr,
+			nullptr,
+			&ActionExpression::EqualToInt64s,
+			&ActionExpression::EqualToDoubles,
+			&ActionExpression::EqualToBools,
+			nullptr,
+			nullptr,
 			nullptr
 		};
 
-		inline static const std::array<ArithmeticOperation, 5> _notEqualToFunctions
+		inline static const std::array<ArithmeticOperation, 13> _notEqualToFunctions
 		{
 			&ActionExpression::NotEqualToIntegers,
 			&ActionExpression::NotEqualToFloats,
 			&ActionExpression::NotEqualToString,
 			nullptr,
+			nullptr,
+			nullptr,
+			nullptr,
+			&ActionExpression::NotEqualToInt64s,
+			&ActionExpression::NotEqualToDoubles,
+			&ActionExpression::NotEqualToBools,
+			nullptr,
+			nullptr,
 			nullptr
 		};
 
-		inline static const std::array<ArithmeticOperation, 5> _logicalNotFunction
+		inline static const std::array<ArithmeticOperation, 13> _logicalNotFunction
 		{
 			&ActionExpression::LogicalNot,
 			nullptr,
 			nullptr,
 			nullptr,
+			nullptr,
+			nullptr,
+			nullptr,
+			nullptr,
+			nullptr,
+			&ActionExpression::LogicalNotBools,
+			nullptr,
+			nullptr,
 			nullptr
 		};
 
 
-		inline static HashMap<std::string, std::array<ArithmeticOperation, 5>> _functionArrays
+		inline static HashMap<std::string, std::array<ArithmeticOperation, 13>> _functionArrays
 		{
 			std::pair{"+", _additionFunctions},
 			std::pair{"-", _subtractionFunctions},
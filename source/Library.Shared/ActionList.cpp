@@ -14,6 +14,11 @@ namespace FieaGameEngine
 	{
 	}
 
+	gsl::owner<ActionList*> ActionList::Clone() const
+	{
+		return new ActionList(*this);
+	}
+
 	void ActionList::Update(const GameTime& gameTime) 
 	{
 		Datum& actions = Append("Actions");
@@ -27,9 +32,9 @@ namespace FieaGameEngine
 		}
 	}
 
-	Vector<Signature> ActionList::Signatures()
+	SignatureList ActionList::Signatures()
 	{
-		return Vector<Signature>
+		return SignatureList
 		{
 			{ "Actions", Datum::DatumTypes::Table, 0, 0 }
 		};
@@ -23,6 +23,11 @@ namespace FieaGameEngine
 		/// </summary>
 		ActionList();
 		/// <summary>
+		/// Creates a copy of the list on the heap, nested actions included.
+		/// </summary>
+		/// <returns>A pointer to the newly allocated copy.</returns>
+		gsl::owner<ActionList*> Clone() const override;
+		/// <summary>
 		/// Update method for ActionList that calls update on every action found in "Actions". 
 		/// </summary>
 		/// <param name=""></param>
@@ -32,7 +37,7 @@ namespace FieaGameEngine
 		/// Signatures for the construction of an ActionList.
 		/// </summary>
 		/// <returns></returns>
-		static Vector<Signature> Signatures();
+		static SignatureList Signatures();
 	};
 
 	ConcreteFactory(ActionList, Scope);
@@ -9,6 +9,16 @@ namespace FieaGameEngine
 	{
 	}
 
+	ActionListSwitch::ActionListSwitch(const ActionListSwitch& other) :
+		ActionList(other), _value{ other._value }
+	{
+	}
+
+	gsl::owner<ActionListSwitch*> ActionListSwitch::Clone() const
+	{
+		return new ActionListSwitch(*this);
+	}
+
 	void ActionListSwitch::Update(const GameTime& gameTime)
 	{
 		Datum& actions = Append("Actions");
@@ -47,9 +57,9 @@ namespace FieaGameEngine
 		}
 	}
 
-	Vector<Signature> ActionListSwitch::Signatures()
+	SignatureList ActionListSwitch::Signatures()
 	{
-		Vector<Signature> signatures
+		SignatureList signatures
 		{
 			FieaGameEngine::Signature{ "Value", Datum::DatumTypes::String, 1, offsetof(ActionListSwitch, _value) }
 		};
@@ -41,6 +41,16 @@ namespace FieaGameEngine
 		/// </summary>
 		ActionListSwitch();
 		/// <summary>
+		/// Copies the switch and its cases. The table of cases points at the actions of the original, so the copy builds its own on its first Update.
+		/// </summary>
+		/// <param name="other">The switch to copy.</param>
+		ActionListSwitch(const ActionListSwitch& other);
+		/// <summary>
+		/// Creates a copy of the switch on the heap, nested actions included.
+		/// </summary>
+		/// <returns>A pointer to the newly allocated copy.</returns>
+		gsl::owner<ActionListSwitch*> Clone() const override;
+		/// <summary>
 		/// Given its value in JSON script, it will perform the corresponding action on Update.
 		/// </summary>
 		/// <param name="gameTime">Reference to an instance of a GameTime.</param>
@@ -49,7 +59,7 @@ namespace FieaGameEngine
 		/// Returns the Vector of Signatures neccessary to construct an ActionListSwitch.
 		/// </summary>
 		/// <returns></returns>
-		static Vector<Signature> Signatures();
+		static SignatureList Signatures();
 
 	};
 
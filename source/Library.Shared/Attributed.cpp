@@ -11,74 +11,83 @@ namespace FieaGameEngine
 	}
 
 	Attributed::Attributed(const Attributed& other) :
-		Scope{ other }
+		Scope{ other }, _signatures{ other._signatures }
 	{
-		(*this)["this"s] = this;
-		SetExternalStorage(other.TypeIdInstance());
+		PairAt(0).second = this;
+		SetExternalStorage();
 	}
 
 	Attributed::Attributed(Attributed&& other) noexcept :
-		Scope{ std::move(other) }
+		Scope{ std::move(other) }, _signatures{ other._signatures }
 	{
-		(*this)["this"s] = this;
-		SetExternalStorage(other.TypeIdInstance());
+		PairAt(0).second = this;
+		SetExternalStorage();
 	}
 
 	Attributed& Attributed::operator=(const Attributed& other)
 	{
 		Scope::operator=(other);
-		(*this)["this"s] = this;
-		SetExternalStorage(other.TypeIdInstance());
+		_signatures = other._signatures;
+		PairAt(0).second = this;
+		SetExternalStorage();
 		return *this;
 	}
 
 	Attributed& Attributed::operator=(Attributed&& other) noexcept
 	{
 		Scope::operator=(std::move(other));
-		(*this)["this"s] = this;
-		SetExternalStorage(other.TypeIdInstance());
+		_signatures = other._signatures;
+		PairAt(0).second = this;
+		SetExternalStorage();
 		return *this;
 	}
 
-	bool Attributed::IsAttribute(const std::string& attributeName)
+	bool Attributed::IsAttribute(std::string_view attributeName)
 	{
-		return Find(attributeName) == nullptr ? false : true;
+		return std::as_const(*this).Find(attributeName) == nullptr ? false : true;
 	}
 
-	bool Attributed::IsPrescribedAttribute(const std::string& attributeName) const
+	bool Attributed::IsPrescribedAttribute(std::string_view attributeName) const
 	{
 		return CompareKeys(attributeName, PrescribedAttributes());
 	}
 
-	bool Attributed::IsAuxillaryAttribute(const std::string& attributeName) const
+	bool Attributed::IsAuxillaryAttribute(std::string_view attributeName) const
 	{
-		return CompareKeys(attributeName, AuxillaryAttributes());
+		if (CompareKeys(attributeName, AuxillaryAttributes()))
+		{
+			return true;
+		}
+		// An instance of a prefab reads the auxillary attributes it has not written from its prototype.
+		const Attributed* prototype{ Prototype() != nullptr ? Prototype()->As<Attributed>() : nullptr };
+		return prototype != nullptr && prototype->IsAuxillaryAttribute(attributeName);
 	}
 
-	Datum& Attributed::AppendAuxillaryAttribute(const std::string& attributeName, Datum::DatumTypes type)
+	Datum& Attributed::AppendAuxillaryAttribute(std::string_view attributeName, Datum::DatumTypes type)
 	{
 		assert(!IsPrescribedAttribute(attributeName));
 		return Append(attributeName, type);
 	}
 
-	Attributed::Indices Attributed::Attributes() const
+	Datum& Attributed::AppendAuxillaryAttribute(const Symbol& attributeName, Datum::DatumTypes type)
 	{
-		return { 1, _orderVector.Size() };
+		assert(!IsPrescribedAttribute(attributeName.Name()));
+		return Append(attributeName, type);
 	}
 
-	Attributed::Indices Attributed::PrescribedAttributes() const
+	Attributed::Indices Attributed::Attributes() const
 	{
-		return { 1, TypeManager::Instance()->GetSignatureForTypeID(TypeIdInstance()).Size() + 1 };
+		return { 1, Size() };
 	}
 
-	Attributed::Indices Attributed::PrescribedAttributes(RTTI::IdType rttiType) const
+	Attributed::Indices Attributed::PrescribedAttributes() const
 	{
-		return { 1, TypeManager::Instance()->GetSignatureForTypeID(rttiType).Size() + 1 };
+		return { 1, _signatures->Size() + 1 };
 	}
 
 	Attributed::Indices Attributed::AuxillaryAttributes() const
 	{
-		return { TypeManager::Instance()->GetSignatureForTypeID(TypeIdInstance()).Size() + 1, _orderVector.Size() };
+		return { _signatures->Size() + 1, Size() };
 	}
 
 	void Attributed::Clear()
@@ -91,9 +100,9 @@ namespace FieaGameEngine
 	{
 		auto typeManager = TypeManager::Instance();
 		assert(typeManager != nullptr);
-		auto& signatures = typeManager->GetSignatureForTypeID(rttiType);
+		_signatures = &typeManager->GetSignatureForTypeID(rttiType);
 		(*this)["this"s] = this;
-		for (auto& signature : signatures)
+		for (auto& signature : *_signatures)
 		{
 			Datum& member = Append(signature._name, signature._type);
 			if (signature._type != Datum::DatumTypes::Table)
@@ -107,28 +116,28 @@ namespace FieaGameEngine
 		}
 	}
 
-	void Attributed::SetExternalStorage(RTTI::IdType rttiType)
+	void Attributed::SetExternalStorage()
 	{
-		auto typeManager = TypeManager::Instance();
-		assert(typeManager != nullptr);
-		auto& signatures = typeManager->GetSignatureForTypeID(rttiType);
-		auto indices = PrescribedAttributes(rttiType);
+		assert(_signatures != nullptr);
+		const SignatureList& signatures{ *_signatures };
+		auto indices = PrescribedAttributes();
 
 		for (auto index{ indices.first }; index != indices.second; ++index)
 		{
-			if (_orderVector[index]->second.Type() != Datum::DatumTypes::Table)
+			Datum& attribute = PairAt(index).second;
+			if (attribute.Type() != Datum::DatumTypes::Table)
 			{
-				auto currentSignature = signatures[index - 1];
-				_orderVector[index]->second.SetStorage(reinterpret_cast<std::byte*>(this) + currentSignature._offset, currentSignature._size);
+				const Signature& currentSignature = signatures[index - 1];
+				attribute.SetStorage(reinterpret_cast<std::byte*>(this) + currentSignature._offset, currentSignature._size);
 			}
 		}
 	}
 
-	bool Attributed::CompareKeys(const std::string& attributeName, Indices indices) const
+	bool Attributed::CompareKeys(std::string_view attributeName, Indices indices) const
 	{
 		for (auto position{ indices.first }; position != indices.second; ++position)
 		{
-			if (attributeName == (_orderVector[position])->first)
+			if (PairAt(position).first == attributeName)
 			{
 				return true;
 			}
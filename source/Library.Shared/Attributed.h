@@ -40,30 +40,37 @@ namespace FieaGameEngine
 	public:
 		Attributed() = delete;
 		/// <summary>
-		/// Takes a given std::string and checks all attributes for a match.
+		/// Takes a given name and checks all attributes for a match.
 		/// </summary>
 		/// <param name="attributeName">The name of the attribute being searched for.</param>
 		/// <returns>Whether or not the given name is found.</returns>
-		[[nodiscard]] bool IsAttribute(const std::string& attributeName);
+		[[nodiscard]] bool IsAttribute(std::string_view attributeName);
 		/// <summary>
-		/// Takes a given std::string and checks all prescribed attributes for a match.
+		/// Takes a given name and checks all prescribed attributes for a match.
 		/// </summary>
 		/// <param name="attributeName">The name of the attribute being searched for.</param>
 		/// <returns>Whether or not the given name is found.</returns>
-		[[nodiscard]] bool IsPrescribedAttribute(const std::string& attributeName) const;
+		[[nodiscard]] bool IsPrescribedAttribute(std::string_view attributeName) const;
 		/// <summary>
-		/// Takes a given std::string and checks all auxillary attributes for a match.
+		/// Takes a given name and checks all auxillary attributes for a match, including those an instance of a prefab reads from its prototype.
 		/// </summary>
 		/// <param name="attributeName">The name of the attribute being searched for.</param>
 		/// <returns>Whether or not the given name is found.</returns>
-		[[nodiscard]] bool IsAuxillaryAttribute(const std::string& attributeName) const;
+		[[nodiscard]] bool IsAuxillaryAttribute(std::string_view attributeName) const;
 		/// <summary>
 		/// Appends an extraneous member to an instatiated class with the given name.
 		/// </summary>
 		/// <param name="attributeName">The name of the member to add.</param>
 		/// <param name="type">The datum type to creeate.</param>
 		/// <returns>A reference to the newly appended attribute's datum.</returns>
-		Datum& AppendAuxillaryAttribute(const std::string& attributeName, Datum::DatumTypes type = Datum::DatumTypes::Unknown);
+		Datum& AppendAuxillaryAttribute(std::string_view attributeName, Datum::DatumTypes type = Datum::DatumTypes::Unknown);
+		/// <summary>
+		/// Appends an extraneous member to an instatiated class keyed on an interned name.
+		/// </summary>
+		/// <param name="attributeName">The Symbol of the member to add.</param>
+		/// <param name="type">The datum type to creeate.</param>
+		/// <returns>A reference to the newly appended attribute's datum.</returns>
+		Datum& AppendAuxillaryAttribute(const Symbol& attributeName, Datum::DatumTypes type = Datum::DatumTypes::Unknown);
 		/// <summary>
 		/// Returns the range in a std::pair of std::size_t of all attributes in the scope. These can be accessed easily using the [] operator.
 		/// The second value serves as a functional end(), meaning that it is one past the last valid index.
@@ -87,17 +94,15 @@ namespace FieaGameEngine
 		/// </summary>
 		void Clear() override;
 	private:
-		Indices PrescribedAttributes(RTTI::IdType rttiType) const;
 		/// <summary>
 		/// Fills the base scope with the correct attributes and sets the added datums storage for prescribed attributes.
 		/// </summary>
 		/// <param name="rttiType">The RTTI IdType to use in the lookup table.</param>
 		void Populate(RTTI::IdType rttiType);
 		/// <summary>
-		/// A similar method to SetExternalStorage, except that it traverses the order vector so that it is instead a constant timer operation to modify the underlying datums.
+		/// Points the prescribed attributes at this instance's members, walking them in order so each one takes constant time. Copies use the signatures of the instance they were copied from, without another lookup.
 		/// </summary>
-		/// <param name="rttiType">The RTTI IdType to use in the lookup table.</param>
-		void SetExternalStorage(RTTI::IdType rttiType);
+		void SetExternalStorage();
 		/// <summary>
 		/// A Helper function used to copare a set of keys. Used in IsAttribute, IsPrescribedAttribute, and IsAuxillaryAttribute. Takes in a range and a name to look for.
 		/// </summary>
@@ -105,6 +110,11 @@ namespace FieaGameEngine
 		/// <param name="first">The first index.</param>
 		/// <param name="last">One past the last index to look for.</param>
 		/// <returns>Whether or not the passed in name was found.</returns>
-		bool CompareKeys(const std::string& attributeName, Indices) const;
+		bool CompareKeys(std::string_view attributeName, Indices) const;
+
+		/// <summary>
+		/// The signatures registered for the most derived type, looked up once when the attributes are first populated.
+		/// </summary>
+		const SignatureList* _signatures{ nullptr };
 	};
 }
@@ -1,22 +1,38 @@
 #include "Datum.h"
+#include <algorithm>
 #include <cassert>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <string_view>
+#include <utility>
+#include "DefaultIncrement.h"
+#include "Scope.h"
+#include "SimdMath.h"
 
 #pragma region Constructors
 FieaGameEngine::Datum::Datum(DatumTypes type) :
-	_type{ type }, _typeSize{type != DatumTypes::Unknown ? _typeSizes[static_cast<std::size_t>(type)] : 0}
+	_type{ type }
+{
+}
+
+FieaGameEngine::Datum::Datum(DatumTypes type, std::pmr::memory_resource* resource) :
+	_resource{ resource }, _type{ type }
 {
 }
 
 FieaGameEngine::Datum::Datum(const Datum& other) :
-	_data{ other._isExternal ? other._data : _data }, _size{ other._size },
-	_capacity{ other._capacity }, _type{ other._type }, _typeSize{ other._typeSize },
-	_isExternal{ other._isExternal }
+	_data{ other._isExternal ? other._data : DatumValues{ nullptr } }, _size{ other._size },
+	_capacity{ other._capacity }, _type{ other._type },
+	_isExternal{ other._isExternal }, _isCopyOnWrite{ other._isCopyOnWrite }
 {
-	if( !_isExternal )
+	if (other.IsSharable() && other._resource == _resource)
+	{
+		Share(other);
+	}
+	else if( !_isExternal )
 	{
-		void* temp = malloc(_typeSize * _capacity);
-		assert(temp != nullptr);
-		_data.vp = temp;
+		Relocate(_capacity);
 		if (_type == DatumTypes::String)
 		{
 			_size = 0;
@@ -25,19 +41,18 @@ FieaGameEngine::Datum::Datum(const Datum& other) :
 				PushBack(other._data.s[position]);
 			}
 		}
-		else
+		else if (_size > 0)
 		{
-			memcpy(_data.vp, other._data.vp, _size * _typeSize);
+			memcpy(_data.vp, other._data.vp, _size * TypeSize());
 		}
 	}
 }
 
 FieaGameEngine::Datum::Datum(Datum&& other) noexcept :
-	_data{ other._data }, _size{ other._size },
-	_capacity{ other._capacity }, _type{ other._type }, _typeSize{ other._typeSize },
-	_isExternal{ other._isExternal }
+	_resource{ other._resource }, _size{ other._size }, _capacity{ other._capacity }, _type{ other._type },
+	_isExternal{ other._isExternal }, _isCopyOnWrite{ other._isCopyOnWrite }
 {
-	other._data.vp = nullptr;
+	StealData(other);
 	other._size = 0;
 	other._capacity = 0;
 }
@@ -46,8 +61,7 @@ FieaGameEngine::Datum::~Datum()
 {
 	if (!_isExternal)
 	{
-		Clear();
-		free(_data.vp);
+		Reset();
 	}
 }
 #pragma endregion 
@@ -61,22 +75,33 @@ FieaGameEngine::Datum& FieaGameEngine::Datum::operator=(const Datum& other)
 		return *this;
 	}
 
+	if (other.IsSharable() && other._resource == _resource)
+	{
+		if (!_isExternal)
+		{
+			Reset();
+		}
+		_type = other._type;
+		_isExternal = false;
+		Share(other);
+		return *this;
+	}
+
 	if (!_isExternal)
 	{
 		Reset();
 		_capacity = 0;
-		_typeSize = other._typeSize;
 		_type = other._type;
 
 		if (!other._isExternal)
 		{
-			Resize(other._capacity);
+			Reserve(other._capacity);
 
 			if (_type == DatumTypes::String)
 			{
 				for (std::size_t position{ 0 }; position < other._size; ++position)
 				{
-					Set(other._data.s[position], position);
+					PushBack(other._data.s[position]);
 				}
 			}
 			else
@@ -85,7 +110,7 @@ FieaGameEngine::Datum& FieaGameEngine::Datum::operator=(const Datum& other)
 				{
 					assert(_data.vp != nullptr);
 					_size = other._size;
-					memcpy(_data.vp, other._data.vp, _size * _typeSize);
+					memcpy(_data.vp, other._data.vp, _size * TypeSize());
 				}
 			}
 		}
@@ -104,14 +129,12 @@ FieaGameEngine::Datum& FieaGameEngine::Datum::operator=(const Datum& other)
 	{
 		if (!other._isExternal)
 		{
-			_typeSize = other._typeSize;
 			_type = other._type;
 			_capacity = other._capacity;
 			_size = other._size;
 			_isExternal = false;
-			void* temp = malloc(_typeSize * _capacity);
-			assert(temp != nullptr);
-			_data.vp = temp;
+			_data.vp = nullptr;
+			Relocate(_capacity);
 			if (_type == DatumTypes::String)
 			{
 				_size = 0;
@@ -120,15 +143,14 @@ FieaGameEngine::Datum& FieaGameEngine::Datum::operator=(const Datum& other)
 					PushBack(other._data.s[position]);
 				}
 			}
-			else
+			else if (other._size > 0)
 			{
-				memcpy(_data.vp, other._data.vp, other._size * _typeSize);
+				memcpy(_data.vp, other._data.vp, other._size * TypeSize());
 			}
 		}
 
 		else
 		{
-			_typeSize = other._typeSize;
 			_type = other._type;
 			_capacity = 0;
 			_size = other._size;
@@ -136,6 +158,8 @@ FieaGameEngine::Datum& FieaGameEngine::Datum::operator=(const Datum& other)
 		}
 
 	}
+	// Taken only now, since releasing storage this Datum still shares depends on its own flag.
+	_isCopyOnWrite = other._isCopyOnWrite;
 	return *this;
 }
 
@@ -146,17 +170,22 @@ FieaGameEngine::Datum& FieaGameEngine::Datum::operator=(Datum&& other) noexcept
 		return *this;
 	}
 
+	// Heap storage from another memory resource cannot be handed back to this Datum's, so it is copied instead.
+	if (_resource != other._resource && !other._isExternal && other._data.vp != nullptr && !other.IsInline())
+	{
+		return *this = std::as_const(other);
+	}
+
 	if (!_isExternal)
 	{
 		Reset();
 	}
-	_data = other._data;
+	StealData(other);
 	_size = other._size;
 	_capacity = other._capacity;
 	_type = other._type;
-	_typeSize = other._typeSize;
 	_isExternal = other._isExternal;
-	other._data.vp = nullptr;
+	_isCopyOnWrite = other._isCopyOnWrite;
 	other._size = 0;
 	other._capacity = 0;
 
@@ -203,7 +232,6 @@ FieaGameEngine::Datum& FieaGameEngine::Datum::operator=(const std::string& other
 	}
 	else
 	{
-		_typeSize = sizeof(std::string);
 		Reset();
 		_capacity = 0;
 		PushBack(other);
@@ -241,6 +269,96 @@ FieaGameEngine::Datum& FieaGameEngine::Datum::operator=(const glm::mat4& other)
 	return *this;
 }
 
+FieaGameEngine::Datum& FieaGameEngine::Datum::operator=(std::int64_t other)
+{
+	_type = _type == DatumTypes::Unknown ? DatumTypes::Int64 : _type;
+	assert(_type == DatumTypes::Int64);
+	if (_isExternal)
+	{
+		Set(other);
+	}
+	else
+	{
+		ScalarAssignment(&other);
+	}
+	return *this;
+}
+
+FieaGameEngine::Datum& FieaGameEngine::Datum::operator=(double other)
+{
+	_type = _type == DatumTypes::Unknown ? DatumTypes::Double : _type;
+	assert(_type == DatumTypes::Double);
+	if (_isExternal)
+	{
+		Set(other);
+	}
+	else
+	{
+		ScalarAssignment(&other);
+	}
+	return *this;
+}
+
+FieaGameEngine::Datum& FieaGameEngine::Datum::AssignBool(bool other)
+{
+	_type = _type == DatumTypes::Unknown ? DatumTypes::Bool : _type;
+	assert(_type == DatumTypes::Bool);
+	if (_isExternal)
+	{
+		Set(other);
+	}
+	else
+	{
+		ScalarAssignment(&other);
+	}
+	return *this;
+}
+
+FieaGameEngine::Datum& FieaGameEngine::Datum::operator=(const glm::vec2& other)
+{
+	_type = _type == DatumTypes::Unknown ? DatumTypes::Vector2 : _type;
+	assert(_type == DatumTypes::Vector2);
+	if (_isExternal)
+	{
+		Set(other);
+	}
+	else
+	{
+		ScalarAssignment(&other);
+	}
+	return *this;
+}
+
+FieaGameEngine::Datum& FieaGameEngine::Datum::operator=(const glm::vec3& other)
+{
+	_type = _type == DatumTypes::Unknown ? DatumTypes::Vector3 : _type;
+	assert(_type == DatumTypes::Vector3);
+	if (_isExternal)
+	{
+		Set(other);
+	}
+	else
+	{
+		ScalarAssignment(&other);
+	}
+	return *this;
+}
+
+FieaGameEngine::Datum& FieaGameEngine::Datum::operator=(const glm::quat& other)
+{
+	_type = _type == DatumTypes::Unknown ? DatumTypes::Quaternion : _type;
+	assert(_type == DatumTypes::Quaternion);
+	if (_isExternal)
+	{
+		Set(other);
+	}
+	else
+	{
+		ScalarAssignment(&other);
+	}
+	return *this;
+}
+
 FieaGameEngine::Datum& FieaGameEngine::Datum::operator=(RTTI* const other)
 {
 	assert(_isExternal == false);
@@ -264,15 +382,18 @@ FieaGameEngine::Datum& FieaGameEngine::Datum::operator=(const Scope& other)
 #pragma region Utility
 void FieaGameEngine::Datum::SetType(DatumTypes type)
 {
-	_type = _type == DatumTypes::Unknown ? type : _type;
+	if (_type == DatumTypes::Unknown && type != DatumTypes::Unknown)
+	{
+		_type = type;
+	}
 }
 
-FieaGameEngine::Datum::DatumTypes FieaGameEngine::Datum::Type()
+FieaGameEngine::Datum::DatumTypes FieaGameEngine::Datum::Type() const
 {
 	return _type;
 }
 
-std::size_t FieaGameEngine::Datum::Size()
+std::size_t FieaGameEngine::Datum::Size() const
 {
 	return _size;
 }
@@ -282,28 +403,59 @@ std::size_t FieaGameEngine::Datum::Capacity()
 	return _capacity;
 }
 
+bool FieaGameEngine::Datum::IsInline() const
+{
+	return _data.vp == static_cast<const void*>(_buffer);
+}
+
+void FieaGameEngine::Datum::SetCopyOnWrite(bool copyOnWrite)
+{
+	if (!copyOnWrite)
+	{
+		Detach();
+	}
+	_isCopyOnWrite = copyOnWrite;
+}
+
+bool FieaGameEngine::Datum::IsCopyOnWrite() const
+{
+	return _isCopyOnWrite;
+}
+
+bool FieaGameEngine::Datum::IsShared() const
+{
+	return IsSharable() && Header()._references > 1;
+}
+
+std::pmr::memory_resource* FieaGameEngine::Datum::Resource() const
+{
+	return _resource;
+}
+
 void FieaGameEngine::Datum::PopBack()
 {
 	if (!_isExternal && _size > 0)
 	{
+		Detach();
 		if (_type == DatumTypes::String)
 		{
 			BackAsString().~basic_string();
 		}
+		else if (_type == DatumTypes::Table)
+		{
+			ReleaseChild(_size - 1);
+		}
 		--_size;
 	}
 }
 
 void FieaGameEngine::Datum::ScalarAssignment(const void* other)
 {
-	_typeSize = _typeSizes[static_cast<std::size_t>(_type)];
 	Reset();
-	_size = 1;
 	_capacity = 1;
-	void* temp = malloc(_typeSize * _capacity);
-	assert(temp != nullptr);
-	_data.vp = temp;
-	memcpy(_data.vp, other, _size * _typeSize);
+	Relocate(_capacity);
+	_size = 1;
+	memcpy(_data.vp, other, _size * TypeSize());
 }
 
 #pragma endregion
@@ -345,6 +497,48 @@ void FieaGameEngine::Datum::SetStorage(glm::mat4* array, std::size_t size)
 	SetStorage(static_cast<void*>(array), size);
 }
 
+void FieaGameEngine::Datum::SetStorage(std::int64_t* array, std::size_t size)
+{
+	_type = _type == DatumTypes::Unknown ? DatumTypes::Int64 : _type;
+	assert(_type == DatumTypes::Int64);
+	SetStorage(static_cast<void*>(array), size);
+}
+
+void FieaGameEngine::Datum::SetStorage(double* array, std::size_t size)
+{
+	_type = _type == DatumTypes::Unknown ? DatumTypes::Double : _type;
+	assert(_type == DatumTypes::Double);
+	SetStorage(static_cast<void*>(array), size);
+}
+
+void FieaGameEngine::Datum::SetStorage(bool* array, std::size_t size)
+{
+	_type = _type == DatumTypes::Unknown ? DatumTypes::Bool : _type;
+	assert(_type == DatumTypes::Bool);
+	SetStorage(static_cast<void*>(array), size);
+}
+
+void FieaGameEngine::Datum::SetStorage(glm::vec2* array, std::size_t size)
+{
+	_type = _type == DatumTypes::Unknown ? DatumTypes::Vector2 : _type;
+	assert(_type == DatumTypes::Vector2);
+	SetStorage(static_cast<void*>(array), size);
+}
+
+void FieaGameEngine::Datum::SetStorage(glm::vec3* array, std::size_t size)
+{
+	_type = _type == DatumTypes::Unknown ? DatumTypes::Vector3 : _type;
+	assert(_type == DatumTypes::Vector3);
+	SetStorage(static_cast<void*>(array), size);
+}
+
+void FieaGameEngine::Datum::SetStorage(glm::quat* array, std::size_t size)
+{
+	_type = _type == DatumTypes::Unknown ? DatumTypes::Quaternion : _type;
+	assert(_type == DatumTypes::Quaternion);
+	SetStorage(static_cast<void*>(array), size);
+}
+
 void FieaGameEngine::Datum::SetStorage(RTTI** array, std::size_t size)
 {
 	_type = _type == DatumTypes::Unknown ? DatumTypes::Pointer : _type;
@@ -358,7 +552,8 @@ void FieaGameEngine::Datum::SetStorage(void* array, std::size_t size)
 	{
 		Reset();
 	}
-	_size = size;
+	assert(size <= std::numeric_limits<std::uint32_t>::max());
+	_size = static_cast<std::uint32_t>(size);
 	_capacity = _size;
 	_data.vp = array;
 	_isExternal = true;
@@ -371,6 +566,7 @@ void FieaGameEngine::Datum::Resize(std::size_t capacity)
 {
 	if (!_isExternal)
 	{ 
+		Detach();
 		if (capacity == 0)
 		{
 			Reset();
@@ -387,7 +583,14 @@ void FieaGameEngine::Datum::Resize(std::size_t capacity)
 					_data.s[position].~basic_string();
 				}
 			}
-			_size = capacity;
+			else if (_type == DatumTypes::Table)
+			{
+				for (std::size_t position{ capacity }; position < _size; ++position)
+				{
+					ReleaseChild(position);
+				}
+			}
+			_size = static_cast<std::uint32_t>(capacity);
 			ShrinkToFit();
 		}
 
@@ -404,7 +607,7 @@ void FieaGameEngine::Datum::Resize(std::size_t capacity)
 
 			else
 			{
-				memset(static_cast<std::byte*>(_data.vp) + (_size * _typeSize), 0, (_capacity - _size) * _typeSize);
+				memset(static_cast<std::byte*>(_data.vp) + (_size * TypeSize()), 0, (_capacity - _size) * TypeSize());
 				_size = _capacity;
 			}
 		}
@@ -419,7 +622,7 @@ void FieaGameEngine::Datum::Reserve(std::size_t capacity)
 		if (capacity > _capacity)
 		{
 			Relocate(capacity);
-			_capacity = capacity;
+			_capacity = static_cast<std::uint32_t>(capacity);
 		}
 	}
 }
@@ -440,27 +643,207 @@ void FieaGameEngine::Datum::Relocate(std::size_t capacity)
 {
 	if (!_isExternal && capacity > 0)
 	{
-		void* vec = reinterpret_cast<void*>(realloc(_data.vp, (capacity)*_typeSize));
-		assert(vec != nullptr);
-		_data.vp = vec;
+		assert(capacity <= std::numeric_limits<std::uint32_t>::max());
+		Detach();
+		// Copies fill in their elements after storage is allocated, so storage that does not exist yet has nothing to move.
+		const std::size_t size{ _data.vp != nullptr ? _size : 0 };
+
+		if (FitsInline(capacity))
+		{
+			if (!IsInline())
+			{
+				// memcpy may not be handed a null pointer even to copy nothing, and the optimizer relies on that to drop the check in Deallocate.
+				if (size > 0)
+				{
+					memcpy(_buffer, _data.vp, size * TypeSize());
+				}
+				Deallocate();
+				_data.vp = _buffer;
+			}
+		}
+
+		else if (IsInline() || _data.vp == nullptr)
+		{
+			void* vec = Allocate(capacity);
+			memcpy(vec, _buffer, size * TypeSize());
+			_data.vp = vec;
+		}
+
+		else if (_resource != nullptr)
+		{
+			// Memory resources cannot grow a block in place, so the elements move to a new one.
+			void* vec = Allocate(capacity);
+			memcpy(vec, _data.vp, size * TypeSize());
+			Deallocate();
+			_data.vp = vec;
+		}
+
+		else
+		{
+			const std::size_t bytes{ sizeof(PayloadHeader) + capacity * TypeSize() };
+			void* block = realloc(&Header(), bytes);
+			assert(block != nullptr);
+			_data.vp = static_cast<std::byte*>(block) + sizeof(PayloadHeader);
+			Header()._bytes = bytes;
+		}
+	}
+}
+
+std::size_t FieaGameEngine::Datum::OffsetOf(const void* pointer) const
+{
+	const std::byte* first{ static_cast<const std::byte*>(_data.vp) };
+	const std::byte* byte{ static_cast<const std::byte*>(pointer) };
+	// std::less orders pointers into different blocks too, which the built-in comparison does not promise.
+	if (first == nullptr || std::less<const std::byte*>{}(byte, first) || !std::less<const std::byte*>{}(byte, first + _size * TypeSize()))
+	{
+		return NotStored;
+	}
+	return static_cast<std::size_t>(byte - first);
+}
+
+bool FieaGameEngine::Datum::FitsInline(std::size_t capacity) const
+{
+	return _type != DatumTypes::Unknown && _type != DatumTypes::String && capacity * TypeSize() <= InlineStorageSize;
+}
+
+std::size_t FieaGameEngine::Datum::GrowCapacity() const
+{
+	const std::size_t inlineCapacity{ FitsInline(1) ? InlineStorageSize / TypeSize() : 0 };
+	return _capacity < inlineCapacity ? inlineCapacity : DefaultIncrement<std::byte>{}(_capacity, _size);
+}
+
+void FieaGameEngine::Datum::StealData(Datum& other) noexcept
+{
+	if (other.IsInline())
+	{
+		memcpy(_buffer, other._buffer, InlineStorageSize);
+		_data.vp = _buffer;
+	}
+	else
+	{
+		_data = other._data;
+	}
+	other._data.vp = nullptr;
+}
+
+FieaGameEngine::Datum::PayloadHeader& FieaGameEngine::Datum::Header() const
+{
+	assert(_data.vp != nullptr && !IsInline() && !_isExternal);
+	return *reinterpret_cast<PayloadHeader*>(static_cast<std::byte*>(_data.vp) - sizeof(PayloadHeader));
+}
+
+void* FieaGameEngine::Datum::Allocate(std::size_t capacity) const
+{
+	const std::size_t bytes{ sizeof(PayloadHeader) + capacity * TypeSize() };
+	void* block = _resource != nullptr ? _resource->allocate(bytes, alignof(PayloadHeader)) : malloc(bytes);
+	assert(block != nullptr);
+	new (block) PayloadHeader{ 1, bytes };
+	return static_cast<std::byte*>(block) + sizeof(PayloadHeader);
+}
+
+void FieaGameEngine::Datum::Deallocate()
+{
+	if (!_isExternal && _data.vp != nullptr && !IsInline())
+	{
+		PayloadHeader& header{ Header() };
+		if (_resource != nullptr)
+		{
+			_resource->deallocate(&header, header._bytes, alignof(PayloadHeader));
+		}
+		else
+		{
+			free(&header);
+		}
+	}
+}
+
+bool FieaGameEngine::Datum::IsSharable() const
+{
+	return _isCopyOnWrite && !_isExternal && _data.vp != nullptr && !IsInline();
+}
+
+void FieaGameEngine::Datum::Share(const Datum& other)
+{
+	assert(other.IsSharable());
+	++other.Header()._references;
+	_data = other._data;
+	_size = other._size;
+	_capacity = other._capacity;
+	_isCopyOnWrite = true;
+}
+
+void FieaGameEngine::Datum::Detach()
+{
+	if (IsShared())
+	{
+		void* data{ Allocate(_capacity) };
+		if (_type == DatumTypes::String)
+		{
+			for (std::size_t position{ 0 }; position < _size; ++position)
+			{
+				new (static_cast<std::string*>(data) + position)std::string{ _data.s[position] };
+			}
+		}
+		else
+		{
+			memcpy(data, _data.vp, _size * TypeSize());
+		}
+		--Header()._references;
+		_data.vp = data;
+	}
+}
+
+void FieaGameEngine::Datum::ReleaseChild(std::size_t position)
+{
+	Scope* child{ _data.t[position] };
+	if (child != nullptr && child->_parentDatum == this)
+	{
+		child->Reparent(nullptr, nullptr, 0);
+	}
+}
+
+void FieaGameEngine::Datum::ReindexChildren(std::size_t first)
+{
+	for (std::size_t position{ first }; position < _size; ++position)
+	{
+		Scope* child{ _data.t[position] };
+		if (child != nullptr && child->_parentDatum == this)
+		{
+			child->_parentIndex = position;
+		}
 	}
 }
 
 void FieaGameEngine::Datum::Reset()
 {
 	Clear();
-	free(_data.vp);
+	Deallocate();
 	_data.vp = nullptr;
 }
+
 void FieaGameEngine::Datum::Clear()
 {
-	if (!_isExternal && _type == DatumTypes::String)
+	if (IsShared())
+	{
+		// The elements still belong to the Datums that share them, so only the reference is given up.
+		--Header()._references;
+		_data.vp = nullptr;
+		_capacity = 0;
+	}
+	else if (!_isExternal && _type == DatumTypes::String)
 	{
 		for (std::size_t position{ 0 }; position < _size; ++position)
 		{
 			_data.s[position].~basic_string();
 		}
 	}
+	else if (_type == DatumTypes::Table)
+	{
+		for (std::size_t position{ 0 }; position < _size; ++position)
+		{
+			ReleaseChild(position);
+		}
+	}
 	_size = 0;
 }
 
@@ -474,7 +857,7 @@ bool FieaGameEngine::Datum::operator==(const Datum& rhs) const
 
 	if (_type == rhs._type && _size == rhs._size)
 	{
-		if (_type == DatumTypes::Unknown)
+		if (_type == DatumTypes::Unknown || _data.vp == rhs._data.vp)
 		{
 			result = true;
 		}
@@ -569,31 +952,122 @@ bool FieaGameEngine::Datum::operator==(const glm::mat4& rhs) const
 	return result;
 }
 
-bool FieaGameEngine::Datum::operator!=(const glm::mat4& rhs) const
+bool FieaGameEngine::Datum::operator==(std::int64_t rhs) const
 {
-	return !operator==(rhs);
+	bool result{ false };
+
+	if (_size == 1 && _type == DatumTypes::Int64)
+	{
+		result = FrontAsInt64() == rhs;
+	}
+	return result;
 }
 
-bool FieaGameEngine::Datum::operator==(RTTI* rhs) const
+bool FieaGameEngine::Datum::operator==(double rhs) const
 {
 	bool result{ false };
 
-	if (_size == 1 && _type == DatumTypes::Pointer)
+	if (_size == 1 && _type == DatumTypes::Double)
 	{
-		result = FrontAsRTTI()->Equals(rhs);
+		result = FrontAsDouble() == rhs;
 	}
 	return result;
 }
 
-bool FieaGameEngine::Datum::operator!=(RTTI* rhs) const
+bool FieaGameEngine::Datum::operator==(const glm::vec2& rhs) const
 {
-	return !operator==(rhs);
+	bool result{ false };
+
+	if (_size == 1 && _type == DatumTypes::Vector2)
+	{
+		result = FrontAsVector2() == rhs;
+	}
+	return result;
+}
+
+bool FieaGameEngine::Datum::operator==(const glm::vec3& rhs) const
+{
+	bool result{ false };
+
+	if (_size == 1 && _type == DatumTypes::Vector3)
+	{
+		result = FrontAsVector3() == rhs;
+	}
+	return result;
+}
+
+bool FieaGameEngine::Datum::operator==(const glm::quat& rhs) const
+{
+	bool result{ false };
+
+	if (_size == 1 && _type == DatumTypes::Quaternion)
+	{
+		result = FrontAsQuaternion() == rhs;
+	}
+	return result;
+}
+
+bool FieaGameEngine::Datum::operator!=(const glm::mat4& rhs) const
+{
+	return !operator==(rhs);
+}
+
+bool FieaGameEngine::Datum::operator!=(std::int64_t rhs) const
+{
+	return !operator==(rhs);
+}
+
+bool FieaGameEngine::Datum::operator!=(double rhs) const
+{
+	return !operator==(rhs);
+}
+
+bool FieaGameEngine::Datum::EqualsBool(bool rhs) const
+{
+	bool result{ false };
+
+	if (_size == 1 && _type == DatumTypes::Bool)
+	{
+		result = FrontAsBool() == rhs;
+	}
+	return result;
+}
+
+bool FieaGameEngine::Datum::operator!=(const glm::vec2& rhs) const
+{
+	return !operator==(rhs);
+}
+
+bool FieaGameEngine::Datum::operator!=(const glm::vec3& rhs) const
+{
+	return !operator==(rhs);
+}
+
+bool FieaGameEngine::Datum::operator!=(const glm::quat& rhs) const
+{
+	return !operator==(rhs);
+}
+
+bool FieaGameEngine::Datum::operator==(RTTI* rhs) const
+{
+	bool result{ false };
+
+	if (_size == 1 && _type == DatumTypes::Pointer)
+	{
+		result = FrontAsRTTI()->Equals(rhs);
+	}
+	return result;
+}
+
+bool FieaGameEngine::Datum::operator!=(RTTI* rhs) const
+{
+	return !operator==(rhs);
 }
 
 bool FieaGameEngine::Datum::GenericSetCompare(void* data) const
 {
 	assert(_type != DatumTypes::String && _type != DatumTypes::Pointer);
-	return memcmp(_data.vp, data, _size * _typeSize) == 0 ? true : false;
+	return memcmp(_data.vp, data, _size * TypeSize()) == 0 ? true : false;
 }
 
 bool FieaGameEngine::Datum::StringSetCompare(void* data) const
@@ -612,9 +1086,10 @@ bool FieaGameEngine::Datum::StringSetCompare(void* data) const
 bool FieaGameEngine::Datum::PointerSetCompare(void* data) const
 {
 	assert(_type == DatumTypes::Pointer || _type == DatumTypes::Table);
+	RTTI** other{ static_cast<RTTI**>(data) };
 	for (std::size_t position{ 0 }; position < _size; ++position)
 	{
-		if (!_data.p[position]->Equals(static_cast<RTTI**>(data)[position]))
+		if (_data.p[position] != other[position] && !_data.p[position]->Equals(other[position]))
 		{
 			return false;
 		}
@@ -633,7 +1108,6 @@ void FieaGameEngine::Datum::PushBack(int item)
 		if (_type == DatumTypes::Unknown)
 		{
 			_type = DatumTypes::Integer;
-			_typeSize = sizeof(int);
 		}
 		assert(_type == DatumTypes::Integer);
 		PushBack(&item);
@@ -647,7 +1121,6 @@ void FieaGameEngine::Datum::PushBack(float item)
 		if (_type == DatumTypes::Unknown)
 		{
 			_type = DatumTypes::Float;
-			_typeSize = sizeof(float);
 		}
 		assert(_type == DatumTypes::Float);
 		PushBack(&item);
@@ -661,12 +1134,12 @@ void FieaGameEngine::Datum::PushBack(const std::string& item)
 		if (_type == DatumTypes::Unknown)
 		{
 			_type = DatumTypes::String;
-			_typeSize = sizeof(std::string);
 		}
 		assert(_type == DatumTypes::String);
+		Detach();
 		if (_capacity == _size)
 		{
-			Reserve(_capacity + 1);
+			Reserve(GrowCapacity());
 		}
 		new (_data.s + _size++)std::string{ item };
 	}
@@ -679,12 +1152,12 @@ void FieaGameEngine::Datum::PushBack(std::string&& item)
 		if (_type == DatumTypes::Unknown)
 		{
 			_type = DatumTypes::String;
-			_typeSize = sizeof(std::string);
 		}
 		assert(_type == DatumTypes::String);
+		Detach();
 		if (_capacity == _size)
 		{
-			Reserve(_capacity + 1);
+			Reserve(GrowCapacity());
 		}
 		new (_data.s + _size++)std::string{ std::forward<std::string>(item) };
 	}
@@ -697,7 +1170,6 @@ void FieaGameEngine::Datum::PushBack(const glm::vec4& item)
 		if (_type == DatumTypes::Unknown)
 		{
 			_type = DatumTypes::Vector;
-			_typeSize = sizeof(glm::vec4);
 		}
 		assert(_type == DatumTypes::Vector);
 		PushBack(&item);
@@ -711,637 +1183,1801 @@ void FieaGameEngine::Datum::PushBack(const glm::mat4& item)
 		if (_type == DatumTypes::Unknown)
 		{
 			_type = DatumTypes::Matrix;
-			_typeSize = sizeof(glm::mat4);
 		}
 		assert(_type == DatumTypes::Matrix);
 		PushBack(&item);
 	}
 }
 
-void FieaGameEngine::Datum::PushBack(RTTI* item)
+void FieaGameEngine::Datum::PushBack(std::int64_t item)
 {
 	if (!_isExternal)
 	{
-		assert(_type == DatumTypes::Pointer);
+		if (_type == DatumTypes::Unknown)
+		{
+			_type = DatumTypes::Int64;
+		}
+		assert(_type == DatumTypes::Int64);
 		PushBack(&item);
 	}
 }
 
-void FieaGameEngine::Datum::PushBackFromString(const std::string& string)
-{
-	assert(_type != DatumTypes::Unknown && _type != DatumTypes::Pointer);
-	PushBackFromStringFunction func = _pushbackFromStringFunctions[static_cast<int>(_type)];
-	assert(func != nullptr);
-	(this->*func)(string);
-}
-
-void FieaGameEngine::Datum::PushBack(Scope* item)
+void FieaGameEngine::Datum::PushBack(double item)
 {
 	if (!_isExternal)
 	{
-		assert(_type == DatumTypes::Table);
+		if (_type == DatumTypes::Unknown)
+		{
+			_type = DatumTypes::Double;
+		}
+		assert(_type == DatumTypes::Double);
 		PushBack(&item);
 	}
 }
-void FieaGameEngine::Datum::PushBack(const void* item)
+
+void FieaGameEngine::Datum::PushBackBool(bool item)
 {
 	if (!_isExternal)
 	{
-		if (_capacity == _size)
+		if (_type == DatumTypes::Unknown)
 		{
-			Reserve(_capacity + 1);
+			_type = DatumTypes::Bool;
 		}
-
-		memcpy(static_cast<std::byte*>(_data.vp) + (_size++) * _typeSize, item, _typeSize);
+		assert(_type == DatumTypes::Bool);
+		PushBack(static_cast<const void*>(&item));
 	}
 }
 
-#pragma endregion 
-
-#pragma region SetAndGet
-
-void FieaGameEngine::Datum::Set(int item, std::size_t position)
+void FieaGameEngine::Datum::PushBack(const glm::vec2& item)
 {
-	assert(_type == DatumTypes::Integer);
-	assert(position < _size);
-
-	_data.i[position] = item;
+	if (!_isExternal)
+	{
+		if (_type == DatumTypes::Unknown)
+		{
+			_type = DatumTypes::Vector2;
+		}
+		assert(_type == DatumTypes::Vector2);
+		PushBack(&item);
+	}
 }
 
-void FieaGameEngine::Datum::Set(float item, std::size_t position)
+void FieaGameEngine::Datum::PushBack(const glm::vec3& item)
 {
-	assert(_type == DatumTypes::Float);
-	assert(position < _size);
-
-	_data.f[position] = item;
+	if (!_isExternal)
+	{
+		if (_type == DatumTypes::Unknown)
+		{
+			_type = DatumTypes::Vector3;
+		}
+		assert(_type == DatumTypes::Vector3);
+		PushBack(&item);
+	}
 }
 
-void FieaGameEngine::Datum::Set(const std::string& item, std::size_t position)
+void FieaGameEngine::Datum::PushBack(const glm::quat& item)
 {
-	assert(_type == DatumTypes::String);
-	assert(position < _size);
-
-	_data.s[position] = item;
+	if (!_isExternal)
+	{
+		if (_type == DatumTypes::Unknown)
+		{
+			_type = DatumTypes::Quaternion;
+		}
+		assert(_type == DatumTypes::Quaternion);
+		PushBack(&item);
+	}
 }
 
-void FieaGameEngine::Datum::Set(glm::vec4 item, std::size_t position)
+void FieaGameEngine::Datum::PushBack(RTTI* item)
 {
-	assert(_type == DatumTypes::Vector);
-	assert(position < _size);
-
-	_data.v[position] = item;
+	if (!_isExternal)
+	{
+		assert(_type == DatumTypes::Pointer);
+		PushBack(&item);
+	}
 }
 
-void FieaGameEngine::Datum::Set(const glm::mat4& item, std::size_t position)
+void FieaGameEngine::Datum::PushBackFromString(std::string_view string)
 {
-	assert(_type == DatumTypes::Matrix);
-	assert(position < _size);
-
-	_data.m[position] = item;
+	[[maybe_unused]] const std::from_chars_result result{ PushBackFromChars(string.data(), string.data() + string.size()) };
+	assert(result.ec == std::errc{});
 }
 
-void FieaGameEngine::Datum::Set(RTTI* item, std::size_t position)
+std::from_chars_result FieaGameEngine::Datum::PushBackFromChars(const char* first, const char* last)
 {
-	assert(_type == DatumTypes::Pointer);
-	assert(position < _size);
-
-	_data.p[position] = item;
+	assert(_type != DatumTypes::Unknown && _type != DatumTypes::Pointer && _type != DatumTypes::Table);
+	PushBackFromCharsFunction func = _pushBackFromCharsFunctions[static_cast<int>(_type)];
+	assert(func != nullptr);
+	return (this->*func)(first, last);
 }
 
-int& FieaGameEngine::Datum::GetAsInt(std::size_t position)
+std::from_chars_result FieaGameEngine::Datum::PushBackFromCharsString(const char* first, const char* last)
 {
-	assert(_type == DatumTypes::Integer);
-	assert(position < _size);
-
-	return _data.i[position];
+	PushBack(std::string{ first, last });
+	return { last, std::errc{} };
 }
 
-int FieaGameEngine::Datum::GetAsInt(std::size_t position) const
+void FieaGameEngine::Datum::PushBack(Scope* item)
 {
-	assert(_type == DatumTypes::Integer);
-	assert(position < _size);
-
-	return _data.i[position];
+	if (!_isExternal)
+	{
+		assert(_type == DatumTypes::Table);
+		PushBack(&item);
+	}
 }
-
-float& FieaGameEngine::Datum::GetAsFloat(std::size_t position)
+void FieaGameEngine::Datum::Set(Scope* item, std::size_t index)
 {
-	assert(_type == DatumTypes::Float);
-	assert(position < _size);
+	assert(_type == DatumTypes::Table);
+	assert(index < _size);
 
-	return _data.f[position];
+	Detach();
+	_data.t[index] = item;
 }
-
-float FieaGameEngine::Datum::GetAsFloat(std::size_t position) const
+void FieaGameEngine::Datum::PushBack(const void* item)
 {
-	assert(_type == DatumTypes::Float);
-	assert(position < _size);
+	if (!_isExternal)
+	{
+		Detach();
+		if (_capacity == _size)
+		{
+			Reserve(GrowCapacity());
+		}
 
-	return _data.f[position];
+		memcpy(static_cast<std::byte*>(_data.vp) + (_size++) * TypeSize(), item, TypeSize());
+	}
 }
 
-std::string& FieaGameEngine::Datum::GetAsString(std::size_t position)
-{
-	assert(_type == DatumTypes::String);
-	assert(position < _size);
+#pragma endregion 
 
-	return _data.s[position];
-}
+#pragma region Append
 
-const std::string& FieaGameEngine::Datum::GetAsString(std::size_t position) const
+void FieaGameEngine::Datum::Append(std::span<const int> values)
 {
-	assert(_type == DatumTypes::String);
-	assert(position < _size);
-
-	return _data.s[position];
+	if (!_isExternal)
+	{
+		if (_type == DatumTypes::Unknown)
+		{
+			_type = DatumTypes::Integer;
+		}
+		assert(_type == DatumTypes::Integer);
+		Append(values.data(), values.size());
+	}
 }
 
-glm::vec4& FieaGameEngine::Datum::GetAsVector(std::size_t position)
+void FieaGameEngine::Datum::Append(std::span<const float> values)
 {
-	assert(_type == DatumTypes::Vector);
-	assert(position < _size);
-
-	return _data.v[position];
+	if (!_isExternal)
+	{
+		if (_type == DatumTypes::Unknown)
+		{
+			_type = DatumTypes::Float;
+		}
+		assert(_type == DatumTypes::Float);
+		Append(values.data(), values.size());
+	}
 }
 
-const glm::vec4& FieaGameEngine::Datum::GetAsVector(std::size_t position) const
+void FieaGameEngine::Datum::Append(std::span<const std::string> values)
 {
-	assert(_type == DatumTypes::Vector);
-	assert(position < _size);
-
-	return _data.v[position];
+	if (!_isExternal)
+	{
+		if (_type == DatumTypes::Unknown)
+		{
+			_type = DatumTypes::String;
+		}
+		assert(_type == DatumTypes::String);
+		const std::size_t offset{ OffsetOf(values.data()) };
+		Detach();
+		if (_size + values.size() > _capacity)
+		{
+			Reserve(std::max(_size + values.size(), GrowCapacity()));
+		}
+		if (offset != NotStored)
+		{
+			values = std::span<const std::string>{ _data.s + offset / sizeof(std::string), values.size() };
+		}
+		for (const std::string& value : values)
+		{
+			new (_data.s + _size++)std::string{ value };
+		}
+	}
 }
 
-glm::mat4& FieaGameEngine::Datum::GetAsMatrix(std::size_t position)
+void FieaGameEngine::Datum::Append(std::span<const glm::vec4> values)
 {
-	assert(_type == DatumTypes::Matrix);
-	assert(position < _size);
-
-	return _data.m[position];
+	if (!_isExternal)
+	{
+		if (_type == DatumTypes::Unknown)
+		{
+			_type = DatumTypes::Vector;
+		}
+		assert(_type == DatumTypes::Vector);
+		Append(values.data(), values.size());
+	}
 }
 
-const glm::mat4& FieaGameEngine::Datum::GetAsMatrix(std::size_t position) const
+void FieaGameEngine::Datum::Append(std::span<const glm::mat4> values)
 {
-	assert(_type == DatumTypes::Matrix);
-	assert(position < _size);
-
-	return _data.m[position];
+	if (!_isExternal)
+	{
+		if (_type == DatumTypes::Unknown)
+		{
+			_type = DatumTypes::Matrix;
+		}
+		assert(_type == DatumTypes::Matrix);
+		Append(values.data(), values.size());
+	}
 }
 
-FieaGameEngine::RTTI*& FieaGameEngine::Datum::GetAsRTTI(std::size_t position)
+void FieaGameEngine::Datum::Append(std::span<const std::int64_t> values)
 {
-	assert(_type == DatumTypes::Pointer);
+	if (!_isExternal)
+	{
+		if (_type == DatumTypes::Unknown)
+		{
+			_type = DatumTypes::Int64;
+		}
+		assert(_type == DatumTypes::Int64);
+		Append(values.data(), values.size());
+	}
+}
+
+void FieaGameEngine::Datum::Append(std::span<const double> values)
+{
+	if (!_isExternal)
+	{
+		if (_type == DatumTypes::Unknown)
+		{
+			_type = DatumTypes::Double;
+		}
+		assert(_type == DatumTypes::Double);
+		Append(values.data(), values.size());
+	}
+}
+
+void FieaGameEngine::Datum::Append(std::span<const bool> values)
+{
+	if (!_isExternal)
+	{
+		if (_type == DatumTypes::Unknown)
+		{
+			_type = DatumTypes::Bool;
+		}
+		assert(_type == DatumTypes::Bool);
+		Append(values.data(), values.size());
+	}
+}
+
+void FieaGameEngine::Datum::Append(std::span<const glm::vec2> values)
+{
+	if (!_isExternal)
+	{
+		if (_type == DatumTypes::Unknown)
+		{
+			_type = DatumTypes::Vector2;
+		}
+		assert(_type == DatumTypes::Vector2);
+		Append(values.data(), values.size());
+	}
+}
+
+void FieaGameEngine::Datum::Append(std::span<const glm::vec3> values)
+{
+	if (!_isExternal)
+	{
+		if (_type == DatumTypes::Unknown)
+		{
+			_type = DatumTypes::Vector3;
+		}
+		assert(_type == DatumTypes::Vector3);
+		Append(values.data(), values.size());
+	}
+}
+
+void FieaGameEngine::Datum::Append(std::span<const glm::quat> values)
+{
+	if (!_isExternal)
+	{
+		if (_type == DatumTypes::Unknown)
+		{
+			_type = DatumTypes::Quaternion;
+		}
+		assert(_type == DatumTypes::Quaternion);
+		Append(values.data(), values.size());
+	}
+}
+
+void FieaGameEngine::Datum::Append(const void* values, std::size_t count)
+{
+	if (!_isExternal && count > 0)
+	{
+		const std::size_t offset{ OffsetOf(values) };
+		Detach();
+		if (_size + count > _capacity)
+		{
+			Reserve(std::max(_size + count, GrowCapacity()));
+		}
+		if (offset != NotStored)
+		{
+			values = static_cast<const std::byte*>(_data.vp) + offset;
+		}
+
+		memcpy(static_cast<std::byte*>(_data.vp) + (_size * TypeSize()), values, count * TypeSize());
+		_size += static_cast<std::uint32_t>(count);
+	}
+}
+
+#pragma endregion
+
+#pragma region SetAndGet
+
+void FieaGameEngine::Datum::Set(int item, std::size_t position)
+{
+	assert(_type == DatumTypes::Integer);
 	assert(position < _size);
 
-	return _data.p[position];
+	Detach();
+	_data.i[position] = item;
 }
 
-FieaGameEngine::RTTI* FieaGameEngine::Datum::GetAsRTTI(std::size_t position) const
+void FieaGameEngine::Datum::Set(float item, std::size_t position)
 {
-	assert(_type == DatumTypes::Pointer);
+	assert(_type == DatumTypes::Float);
 	assert(position < _size);
 
-	return _data.p[position];
+	Detach();
+	_data.f[position] = item;
 }
 
-FieaGameEngine::Scope* FieaGameEngine::Datum::GetAsScope(std::size_t index) const
+void FieaGameEngine::Datum::Set(const std::string& item, std::size_t position)
 {
-	assert(_type == DatumTypes::Table);
-	assert(index < _size);
+	assert(_type == DatumTypes::String);
+	assert(position < _size);
 
-	return _data.t[index];
+	Detach();
+	_data.s[position] = item;
 }
 
-#pragma endregion
+void FieaGameEngine::Datum::Set(glm::vec4 item, std::size_t position)
+{
+	assert(_type == DatumTypes::Vector);
+	assert(position < _size);
 
-#pragma region Remove
+	Detach();
+	_data.v[position] = item;
+}
 
-void FieaGameEngine::Datum::Remove(int value)
+void FieaGameEngine::Datum::Set(const glm::mat4& item, std::size_t position)
+{
+	assert(_type == DatumTypes::Matrix);
+	assert(position < _size);
+
+	Detach();
+	_data.m[position] = item;
+}
+
+void FieaGameEngine::Datum::Set(std::int64_t item, std::size_t position)
+{
+	assert(_type == DatumTypes::Int64);
+	assert(position < _size);
+
+	Detach();
+	_data.l[position] = item;
+}
+
+void FieaGameEngine::Datum::Set(double item, std::size_t position)
+{
+	assert(_type == DatumTypes::Double);
+	assert(position < _size);
+
+	Detach();
+	_data.d[position] = item;
+}
+
+void FieaGameEngine::Datum::SetBool(bool item, std::size_t position)
+{
+	assert(_type == DatumTypes::Bool);
+	assert(position < _size);
+
+	Detach();
+	_data.b[position] = item;
+}
+
+void FieaGameEngine::Datum::Set(const glm::vec2& item, std::size_t position)
+{
+	assert(_type == DatumTypes::Vector2);
+	assert(position < _size);
+
+	Detach();
+	_data.v2[position] = item;
+}
+
+void FieaGameEngine::Datum::Set(const glm::vec3& item, std::size_t position)
+{
+	assert(_type == DatumTypes::Vector3);
+	assert(position < _size);
+
+	Detach();
+	_data.v3[position] = item;
+}
+
+void FieaGameEngine::Datum::Set(const glm::quat& item, std::size_t position)
+{
+	assert(_type == DatumTypes::Quaternion);
+	assert(position < _size);
+
+	Detach();
+	_data.q[position] = item;
+}
+
+void FieaGameEngine::Datum::Set(RTTI* item, std::size_t position)
+{
+	assert(_type == DatumTypes::Pointer);
+	assert(position < _size);
+
+	Detach();
+	_data.p[position] = item;
+}
+
+void FieaGameEngine::Datum::SetRange(std::span<const int> values, std::size_t index)
 {
 	assert(_type == DatumTypes::Integer);
-	std::size_t position = Find(value);
-	if (position < _size)
+	SetRange(values.data(), values.size(), index);
+}
+
+void FieaGameEngine::Datum::SetRange(std::span<const float> values, std::size_t index)
+{
+	assert(_type == DatumTypes::Float);
+	SetRange(values.data(), values.size(), index);
+}
+
+void FieaGameEngine::Datum::SetRange(std::span<const std::string> values, std::size_t index)
+{
+	assert(_type == DatumTypes::String);
+	assert(index + values.size() <= _size);
+
+	Detach();
+	for (std::size_t position{ 0 }; position < values.size(); ++position)
 	{
-		RemoveAt(position);
+		_data.s[index + position] = values[position];
 	}
 }
 
-void FieaGameEngine::Datum::Remove(float value)
+void FieaGameEngine::Datum::SetRange(std::span<const glm::vec4> values, std::size_t index)
+{
+	assert(_type == DatumTypes::Vector);
+	SetRange(values.data(), values.size(), index);
+}
+
+void FieaGameEngine::Datum::SetRange(std::span<const glm::mat4> values, std::size_t index)
+{
+	assert(_type == DatumTypes::Matrix);
+	SetRange(values.data(), values.size(), index);
+}
+
+void FieaGameEngine::Datum::SetRange(std::span<const std::int64_t> values, std::size_t index)
+{
+	assert(_type == DatumTypes::Int64);
+	SetRange(values.data(), values.size(), index);
+}
+
+void FieaGameEngine::Datum::SetRange(std::span<const double> values, std::size_t index)
+{
+	assert(_type == DatumTypes::Double);
+	SetRange(values.data(), values.size(), index);
+}
+
+void FieaGameEngine::Datum::SetRange(std::span<const bool> values, std::size_t index)
+{
+	assert(_type == DatumTypes::Bool);
+	SetRange(values.data(), values.size(), index);
+}
+
+void FieaGameEngine::Datum::SetRange(std::span<const glm::vec2> values, std::size_t index)
+{
+	assert(_type == DatumTypes::Vector2);
+	SetRange(values.data(), values.size(), index);
+}
+
+void FieaGameEngine::Datum::SetRange(std::span<const glm::vec3> values, std::size_t index)
+{
+	assert(_type == DatumTypes::Vector3);
+	SetRange(values.data(), values.size(), index);
+}
+
+void FieaGameEngine::Datum::SetRange(std::span<const glm::quat> values, std::size_t index)
+{
+	assert(_type == DatumTypes::Quaternion);
+	SetRange(values.data(), values.size(), index);
+}
+
+void FieaGameEngine::Datum::SetRange(const void* values, std::size_t count, std::size_t index)
+{
+	assert(index + count <= _size);
+
+	if (count > 0)
+	{
+		Detach();
+		memmove(static_cast<std::byte*>(_data.vp) + (index * TypeSize()), values, count * TypeSize());
+	}
+}
+
+int& FieaGameEngine::Datum::GetAsInt(std::size_t position)
+{
+	assert(_type == DatumTypes::Integer);
+	assert(position < _size);
+
+	Detach();
+	return _data.i[position];
+}
+
+int FieaGameEngine::Datum::GetAsInt(std::size_t position) const
+{
+	assert(_type == DatumTypes::Integer);
+	assert(position < _size);
+
+	return _data.i[position];
+}
+
+float& FieaGameEngine::Datum::GetAsFloat(std::size_t position)
 {
 	assert(_type == DatumTypes::Float);
-	std::size_t position = Find(value);
-	if (position < _size)
+	assert(position < _size);
+
+	Detach();
+	return _data.f[position];
+}
+
+float FieaGameEngine::Datum::GetAsFloat(std::size_t position) const
+{
+	assert(_type == DatumTypes::Float);
+	assert(position < _size);
+
+	return _data.f[position];
+}
+
+std::string& FieaGameEngine::Datum::GetAsString(std::size_t position)
+{
+	assert(_type == DatumTypes::String);
+	assert(position < _size);
+
+	Detach();
+	return _data.s[position];
+}
+
+const std::string& FieaGameEngine::Datum::GetAsString(std::size_t position) const
+{
+	assert(_type == DatumTypes::String);
+	assert(position < _size);
+
+	return _data.s[position];
+}
+
+glm::vec4& FieaGameEngine::Datum::GetAsVector(std::size_t position)
+{
+	assert(_type == DatumTypes::Vector);
+	assert(position < _size);
+
+	Detach();
+	return _data.v[position];
+}
+
+const glm::vec4& FieaGameEngine::Datum::GetAsVector(std::size_t position) const
+{
+	assert(_type == DatumTypes::Vector);
+	assert(position < _size);
+
+	return _data.v[position];
+}
+
+glm::mat4& FieaGameEngine::Datum::GetAsMatrix(std::size_t position)
+{
+	assert(_type == DatumTypes::Matrix);
+	assert(position < _size);
+
+	Detach();
+	return _data.m[position];
+}
+
+std::int64_t& FieaGameEngine::Datum::GetAsInt64(std::size_t position)
+{
+	assert(_type == DatumTypes::Int64);
+	assert(position < _size);
+
+	Detach();
+	return _data.l[position];
+}
+
+double& FieaGameEngine::Datum::GetAsDouble(std::size_t position)
+{
+	assert(_type == DatumTypes::Double);
+	assert(position < _size);
+
+	Detach();
+	return _data.d[position];
+}
+
+bool& FieaGameEngine::Datum::GetAsBool(std::size_t position)
+{
+	assert(_type == DatumTypes::Bool);
+	assert(position < _size);
+
+	Detach();
+	return _data.b[position];
+}
+
+glm::vec2& FieaGameEngine::Datum::GetAsVector2(std::size_t position)
+{
+	assert(_type == DatumTypes::Vector2);
+	assert(position < _size);
+
+	Detach();
+	return _data.v2[position];
+}
+
+glm::vec3& FieaGameEngine::Datum::GetAsVector3(std::size_t position)
+{
+	assert(_type == DatumTypes::Vector3);
+	assert(position < _size);
+
+	Detach();
+	return _data.v3[position];
+}
+
+glm::quat& FieaGameEngine::Datum::GetAsQuaternion(std::size_t position)
+{
+	assert(_type == DatumTypes::Quaternion);
+	assert(position < _size);
+
+	Detach();
+	return _data.q[position];
+}
+
+const glm::mat4& FieaGameEngine::Datum::GetAsMatrix(std::size_t position) const
+{
+	assert(_type == DatumTypes::Matrix);
+	assert(position < _size);
+
+	return _data.m[position];
+}
+
+std::int64_t FieaGameEngine::Datum::GetAsInt64(std::size_t position) const
+{
+	assert(_type == DatumTypes::Int64);
+	assert(position < _size);
+
+	return _data.l[position];
+}
+
+double FieaGameEngine::Datum::GetAsDouble(std::size_t position) const
+{
+	assert(_type == DatumTypes::Double);
+	assert(position < _size);
+
+	return _data.d[position];
+}
+
+bool FieaGameEngine::Datum::GetAsBool(std::size_t position) const
+{
+	assert(_type == DatumTypes::Bool);
+	assert(position < _size);
+
+	return _data.b[position];
+}
+
+const glm::vec2& FieaGameEngine::Datum::GetAsVector2(std::size_t position) const
+{
+	assert(_type == DatumTypes::Vector2);
+	assert(position < _size);
+
+	return _data.v2[position];
+}
+
+const glm::vec3& FieaGameEngine::Datum::GetAsVector3(std::size_t position) const
+{
+	assert(_type == DatumTypes::Vector3);
+	assert(position < _size);
+
+	return _data.v3[position];
+}
+
+const glm::quat& FieaGameEngine::Datum::GetAsQuaternion(std::size_t position) const
+{
+	assert(_type == DatumTypes::Quaternion);
+	assert(position < _size);
+
+	return _data.q[position];
+}
+
+FieaGameEngine::RTTI*& FieaGameEngine::Datum::GetAsRTTI(std::size_t position)
+{
+	assert(_type == DatumTypes::Pointer);
+	assert(position < _size);
+
+	Detach();
+	return _data.p[position];
+}
+
+FieaGameEngine::RTTI* FieaGameEngine::Datum::GetAsRTTI(std::size_t position) const
+{
+	assert(_type == DatumTypes::Pointer);
+	assert(position < _size);
+
+	return _data.p[position];
+}
+
+FieaGameEngine::Scope* FieaGameEngine::Datum::GetAsScope(std::size_t index) const
+{
+	assert(_type == DatumTypes::Table);
+	assert(index < _size);
+
+	return _data.t[index];
+}
+
+std::size_t FieaGameEngine::Datum::CopyTo(std::span<int> destination, std::size_t index) const
+{
+	assert(_type == DatumTypes::Integer);
+	return CopyTo(destination.data(), destination.size(), index);
+}
+
+std::size_t FieaGameEngine::Datum::CopyTo(std::span<float> destination, std::size_t index) const
+{
+	assert(_type == DatumTypes::Float);
+	return CopyTo(destination.data(), destination.size(), index);
+}
+
+std::size_t FieaGameEngine::Datum::CopyTo(std::span<std::string> destination, std::size_t index) const
+{
+	assert(_type == DatumTypes::String);
+	assert(index <= _size);
+
+	const std::size_t count{ index < _size ? std::min(destination.size(), _size - index) : 0 };
+	for (std::size_t position{ 0 }; position < count; ++position)
+	{
+		destination[position] = _data.s[index + position];
+	}
+	return count;
+}
+
+std::size_t FieaGameEngine::Datum::CopyTo(std::span<glm::vec4> destination, std::size_t index) const
+{
+	assert(_type == DatumTypes::Vector);
+	return CopyTo(destination.data(), destination.size(), index);
+}
+
+std::size_t FieaGameEngine::Datum::CopyTo(std::span<glm::mat4> destination, std::size_t index) const
+{
+	assert(_type == DatumTypes::Matrix);
+	return CopyTo(destination.data(), destination.size(), index);
+}
+
+std::size_t FieaGameEngine::Datum::CopyTo(std::span<std::int64_t> destination, std::size_t index) const
+{
+	assert(_type == DatumTypes::Int64);
+	return CopyTo(destination.data(), destination.size(), index);
+}
+
+std::size_t FieaGameEngine::Datum::CopyTo(std::span<double> destination, std::size_t index) const
+{
+	assert(_type == DatumTypes::Double);
+	return CopyTo(destination.data(), destination.size(), index);
+}
+
+std::size_t FieaGameEngine::Datum::CopyTo(std::span<bool> destination, std::size_t index) const
+{
+	assert(_type == DatumTypes::Bool);
+	return CopyTo(destination.data(), destination.size(), index);
+}
+
+std::size_t FieaGameEngine::Datum::CopyTo(std::span<glm::vec2> destination, std::size_t index) const
+{
+	assert(_type == DatumTypes::Vector2);
+	return CopyTo(destination.data(), destination.size(), index);
+}
+
+std::size_t FieaGameEngine::Datum::CopyTo(std::span<glm::vec3> destination, std::size_t index) const
+{
+	assert(_type == DatumTypes::Vector3);
+	return CopyTo(destination.data(), destination.size(), index);
+}
+
+std::size_t FieaGameEngine::Datum::CopyTo(std::span<glm::quat> destination, std::size_t index) const
+{
+	assert(_type == DatumTypes::Quaternion);
+	return CopyTo(destination.data(), destination.size(), index);
+}
+
+std::size_t FieaGameEngine::Datum::CopyTo(void* destination, std::size_t count, std::size_t index) const
+{
+	assert(index <= _size);
+
+	const std::size_t copied{ index < _size ? std::min(count, _size - index) : 0 };
+	if (copied > 0)
+	{
+		memmove(destination, static_cast<const std::byte*>(_data.vp) + (index * TypeSize()), copied * TypeSize());
+	}
+	return copied;
+}
+
+std::size_t FieaGameEngine::Datum::CopyTo(Datum& destination) const
+{
+	assert(_type == destination._type);
+	assert(_type != DatumTypes::Table);
+
+	const std::size_t count{ std::min(_size, destination._size) };
+	destination.Detach();
+	if (_type == DatumTypes::String)
+	{
+		for (std::size_t position{ 0 }; position < count; ++position)
+		{
+			destination._data.s[position] = _data.s[position];
+		}
+	}
+	else if (count > 0)
+	{
+		memmove(destination._data.vp, _data.vp, count * TypeSize());
+	}
+	return count;
+}
+
+#pragma endregion
+
+#pragma region Remove
+
+void FieaGameEngine::Datum::Remove(int value)
+{
+	assert(_type == DatumTypes::Integer);
+	std::size_t position = Find(value);
+	if (position < _size)
+	{
+		RemoveAt(position);
+	}
+}
+
+void FieaGameEngine::Datum::Remove(float value)
+{
+	assert(_type == DatumTypes::Float);
+	std::size_t position = Find(value);
+	if (position < _size)
+	{
+		RemoveAt(position);
+	}
+}
+
+void FieaGameEngine::Datum::Remove(const std::string& value)
+{
+	assert(_type == DatumTypes::String);
+	std::size_t position = Find(value);
+	if (position < _size)
+	{
+		RemoveAt(position);
+	}
+}
+
+void FieaGameEngine::Datum::Remove(const glm::vec4& value)
+{
+	assert(_type == DatumTypes::Vector);
+	std::size_t position = Find(value);
+	if (position < _size)
+	{
+		RemoveAt(position);
+	}
+}
+
+void FieaGameEngine::Datum::Remove(const glm::mat4& value)
+{
+	assert(_type == DatumTypes::Matrix);
+	std::size_t position = Find(value);
+	if (position < _size)
+	{
+		RemoveAt(position);
+	}
+}
+
+void FieaGameEngine::Datum::Remove(std::int64_t value)
+{
+	assert(_type == DatumTypes::Int64);
+	std::size_t position = Find(value);
+	if (position < _size)
+	{
+		RemoveAt(position);
+	}
+}
+
+void FieaGameEngine::Datum::Remove(double value)
+{
+	assert(_type == DatumTypes::Double);
+	std::size_t position = Find(value);
+	if (position < _size)
+	{
+		RemoveAt(position);
+	}
+}
+
+void FieaGameEngine::Datum::RemoveBool(bool value)
+{
+	assert(_type == DatumTypes::Bool);
+	std::size_t position = Find(value);
+	if (position < _size)
+	{
+		RemoveAt(position);
+	}
+}
+
+void FieaGameEngine::Datum::Remove(const glm::vec2& value)
+{
+	assert(_type == DatumTypes::Vector2);
+	std::size_t position = Find(value);
+	if (position < _size)
+	{
+		RemoveAt(position);
+	}
+}
+
+void FieaGameEngine::Datum::Remove(const glm::vec3& value)
+{
+	assert(_type == DatumTypes::Vector3);
+	std::size_t position = Find(value);
+	if (position < _size)
+	{
+		RemoveAt(position);
+	}
+}
+
+void FieaGameEngine::Datum::Remove(const glm::quat& value)
+{
+	assert(_type == DatumTypes::Quaternion);
+	std::size_t position = Find(value);
+	if (position < _size)
+	{
+		RemoveAt(position);
+	}
+}
+
+void FieaGameEngine::Datum::Remove(const RTTI* value)
+{
+	assert(_type == DatumTypes::Pointer);
+	std::size_t position = Find(value);
+	if (position < _size)
+	{
+		RemoveAt(position);
+	}
+}
+
+void FieaGameEngine::Datum::RemoveAt(std::size_t index)
+{
+	if (!_isExternal)
+	{
+		assert(index < _size);
+		Detach();
+		if (_type == DatumTypes::String)
+		{
+			_data.s[index].~basic_string();
+		}
+		else if (_type == DatumTypes::Table)
+		{
+			ReleaseChild(index);
+		}
+		--_size;
+		memmove((static_cast<std::byte*>(_data.vp) + (index * TypeSize())), ((static_cast<std::byte*>(_data.vp)) + ((index + 1) * TypeSize())), (_size - index) * TypeSize());
+		if (_type == DatumTypes::Table)
+		{
+			ReindexChildren(index);
+		}
+	}
+}
+#pragma endregion
+
+#pragma region FrontAndBack
+
+int& FieaGameEngine::Datum::FrontAsInt()
+{
+	return GetAsInt(0);
+}
+
+float& FieaGameEngine::Datum::FrontAsFloat()
+{
+	return GetAsFloat(0);
+}
+
+std::string& FieaGameEngine::Datum::FrontAsString()
+{
+	return GetAsString(0);
+}
+
+glm::vec4& FieaGameEngine::Datum::FrontAsVector()
+{
+	return GetAsVector(0);
+}
+
+glm::mat4& FieaGameEngine::Datum::FrontAsMatrix()
+{
+	return GetAsMatrix(0);
+}
+
+std::int64_t& FieaGameEngine::Datum::FrontAsInt64()
+{
+	return GetAsInt64(0);
+}
+
+double& FieaGameEngine::Datum::FrontAsDouble()
+{
+	return GetAsDouble(0);
+}
+
+bool& FieaGameEngine::Datum::FrontAsBool()
+{
+	return GetAsBool(0);
+}
+
+glm::vec2& FieaGameEngine::Datum::FrontAsVector2()
+{
+	return GetAsVector2(0);
+}
+
+glm::vec3& FieaGameEngine::Datum::FrontAsVector3()
+{
+	return GetAsVector3(0);
+}
+
+glm::quat& FieaGameEngine::Datum::FrontAsQuaternion()
+{
+	return GetAsQuaternion(0);
+}
+
+FieaGameEngine::RTTI*& FieaGameEngine::Datum::FrontAsRTTI()
+{
+	return GetAsRTTI(0);
+}
+
+int FieaGameEngine::Datum::FrontAsInt() const
+{
+	return GetAsInt(0);
+}
+
+float FieaGameEngine::Datum::FrontAsFloat() const
+{
+	return GetAsFloat(0);
+}
+
+const std::string& FieaGameEngine::Datum::FrontAsString() const
+{
+	return GetAsString(0);
+}
+
+const glm::vec4& FieaGameEngine::Datum::FrontAsVector() const
+{
+	return GetAsVector(0);
+}
+
+const glm::mat4& FieaGameEngine::Datum::FrontAsMatrix() const
+{
+	return GetAsMatrix(0);
+}
+
+std::int64_t FieaGameEngine::Datum::FrontAsInt64() const
+{
+	return GetAsInt64(0);
+}
+
+double FieaGameEngine::Datum::FrontAsDouble() const
+{
+	return GetAsDouble(0);
+}
+
+bool FieaGameEngine::Datum::FrontAsBool() const
+{
+	return GetAsBool(0);
+}
+
+const glm::vec2& FieaGameEngine::Datum::FrontAsVector2() const
+{
+	return GetAsVector2(0);
+}
+
+const glm::vec3& FieaGameEngine::Datum::FrontAsVector3() const
+{
+	return GetAsVector3(0);
+}
+
+const glm::quat& FieaGameEngine::Datum::FrontAsQuaternion() const
+{
+	return GetAsQuaternion(0);
+}
+
+FieaGameEngine::RTTI* FieaGameEngine::Datum::FrontAsRTTI() const
+{
+	return GetAsRTTI(0);
+}
+
+int& FieaGameEngine::Datum::BackAsInt()
+{
+	return GetAsInt(_size - 1);
+}
+
+float& FieaGameEngine::Datum::BackAsFloat()
+{
+	return GetAsFloat(_size - 1);
+}
+
+std::string& FieaGameEngine::Datum::BackAsString()
+{
+	return GetAsString(_size - 1);
+}
+
+glm::vec4& FieaGameEngine::Datum::BackAsVector()
+{
+	return GetAsVector(_size - 1);
+}
+
+glm::mat4& FieaGameEngine::Datum::BackAsMatrix()
+{
+	return GetAsMatrix(_size - 1);
+}
+
+std::int64_t& FieaGameEngine::Datum::BackAsInt64()
+{
+	return GetAsInt64(_size - 1);
+}
+
+double& FieaGameEngine::Datum::BackAsDouble()
+{
+	return GetAsDouble(_size - 1);
+}
+
+bool& FieaGameEngine::Datum::BackAsBool()
+{
+	return GetAsBool(_size - 1);
+}
+
+glm::vec2& FieaGameEngine::Datum::BackAsVector2()
+{
+	return GetAsVector2(_size - 1);
+}
+
+glm::vec3& FieaGameEngine::Datum::BackAsVector3()
+{
+	return GetAsVector3(_size - 1);
+}
+
+glm::quat& FieaGameEngine::Datum::BackAsQuaternion()
+{
+	return GetAsQuaternion(_size - 1);
+}
+
+FieaGameEngine::RTTI*& FieaGameEngine::Datum::BackAsRTTI()
+{
+	return GetAsRTTI(_size - 1);
+}
+
+int FieaGameEngine::Datum::BackAsInt() const
+{
+	return GetAsInt(_size - 1);
+}
+
+float FieaGameEngine::Datum::BackAsFloat() const
+{
+	return GetAsFloat(_size - 1);
+}
+
+const std::string& FieaGameEngine::Datum::BackAsString() const
+{
+	return GetAsString(_size - 1);
+}
+
+const glm::vec4& FieaGameEngine::Datum::BackAsVector() const
+{
+	return GetAsVector(_size - 1);
+}
+
+const glm::mat4& FieaGameEngine::Datum::BackAsMatrix() const
+{
+	return GetAsMatrix(_size - 1);
+}
+
+std::int64_t FieaGameEngine::Datum::BackAsInt64() const
+{
+	return GetAsInt64(_size - 1);
+}
+
+double FieaGameEngine::Datum::BackAsDouble() const
+{
+	return GetAsDouble(_size - 1);
+}
+
+bool FieaGameEngine::Datum::BackAsBool() const
+{
+	return GetAsBool(_size - 1);
+}
+
+const glm::vec2& FieaGameEngine::Datum::BackAsVector2() const
+{
+	return GetAsVector2(_size - 1);
+}
+
+const glm::vec3& FieaGameEngine::Datum::BackAsVector3() const
+{
+	return GetAsVector3(_size - 1);
+}
+
+const glm::quat& FieaGameEngine::Datum::BackAsQuaternion() const
+{
+	return GetAsQuaternion(_size - 1);
+}
+
+FieaGameEngine::RTTI* FieaGameEngine::Datum::BackAsRTTI() const
+{
+	return GetAsRTTI(_size - 1);
+}
+
+
+#pragma endregion 
+
+#pragma region Find
+namespace
+{
+	std::size_t Search(std::span<const int> values, int value)
+	{
+		return FieaGameEngine::SimdMath::Find(values, value);
+	}
+
+	std::size_t Search(std::span<const float> values, float value)
+	{
+		return FieaGameEngine::SimdMath::Find(values, value);
+	}
+
+	std::size_t Search(std::span<const std::string> values, const std::string& value)
 	{
-		RemoveAt(position);
+		return static_cast<std::size_t>(std::find(values.begin(), values.end(), value) - values.begin());
 	}
-}
 
-void FieaGameEngine::Datum::Remove(const std::string& value)
-{
-	assert(_type == DatumTypes::String);
-	std::size_t position = Find(value);
-	if (position < _size)
+	std::size_t Search(std::span<const glm::vec4> values, const glm::vec4& value)
 	{
-		RemoveAt(position);
+		return FieaGameEngine::SimdMath::Find(values, value);
 	}
-}
 
-void FieaGameEngine::Datum::Remove(const glm::vec4& value)
-{
-	assert(_type == DatumTypes::Vector);
-	std::size_t position = Find(value);
-	if (position < _size)
+	std::size_t Search(std::span<const glm::mat4> values, const glm::mat4& value)
 	{
-		RemoveAt(position);
+		return FieaGameEngine::SimdMath::Find(values, value);
 	}
-}
 
-void FieaGameEngine::Datum::Remove(const glm::mat4& value)
-{
-	assert(_type == DatumTypes::Matrix);
-	std::size_t position = Find(value);
-	if (position < _size)
+	std::size_t Search(std::span<FieaGameEngine::RTTI* const> values, const FieaGameEngine::RTTI* value)
 	{
-		RemoveAt(position);
+		return FieaGameEngine::SimdMath::Find(std::span<const void* const>{ reinterpret_cast<const void* const*>(values.data()), values.size() }, value);
 	}
-}
 
-void FieaGameEngine::Datum::Remove(const RTTI* value)
-{
-	assert(_type == DatumTypes::Pointer);
-	std::size_t position = Find(value);
-	if (position < _size)
+	/// <summary>
+	/// Falls back to a linear scan for the types SimdMath has no kernel for.
+	/// </summary>
+	template <typename T>
+	std::size_t Search(std::span<const T> values, const T& value)
 	{
-		RemoveAt(position);
+		return static_cast<std::size_t>(std::find(values.begin(), values.end(), value) - values.begin());
 	}
-}
 
-void FieaGameEngine::Datum::RemoveAt(std::size_t index)
-{
-	if (!_isExternal)
+	/// <summary>
+	/// Restarts the search one past each match, so an array with few matches is still scanned only once.
+	/// </summary>
+	template <typename T, typename TValue>
+	FieaGameEngine::Vector<std::size_t> SearchAll(std::span<T> values, const TValue& value)
 	{
-		assert(index < _size);
-		if (_type == DatumTypes::String)
+		FieaGameEngine::Vector<std::size_t> indices;
+		for (std::size_t index{ Search(values, value) }; index < values.size(); index += 1 + Search(values.subspan(index + 1), value))
 		{
-			_data.s[index].~basic_string();
+			indices.PushBack(index);
 		}
-		--_size;
-		memmove((static_cast<std::byte*>(_data.vp) + (index * _typeSize)), ((static_cast<std::byte*>(_data.vp)) + ((index + 1) * _typeSize)), (_size - index) * _typeSize);
+
+		return indices;
 	}
 }
-#pragma endregion
-
-#pragma region FrontAndBack
 
-int& FieaGameEngine::Datum::FrontAsInt()
+std::size_t FieaGameEngine::Datum::Find(int value) const
 {
-	return GetAsInt(0);
+	return Search(AsSpan<int>(), value);
 }
 
-float& FieaGameEngine::Datum::FrontAsFloat()
+std::size_t FieaGameEngine::Datum::Find(float value) const
 {
-	return GetAsFloat(0);
+	return Search(AsSpan<float>(), value);
 }
 
-std::string& FieaGameEngine::Datum::FrontAsString()
+std::size_t FieaGameEngine::Datum::Find(const std::string& value) const
 {
-	return GetAsString(0);
+	return Search(AsSpan<std::string>(), value);
 }
 
-glm::vec4& FieaGameEngine::Datum::FrontAsVector()
+std::size_t FieaGameEngine::Datum::Find(const glm::vec4& value) const
 {
-	return GetAsVector(0);
+	return Search(AsSpan<glm::vec4>(), value);
 }
 
-glm::mat4& FieaGameEngine::Datum::FrontAsMatrix()
+std::size_t FieaGameEngine::Datum::Find(const glm::mat4& value) const
 {
-	return GetAsMatrix(0);
+	return Search(AsSpan<glm::mat4>(), value);
 }
 
-FieaGameEngine::RTTI*& FieaGameEngine::Datum::FrontAsRTTI()
+std::size_t FieaGameEngine::Datum::Find(std::int64_t value) const
 {
-	return GetAsRTTI(0);
+	return Search(AsSpan<std::int64_t>(), value);
 }
 
-int FieaGameEngine::Datum::FrontAsInt() const
+std::size_t FieaGameEngine::Datum::Find(double value) const
 {
-	return GetAsInt(0);
+	return Search(AsSpan<double>(), value);
 }
 
-float FieaGameEngine::Datum::FrontAsFloat() const
+std::size_t FieaGameEngine::Datum::FindBool(bool value) const
 {
-	return GetAsFloat(0);
+	return Search(AsSpan<bool>(), value);
 }
 
-const std::string& FieaGameEngine::Datum::FrontAsString() const
+std::size_t FieaGameEngine::Datum::Find(const glm::vec2& value) const
 {
-	return GetAsString(0);
+	return Search(AsSpan<glm::vec2>(), value);
 }
 
-const glm::vec4& FieaGameEngine::Datum::FrontAsVector() const
+std::size_t FieaGameEngine::Datum::Find(const glm::vec3& value) const
 {
-	return GetAsVector(0);
+	return Search(AsSpan<glm::vec3>(), value);
 }
 
-const glm::mat4& FieaGameEngine::Datum::FrontAsMatrix() const
+std::size_t FieaGameEngine::Datum::Find(const glm::quat& value) const
 {
-	return GetAsMatrix(0);
+	return Search(AsSpan<glm::quat>(), value);
 }
 
-FieaGameEngine::RTTI* FieaGameEngine::Datum::FrontAsRTTI() const
+std::size_t FieaGameEngine::Datum::Find(const RTTI* value) const
 {
-	return GetAsRTTI(0);
+	return Search(AsSpan<RTTI*>(), value);
 }
 
-int& FieaGameEngine::Datum::BackAsInt()
+FieaGameEngine::Vector<std::size_t> FieaGameEngine::Datum::FindAll(int value) const
 {
-	return GetAsInt(_size - 1);
+	return SearchAll(AsSpan<int>(), value);
 }
 
-float& FieaGameEngine::Datum::BackAsFloat()
+FieaGameEngine::Vector<std::size_t> FieaGameEngine::Datum::FindAll(float value) const
 {
-	return GetAsFloat(_size - 1);
+	return SearchAll(AsSpan<float>(), value);
 }
 
-std::string& FieaGameEngine::Datum::BackAsString()
+FieaGameEngine::Vector<std::size_t> FieaGameEngine::Datum::FindAll(const std::string& value) const
 {
-	return GetAsString(_size - 1);
+	return SearchAll(AsSpan<std::string>(), value);
 }
 
-glm::vec4& FieaGameEngine::Datum::BackAsVector()
+FieaGameEngine::Vector<std::size_t> FieaGameEngine::Datum::FindAll(const glm::vec4& value) const
 {
-	return GetAsVector(_size - 1);
+	return SearchAll(AsSpan<glm::vec4>(), value);
 }
 
-glm::mat4& FieaGameEngine::Datum::BackAsMatrix()
+FieaGameEngine::Vector<std::size_t> FieaGameEngine::Datum::FindAll(const glm::mat4& value) const
 {
-	return GetAsMatrix(_size - 1);
+	return SearchAll(AsSpan<glm::mat4>(), value);
 }
 
-FieaGameEngine::RTTI*& FieaGameEngine::Datum::BackAsRTTI()
+FieaGameEngine::Vector<std::size_t> FieaGameEngine::Datum::FindAll(std::int64_t value) const
 {
-	return GetAsRTTI(_size - 1);
+	return SearchAll(AsSpan<std::int64_t>(), value);
 }
 
-int FieaGameEngine::Datum::BackAsInt() const
+FieaGameEngine::Vector<std::size_t> FieaGameEngine::Datum::FindAll(double value) const
 {
-	return GetAsInt(_size - 1);
+	return SearchAll(AsSpan<double>(), value);
 }
 
-float FieaGameEngine::Datum::BackAsFloat() const
+FieaGameEngine::Vector<std::size_t> FieaGameEngine::Datum::FindAllBool(bool value) const
 {
-	return GetAsFloat(_size - 1);
+	return SearchAll(AsSpan<bool>(), value);
 }
 
-const std::string& FieaGameEngine::Datum::BackAsString() const
+FieaGameEngine::Vector<std::size_t> FieaGameEngine::Datum::FindAll(const glm::vec2& value) const
 {
-	return GetAsString(_size - 1);
+	return SearchAll(AsSpan<glm::vec2>(), value);
 }
 
-const glm::vec4& FieaGameEngine::Datum::BackAsVector() const
+FieaGameEngine::Vector<std::size_t> FieaGameEngine::Datum::FindAll(const glm::vec3& value) const
 {
-	return GetAsVector(_size - 1);
+	return SearchAll(AsSpan<glm::vec3>(), value);
 }
 
-const glm::mat4& FieaGameEngine::Datum::BackAsMatrix() const
+FieaGameEngine::Vector<std::size_t> FieaGameEngine::Datum::FindAll(const glm::quat& value) const
 {
-	return GetAsMatrix(_size - 1);
+	return SearchAll(AsSpan<glm::quat>(), value);
 }
 
-FieaGameEngine::RTTI* FieaGameEngine::Datum::BackAsRTTI() const
+FieaGameEngine::Vector<std::size_t> FieaGameEngine::Datum::FindAll(const RTTI* value) const
 {
-	return GetAsRTTI(_size - 1);
+	return SearchAll(AsSpan<RTTI*>(), value);
 }
 
+#pragma endregion
 
-#pragma endregion 
-
-#pragma region Find
-
-std::size_t FieaGameEngine::Datum::Find(int value) const
+#pragma region Chars
+namespace
 {
-	assert(_type == DatumTypes::Integer);
-	std::size_t position{ 0 };
-	while (position < _size)
+	bool IsSpace(char character)
+	{
+		return character == ' ' || character == '\t' || character == '\n' || character == '\r' || character == '\f' || character == '\v';
+	}
+
+	const char* SkipSpace(const char* first, const char* last)
 	{
-		if (_data.i[position] == value)
+		while (first != last && IsSpace(*first))
 		{
-			break;
+			++first;
 		}
-		++position;
-	}
 
-	return position;
-}
+		return first;
+	}
 
-std::size_t FieaGameEngine::Datum::Find(float value) const
-{
-	assert(_type == DatumTypes::Float);
-	std::size_t position{ 0 };
-	while (position < _size)
+	/// <summary>
+	/// Skips whitespace, then moves past the literal if the text starts with it.
+	/// </summary>
+	bool Expect(const char*& position, const char* last, std::string_view literal)
 	{
-		if (_data.f[position] == value)
+		const char* start{ SkipSpace(position, last) };
+		if (static_cast<std::size_t>(last - start) < literal.size() || !std::equal(literal.begin(), literal.end(), start))
 		{
-			break;
+			return false;
 		}
-		++position;
-	}
 
-	return position;
-}
+		position = start + literal.size();
+		return true;
+	}
 
-std::size_t FieaGameEngine::Datum::Find(const std::string& value) const
-{
-	assert(_type == DatumTypes::String);
-	std::size_t position{ 0 };
-	while (position < _size)
+	/// <summary>
+	/// Matches what std::stoi, std::stof and %f accept ahead of the digits, which std::from_chars does not.
+	/// </summary>
+	template <typename T>
+	std::from_chars_result ParseNumber(const char* first, const char* last, T& value)
 	{
-		if (_data.s[position] == value)
+		const char* start{ SkipSpace(first, last) };
+		if (start != last && *start == '+')
 		{
-			break;
+			++start;
 		}
-		++position;
+
+		const std::from_chars_result result{ std::from_chars(start, last, value) };
+		return result.ec == std::errc{} ? result : std::from_chars_result{ first, result.ec };
 	}
 
-	return position;
-}
+	/// <summary>
+	/// Parses "(x, y, ...)" into consecutive floats, one for each component, between the given brackets.
+	/// </summary>
+	std::errc ParseComponents(const char*& position, const char* last, std::span<float> components, std::string_view open = "(", std::string_view close = ")")
+	{
+		if (!Expect(position, last, open))
+		{
+			return std::errc::invalid_argument;
+		}
 
-std::size_t FieaGameEngine::Datum::Find(const glm::vec4& value) const
-{
-	assert(_type == DatumTypes::Vector);
-	std::size_t position{ 0 };
-	while (position < _size)
+		for (std::size_t component{ 0 }; component < components.size(); ++component)
+		{
+			if (component > 0 && !Expect(position, last, ","))
+			{
+				return std::errc::invalid_argument;
+			}
+
+			const std::from_chars_result result{ ParseNumber(position, last, components[component]) };
+			if (result.ec != std::errc{})
+			{
+				return result.ec;
+			}
+			position = result.ptr;
+		}
+
+		return Expect(position, last, close) ? std::errc{} : std::errc::invalid_argument;
+	}
+
+	std::to_chars_result WriteLiteral(char* first, char* last, std::string_view literal)
 	{
-		if (_data.v[position] == value)
+		if (static_cast<std::size_t>(last - first) < literal.size())
 		{
-			break;
+			return { last, std::errc::value_too_large };
 		}
-		++position;
+
+		return { std::copy(literal.begin(), literal.end(), first), std::errc{} };
 	}
 
-	return position;
-}
+	/// <summary>
+	/// Writes "(x, y, ...)", or the components between the given brackets.
+	/// </summary>
+	std::to_chars_result WriteComponents(char* first, char* last, std::span<const float> components, std::string_view open = "(", std::string_view close = ")")
+	{
+		std::to_chars_result result{ WriteLiteral(first, last, open) };
+		for (std::size_t component{ 0 }; component < components.size() && result.ec == std::errc{}; ++component)
+		{
+			if (component > 0)
+			{
+				result = WriteLiteral(result.ptr, last, ", ");
+			}
+			if (result.ec == std::errc{})
+			{
+				result = FieaGameEngine::Datum::Format(result.ptr, last, components[component]);
+			}
+		}
 
-std::size_t FieaGameEngine::Datum::Find(const glm::mat4& value) const
-{
-	assert(_type == DatumTypes::Matrix);
-	std::size_t position{ 0 };
-	while (position < _size)
+		return result.ec == std::errc{} ? WriteLiteral(result.ptr, last, close) : result;
+	}
+
+	/// <summary>
+	/// Parses a vector written as the given name followed by its components, such as "vec2(x, y)".
+	/// </summary>
+	template <typename T>
+	std::from_chars_result ParseVector(const char* first, const char* last, std::string_view name, T& value)
 	{
-		if (_data.m[position] == value)
+		const char* position{ first };
+		T result{};
+		if (!Expect(position, last, name))
+		{
+			return { first, std::errc::invalid_argument };
+		}
+
+		const std::errc error{ ParseComponents(position, last, { &result.x, sizeof(T) / sizeof(float) }) };
+		if (error != std::errc{})
 		{
-			break;
+			return { first, error };
 		}
-		++position;
+
+		value = result;
+		return { position, std::errc{} };
 	}
+}
 
-	return position;
+std::to_chars_result FieaGameEngine::Datum::Format(char* first, char* last, int value)
+{
+	return std::to_chars(first, last, value);
 }
 
-std::size_t FieaGameEngine::Datum::Find(const RTTI* value) const
+std::to_chars_result FieaGameEngine::Datum::Format(char* first, char* last, float value)
 {
-	assert(_type == DatumTypes::Pointer);
-	std::size_t position{ 0 };
-	while (position < _size)
+	return std::to_chars(first, last, value, std::chars_format::fixed, 6);
+}
+
+std::to_chars_result FieaGameEngine::Datum::Format(char* first, char* last, const glm::vec4& value)
+{
+	const std::to_chars_result result{ WriteLiteral(first, last, "vec4") };
+	return result.ec == std::errc{} ? WriteComponents(result.ptr, last, { &value.x, 4 }) : result;
+}
+
+std::to_chars_result FieaGameEngine::Datum::Format(char* first, char* last, const glm::mat4& value)
+{
+	std::to_chars_result result{ WriteLiteral(first, last, "mat4x4(") };
+	for (int column{ 0 }; column < 4 && result.ec == std::errc{}; ++column)
 	{
-		if (_data.p[position] == value)
+		if (column > 0)
 		{
-			break;
+			result = WriteLiteral(result.ptr, last, ", ");
+		}
+		if (result.ec == std::errc{})
+		{
+			result = WriteComponents(result.ptr, last, { &value[column].x, 4 });
 		}
-		++position;
 	}
 
-	return position;
+	return result.ec == std::errc{} ? WriteLiteral(result.ptr, last, ")") : result;
 }
 
-#pragma endregion
-
-#pragma region ToString
-std::string FieaGameEngine::Datum::ToString(std::size_t index)
+std::to_chars_result FieaGameEngine::Datum::Format(char* first, char* last, std::int64_t value)
 {
-	assert(index < _size);
-	assert(_type != DatumTypes::Unknown);
-	ToStringFunction func = _toStringFunctions[static_cast<int>(_type)];
-	assert(func != nullptr);
-	return (this->*func)(index);
+	return std::to_chars(first, last, value);
 }
 
-std::string FieaGameEngine::Datum::ToStringInt(std::size_t index)
+std::to_chars_result FieaGameEngine::Datum::Format(char* first, char* last, double value)
 {
-	assert(_type == DatumTypes::Integer);
-	return std::to_string(_data.i[index]);
+	return std::to_chars(first, last, value);
 }
 
-std::string FieaGameEngine::Datum::ToStringFloat(std::size_t index)
+std::to_chars_result FieaGameEngine::Datum::Format(char* first, char* last, bool value)
 {
-	assert(_type == DatumTypes::Float);
-	return std::to_string(_data.f[index]);
+	return WriteLiteral(first, last, value ? "true" : "false");
 }
 
-std::string FieaGameEngine::Datum::ToStringString(std::size_t index)
+std::to_chars_result FieaGameEngine::Datum::Format(char* first, char* last, const glm::vec2& value)
 {
-	assert(_type == DatumTypes::String);
-	return _data.s[index];
+	const std::to_chars_result result{ WriteLiteral(first, last, "vec2") };
+	return result.ec == std::errc{} ? WriteComponents(result.ptr, last, { &value.x, 2 }) : result;
 }
 
-std::string FieaGameEngine::Datum::ToStringVector(std::size_t index)
+std::to_chars_result FieaGameEngine::Datum::Format(char* first, char* last, const glm::vec3& value)
 {
-	assert(_type == DatumTypes::Vector);
-	return glm::to_string(_data.v[index]);
+	const std::to_chars_result result{ WriteLiteral(first, last, "vec3") };
+	return result.ec == std::errc{} ? WriteComponents(result.ptr, last, { &value.x, 3 }) : result;
 }
 
-std::string FieaGameEngine::Datum::ToStringMatrix(std::size_t index)
+std::to_chars_result FieaGameEngine::Datum::Format(char* first, char* last, const glm::quat& value)
 {
-	assert(_type == DatumTypes::Matrix);
-	return glm::to_string(_data.m[index]);
+	std::to_chars_result result{ WriteLiteral(first, last, "quat(") };
+	if (result.ec == std::errc{})
+	{
+		result = Format(result.ptr, last, value.w);
+	}
+	if (result.ec == std::errc{})
+	{
+		result = WriteLiteral(result.ptr, last, ", ");
+	}
+	if (result.ec == std::errc{})
+	{
+		result = WriteComponents(result.ptr, last, { &value.x, 3 }, "{", "}");
+	}
+
+	return result.ec == std::errc{} ? WriteLiteral(result.ptr, last, ")") : result;
 }
 
-std::string FieaGameEngine::Datum::ToStringPointer(std::size_t index)
+std::from_chars_result FieaGameEngine::Datum::Parse(const char* first, const char* last, int& value)
 {
-	assert(_type == DatumTypes::Pointer);
-	return _data.p[index]->ToString();
+	return ParseNumber(first, last, value);
 }
 
-#pragma endregion
+std::from_chars_result FieaGameEngine::Datum::Parse(const char* first, const char* last, float& value)
+{
+	return ParseNumber(first, last, value);
+}
 
-#pragma region SetFromString
+std::from_chars_result FieaGameEngine::Datum::Parse(const char* first, const char* last, glm::vec4& value)
+{
+	return ParseVector(first, last, "vec4", value);
+}
 
-void FieaGameEngine::Datum::SetFromString(const std::string& string, std::size_t index)
+std::from_chars_result FieaGameEngine::Datum::Parse(const char* first, const char* last, glm::mat4& value)
 {
-	assert(_type != DatumTypes::Unknown && _type != DatumTypes::Pointer);
-	SetFromStringFunction func = _setFromStringFunctions[static_cast<int>(_type)];
-	assert(func != nullptr);
-	(this->*func)(string, index);
+	const char* position{ first };
+	glm::mat4 result{};
+	if (!Expect(position, last, "mat4x4") || !Expect(position, last, "("))
+	{
+		return { first, std::errc::invalid_argument };
+	}
+
+	for (int column{ 0 }; column < 4; ++column)
+	{
+		if (column > 0 && !Expect(position, last, ","))
+		{
+			return { first, std::errc::invalid_argument };
+		}
+
+		const std::errc error{ ParseComponents(position, last, { &result[column].x, 4 }) };
+		if (error != std::errc{})
+		{
+			return { first, error };
+		}
+	}
+
+	if (!Expect(position, last, ")"))
+	{
+		return { first, std::errc::invalid_argument };
+	}
+
+	value = result;
+	return { position, std::errc{} };
 }
 
-void FieaGameEngine::Datum::SetIntFromString(const std::string& string, std::size_t index)
+std::from_chars_result FieaGameEngine::Datum::Parse(const char* first, const char* last, std::int64_t& value)
 {
-	Set(std::stoi(string), index);
+	return ParseNumber(first, last, value);
 }
 
-void FieaGameEngine::Datum::SetFloatFromString(const std::string& string, std::size_t index)
+std::from_chars_result FieaGameEngine::Datum::Parse(const char* first, const char* last, double& value)
 {
-	Set(std::stof(string), index);
+	return ParseNumber(first, last, value);
 }
 
-void FieaGameEngine::Datum::SetVectorFromString(const std::string& string, std::size_t index)
+std::from_chars_result FieaGameEngine::Datum::Parse(const char* first, const char* last, bool& value)
 {
-	glm::vec4 vec{};
-	int result = sscanf_s(string.c_str(), " vec4(%f, %f, %f, %f) ", &vec.x, &vec.y, &vec.z, &vec.w);
-	assert(result == 4);
-	if (result == 4)
+	const char* position{ first };
+	if (Expect(position, last, "true"))
+	{
+		value = true;
+		return { position, std::errc{} };
+	}
+	if (Expect(position, last, "false"))
 	{
-		Set(vec, index);
+		value = false;
+		return { position, std::errc{} };
 	}
+
+	return { first, std::errc::invalid_argument };
 }
 
-void FieaGameEngine::Datum::SetMatrixFromString(const std::string& string, std::size_t index)
+std::from_chars_result FieaGameEngine::Datum::Parse(const char* first, const char* last, glm::vec2& value)
 {
-	glm::vec4 vec1{};
-	glm::vec4 vec2{};
-	glm::vec4 vec3{};
-	glm::vec4 vec4{};
-	int result = sscanf_s(string.c_str(), " mat4x4((%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f)) ",
-		&vec1.x, &vec1.y, &vec1.z, &vec1.w,
-		&vec2.x, &vec2.y, &vec2.z, &vec2.w,
-		&vec3.x, &vec3.y, &vec3.z, &vec3.w,
-		&vec4.x, &vec4.y, &vec4.z, &vec4.w
-		);
-	assert(result == 16);
-	if (result == 16)
-	{
-		Set(glm::mat4{ vec1, vec2, vec3, vec4 }, index);
-	}
+	return ParseVector(first, last, "vec2", value);
 }
 
-void FieaGameEngine::Datum::PushBackVectorFromString(const std::string& string)
+std::from_chars_result FieaGameEngine::Datum::Parse(const char* first, const char* last, glm::vec3& value)
 {
-	glm::vec4 vec{};
-	int result = sscanf_s(string.c_str(), " vec4(%f, %f, %f, %f) ", &vec.x, &vec.y, &vec.z, &vec.w);
-	assert(result == 4);
-	if (result == 4)
+	return ParseVector(first, last, "vec3", value);
+}
+
+std::from_chars_result FieaGameEngine::Datum::Parse(const char* first, const char* last, glm::quat& value)
+{
+	const char* position{ first };
+	glm::quat result{};
+	if (!Expect(position, last, "quat") || !Expect(position, last, "("))
+	{
+		return { first, std::errc::invalid_argument };
+	}
+
+	std::from_chars_result number{ ParseNumber(position, last, result.w) };
+	if (number.ec != std::errc{})
+	{
+		return { first, number.ec };
+	}
+	position = number.ptr;
+
+	if (!Expect(position, last, ","))
+	{
+		return { first, std::errc::invalid_argument };
+	}
+
+	const std::errc error{ ParseComponents(position, last, { &result.x, 3 }, "{", "}") };
+	if (error != std::errc{} || !Expect(position, last, ")"))
 	{
-		PushBack(vec);
+		return { first, error != std::errc{} ? error : std::errc::invalid_argument };
 	}
+
+	value = result;
+	return { position, std::errc{} };
+}
+
+std::to_chars_result FieaGameEngine::Datum::ToChars(char* first, char* last, std::size_t index) const
+{
+	assert(index < _size);
+	assert(_type != DatumTypes::Unknown);
+	ToCharsFunction func = _toCharsFunctions[static_cast<int>(_type)];
+	assert(func != nullptr);
+	return (this->*func)(first, last, index);
+}
+
+std::to_chars_result FieaGameEngine::Datum::ToCharsString(char* first, char* last, std::size_t index) const
+{
+	return WriteLiteral(first, last, _data.s[index]);
+}
+
+std::to_chars_result FieaGameEngine::Datum::ToCharsPointer(char* first, char* last, std::size_t index) const
+{
+	return WriteLiteral(first, last, _data.p[index]->ToString());
+}
+
+std::from_chars_result FieaGameEngine::Datum::FromChars(const char* first, const char* last, std::size_t index)
+{
+	assert(_type != DatumTypes::Unknown && _type != DatumTypes::Pointer && _type != DatumTypes::Table);
+	FromCharsFunction func = _fromCharsFunctions[static_cast<int>(_type)];
+	assert(func != nullptr);
+	return (this->*func)(first, last, index);
+}
+
+std::from_chars_result FieaGameEngine::Datum::FromCharsString(const char* first, const char* last, std::size_t index)
+{
+	Set(std::string{ first, last }, index);
+	return { last, std::errc{} };
 }
+#pragma endregion
 
-void FieaGameEngine::Datum::PushBackMatrixFromString(const std::string& string)
+#pragma region ToString
+std::string FieaGameEngine::Datum::ToString(std::size_t index)
 {
-	glm::vec4 vec1{};
-	glm::vec4 vec2{};
-	glm::vec4 vec3{};
-	glm::vec4 vec4{};
-	int result = sscanf_s(string.c_str(), " mat4x4((%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f)) ",
-		&vec1.x, &vec1.y, &vec1.z, &vec1.w,
-		&vec2.x, &vec2.y, &vec2.z, &vec2.w,
-		&vec3.x, &vec3.y, &vec3.z, &vec3.w,
-		&vec4.x, &vec4.y, &vec4.z, &vec4.w
-	);
-	assert(result == 16);
-	if (result == 16)
+	assert(index < _size);
+	assert(_type != DatumTypes::Unknown);
+	if (_type == DatumTypes::String)
+	{
+		return _data.s[index];
+	}
+	if (_type == DatumTypes::Pointer || _type == DatumTypes::Table)
 	{
-		PushBack(glm::mat4{ vec1, vec2, vec3, vec4 });
+		return _data.p[index]->ToString();
 	}
+
+	std::array<char, CharsBufferSize> buffer;
+	const std::to_chars_result result{ ToChars(buffer.data(), buffer.data() + buffer.size(), index) };
+	assert(result.ec == std::errc{});
+	return std::string{ buffer.data(), result.ptr };
 }
+#pragma endregion
 
+#pragma region SetFromString
+void FieaGameEngine::Datum::SetFromString(std::string_view string, std::size_t index)
+{
+	[[maybe_unused]] const std::from_chars_result result{ FromChars(string.data(), string.data() + string.size(), index) };
+	assert(result.ec == std::errc{});
+}
 #pragma endregion
\ No newline at end of file
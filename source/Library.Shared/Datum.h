@@ -1,11 +1,20 @@
 #pragma once
 
+#include <charconv>
+#include <concepts>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
 #include <string>
+#include <string_view>
 #include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
 #include <glm/gtx/string_cast.hpp>
 #include <array>
+#include <span>
 #include "RTTI.h"
+#include "Vector.h"
 
 namespace FieaGameEngine
 {
@@ -13,7 +22,7 @@ namespace FieaGameEngine
 	class Scope;
 	class JsonTableParseHelper;
 	/// <summary>
-	/// Datum is a class that is part of a larger hierarchy that can contain multiple different types including int, float, string, vec4, mat4, and RTTI*. It stores the values in a dynamic array. In order to utilize the storage
+	/// Datum is a class that is part of a larger hierarchy that can contain multiple different types including int, int64, float, double, bool, string, vec2, vec3, vec4, quat, mat4, and RTTI*. It stores the values in a dynamic array, which is kept inside the Datum itself while it is small enough. In order to utilize the storage
 	/// of a Datum, the type must first be set. This can be done during initialization or after initialization. The type cannot be changed dynamically unless being assigned to the value of another datum. Datums can also serve as a thin wrapper for
 	/// other class' data.
 	/// </summary>
@@ -24,9 +33,9 @@ namespace FieaGameEngine
 		friend Attributed;
 		friend JsonTableParseHelper;
 		/// <summary>
-		/// Enumeration for the possible data types.
+		/// Enumeration for the possible data types. It is one byte wide so that a Datum can pack it next to its flags.
 		/// </summary>
-		enum class DatumTypes
+		enum class DatumTypes : std::int8_t
 		{
 			Unknown = -1,
 			Integer = 0,
@@ -35,7 +44,13 @@ namespace FieaGameEngine
 			Vector = 3,
 			Matrix = 4,
 			Pointer = 5,
-			Table = 6
+			Table = 6,
+			Int64 = 7,
+			Double = 8,
+			Bool = 9,
+			Vector2 = 10,
+			Vector3 = 11,
+			Quaternion = 12
 		};
 
 	private:
@@ -48,11 +63,17 @@ namespace FieaGameEngine
 			glm::mat4* m;
 			RTTI** p;
 			Scope** t;
+			std::int64_t* l;
+			double* d;
+			bool* b;
+			glm::vec2* v2;
+			glm::vec3* v3;
+			glm::quat* q;
 			void* vp;
 		};
 
 
-		inline static const std::array<std::size_t, 7> _typeSizes
+		inline static const std::array<std::size_t, 13> _typeSizes
 		{
 			sizeof(int),
 			sizeof(float),
@@ -60,15 +81,43 @@ namespace FieaGameEngine
 			sizeof(glm::vec4),
 			sizeof(glm::mat4),
 			sizeof(RTTI*),
-			sizeof(Scope*)
+			sizeof(Scope*),
+			sizeof(std::int64_t),
+			sizeof(double),
+			sizeof(bool),
+			sizeof(glm::vec2),
+			sizeof(glm::vec3),
+			sizeof(glm::quat)
 		};
 
+		/// <summary>
+		/// Scopes hold thousands of Datums, so the bookkeeping is kept small: sizes are 32 bits, the type and both flags share a single byte,
+		/// and the size of an element is looked up from the type rather than stored.
+		/// </summary>
 		DatumValues _data{ nullptr };
-		std::size_t _size{ 0 };
-		std::size_t _capacity{ 0 };
-		DatumTypes _type{ DatumTypes::Unknown };
-		std::size_t _typeSize{ 0 };
-		bool _isExternal{ false };
+		std::pmr::memory_resource* _resource{ nullptr };
+		std::uint32_t _size{ 0 };
+		std::uint32_t _capacity{ 0 };
+		DatumTypes _type : 5 { DatumTypes::Unknown };
+		bool _isExternal : 1 { false };
+		bool _isCopyOnWrite : 1 { false };
+
+		/// <summary>
+		/// Sits in front of the elements of every heap allocation a Datum makes, counting the copy-on-write Datums that share it and recording the size of the block
+		/// so it can be handed back to the memory resource it came from. Like the rest of Datum, the count is not safe to change from several threads at once.
+		/// </summary>
+		struct alignas(std::max_align_t) PayloadHeader final
+		{
+			std::size_t _references{ 1 };
+			std::size_t _bytes{ 0 };
+		};
+
+		/// <summary>
+		/// Bytes of storage held inside the Datum itself. A Datum whose capacity fits here, such as a single int, float, vec4 or a pair of pointers,
+		/// never touches the heap. Strings are always stored on the heap.
+		/// </summary>
+		static constexpr std::size_t InlineStorageSize{ sizeof(glm::vec4) };
+		alignas(void*) std::byte _buffer[InlineStorageSize]{};
 
 	public:
 		/// <summary>
@@ -81,6 +130,13 @@ namespace FieaGameEngine
 		/// <param name="type"> The enumeration of Datum::DatumTypes that corresponds to the desired type for the Datum to store and act as.</param>
 		explicit Datum(DatumTypes type);
 		/// <summary>
+		/// Constructs a datum of the given type whose heap storage comes from the given memory resource instead of malloc. The resource must outlive the Datum.
+		/// Copies made with the copy constructor use malloc again, while moves keep the resource along with the storage.
+		/// </summary>
+		/// <param name="type">The type the Datum stores.</param>
+		/// <param name="resource">Where heap storage is allocated from, or nullptr for malloc.</param>
+		Datum(DatumTypes type, std::pmr::memory_resource* resource);
+		/// <summary>
 		/// Constructs a datum equal to, but not the same as, the passed datum.
 		/// </summary>
 		/// <param name="other">The other datum being copied from.</param>
@@ -136,6 +192,44 @@ namespace FieaGameEngine
 		/// <summary>
 		/// If the assigned Datum has internal storage, it is cleared and resized to 1 and contains only the element on the right.
 		/// </summary>
+		/// <param name="other">int64 to assign to Datum</param>
+		/// <returns>Reference to the Datum being assigned.</returns>
+		Datum& operator=(std::int64_t other);
+		/// <summary>
+		/// If the assigned Datum has internal storage, it is cleared and resized to 1 and contains only the element on the right.
+		/// </summary>
+		/// <param name="other">double to assign to Datum</param>
+		/// <returns>Reference to the Datum being assigned.</returns>
+		Datum& operator=(double other);
+		/// <summary>
+		/// If the assigned Datum has internal storage, it is cleared and resized to 1 and contains only the element on the right.
+		/// Bool overloads that take a single value are templates, so that string literals and pointers, which convert to bool, still pick the overloads they always have.
+		/// </summary>
+		/// <param name="other">bool to assign to Datum</param>
+		/// <returns>Reference to the Datum being assigned.</returns>
+		template <std::same_as<bool> T>
+		Datum& operator=(T other);
+		/// <summary>
+		/// If the assigned Datum has internal storage, it is cleared and resized to 1 and contains only the element on the right.
+		/// </summary>
+		/// <param name="other">vec2 to assign to Datum</param>
+		/// <returns>Reference to the Datum being assigned.</returns>
+		Datum& operator=(const glm::vec2& other);
+		/// <summary>
+		/// If the assigned Datum has internal storage, it is cleared and resized to 1 and contains only the element on the right.
+		/// </summary>
+		/// <param name="other">vec3 to assign to Datum</param>
+		/// <returns>Reference to the Datum being assigned.</returns>
+		Datum& operator=(const glm::vec3& other);
+		/// <summary>
+		/// If the assigned Datum has internal storage, it is cleared and resized to 1 and contains only the element on the right.
+		/// </summary>
+		/// <param name="other">quat to assign to Datum</param>
+		/// <returns>Reference to the Datum being assigned.</returns>
+		Datum& operator=(const glm::quat& other);
+		/// <summary>
+		/// If the assigned Datum has internal storage, it is cleared and resized to 1 and contains only the element on the right.
+		/// </summary>
 		/// <param name="other">RTTI* to assign to Datum</param>
 		/// <returns>Reference to the Datum being assigned.</returns>
 		Datum& operator=(RTTI* const);
@@ -177,6 +271,43 @@ namespace FieaGameEngine
 		/// <returns>bool whether or not the scalar values are equivalent.</returns>
 		bool operator==(const glm::mat4& rhs) const;
 		/// <summary>
+		/// Checks Equivalence between a Datum and an int64. The Datum must be of size 1 and of the same type in order to be compared.
+		/// </summary>
+		/// <param name="rhs">int64 value to be compared against.</param>
+		/// <returns>bool whether or not the scalar values are equivalent.</returns>
+		bool operator==(std::int64_t rhs) const;
+		/// <summary>
+		/// Checks Equivalence between a Datum and a double. The Datum must be of size 1 and of the same type in order to be compared.
+		/// </summary>
+		/// <param name="rhs">double value to be compared against.</param>
+		/// <returns>bool whether or not the scalar values are equivalent.</returns>
+		bool operator==(double rhs) const;
+		/// <summary>
+		/// Checks Equivalence between a Datum and a bool. The Datum must be of size 1 and of the same type in order to be compared.
+		/// </summary>
+		/// <param name="rhs">bool value to be compared against.</param>
+		/// <returns>bool whether or not the scalar values are equivalent.</returns>
+		template <std::same_as<bool> T>
+		bool operator==(T rhs) const;
+		/// <summary>
+		/// Checks Equivalence between a Datum and a vec2. The Datum must be of size 1 and of the same type in order to be compared.
+		/// </summary>
+		/// <param name="rhs">vec2 value to be compared against.</param>
+		/// <returns>bool whether or not the scalar values are equivalent.</returns>
+		bool operator==(const glm::vec2& rhs) const;
+		/// <summary>
+		/// Checks Equivalence between a Datum and a vec3. The Datum must be of size 1 and of the same type in order to be compared.
+		/// </summary>
+		/// <param name="rhs">vec3 value to be compared against.</param>
+		/// <returns>bool whether or not the scalar values are equivalent.</returns>
+		bool operator==(const glm::vec3& rhs) const;
+		/// <summary>
+		/// Checks Equivalence between a Datum and a quat. The Datum must be of size 1 and of the same type in order to be compared.
+		/// </summary>
+		/// <param name="rhs">quat value to be compared against.</param>
+		/// <returns>bool whether or not the scalar values are equivalent.</returns>
+		bool operator==(const glm::quat& rhs) const;
+		/// <summary>
 		/// Checks Equivalence between a Datum and an RTTI*. The Datum must be of size 1 and of the same type in order to be compared.
 		/// </summary>
 		/// <param name="rhs">RTTI* value to be compared against.</param>
@@ -219,6 +350,43 @@ namespace FieaGameEngine
 		/// <returns>bool whether or not the scalar values are equivalent.</returns>
 		bool operator!=(const glm::mat4& rhs) const;
 		/// <summary>
+		/// Checks Equivalence between a Datum and an int64. The Datum must be of size 1 and of the same type in order to be compared.
+		/// </summary>
+		/// <param name="rhs">int64 value to be compared against.</param>
+		/// <returns>bool whether or not the scalar values are equivalent.</returns>
+		bool operator!=(std::int64_t rhs) const;
+		/// <summary>
+		/// Checks Equivalence between a Datum and a double. The Datum must be of size 1 and of the same type in order to be compared.
+		/// </summary>
+		/// <param name="rhs">double value to be compared against.</param>
+		/// <returns>bool whether or not the scalar values are equivalent.</returns>
+		bool operator!=(double rhs) const;
+		/// <summary>
+		/// Checks Equivalence between a Datum and a bool. The Datum must be of size 1 and of the same type in order to be compared.
+		/// </summary>
+		/// <param name="rhs">bool value to be compared against.</param>
+		/// <returns>bool whether or not the scalar values are equivalent.</returns>
+		template <std::same_as<bool> T>
+		bool operator!=(T rhs) const;
+		/// <summary>
+		/// Checks Equivalence between a Datum and a vec2. The Datum must be of size 1 and of the same type in order to be compared.
+		/// </summary>
+		/// <param name="rhs">vec2 value to be compared against.</param>
+		/// <returns>bool whether or not the scalar values are equivalent.</returns>
+		bool operator!=(const glm::vec2& rhs) const;
+		/// <summary>
+		/// Checks Equivalence between a Datum and a vec3. The Datum must be of size 1 and of the same type in order to be compared.
+		/// </summary>
+		/// <param name="rhs">vec3 value to be compared against.</param>
+		/// <returns>bool whether or not the scalar values are equivalent.</returns>
+		bool operator!=(const glm::vec3& rhs) const;
+		/// <summary>
+		/// Checks Equivalence between a Datum and a quat. The Datum must be of size 1 and of the same type in order to be compared.
+		/// </summary>
+		/// <param name="rhs">quat value to be compared against.</param>
+		/// <returns>bool whether or not the scalar values are equivalent.</returns>
+		bool operator!=(const glm::quat& rhs) const;
+		/// <summary>
 		/// Checks equivalence to another Datum. This comparison does not take into account the capacity of the Datums, but rather the type, size, and contents of said Datums.
 		/// </summary>
 		/// <param name="rhs">The right hand Datum being compared to.</param>
@@ -233,7 +401,7 @@ namespace FieaGameEngine
 		/// A getter for the current type assigned to the Datum.
 		/// </summary>
 		/// <returns>A DatumTypes enumeration specifying the type of data stored within the Datum.</returns>
-		DatumTypes Type();
+		DatumTypes Type() const;
 		/// <summary>
 		/// Sets the the storage to external for the Datum and assigns it as a thin layer to view the contents of another structure.
 		/// </summary>
@@ -269,14 +437,51 @@ namespace FieaGameEngine
 		/// </summary>
 		/// <param name="array">Array that holds the data. </param>
 		/// <param name="size">The size of the type.</param>
+		void SetStorage(std::int64_t* array, std::size_t size);
+		/// <summary>
+		/// Sets the the storage to external for the Datum and assigns it as a thin layer to view the contents of another structure.
+		/// </summary>
+		/// <param name="array">Array that holds the data. </param>
+		/// <param name="size">The size of the type.</param>
+		void SetStorage(double* array, std::size_t size);
+		/// <summary>
+		/// Sets the the storage to external for the Datum and assigns it as a thin layer to view the contents of another structure.
+		/// </summary>
+		/// <param name="array">Array that holds the data. </param>
+		/// <param name="size">The size of the type.</param>
+		void SetStorage(bool* array, std::size_t size);
+		/// <summary>
+		/// Sets the the storage to external for the Datum and assigns it as a thin layer to view the contents of another structure.
+		/// </summary>
+		/// <param name="array">Array that holds the data. </param>
+		/// <param name="size">The size of the type.</param>
+		void SetStorage(glm::vec2* array, std::size_t size);
+		/// <summary>
+		/// Sets the the storage to external for the Datum and assigns it as a thin layer to view the contents of another structure.
+		/// </summary>
+		/// <param name="array">Array that holds the data. </param>
+		/// <param name="size">The size of the type.</param>
+		void SetStorage(glm::vec3* array, std::size_t size);
+		/// <summary>
+		/// Sets the the storage to external for the Datum and assigns it as a thin layer to view the contents of another structure.
+		/// </summary>
+		/// <param name="array">Array that holds the data. </param>
+		/// <param name="size">The size of the type.</param>
+		void SetStorage(glm::quat* array, std::size_t size);
+		/// <summary>
+		/// Sets the the storage to external for the Datum and assigns it as a thin layer to view the contents of another structure.
+		/// </summary>
+		/// <param name="array">Array that holds the data. </param>
+		/// <param name="size">The size of the type.</param>
 		void SetStorage(RTTI** array, std::size_t size);
 		/// <summary>
 		/// Returns the number of elements held within the Datum.
 		/// </summary>
 		/// <returns>std::size_t number of elements</returns>
-		std::size_t Size();
+		std::size_t Size() const;
 		/// <summary>
 		/// Removes all elements from the Datum and does work where needed by destructing the objects.
+		/// Scopes removed from a Table are handed back to the caller as Scope::Orphan would, with their parent cleared.
 		/// </summary>
 		void Clear();
 		/// <summary>
@@ -285,6 +490,34 @@ namespace FieaGameEngine
 		/// <returns>std::size_t The total number of allocated spots for data.</returns>
 		std::size_t Capacity();
 		/// <summary>
+		/// Returns whether the stored data lives inside the Datum rather than on the heap.
+		/// </summary>
+		/// <returns>True if the data is stored inline.</returns>
+		bool IsInline() const;
+		/// <summary>
+		/// Turns copy-on-write on or off. Copies of a copy-on-write Datum share its heap storage, and are copy-on-write themselves, until one of them is written to,
+		/// which gives the writer its own copy. Every non-const accessor counts as a write, and a reference taken before a copy was made still points into the shared storage.
+		/// Copy construction, copy assignment and moves all take the flag from the source, so assigning a plain Datum to a copy-on-write one turns it off for the destination.
+		/// Turning it off gives this Datum its own copy if it is sharing.
+		/// </summary>
+		/// <param name="copyOnWrite">Whether copies should share storage.</param>
+		void SetCopyOnWrite(bool copyOnWrite);
+		/// <summary>
+		/// Returns whether copies of this Datum share its storage.
+		/// </summary>
+		/// <returns>True if the Datum is copy-on-write.</returns>
+		bool IsCopyOnWrite() const;
+		/// <summary>
+		/// Returns whether this Datum's storage is currently shared with a copy.
+		/// </summary>
+		/// <returns>True if another Datum refers to the same storage.</returns>
+		bool IsShared() const;
+		/// <summary>
+		/// Returns the memory resource heap storage is allocated from. Copy-on-write storage is only shared between Datums with the same resource.
+		/// </summary>
+		/// <returns>The memory resource, or nullptr if storage comes from malloc.</returns>
+		std::pmr::memory_resource* Resource() const;
+		/// <summary>
 		/// Resizes the datum to the requested size. Will shrink or grow the Datum. If the datum grows, it will initialize the data as needed.
 		/// </summary>
 		/// <param name="capacity">The size requested to conform to.</param>
@@ -299,7 +532,7 @@ namespace FieaGameEngine
 		/// </summary>
 		void ShrinkToFit();
 		/// <summary>
-		/// Will remove the last element in the Datum.
+		/// Will remove the last element in the Datum. A Scope removed from a Table is handed back to the caller as Scope::Orphan would, with its parent cleared.
 		/// </summary>
 		void PopBack();
 		/// <summary>
@@ -335,9 +568,107 @@ namespace FieaGameEngine
 		/// <summary>
 		/// Pushes the specified value to the end of the Datum.
 		/// </summary>
+		/// <param name="item">int64 value to put at the end</param>
+		void PushBack(std::int64_t item);
+		/// <summary>
+		/// Pushes the specified value to the end of the Datum.
+		/// </summary>
+		/// <param name="item">double value to put at the end</param>
+		void PushBack(double item);
+		/// <summary>
+		/// Pushes the specified value to the end of the Datum.
+		/// </summary>
+		/// <param name="item">bool value to put at the end</param>
+		template <std::same_as<bool> T>
+		void PushBack(T item);
+		/// <summary>
+		/// Pushes the specified value to the end of the Datum.
+		/// </summary>
+		/// <param name="item">vec2 reference value to put at the end</param>
+		void PushBack(const glm::vec2& item);
+		/// <summary>
+		/// Pushes the specified value to the end of the Datum.
+		/// </summary>
+		/// <param name="item">vec3 reference value to put at the end</param>
+		void PushBack(const glm::vec3& item);
+		/// <summary>
+		/// Pushes the specified value to the end of the Datum.
+		/// </summary>
+		/// <param name="item">quat reference value to put at the end</param>
+		void PushBack(const glm::quat& item);
+		/// <summary>
+		/// Pushes the specified value to the end of the Datum.
+		/// </summary>
 		/// <param name="item">RTTI* value to put at the end</param>
 		void PushBack(RTTI* item);
-		void PushBackFromString(const std::string& string);
+		/// <summary>
+		/// Pushes a value parsed from a string to the end of the Datum.
+		/// </summary>
+		/// <param name="string">The text of the value, in the form ToString writes.</param>
+		void PushBackFromString(std::string_view string);
+		/// <summary>
+		/// Parses a value from a range of characters and pushes it to the end of the Datum, without building an intermediate string for numeric types.
+		/// Nothing is pushed if the text does not hold a value.
+		/// </summary>
+		/// <param name="first">The start of the text.</param>
+		/// <param name="last">One past the end of the text.</param>
+		/// <returns>The end of the parsed text and std::errc{} on success, or first and the error.</returns>
+		std::from_chars_result PushBackFromChars(const char* first, const char* last);
+		/// <summary>
+		/// Pushes every value in the span to the end of the Datum, growing the storage at most once.
+		/// </summary>
+		/// <param name="values">The ints to append.</param>
+		void Append(std::span<const int> values);
+		/// <summary>
+		/// Pushes every value in the span to the end of the Datum, growing the storage at most once.
+		/// </summary>
+		/// <param name="values">The floats to append.</param>
+		void Append(std::span<const float> values);
+		/// <summary>
+		/// Pushes every value in the span to the end of the Datum, growing the storage at most once.
+		/// </summary>
+		/// <param name="values">The strings to append.</param>
+		void Append(std::span<const std::string> values);
+		/// <summary>
+		/// Pushes every value in the span to the end of the Datum, growing the storage at most once.
+		/// </summary>
+		/// <param name="values">The vec4s to append.</param>
+		void Append(std::span<const glm::vec4> values);
+		/// <summary>
+		/// Pushes every value in the span to the end of the Datum, growing the storage at most once.
+		/// </summary>
+		/// <param name="values">The mat4s to append.</param>
+		void Append(std::span<const glm::mat4> values);
+		/// <summary>
+		/// Pushes every value in the span to the end of the Datum, growing the storage at most once.
+		/// </summary>
+		/// <param name="values">The int64s to append.</param>
+		void Append(std::span<const std::int64_t> values);
+		/// <summary>
+		/// Pushes every value in the span to the end of the Datum, growing the storage at most once.
+		/// </summary>
+		/// <param name="values">The doubles to append.</param>
+		void Append(std::span<const double> values);
+		/// <summary>
+		/// Pushes every value in the span to the end of the Datum, growing the storage at most once.
+		/// </summary>
+		/// <param name="values">The bools to append.</param>
+		void Append(std::span<const bool> values);
+		/// <summary>
+		/// Pushes every value in the span to the end of the Datum, growing the storage at most once.
+		/// </summary>
+		/// <param name="values">The vec2s to append.</param>
+		void Append(std::span<const glm::vec2> values);
+		/// <summary>
+		/// Pushes every value in the span to the end of the Datum, growing the storage at most once.
+		/// </summary>
+		/// <param name="values">The vec3s to append.</param>
+		void Append(std::span<const glm::vec3> values);
+		/// <summary>
+		/// Pushes every value in the span to the end of the Datum, growing the storage at most once.
+		/// </summary>
+		/// <param name="values">The quats to append.</param>
+		void Append(std::span<const glm::quat> values);
 		/// <summary>
 		/// Sets the value at the specified position granted that the index is less than the Datum's size.
 		/// </summary>
@@ -371,10 +702,113 @@ namespace FieaGameEngine
 		/// <summary>
 		/// Sets the value at the specified position granted that the index is less than the Datum's size.
 		/// </summary>
+		/// <param name="item">int64 value to assign</param>
+		/// <param name="index">position to assign to.</param>
+		void Set(std::int64_t item, std::size_t index = 0);
+		/// <summary>
+		/// Sets the value at the specified position granted that the index is less than the Datum's size.
+		/// </summary>
+		/// <param name="item">double value to assign</param>
+		/// <param name="index">position to assign to.</param>
+		void Set(double item, std::size_t index = 0);
+		/// <summary>
+		/// Sets the value at the specified position granted that the index is less than the Datum's size.
+		/// </summary>
+		/// <param name="item">bool value to assign</param>
+		/// <param name="index">position to assign to.</param>
+		template <std::same_as<bool> T>
+		void Set(T item, std::size_t index = 0);
+		/// <summary>
+		/// Sets the value at the specified position granted that the index is less than the Datum's size.
+		/// </summary>
+		/// <param name="item">vec2 reference value to assign</param>
+		/// <param name="index">position to assign to.</param>
+		void Set(const glm::vec2& item, std::size_t index = 0);
+		/// <summary>
+		/// Sets the value at the specified position granted that the index is less than the Datum's size.
+		/// </summary>
+		/// <param name="item">vec3 reference value to assign</param>
+		/// <param name="index">position to assign to.</param>
+		void Set(const glm::vec3& item, std::size_t index = 0);
+		/// <summary>
+		/// Sets the value at the specified position granted that the index is less than the Datum's size.
+		/// </summary>
+		/// <param name="item">quat reference value to assign</param>
+		/// <param name="index">position to assign to.</param>
+		void Set(const glm::quat& item, std::size_t index = 0);
+		/// <summary>
+		/// Sets the value at the specified position granted that the index is less than the Datum's size.
+		/// </summary>
 		/// <param name="item">RTTI* value to assign</param>
 		/// <param name="index">position to assign to.</param>
 		void Set(RTTI* item, std::size_t index = 0);
 		/// <summary>
+		/// Overwrites consecutive values starting at the given position, granted that every position written is less than the Datum's size.
+		/// </summary>
+		/// <param name="values">The ints to assign.</param>
+		/// <param name="index">The position of the first value to assign.</param>
+		void SetRange(std::span<const int> values, std::size_t index = 0);
+		/// <summary>
+		/// Overwrites consecutive values starting at the given position, granted that every position written is less than the Datum's size.
+		/// </summary>
+		/// <param name="values">The floats to assign.</param>
+		/// <param name="index">The position of the first value to assign.</param>
+		void SetRange(std::span<const float> values, std::size_t index = 0);
+		/// <summary>
+		/// Overwrites consecutive values starting at the given position, granted that every position written is less than the Datum's size.
+		/// </summary>
+		/// <param name="values">The strings to assign.</param>
+		/// <param name="index">The position of the first value to assign.</param>
+		void SetRange(std::span<const std::string> values, std::size_t index = 0);
+		/// <summary>
+		/// Overwrites consecutive values starting at the given position, granted that every position written is less than the Datum's size.
+		/// </summary>
+		/// <param name="values">The vec4s to assign.</param>
+		/// <param name="index">The position of the first value to assign.</param>
+		void SetRange(std::span<const glm::vec4> values, std::size_t index = 0);
+		/// <summary>
+		/// Overwrites consecutive values starting at the given position, granted that every position written is less than the Datum's size.
+		/// </summary>
+		/// <param name="values">The mat4s to assign.</param>
+		/// <param name="index">The position of the first value to assign.</param>
+		void SetRange(std::span<const glm::mat4> values, std::size_t index = 0);
+		/// <summary>
+		/// Overwrites consecutive values starting at the given position, granted that every position written is less than the Datum's size.
+		/// </summary>
+		/// <param name="values">The int64s to assign.</param>
+		/// <param name="index">The position of the first value to assign.</param>
+		void SetRange(std::span<const std::int64_t> values, std::size_t index = 0);
+		/// <summary>
+		/// Overwrites consecutive values starting at the given position, granted that every position written is less than the Datum's size.
+		/// </summary>
+		/// <param name="values">The doubles to assign.</param>
+		/// <param name="index">The position of the first value to assign.</param>
+		void SetRange(std::span<const double> values, std::size_t index = 0);
+		/// <summary>
+		/// Overwrites consecutive values starting at the given position, granted that every position written is less than the Datum's size.
+		/// </summary>
+		/// <param name="values">The bools to assign.</param>
+		/// <param name="index">The position of the first value to assign.</param>
+		void SetRange(std::span<const bool> values, std::size_t index = 0);
+		/// <summary>
+		/// Overwrites consecutive values starting at the given position, granted that every position written is less than the Datum's size.
+		/// </summary>
+		/// <param name="values">The vec2s to assign.</param>
+		/// <param name="index">The position of the first value to assign.</param>
+		void SetRange(std::span<const glm::vec2> values, std::size_t index = 0);
+		/// <summary>
+		/// Overwrites consecutive values starting at the given position, granted that every position written is less than the Datum's size.
+		/// </summary>
+		/// <param name="values">The vec3s to assign.</param>
+		/// <param name="index">The position of the first value to assign.</param>
+		void SetRange(std::span<const glm::vec3> values, std::size_t index = 0);
+		/// <summary>
+		/// Overwrites consecutive values starting at the given position, granted that every position written is less than the Datum's size.
+		/// </summary>
+		/// <param name="values">The quats to assign.</param>
+		/// <param name="index">The position of the first value to assign.</param>
+		void SetRange(std::span<const glm::quat> values, std::size_t index = 0);
+		/// <summary>
 		/// Traverses the Datum in order to find the given value and returns an index to said item if it is found, otherwise it will return the size of the Datum.
 		/// </summary>
 		/// <param name="value">The value to search for.</param>
@@ -409,59 +843,201 @@ namespace FieaGameEngine
 		/// </summary>
 		/// <param name="value">The value to search for.</param>
 		/// <returns>std::size_t an index to the found item, will return the size of the Datum.</returns>
-		std::size_t Find(const RTTI* value) const;
+		std::size_t Find(std::int64_t value) const;
 		/// <summary>
-		/// Uses Find with the given value and if the returned index is less than size, it will remove the data stored at that index.
+		/// Traverses the Datum in order to find the given value and returns an index to said item if it is found, otherwise it will return the size of the Datum.
 		/// </summary>
-		/// <param name="value">The value to find and remove.</param>
-		void Remove(int value);
+		/// <param name="value">The value to search for.</param>
+		/// <returns>std::size_t an index to the found item, will return the size of the Datum.</returns>
+		std::size_t Find(double value) const;
 		/// <summary>
-		/// Uses Find with the given value and if the returned index is less than size, it will remove the data stored at that index.
+		/// Traverses the Datum in order to find the given value and returns an index to said item if it is found, otherwise it will return the size of the Datum.
 		/// </summary>
-		/// <param name="value">The value to find and remove.</param>
-		void Remove(float value);
+		/// <param name="value">The value to search for.</param>
+		/// <returns>std::size_t an index to the found item, will return the size of the Datum.</returns>
+		template <std::same_as<bool> T>
+		std::size_t Find(T value) const;
 		/// <summary>
-		/// Uses Find with the given value and if the returned index is less than size, it will remove the data stored at that index.
+		/// Traverses the Datum in order to find the given value and returns an index to said item if it is found, otherwise it will return the size of the Datum.
 		/// </summary>
-		/// <param name="value">The value to find and remove.</param>
-		void Remove(const std::string& value);
+		/// <param name="value">The value to search for.</param>
+		/// <returns>std::size_t an index to the found item, will return the size of the Datum.</returns>
+		std::size_t Find(const glm::vec2& value) const;
 		/// <summary>
-		/// Uses Find with the given value and if the returned index is less than size, it will remove the data stored at that index.
+		/// Traverses the Datum in order to find the given value and returns an index to said item if it is found, otherwise it will return the size of the Datum.
 		/// </summary>
-		/// <param name="value">The value to find and remove.</param>
-		void Remove(const glm::vec4& value);
+		/// <param name="value">The value to search for.</param>
+		/// <returns>std::size_t an index to the found item, will return the size of the Datum.</returns>
+		std::size_t Find(const glm::vec3& value) const;
 		/// <summary>
-		/// Uses Find with the given value and if the returned index is less than size, it will remove the data stored at that index.
+		/// Traverses the Datum in order to find the given value and returns an index to said item if it is found, otherwise it will return the size of the Datum.
 		/// </summary>
-		/// <param name="value">The value to find and remove.</param>
-		void Remove(const glm::mat4& value);
+		/// <param name="value">The value to search for.</param>
+		/// <returns>std::size_t an index to the found item, will return the size of the Datum.</returns>
+		std::size_t Find(const glm::quat& value) const;
 		/// <summary>
-		/// Uses Find with the given value and if the returned index is less than size, it will remove the data stored at that index.
+		/// Traverses the Datum in order to find the given value and returns an index to said item if it is found, otherwise it will return the size of the Datum.
 		/// </summary>
-		/// <param name="value">The value to find and remove.</param>
-		void Remove(const RTTI* value);
+		/// <param name="value">The value to search for.</param>
+		/// <returns>std::size_t an index to the found item, will return the size of the Datum.</returns>
+		std::size_t Find(const RTTI* value) const;
 		/// <summary>
-		/// Removes the data at the given index if the passed index is less than size.
+		/// Finds every element equal to the given value, using the same comparison as Find.
 		/// </summary>
-		/// <param name="index">The index to remove at.</param>
-		void RemoveAt(std::size_t index);
+		/// <param name="value">The value to search for.</param>
+		/// <returns>Vector of the indices of every match, in ascending order; empty when there is none.</returns>
+		Vector<std::size_t> FindAll(int value) const;
 		/// <summary>
-		/// Returns the value at the given index as an int.
+		/// Finds every element equal to the given value, using the same comparison as Find.
 		/// </summary>
-		/// <param name="index">The index at which to pull from.</param>
-		/// <returns>A mutable reference to the value.</returns>
-		int& GetAsInt(std::size_t index = 0);
+		/// <param name="value">The value to search for.</param>
+		/// <returns>Vector of the indices of every match, in ascending order; empty when there is none.</returns>
+		Vector<std::size_t> FindAll(float value) const;
 		/// <summary>
-		/// Returns the value at the given index as a float.
+		/// Finds every element equal to the given value, using the same comparison as Find.
 		/// </summary>
-		/// <param name="index">The index at which to pull from.</param>
-		/// <returns>A mutable reference to the value.</returns>
-		float& GetAsFloat(std::size_t index = 0);
+		/// <param name="value">The value to search for.</param>
+		/// <returns>Vector of the indices of every match, in ascending order; empty when there is none.</returns>
+		Vector<std::size_t> FindAll(const std::string& value) const;
 		/// <summary>
-		/// Returns the value at the given index as a std::string reference.
+		/// Finds every element equal to the given value, using the same comparison as Find.
 		/// </summary>
-		/// <param name="index">The index at which to pull from.</param>
-		/// <returns>A mutable reference to the value.</returns>
+		/// <param name="value">The value to search for.</param>
+		/// <returns>Vector of the indices of every match, in ascending order; empty when there is none.</returns>
+		Vector<std::size_t> FindAll(const glm::vec4& value) const;
+		/// <summary>
+		/// Finds every element equal to the given value, using the same comparison as Find.
+		/// </summary>
+		/// <param name="value">The value to search for.</param>
+		/// <returns>Vector of the indices of every match, in ascending order; empty when there is none.</returns>
+		Vector<std::size_t> FindAll(const glm::mat4& value) const;
+		/// <summary>
+		/// Finds every element equal to the given value, using the same comparison as Find.
+		/// </summary>
+		/// <param name="value">The value to search for.</param>
+		/// <returns>Vector of the indices of every match, in ascending order; empty when there is none.</returns>
+		Vector<std::size_t> FindAll(std::int64_t value) const;
+		/// <summary>
+		/// Finds every element equal to the given value, using the same comparison as Find.
+		/// </summary>
+		/// <param name="value">The value to search for.</param>
+		/// <returns>Vector of the indices of every match, in ascending order; empty when there is none.</returns>
+		Vector<std::size_t> FindAll(double value) const;
+		/// <summary>
+		/// Finds every element equal to the given value, using the same comparison as Find.
+		/// </summary>
+		/// <param name="value">The value to search for.</param>
+		/// <returns>Vector of the indices of every match, in ascending order; empty when there is none.</returns>
+		template <std::same_as<bool> T>
+		Vector<std::size_t> FindAll(T value) const;
+		/// <summary>
+		/// Finds every element equal to the given value, using the same comparison as Find.
+		/// </summary>
+		/// <param name="value">The value to search for.</param>
+		/// <returns>Vector of the indices of every match, in ascending order; empty when there is none.</returns>
+		Vector<std::size_t> FindAll(const glm::vec2& value) const;
+		/// <summary>
+		/// Finds every element equal to the given value, using the same comparison as Find.
+		/// </summary>
+		/// <param name="value">The value to search for.</param>
+		/// <returns>Vector of the indices of every match, in ascending order; empty when there is none.</returns>
+		Vector<std::size_t> FindAll(const glm::vec3& value) const;
+		/// <summary>
+		/// Finds every element equal to the given value, using the same comparison as Find.
+		/// </summary>
+		/// <param name="value">The value to search for.</param>
+		/// <returns>Vector of the indices of every match, in ascending order; empty when there is none.</returns>
+		Vector<std::size_t> FindAll(const glm::quat& value) const;
+		/// <summary>
+		/// Finds every element equal to the given value, using the same comparison as Find.
+		/// </summary>
+		/// <param name="value">The value to search for.</param>
+		/// <returns>Vector of the indices of every match, in ascending order; empty when there is none.</returns>
+		Vector<std::size_t> FindAll(const RTTI* value) const;
+		/// <summary>
+		/// Uses Find with the given value and if the returned index is less than size, it will remove the data stored at that index.
+		/// </summary>
+		/// <param name="value">The value to find and remove.</param>
+		void Remove(int value);
+		/// <summary>
+		/// Uses Find with the given value and if the returned index is less than size, it will remove the data stored at that index.
+		/// </summary>
+		/// <param name="value">The value to find and remove.</param>
+		void Remove(float value);
+		/// <summary>
+		/// Uses Find with the given value and if the returned index is less than size, it will remove the data stored at that index.
+		/// </summary>
+		/// <param name="value">The value to find and remove.</param>
+		void Remove(const std::string& value);
+		/// <summary>
+		/// Uses Find with the given value and if the returned index is less than size, it will remove the data stored at that index.
+		/// </summary>
+		/// <param name="value">The value to find and remove.</param>
+		void Remove(const glm::vec4& value);
+		/// <summary>
+		/// Uses Find with the given value and if the returned index is less than size, it will remove the data stored at that index.
+		/// </summary>
+		/// <param name="value">The value to find and remove.</param>
+		void Remove(const glm::mat4& value);
+		/// <summary>
+		/// Uses Find with the given value and if the returned index is less than size, it will remove the data stored at that index.
+		/// </summary>
+		/// <param name="value">The value to find and remove.</param>
+		void Remove(std::int64_t value);
+		/// <summary>
+		/// Uses Find with the given value and if the returned index is less than size, it will remove the data stored at that index.
+		/// </summary>
+		/// <param name="value">The value to find and remove.</param>
+		void Remove(double value);
+		/// <summary>
+		/// Uses Find with the given value and if the returned index is less than size, it will remove the data stored at that index.
+		/// </summary>
+		/// <param name="value">The value to find and remove.</param>
+		template <std::same_as<bool> T>
+		void Remove(T value);
+		/// <summary>
+		/// Uses Find with the given value and if the returned index is less than size, it will remove the data stored at that index.
+		/// </summary>
+		/// <param name="value">The value to find and remove.</param>
+		void Remove(const glm::vec2& value);
+		/// <summary>
+		/// Uses Find with the given value and if the returned index is less than size, it will remove the data stored at that index.
+		/// </summary>
+		/// <param name="value">The value to find and remove.</param>
+		void Remove(const glm::vec3& value);
+		/// <summary>
+		/// Uses Find with the given value and if the returned index is less than size, it will remove the data stored at that index.
+		/// </summary>
+		/// <param name="value">The value to find and remove.</param>
+		void Remove(const glm::quat& value);
+		/// <summary>
+		/// Uses Find with the given value and if the returned index is less than size, it will remove the data stored at that index.
+		/// </summary>
+		/// <param name="value">The value to find and remove.</param>
+		void Remove(const RTTI* value);
+		/// <summary>
+		/// Removes the data at the given index if the passed index is less than size. A Scope removed from a Table is handed back to the caller as Scope::Orphan would,
+		/// with its parent cleared, and the Scopes after it are told their new positions.
+		/// </summary>
+		/// <param name="index">The index to remove at.</param>
+		void RemoveAt(std::size_t index);
+		/// <summary>
+		/// Returns the value at the given index as an int.
+		/// </summary>
+		/// <param name="index">The index at which to pull from.</param>
+		/// <returns>A mutable reference to the value.</returns>
+		int& GetAsInt(std::size_t index = 0);
+		/// <summary>
+		/// Returns the value at the given index as a float.
+		/// </summary>
+		/// <param name="index">The index at which to pull from.</param>
+		/// <returns>A mutable reference to the value.</returns>
+		float& GetAsFloat(std::size_t index = 0);
+		/// <summary>
+		/// Returns the value at the given index as a std::string reference.
+		/// </summary>
+		/// <param name="index">The index at which to pull from.</param>
+		/// <returns>A mutable reference to the value.</returns>
 		std::string& GetAsString(std::size_t index = 0);
 		/// <summary>
 		/// Returns the value at the given index as a vec4 reference.
@@ -476,6 +1052,42 @@ namespace FieaGameEngine
 		/// <returns>A mutable reference to the value.</returns>
 		glm::mat4& GetAsMatrix(std::size_t index = 0);
 		/// <summary>
+		/// Returns the value at the given index as an int64 reference.
+		/// </summary>
+		/// <param name="index">The index at which to pull from.</param>
+		/// <returns>A mutable reference to the value.</returns>
+		std::int64_t& GetAsInt64(std::size_t index = 0);
+		/// <summary>
+		/// Returns the value at the given index as a double reference.
+		/// </summary>
+		/// <param name="index">The index at which to pull from.</param>
+		/// <returns>A mutable reference to the value.</returns>
+		double& GetAsDouble(std::size_t index = 0);
+		/// <summary>
+		/// Returns the value at the given index as a bool reference.
+		/// </summary>
+		/// <param name="index">The index at which to pull from.</param>
+		/// <returns>A mutable reference to the value.</returns>
+		bool& GetAsBool(std::size_t index = 0);
+		/// <summary>
+		/// Returns the value at the given index as a vec2 reference.
+		/// </summary>
+		/// <param name="index">The index at which to pull from.</param>
+		/// <returns>A mutable reference to the value.</returns>
+		glm::vec2& GetAsVector2(std::size_t index = 0);
+		/// <summary>
+		/// Returns the value at the given index as a vec3 reference.
+		/// </summary>
+		/// <param name="index">The index at which to pull from.</param>
+		/// <returns>A mutable reference to the value.</returns>
+		glm::vec3& GetAsVector3(std::size_t index = 0);
+		/// <summary>
+		/// Returns the value at the given index as a quat reference.
+		/// </summary>
+		/// <param name="index">The index at which to pull from.</param>
+		/// <returns>A mutable reference to the value.</returns>
+		glm::quat& GetAsQuaternion(std::size_t index = 0);
+		/// <summary>
 		/// Returns the value at the given index as a RTTI* reference.
 		/// </summary>
 		/// <param name="index">The index at which to pull from.</param>
@@ -512,6 +1124,42 @@ namespace FieaGameEngine
 		/// <returns>An immutable reference of the value.</returns>
 		const glm::mat4& GetAsMatrix(std::size_t index = 0) const;
 		/// <summary>
+		/// Returns the value at the given index as an int64.
+		/// </summary>
+		/// <param name="index">The index at which to pull from.</param>
+		/// <returns>An immutable copy of the value.</returns>
+		std::int64_t GetAsInt64(std::size_t index = 0) const;
+		/// <summary>
+		/// Returns the value at the given index as a double.
+		/// </summary>
+		/// <param name="index">The index at which to pull from.</param>
+		/// <returns>An immutable copy of the value.</returns>
+		double GetAsDouble(std::size_t index = 0) const;
+		/// <summary>
+		/// Returns the value at the given index as a bool.
+		/// </summary>
+		/// <param name="index">The index at which to pull from.</param>
+		/// <returns>An immutable copy of the value.</returns>
+		bool GetAsBool(std::size_t index = 0) const;
+		/// <summary>
+		/// Returns the value at the given index as a vec2 reference.
+		/// </summary>
+		/// <param name="index">The index at which to pull from.</param>
+		/// <returns>An immutable reference of the value.</returns>
+		const glm::vec2& GetAsVector2(std::size_t index = 0) const;
+		/// <summary>
+		/// Returns the value at the given index as a vec3 reference.
+		/// </summary>
+		/// <param name="index">The index at which to pull from.</param>
+		/// <returns>An immutable reference of the value.</returns>
+		const glm::vec3& GetAsVector3(std::size_t index = 0) const;
+		/// <summary>
+		/// Returns the value at the given index as a quat reference.
+		/// </summary>
+		/// <param name="index">The index at which to pull from.</param>
+		/// <returns>An immutable reference of the value.</returns>
+		const glm::quat& GetAsQuaternion(std::size_t index = 0) const;
+		/// <summary>
 		/// Returns the value at the given index as an RTTI*.
 		/// </summary>
 		/// <param name="index">The index at which to pull from.</param>
@@ -519,6 +1167,105 @@ namespace FieaGameEngine
 		RTTI* GetAsRTTI(std::size_t index = 0) const;
 		Scope* GetAsScope(std::size_t index = 0) const;
 		/// <summary>
+		/// Copies consecutive values starting at the given position into the destination, stopping at whichever runs out first.
+		/// </summary>
+		/// <param name="destination">The ints to copy into.</param>
+		/// <param name="index">The position of the first value to copy.</param>
+		/// <returns>The number of values copied.</returns>
+		std::size_t CopyTo(std::span<int> destination, std::size_t index = 0) const;
+		/// <summary>
+		/// Copies consecutive values starting at the given position into the destination, stopping at whichever runs out first.
+		/// </summary>
+		/// <param name="destination">The floats to copy into.</param>
+		/// <param name="index">The position of the first value to copy.</param>
+		/// <returns>The number of values copied.</returns>
+		std::size_t CopyTo(std::span<float> destination, std::size_t index = 0) const;
+		/// <summary>
+		/// Copies consecutive values starting at the given position into the destination, stopping at whichever runs out first.
+		/// </summary>
+		/// <param name="destination">The strings to copy into.</param>
+		/// <param name="index">The position of the first value to copy.</param>
+		/// <returns>The number of values copied.</returns>
+		std::size_t CopyTo(std::span<std::string> destination, std::size_t index = 0) const;
+		/// <summary>
+		/// Copies consecutive values starting at the given position into the destination, stopping at whichever runs out first.
+		/// </summary>
+		/// <param name="destination">The vec4s to copy into.</param>
+		/// <param name="index">The position of the first value to copy.</param>
+		/// <returns>The number of values copied.</returns>
+		std::size_t CopyTo(std::span<glm::vec4> destination, std::size_t index = 0) const;
+		/// <summary>
+		/// Copies consecutive values starting at the given position into the destination, stopping at whichever runs out first.
+		/// </summary>
+		/// <param name="destination">The mat4s to copy into.</param>
+		/// <param name="index">The position of the first value to copy.</param>
+		/// <returns>The number of values copied.</returns>
+		std::size_t CopyTo(std::span<glm::mat4> destination, std::size_t index = 0) const;
+		/// <summary>
+		/// Copies consecutive values starting at the given position into the destination, stopping at whichever runs out first.
+		/// </summary>
+		/// <param name="destination">The int64s to copy into.</param>
+		/// <param name="index">The position of the first value to copy.</param>
+		/// <returns>The number of values copied.</returns>
+		std::size_t CopyTo(std::span<std::int64_t> destination, std::size_t index = 0) const;
+		/// <summary>
+		/// Copies consecutive values starting at the given position into the destination, stopping at whichever runs out first.
+		/// </summary>
+		/// <param name="destination">The doubles to copy into.</param>
+		/// <param name="index">The position of the first value to copy.</param>
+		/// <returns>The number of values copied.</returns>
+		std::size_t CopyTo(std::span<double> destination, std::size_t index = 0) const;
+		/// <summary>
+		/// Copies consecutive values starting at the given position into the destination, stopping at whichever runs out first.
+		/// </summary>
+		/// <param name="destination">The bools to copy into.</param>
+		/// <param name="index">The position of the first value to copy.</param>
+		/// <returns>The number of values copied.</returns>
+		std::size_t CopyTo(std::span<bool> destination, std::size_t index = 0) const;
+		/// <summary>
+		/// Copies consecutive values starting at the given position into the destination, stopping at whichever runs out first.
+		/// </summary>
+		/// <param name="destination">The vec2s to copy into.</param>
+		/// <param name="index">The position of the first value to copy.</param>
+		/// <returns>The number of values copied.</returns>
+		std::size_t CopyTo(std::span<glm::vec2> destination, std::size_t index = 0) const;
+		/// <summary>
+		/// Copies consecutive values starting at the given position into the destination, stopping at whichever runs out first.
+		/// </summary>
+		/// <param name="destination">The vec3s to copy into.</param>
+		/// <param name="index">The position of the first value to copy.</param>
+		/// <returns>The number of values copied.</returns>
+		std::size_t CopyTo(std::span<glm::vec3> destination, std::size_t index = 0) const;
+		/// <summary>
+		/// Copies consecutive values starting at the given position into the destination, stopping at whichever runs out first.
+		/// </summary>
+		/// <param name="destination">The quats to copy into.</param>
+		/// <param name="index">The position of the first value to copy.</param>
+		/// <returns>The number of values copied.</returns>
+		std::size_t CopyTo(std::span<glm::quat> destination, std::size_t index = 0) const;
+		/// <summary>
+		/// Copies this Datum's values over the values already held by a Datum of the same type, such as one wrapping external storage, without changing its size.
+		/// </summary>
+		/// <param name="destination">The Datum to copy into.</param>
+		/// <returns>The number of values copied.</returns>
+		std::size_t CopyTo(Datum& destination) const;
+		/// <summary>
+		/// Returns a view over every value in the Datum after checking the type once, for loops and algorithms that walk the whole array.
+		/// The view is invalidated by anything that changes the Datum's capacity.
+		/// </summary>
+		/// <typeparam name="T">int, std::int64_t, float, double, bool, std::string, glm::vec2, glm::vec3, glm::vec4, glm::quat, glm::mat4 or RTTI*, matching the Datum's type.</typeparam>
+		/// <returns>A mutable view of the values.</returns>
+		template <typename T>
+		std::span<T> AsSpan();
+		/// <summary>
+		/// Returns a view over every value in the Datum after checking the type once, for loops and algorithms that walk the whole array.
+		/// The view is invalidated by anything that changes the Datum's capacity.
+		/// </summary>
+		/// <typeparam name="T">int, std::int64_t, float, double, bool, std::string, glm::vec2, glm::vec3, glm::vec4, glm::quat, glm::mat4 or RTTI*, matching the Datum's type.</typeparam>
+		/// <returns>An immutable view of the values.</returns>
+		template <typename T>
+		std::span<const T> AsSpan() const;
+		/// <summary>
 		/// Returns the value at the front as an int.
 		/// </summary>
 		/// <returns>A mutable reference to the value.</returns>
@@ -544,6 +1291,36 @@ namespace FieaGameEngine
 		/// <returns>A mutable reference to the value.</returns>
 		glm::mat4& FrontAsMatrix();
 		/// <summary>
+		/// Returns the value at the front as an int64 reference.
+		/// </summary>
+		/// <returns>A mutable reference to the value.</returns>
+		std::int64_t& FrontAsInt64();
+		/// <summary>
+		/// Returns the value at the front as a double reference.
+		/// </summary>
+		/// <returns>A mutable reference to the value.</returns>
+		double& FrontAsDouble();
+		/// <summary>
+		/// Returns the value at the front as a bool reference.
+		/// </summary>
+		/// <returns>A mutable reference to the value.</returns>
+		bool& FrontAsBool();
+		/// <summary>
+		/// Returns the value at the front as a vec2 reference.
+		/// </summary>
+		/// <returns>A mutable reference to the value.</returns>
+		glm::vec2& FrontAsVector2();
+		/// <summary>
+		/// Returns the value at the front as a vec3 reference.
+		/// </summary>
+		/// <returns>A mutable reference to the value.</returns>
+		glm::vec3& FrontAsVector3();
+		/// <summary>
+		/// Returns the value at the front as a quat reference.
+		/// </summary>
+		/// <returns>A mutable reference to the value.</returns>
+		glm::quat& FrontAsQuaternion();
+		/// <summary>
 		/// Returns the value at the front as an RTTI* reference.
 		/// </summary>
 		/// <returns>A mutable reference to the value.</returns>
@@ -574,6 +1351,36 @@ namespace FieaGameEngine
 		/// <returns>An immutable reference of the value.</returns>
 		const glm::mat4& FrontAsMatrix() const;
 		/// <summary>
+		/// Returns the value at the front as an int64.
+		/// </summary>
+		/// <returns>An immutable copy of the value.</returns>
+		std::int64_t FrontAsInt64() const;
+		/// <summary>
+		/// Returns the value at the front as a double.
+		/// </summary>
+		/// <returns>An immutable copy of the value.</returns>
+		double FrontAsDouble() const;
+		/// <summary>
+		/// Returns the value at the front as a bool.
+		/// </summary>
+		/// <returns>An immutable copy of the value.</returns>
+		bool FrontAsBool() const;
+		/// <summary>
+		/// Returns the value at the front as a vec2 reference.
+		/// </summary>
+		/// <returns>An immutable reference of the value.</returns>
+		const glm::vec2& FrontAsVector2() const;
+		/// <summary>
+		/// Returns the value at the front as a vec3 reference.
+		/// </summary>
+		/// <returns>An immutable reference of the value.</returns>
+		const glm::vec3& FrontAsVector3() const;
+		/// <summary>
+		/// Returns the value at the front as a quat reference.
+		/// </summary>
+		/// <returns>An immutable reference of the value.</returns>
+		const glm::quat& FrontAsQuaternion() const;
+		/// <summary>
 		/// Returns the value at the front as a RTTI*.
 		/// </summary>
 		/// <returns>An immutable copy of the value.</returns>
@@ -604,6 +1411,36 @@ namespace FieaGameEngine
 		/// <returns>A mutable reference to the value.</returns>
 		glm::mat4& BackAsMatrix();
 		/// <summary>
+		/// Returns the value at the back as an int64 reference.
+		/// </summary>
+		/// <returns>A mutable reference to the value.</returns>
+		std::int64_t& BackAsInt64();
+		/// <summary>
+		/// Returns the value at the back as a double reference.
+		/// </summary>
+		/// <returns>A mutable reference to the value.</returns>
+		double& BackAsDouble();
+		/// <summary>
+		/// Returns the value at the back as a bool reference.
+		/// </summary>
+		/// <returns>A mutable reference to the value.</returns>
+		bool& BackAsBool();
+		/// <summary>
+		/// Returns the value at the back as a vec2 reference.
+		/// </summary>
+		/// <returns>A mutable reference to the value.</returns>
+		glm::vec2& BackAsVector2();
+		/// <summary>
+		/// Returns the value at the back as a vec3 reference.
+		/// </summary>
+		/// <returns>A mutable reference to the value.</returns>
+		glm::vec3& BackAsVector3();
+		/// <summary>
+		/// Returns the value at the back as a quat reference.
+		/// </summary>
+		/// <returns>A mutable reference to the value.</returns>
+		glm::quat& BackAsQuaternion();
+		/// <summary>
 		/// Returns the value at the back as an RTTI* reference.
 		/// </summary>
 		/// <returns>A mutable reference to the value.</returns>
@@ -634,6 +1471,36 @@ namespace FieaGameEngine
 		/// <returns>An immutable reference of the value.</returns>
 		const glm::mat4& BackAsMatrix() const;
 		/// <summary>
+		/// Returns the value at the back as an int64.
+		/// </summary>
+		/// <returns>An immutable copy of the value.</returns>
+		std::int64_t BackAsInt64() const;
+		/// <summary>
+		/// Returns the value at the back as a double.
+		/// </summary>
+		/// <returns>An immutable copy of the value.</returns>
+		double BackAsDouble() const;
+		/// <summary>
+		/// Returns the value at the back as a bool.
+		/// </summary>
+		/// <returns>An immutable copy of the value.</returns>
+		bool BackAsBool() const;
+		/// <summary>
+		/// Returns the value at the back as a vec2 reference.
+		/// </summary>
+		/// <returns>An immutable reference of the value.</returns>
+		const glm::vec2& BackAsVector2() const;
+		/// <summary>
+		/// Returns the value at the back as a vec3 reference.
+		/// </summary>
+		/// <returns>An immutable reference of the value.</returns>
+		const glm::vec3& BackAsVector3() const;
+		/// <summary>
+		/// Returns the value at the back as a quat reference.
+		/// </summary>
+		/// <returns>An immutable reference of the value.</returns>
+		const glm::quat& BackAsQuaternion() const;
+		/// <summary>
 		/// Returns the value at the back as an RTTI*.
 		/// </summary>
 		/// <returns>An immutable copy of the value.</returns>
@@ -649,16 +1516,272 @@ namespace FieaGameEngine
 		/// </summary>
 		/// <param name="string">The string that contains ther information about the data to set.</param>
 		/// <param name="index">An index to the position to place the value.</param>
-		void SetFromString(const std::string& string, std::size_t index = 0);
+		void SetFromString(std::string_view string, std::size_t index = 0);
+		/// <summary>
+		/// Writes the value at the given index into a caller supplied buffer, in the same form as ToString, without allocating for numeric types.
+		/// No terminating null is written.
+		/// </summary>
+		/// <param name="first">The start of the buffer.</param>
+		/// <param name="last">One past the end of the buffer.</param>
+		/// <param name="index">The index of the value to write.</param>
+		/// <returns>One past the last character written and std::errc{}, or last and std::errc::value_too_large if the buffer is too small.</returns>
+		std::to_chars_result ToChars(char* first, char* last, std::size_t index = 0) const;
+		/// <summary>
+		/// Parses a value from a range of characters and sets it at the given index. The value is left unchanged if the text does not hold one.
+		/// </summary>
+		/// <param name="first">The start of the text.</param>
+		/// <param name="last">One past the end of the text.</param>
+		/// <param name="index">The index of the value to set.</param>
+		/// <returns>The end of the parsed text and std::errc{} on success, or first and the error.</returns>
+		std::from_chars_result FromChars(const char* first, const char* last, std::size_t index = 0);
+
+		/// <summary>
+		/// Size of a buffer large enough for the text of any int, float, vec4 or mat4.
+		/// </summary>
+		static constexpr std::size_t CharsBufferSize{ 1024 };
+		/// <summary>
+		/// Writes an int in decimal.
+		/// </summary>
+		/// <param name="first">The start of the buffer.</param>
+		/// <param name="last">One past the end of the buffer.</param>
+		/// <param name="value">The value to write.</param>
+		/// <returns>One past the last character written and std::errc{}, or last and std::errc::value_too_large.</returns>
+		static std::to_chars_result Format(char* first, char* last, int value);
+		/// <summary>
+		/// Writes a float with six decimal places, as std::to_string does.
+		/// </summary>
+		/// <param name="first">The start of the buffer.</param>
+		/// <param name="last">One past the end of the buffer.</param>
+		/// <param name="value">The value to write.</param>
+		/// <returns>One past the last character written and std::errc{}, or last and std::errc::value_too_large.</returns>
+		static std::to_chars_result Format(char* first, char* last, float value);
+		/// <summary>
+		/// Writes a vec4 as "vec4(x, y, z, w)", as glm::to_string does.
+		/// </summary>
+		/// <param name="first">The start of the buffer.</param>
+		/// <param name="last">One past the end of the buffer.</param>
+		/// <param name="value">The value to write.</param>
+		/// <returns>One past the last character written and std::errc{}, or last and std::errc::value_too_large.</returns>
+		static std::to_chars_result Format(char* first, char* last, const glm::vec4& value);
+		/// <summary>
+		/// Writes a mat4 column by column as "mat4x4((x, y, z, w), ...)", as glm::to_string does.
+		/// </summary>
+		/// <param name="first">The start of the buffer.</param>
+		/// <param name="last">One past the end of the buffer.</param>
+		/// <param name="value">The value to write.</param>
+		/// <returns>One past the last character written and std::errc{}, or last and std::errc::value_too_large.</returns>
+		static std::to_chars_result Format(char* first, char* last, const glm::mat4& value);
+		/// <summary>
+		/// Writes an int64 in decimal.
+		/// </summary>
+		/// <param name="first">The start of the buffer.</param>
+		/// <param name="last">One past the end of the buffer.</param>
+		/// <param name="value">The value to write.</param>
+		/// <returns>One past the last character written and std::errc{}, or last and std::errc::value_too_large.</returns>
+		static std::to_chars_result Format(char* first, char* last, std::int64_t value);
+		/// <summary>
+		/// Writes a double with the fewest digits that read back as the same value, so doubles survive a round trip through text.
+		/// </summary>
+		/// <param name="first">The start of the buffer.</param>
+		/// <param name="last">One past the end of the buffer.</param>
+		/// <param name="value">The value to write.</param>
+		/// <returns>One past the last character written and std::errc{}, or last and std::errc::value_too_large.</returns>
+		static std::to_chars_result Format(char* first, char* last, double value);
+		/// <summary>
+		/// Writes a bool as "true" or "false".
+		/// </summary>
+		/// <param name="first">The start of the buffer.</param>
+		/// <param name="last">One past the end of the buffer.</param>
+		/// <param name="value">The value to write.</param>
+		/// <returns>One past the last character written and std::errc{}, or last and std::errc::value_too_large.</returns>
+		static std::to_chars_result Format(char* first, char* last, bool value);
+		/// <summary>
+		/// Writes a vec2 as "vec2(x, y)", as glm::to_string does.
+		/// </summary>
+		/// <param name="first">The start of the buffer.</param>
+		/// <param name="last">One past the end of the buffer.</param>
+		/// <param name="value">The value to write.</param>
+		/// <returns>One past the last character written and std::errc{}, or last and std::errc::value_too_large.</returns>
+		static std::to_chars_result Format(char* first, char* last, const glm::vec2& value);
+		/// <summary>
+		/// Writes a vec3 as "vec3(x, y, z)", as glm::to_string does.
+		/// </summary>
+		/// <param name="first">The start of the buffer.</param>
+		/// <param name="last">One past the end of the buffer.</param>
+		/// <param name="value">The value to write.</param>
+		/// <returns>One past the last character written and std::errc{}, or last and std::errc::value_too_large.</returns>
+		static std::to_chars_result Format(char* first, char* last, const glm::vec3& value);
+		/// <summary>
+		/// Writes a quat as "quat(w, {x, y, z})", as glm::to_string does.
+		/// </summary>
+		/// <param name="first">The start of the buffer.</param>
+		/// <param name="last">One past the end of the buffer.</param>
+		/// <param name="value">The value to write.</param>
+		/// <returns>One past the last character written and std::errc{}, or last and std::errc::value_too_large.</returns>
+		static std::to_chars_result Format(char* first, char* last, const glm::quat& value);
+		/// <summary>
+		/// Parses a decimal int, skipping leading whitespace and an optional plus sign.
+		/// </summary>
+		/// <param name="first">The start of the text.</param>
+		/// <param name="last">One past the end of the text.</param>
+		/// <param name="value">Set to the parsed value on success.</param>
+		/// <returns>The end of the parsed text and std::errc{} on success, or first and the error.</returns>
+		static std::from_chars_result Parse(const char* first, const char* last, int& value);
+		/// <summary>
+		/// Parses a float, skipping leading whitespace and an optional plus sign.
+		/// </summary>
+		/// <param name="first">The start of the text.</param>
+		/// <param name="last">One past the end of the text.</param>
+		/// <param name="value">Set to the parsed value on success.</param>
+		/// <returns>The end of the parsed text and std::errc{} on success, or first and the error.</returns>
+		static std::from_chars_result Parse(const char* first, const char* last, float& value);
+		/// <summary>
+		/// Parses a vec4 written as "vec4(x, y, z, w)", with any whitespace between the parts.
+		/// </summary>
+		/// <param name="first">The start of the text.</param>
+		/// <param name="last">One past the end of the text.</param>
+		/// <param name="value">Set to the parsed value on success.</param>
+		/// <returns>The end of the parsed text and std::errc{} on success, or first and the error.</returns>
+		static std::from_chars_result Parse(const char* first, const char* last, glm::vec4& value);
+		/// <summary>
+		/// Parses a mat4 written column by column as "mat4x4((x, y, z, w), ...)", with any whitespace between the parts.
+		/// </summary>
+		/// <param name="first">The start of the text.</param>
+		/// <param name="last">One past the end of the text.</param>
+		/// <param name="value">Set to the parsed value on success.</param>
+		/// <returns>The end of the parsed text and std::errc{} on success, or first and the error.</returns>
+		static std::from_chars_result Parse(const char* first, const char* last, glm::mat4& value);
+		/// <summary>
+		/// Parses a decimal int64, skipping leading whitespace and an optional plus sign.
+		/// </summary>
+		/// <param name="first">The start of the text.</param>
+		/// <param name="last">One past the end of the text.</param>
+		/// <param name="value">Set to the parsed value on success.</param>
+		/// <returns>The end of the parsed text and std::errc{} on success, or first and the error.</returns>
+		static std::from_chars_result Parse(const char* first, const char* last, std::int64_t& value);
+		/// <summary>
+		/// Parses a double, skipping leading whitespace and an optional plus sign.
+		/// </summary>
+		/// <param name="first">The start of the text.</param>
+		/// <param name="last">One past the end of the text.</param>
+		/// <param name="value">Set to the parsed value on success.</param>
+		/// <returns>The end of the parsed text and std::errc{} on success, or first and the error.</returns>
+		static std::from_chars_result Parse(const char* first, const char* last, double& value);
+		/// <summary>
+		/// Parses "true" or "false", skipping leading whitespace.
+		/// </summary>
+		/// <param name="first">The start of the text.</param>
+		/// <param name="last">One past the end of the text.</param>
+		/// <param name="value">Set to the parsed value on success.</param>
+		/// <returns>The end of the parsed text and std::errc{} on success, or first and the error.</returns>
+		static std::from_chars_result Parse(const char* first, const char* last, bool& value);
+		/// <summary>
+		/// Parses a vec2 written as "vec2(x, y)", with any whitespace between the parts.
+		/// </summary>
+		/// <param name="first">The start of the text.</param>
+		/// <param name="last">One past the end of the text.</param>
+		/// <param name="value">Set to the parsed value on success.</param>
+		/// <returns>The end of the parsed text and std::errc{} on success, or first and the error.</returns>
+		static std::from_chars_result Parse(const char* first, const char* last, glm::vec2& value);
+		/// <summary>
+		/// Parses a vec3 written as "vec3(x, y, z)", with any whitespace between the parts.
+		/// </summary>
+		/// <param name="first">The start of the text.</param>
+		/// <param name="last">One past the end of the text.</param>
+		/// <param name="value">Set to the parsed value on success.</param>
+		/// <returns>The end of the parsed text and std::errc{} on success, or first and the error.</returns>
+		static std::from_chars_result Parse(const char* first, const char* last, glm::vec3& value);
+		/// <summary>
+		/// Parses a quat written as "quat(w, {x, y, z})", with any whitespace between the parts.
+		/// </summary>
+		/// <param name="first">The start of the text.</param>
+		/// <param name="last">One past the end of the text.</param>
+		/// <param name="value">Set to the parsed value on success.</param>
+		/// <returns>The end of the parsed text and std::errc{} on success, or first and the error.</returns>
+		static std::from_chars_result Parse(const char* first, const char* last, glm::quat& value);
 
 	private:
 		void PushBack(Scope* item);
+		void Set(Scope* item, std::size_t index);
+		/// <summary>
+		/// Clears the parent of the Scope at the given position of a Table if this Datum owns it, ahead of the Scope being removed.
+		/// </summary>
+		void ReleaseChild(std::size_t position);
+		/// <summary>
+		/// Updates the parent index of every Scope this Table owns from the given position on, after the ones before them have moved.
+		/// </summary>
+		void ReindexChildren(std::size_t first);
 		/// <summary>
-		/// A wrapper for realloc that takes a capacity argument.
+		/// The bodies of the bool overloads, which are templates only to keep literals and pointers away from them.
+		/// </summary>
+		Datum& AssignBool(bool other);
+		bool EqualsBool(bool rhs) const;
+		void PushBackBool(bool item);
+		void SetBool(bool item, std::size_t index);
+		std::size_t FindBool(bool value) const;
+		Vector<std::size_t> FindAllBool(bool value) const;
+		void RemoveBool(bool value);
+		/// <summary>
+		/// Moves the stored data into storage for the given capacity. Storage that fits in the inline buffer is kept there, anything larger is taken from the heap.
 		/// </summary>
 		/// <param name="capacity">Amount of storage to request.</param>
 		void Relocate(std::size_t capacity);
 		/// <summary>
+		/// Returns the size of one element of the current type, or zero while the type is unknown.
+		/// </summary>
+		/// <returns>The element size in bytes.</returns>
+		inline std::size_t TypeSize() const;
+		/// <summary>
+		/// Returns whether storage for the given capacity fits in the inline buffer.
+		/// </summary>
+		/// <param name="capacity">The number of elements to store.</param>
+		/// <returns>True if the capacity fits inline.</returns>
+		bool FitsInline(std::size_t capacity) const;
+		/// <summary>
+		/// Returned by OffsetOf for a pointer that is not into this Datum's elements.
+		/// </summary>
+		static constexpr std::size_t NotStored{ std::numeric_limits<std::size_t>::max() };
+		/// <summary>
+		/// Returns how many bytes into this Datum's elements the given pointer is, so a view of them can be found again after growing moves them.
+		/// </summary>
+		/// <param name="pointer">The pointer to look for.</param>
+		/// <returns>The offset in bytes, or NotStored.</returns>
+		std::size_t OffsetOf(const void* pointer) const;
+		/// <summary>
+		/// Takes over the data of another Datum that is being moved from, copying it out of the other's inline buffer if that is where it lives.
+		/// </summary>
+		/// <param name="other">The Datum being moved from.</param>
+		void StealData(Datum& other) noexcept;
+		/// <summary>
+		/// Returns the header in front of the heap storage. Only valid while the data lives on the heap and is owned by this Datum.
+		/// </summary>
+		/// <returns>The PayloadHeader of the current storage.</returns>
+		PayloadHeader& Header() const;
+		/// <summary>
+		/// Allocates heap storage, with its header, for the given number of elements of the current type.
+		/// </summary>
+		/// <param name="capacity">The number of elements to make room for.</param>
+		/// <returns>The start of the elements.</returns>
+		void* Allocate(std::size_t capacity) const;
+		/// <summary>
+		/// Frees the current storage if it is owned and on the heap. Elements are not destroyed.
+		/// </summary>
+		void Deallocate();
+		/// <summary>
+		/// Returns whether the storage may be shared by a copy: the Datum is copy-on-write and owns heap storage.
+		/// </summary>
+		/// <returns>True if a copy would share the storage.</returns>
+		bool IsSharable() const;
+		/// <summary>
+		/// Refers to the storage of another copy-on-write Datum. The Datum must not own any storage.
+		/// </summary>
+		/// <param name="other">The Datum whose storage is shared.</param>
+		void Share(const Datum& other);
+		/// <summary>
+		/// Gives the Datum its own copy of its storage if it is shared. Called before anything that writes to the storage.
+		/// </summary>
+		void Detach();
+		/// <summary>
 		/// Resets the Datum to a blank slate.
 		/// </summary>
 		void Reset();
@@ -679,41 +1802,65 @@ namespace FieaGameEngine
 		/// <param name="data">Pointer to the data to store.</param>
 		void PushBack(const void* data);
 		/// <summary>
-		/// Creates a string fron an int at the given index.
+		/// A generic mechanism for appending an array of trivially copiable data.
+		/// </summary>
+		/// <param name="values">Pointer to the first value to store.</param>
+		/// <param name="count">The number of values to store.</param>
+		void Append(const void* values, std::size_t count);
+		/// <summary>
+		/// A generic mechanism for overwriting a run of trivially copiable data.
+		/// </summary>
+		/// <param name="values">Pointer to the first value to assign.</param>
+		/// <param name="count">The number of values to assign.</param>
+		/// <param name="index">The position of the first value to assign.</param>
+		void SetRange(const void* values, std::size_t count, std::size_t index);
+		/// <summary>
+		/// A generic mechanism for copying out a run of trivially copiable data.
 		/// </summary>
-		/// <param name="index">position to pull the data from.</param>
-		/// <returns>std::string version of the data.</returns>
-		std::string ToStringInt(std::size_t index);
+		/// <param name="destination">Pointer to the storage to copy into.</param>
+		/// <param name="count">The most values the destination can hold.</param>
+		/// <param name="index">The position of the first value to copy.</param>
+		/// <returns>The number of values copied.</returns>
+		std::size_t CopyTo(void* destination, std::size_t count, std::size_t index) const;
 		/// <summary>
-		/// Creates a string fron a float at the given index.
+		/// Returns the capacity to grow to when the Datum is full. An empty Datum first fills its inline buffer, after that the capacity grows geometrically
+		/// so that pushing many values reallocates only a logarithmic number of times.
 		/// </summary>
-		/// <param name="index">position to pull the data from.</param>
-		/// <returns>std::string version of the data.</returns>
-		std::string ToStringFloat(std::size_t index);
+		/// <returns>The next capacity.</returns>
+		std::size_t GrowCapacity() const;
 		/// <summary>
-		/// Returns a string fron a std::string at the given index.
+		/// Returns the enumeration that corresponds to a type a Datum can store.
 		/// </summary>
-		/// <param name="index">position to pull the data from.</param>
-		/// <returns>std::string version of the data.</returns>
-		std::string ToStringString(std::size_t index);
+		/// <typeparam name="T">The stored type.</typeparam>
+		/// <returns>The matching Datum::DatumTypes.</returns>
+		template <typename T>
+		static constexpr DatumTypes TypeOf();
 		/// <summary>
-		/// Creates a string fron a vec4 at the given index.
+		/// Writes the value of a numeric type at the given index.
 		/// </summary>
-		/// <param name="index">position to pull the data from.</param>
-		/// <returns>std::string version of the data.</returns>
-		std::string ToStringVector(std::size_t index);
+		/// <typeparam name="T">The stored type.</typeparam>
+		/// <param name="first">The start of the buffer.</param>
+		/// <param name="last">One past the end of the buffer.</param>
+		/// <param name="index">The index of the value to write.</param>
+		/// <returns>The result of Format.</returns>
+		template <typename T>
+		std::to_chars_result ToCharsAs(char* first, char* last, std::size_t index) const;
 		/// <summary>
-		/// Creates a string fron a mat4 at the given index.
+		/// Copies the string at the given index.
 		/// </summary>
-		/// <param name="index">position to pull the data from.</param>
-		/// <returns>std::string version of the data.</returns>
-		std::string ToStringMatrix(std::size_t index);
+		/// <param name="first">The start of the buffer.</param>
+		/// <param name="last">One past the end of the buffer.</param>
+		/// <param name="index">The index of the value to write.</param>
+		/// <returns>One past the last character written and std::errc{}, or last and std::errc::value_too_large.</returns>
+		std::to_chars_result ToCharsString(char* first, char* last, std::size_t index) const;
 		/// <summary>
-		/// Creates a string fron an RTTI* at the given index.
+		/// Copies the text of the RTTI::ToString of the pointer at the given index.
 		/// </summary>
-		/// <param name="index">position to pull the data from.</param>
-		/// <returns>std::string version of the data.</returns>
-		std::string ToStringPointer(std::size_t index);
+		/// <param name="first">The start of the buffer.</param>
+		/// <param name="last">One past the end of the buffer.</param>
+		/// <param name="index">The index of the value to write.</param>
+		/// <returns>One past the last character written and std::errc{}, or last and std::errc::value_too_large.</returns>
+		std::to_chars_result ToCharsPointer(char* first, char* last, std::size_t index) const;
 		/// <summary>
 		/// Generically compares a trivially comparable set of data given an array of data.
 		/// </summary>
@@ -727,86 +1874,120 @@ namespace FieaGameEngine
 		/// <returns>bool whether or not the set is equivalent.</returns>
 		bool StringSetCompare(void* data) const;
 		/// <summary>
-		/// Compares a set of RTTI* by comparing their RTTI objects.
+		/// Compares a set of RTTI* by comparing their RTTI objects. Elements that point at the same object are equal without a call to Equals.
 		/// </summary>
 		/// <param name="data">The array of data.</param>
 		/// <returns>bool whether or not the set is equivalent.</returns>
 		bool PointerSetCompare(void* data) const;
 		/// <summary>
-		/// Creates an int from a std::string and places it at a given index.
+		/// Parses a value of a numeric type and sets it at the given index.
 		/// </summary>
-		/// <param name="string">std::string to grab the data from.</param>
-		/// <param name="index">Index at which to place the data.</param>
-		void SetIntFromString(const std::string& string, std::size_t index);
+		/// <typeparam name="T">The stored type.</typeparam>
+		/// <param name="first">The start of the text.</param>
+		/// <param name="last">One past the end of the text.</param>
+		/// <param name="index">The index of the value to set.</param>
+		/// <returns>The result of Parse.</returns>
+		template <typename T>
+		std::from_chars_result FromCharsAs(const char* first, const char* last, std::size_t index);
 		/// <summary>
-		/// Creates a float from a std::string and places it at a given index.
+		/// Sets the whole range as the string at the given index.
 		/// </summary>
-		/// <param name="string">std::string to grab the data from.</param>
-		/// <param name="index">Index at which to place the data.</param>
-		void SetFloatFromString(const std::string& string, std::size_t index);
+		/// <param name="first">The start of the text.</param>
+		/// <param name="last">One past the end of the text.</param>
+		/// <param name="index">The index of the value to set.</param>
+		/// <returns>last and std::errc{}.</returns>
+		std::from_chars_result FromCharsString(const char* first, const char* last, std::size_t index);
 		/// <summary>
-		/// Creates a vec4 from a std::string and places it at a given index.
+		/// Parses a value of a numeric type and pushes it to the end.
 		/// </summary>
-		/// <param name="string">std::string to grab the data from.</param>
-		/// <param name="index">Index at which to place the data.</param>
-		void SetVectorFromString(const std::string& string, std::size_t index);
+		/// <typeparam name="T">The stored type.</typeparam>
+		/// <param name="first">The start of the text.</param>
+		/// <param name="last">One past the end of the text.</param>
+		/// <returns>The result of Parse.</returns>
+		template <typename T>
+		std::from_chars_result PushBackFromCharsAs(const char* first, const char* last);
 		/// <summary>
-		/// Creates a mat4 from a std::string and places it at a given index.
+		/// Pushes the whole range as a string to the end.
 		/// </summary>
-		/// <param name="string">std::string to grab the data from.</param>
-		/// <param name="index">Index at which to place the data.</param>
-		void SetMatrixFromString(const std::string& string, std::size_t index);
-		void PushBackVectorFromString(const std::string& string);
-		void PushBackMatrixFromString(const std::string& string);
+		/// <param name="first">The start of the text.</param>
+		/// <param name="last">One past the end of the text.</param>
+		/// <returns>last and std::errc{}.</returns>
+		std::from_chars_result PushBackFromCharsString(const char* first, const char* last);
 
-		using ToStringFunction = std::string(Datum::*)(std::size_t);
-		inline static const std::array< ToStringFunction, 7> _toStringFunctions
+		using ToCharsFunction = std::to_chars_result(Datum::*)(char*, char*, std::size_t) const;
+		inline static const std::array<ToCharsFunction, 13> _toCharsFunctions
 		{
-
-			&ToStringInt,     //DatumTypes::Integer = 0
-			&ToStringFloat,   //DatumTypes::Float
-			&ToStringString,  //DatumTypes::String
-			&ToStringVector,  //DatumTypes::Vector
-			&ToStringMatrix,  //DatumTypes::Matrix
-			&ToStringPointer, //DatumTypes::Pointer
-			&ToStringPointer  //DatumTypes::Table
+			&Datum::ToCharsAs<int>,          //DatumTypes::Integer = 0
+			&Datum::ToCharsAs<float>,        //DatumTypes::Float
+			&Datum::ToCharsString,           //DatumTypes::String
+			&Datum::ToCharsAs<glm::vec4>,    //DatumTypes::Vector
+			&Datum::ToCharsAs<glm::mat4>,    //DatumTypes::Matrix
+			&Datum::ToCharsPointer,          //DatumTypes::Pointer
+			&Datum::ToCharsPointer,          //DatumTypes::Table
+			&Datum::ToCharsAs<std::int64_t>, //DatumTypes::Int64
+			&Datum::ToCharsAs<double>,       //DatumTypes::Double
+			&Datum::ToCharsAs<bool>,         //DatumTypes::Bool
+			&Datum::ToCharsAs<glm::vec2>,    //DatumTypes::Vector2
+			&Datum::ToCharsAs<glm::vec3>,    //DatumTypes::Vector3
+			&Datum::ToCharsAs<glm::quat>     //DatumTypes::Quaternion
 		};
 
 		using SetCompareFunction = bool(Datum::*)(void*) const;
-		inline static const std::array<SetCompareFunction, 7> _setCompareFunctions
+		inline static const std::array<SetCompareFunction, 13> _setCompareFunctions
 		{
-			&GenericSetCompare, //DatumTypes::Integer = 0
-			&GenericSetCompare, //DatumTypes::Float
-			&StringSetCompare,  //DatumTypes::String
-			&GenericSetCompare, //DatumTypes::Vector
-			&GenericSetCompare, //DatumTypes::Matrix
-			&PointerSetCompare, //DatumTypes::Pointer
-			&PointerSetCompare  //DatumTypes::Table
+			&Datum::GenericSetCompare, //DatumTypes::Integer = 0
+			&Datum::GenericSetCompare, //DatumTypes::Float
+			&Datum::StringSetCompare,  //DatumTypes::String
+			&Datum::GenericSetCompare, //DatumTypes::Vector
+			&Datum::GenericSetCompare, //DatumTypes::Matrix
+			&Datum::PointerSetCompare, //DatumTypes::Pointer
+			&Datum::PointerSetCompare, //DatumTypes::Table
+			&Datum::GenericSetCompare, //DatumTypes::Int64
+			&Datum::GenericSetCompare, //DatumTypes::Double
+			&Datum::GenericSetCompare, //DatumTypes::Bool
+			&Datum::GenericSetCompare, //DatumTypes::Vector2
+			&Datum::GenericSetCompare, //DatumTypes::Vector3
+			&Datum::GenericSetCompare  //DatumTypes::Quaternion
 		};
 
-		using SetFromStringFunction = void(Datum::*)(const std::string&, std::size_t);
-		inline static const std::array<SetFromStringFunction, 7> _setFromStringFunctions
+		using FromCharsFunction = std::from_chars_result(Datum::*)(const char*, const char*, std::size_t);
+		inline static const std::array<FromCharsFunction, 13> _fromCharsFunctions
 		{
-			&SetIntFromString,     //DatumTypes::Integer = 0
-			&SetFloatFromString,   //DatumTypes::Float
-			&Set,				   //DatumTypes::String
-			&SetVectorFromString,  //DatumTypes::Vector
-			&SetMatrixFromString,  //DatumTypes::Matrix
-			nullptr,			   //DatumTypes::Pointer
-			nullptr				   //DatumTypes::Table	
+			&Datum::FromCharsAs<int>,          //DatumTypes::Integer = 0
+			&Datum::FromCharsAs<float>,        //DatumTypes::Float
+			&Datum::FromCharsString,           //DatumTypes::String
+			&Datum::FromCharsAs<glm::vec4>,    //DatumTypes::Vector
+			&Datum::FromCharsAs<glm::mat4>,    //DatumTypes::Matrix
+			nullptr,                           //DatumTypes::Pointer
+			nullptr,                           //DatumTypes::Table
+			&Datum::FromCharsAs<std::int64_t>, //DatumTypes::Int64
+			&Datum::FromCharsAs<double>,       //DatumTypes::Double
+			&Datum::FromCharsAs<bool>,         //DatumTypes::Bool
+			&Datum::FromCharsAs<glm::vec2>,    //DatumTypes::Vector2
+			&Datum::FromCharsAs<glm::vec3>,    //DatumTypes::Vector3
+			&Datum::FromCharsAs<glm::quat>     //DatumTypes::Quaternion
 		};
 
-		using PushBackFromStringFunction = void(Datum::*)(const std::string&);
-		inline static const std::array<PushBackFromStringFunction, 7> _pushbackFromStringFunctions
+		using PushBackFromCharsFunction = std::from_chars_result(Datum::*)(const char*, const char*);
+		inline static const std::array<PushBackFromCharsFunction, 13> _pushBackFromCharsFunctions
 		{
-			nullptr,					//DatumTypes::Integer = 0
-			nullptr,					//DatumTypes::Float
-			nullptr,				    //DatumTypes::String
-			&PushBackVectorFromString,  //DatumTypes::Vector
-			&PushBackMatrixFromString,  //DatumTypes::Matrix
-			nullptr,					//DatumTypes::Pointer
-			nullptr						//DatumTypes::Table	
+			&Datum::PushBackFromCharsAs<int>,          //DatumTypes::Integer = 0
+			&Datum::PushBackFromCharsAs<float>,        //DatumTypes::Float
+			&Datum::PushBackFromCharsString,           //DatumTypes::String
+			&Datum::PushBackFromCharsAs<glm::vec4>,    //DatumTypes::Vector
+			&Datum::PushBackFromCharsAs<glm::mat4>,    //DatumTypes::Matrix
+			nullptr,                                   //DatumTypes::Pointer
+			nullptr,                                   //DatumTypes::Table
+			&Datum::PushBackFromCharsAs<std::int64_t>, //DatumTypes::Int64
+			&Datum::PushBackFromCharsAs<double>,       //DatumTypes::Double
+			&Datum::PushBackFromCharsAs<bool>,         //DatumTypes::Bool
+			&Datum::PushBackFromCharsAs<glm::vec2>,    //DatumTypes::Vector2
+			&Datum::PushBackFromCharsAs<glm::vec3>,    //DatumTypes::Vector3
+			&Datum::PushBackFromCharsAs<glm::quat>     //DatumTypes::Quaternion
 		};
 	};
+
+	static_assert(sizeof(Datum) <= 48, "Datum has grown past the layout that keeps Scopes compact.");
 }
 
+#include "Datum.inl"
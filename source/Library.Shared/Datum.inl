@@ -0,0 +1,162 @@
+#include "Datum.h"
+#pragma once
+
+#include <cassert>
+#include <type_traits>
+
+namespace FieaGameEngine
+{
+	inline std::size_t Datum::TypeSize() const
+	{
+		return _type != DatumTypes::Unknown ? _typeSizes[static_cast<std::size_t>(_type)] : 0;
+	}
+
+	template <std::same_as<bool> T>
+	inline Datum& Datum::operator=(T other)
+	{
+		return AssignBool(other);
+	}
+
+	template <std::same_as<bool> T>
+	inline bool Datum::operator==(T rhs) const
+	{
+		return EqualsBool(rhs);
+	}
+
+	template <std::same_as<bool> T>
+	inline bool Datum::operator!=(T rhs) const
+	{
+		return !EqualsBool(rhs);
+	}
+
+	template <std::same_as<bool> T>
+	inline void Datum::PushBack(T item)
+	{
+		PushBackBool(item);
+	}
+
+	template <std::same_as<bool> T>
+	inline void Datum::Set(T item, std::size_t index)
+	{
+		SetBool(item, index);
+	}
+
+	template <std::same_as<bool> T>
+	inline std::size_t Datum::Find(T value) const
+	{
+		return FindBool(value);
+	}
+
+	template <std::same_as<bool> T>
+	inline Vector<std::size_t> Datum::FindAll(T value) const
+	{
+		return FindAllBool(value);
+	}
+
+	template <std::same_as<bool> T>
+	inline void Datum::Remove(T value)
+	{
+		RemoveBool(value);
+	}
+
+	template <typename T>
+	inline std::span<T> Datum::AsSpan()
+	{
+		assert(_type == TypeOf<T>());
+		Detach();
+		return std::span<T>{ static_cast<T*>(_data.vp), _size };
+	}
+
+	template <typename T>
+	inline std::span<const T> Datum::AsSpan() const
+	{
+		assert(_type == TypeOf<T>());
+		return std::span<const T>{ static_cast<const T*>(_data.vp), _size };
+	}
+
+	template <typename T>
+	inline std::to_chars_result Datum::ToCharsAs(char* first, char* last, std::size_t index) const
+	{
+		return Format(first, last, AsSpan<T>()[index]);
+	}
+
+	template <typename T>
+	inline std::from_chars_result Datum::FromCharsAs(const char* first, const char* last, std::size_t index)
+	{
+		T value{};
+		const std::from_chars_result result{ Parse(first, last, value) };
+		if (result.ec == std::errc{})
+		{
+			Set(value, index);
+		}
+
+		return result;
+	}
+
+	template <typename T>
+	inline std::from_chars_result Datum::PushBackFromCharsAs(const char* first, const char* last)
+	{
+		T value{};
+		const std::from_chars_result result{ Parse(first, last, value) };
+		if (result.ec == std::errc{})
+		{
+			PushBack(value);
+		}
+
+		return result;
+	}
+
+	template <typename T>
+	inline constexpr Datum::DatumTypes Datum::TypeOf()
+	{
+		if constexpr (std::is_same_v<T, int>)
+		{
+			return DatumTypes::Integer;
+		}
+		else if constexpr (std::is_same_v<T, float>)
+		{
+			return DatumTypes::Float;
+		}
+		else if constexpr (std::is_same_v<T, std::string>)
+		{
+			return DatumTypes::String;
+		}
+		else if constexpr (std::is_same_v<T, glm::vec4>)
+		{
+			return DatumTypes::Vector;
+		}
+		else if constexpr (std::is_same_v<T, glm::mat4>)
+		{
+			return DatumTypes::Matrix;
+		}
+		else if constexpr (std::is_same_v<T, std::int64_t>)
+		{
+			return DatumTypes::Int64;
+		}
+		else if constexpr (std::is_same_v<T, double>)
+		{
+			return DatumTypes::Double;
+		}
+		else if constexpr (std::is_same_v<T, bool>)
+		{
+			return DatumTypes::Bool;
+		}
+		else if constexpr (std::is_same_v<T, glm::vec2>)
+		{
+			return DatumTypes::Vector2;
+		}
+		else if constexpr (std::is_same_v<T, glm::vec3>)
+		{
+			return DatumTypes::Vector3;
+		}
+		else if constexpr (std::is_same_v<T, glm::quat>)
+		{
+			return DatumTypes::Quaternion;
+		}
+		else
+		{
+			static_assert(std::is_same_v<T, RTTI*>, "Datum does not store this type.");
+			return DatumTypes::Pointer;
+		}
+	}
+}
@@ -1,6 +1,9 @@
 #pragma once
 
 #include <cstddef>
+#include <cstring>
+#include <string>
+#include <string_view>
 
 template<typename T>
 struct DefaultEquality final
@@ -24,6 +27,41 @@ inline bool DefaultEquality<T>::operator()(const T* lhs, const T* rhs) const
 template<>
 inline bool DefaultEquality<char>::operator()(const char* lhs, const char* rhs) const
 {
-	return strcmp(lhs, rhs);
+	return strcmp(lhs, rhs) == 0;
+}
+
+template<>
+inline bool DefaultEquality<const char*>::operator()(const char* const& lhs, const char* const& rhs) const
+{
+	return strcmp(lhs, rhs) == 0;
+}
+
+/// <summary>
+/// Compares std::string keys against other strings, string views and C strings without building a std::string.
+/// is_transparent lets HashMap and OpenHashMap look up std::string keys using any of those types.
+/// </summary>
+template<>
+struct DefaultEquality<std::string> final
+{
+	using is_transparent = void;
+
+	bool operator()(const std::string&, const std::string&) const;
+	bool operator()(const std::string&, std::string_view) const;
+	bool operator()(const std::string&, const char*) const;
+};
+
+inline bool DefaultEquality<std::string>::operator()(const std::string& lhs, const std::string& rhs) const
+{
+	return lhs == rhs;
+}
+
+inline bool DefaultEquality<std::string>::operator()(const std::string& lhs, std::string_view rhs) const
+{
+	return std::string_view{ lhs } == rhs;
+}
+
+inline bool DefaultEquality<std::string>::operator()(const std::string& lhs, const char* rhs) const
+{
+	return std::string_view{ lhs } == std::string_view{ rhs };
 }
 
@@ -1,10 +1,145 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <cassert>
+#include <concepts>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include "DefaultEquality.h"
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
 
 namespace FieaGameEngine
 {
+	namespace Hashing
+	{
+		inline constexpr std::uint64_t Secret[4]{ 0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull };
+
+		/// <summary>
+		/// Multiplies two 64 bit values into a 128 bit product and returns the low and high halves through the arguments.
+		/// </summary>
+		inline void Multiply(std::uint64_t& a, std::uint64_t& b)
+		{
+#if defined(__SIZEOF_INT128__)
+			unsigned __int128 product{ static_cast<unsigned __int128>(a) * b };
+			a = static_cast<std::uint64_t>(product);
+			b = static_cast<std::uint64_t>(product >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+			a = _umul128(a, b, &b);
+#else
+			std::uint64_t aHigh{ a >> 32 }, aLow{ a & 0xFFFFFFFFull }, bHigh{ b >> 32 }, bLow{ b & 0xFFFFFFFFull };
+			std::uint64_t highHigh{ aHigh * bHigh }, highLow{ aHigh * bLow }, lowHigh{ aLow * bHigh }, lowLow{ aLow * bLow };
+			std::uint64_t middle{ (lowLow >> 32) + (highLow & 0xFFFFFFFFull) + lowHigh };
+			a = (middle << 32) | (lowLow & 0xFFFFFFFFull);
+			b = highHigh + (highLow >> 32) + (middle >> 32);
+#endif
+		}
+
+		/// <summary>
+		/// Folds the 128 bit product of two values into 64 bits. Every input bit affects every output bit.
+		/// </summary>
+		inline std::uint64_t Mix(std::uint64_t a, std::uint64_t b)
+		{
+			Multiply(a, b);
+			return a ^ b;
+		}
+
+		inline std::uint64_t Read8(const std::uint8_t* data)
+		{
+			std::uint64_t value;
+			std::memcpy(&value, data, sizeof(value));
+			return value;
+		}
+
+		inline std::uint64_t Read4(const std::uint8_t* data)
+		{
+			std::uint32_t value;
+			std::memcpy(&value, data, sizeof(value));
+			return value;
+		}
+
+		/// <summary>
+		/// Hashes a block of memory eight bytes at a time. This follows the construction of wyhash, which is in the public domain.
+		/// </summary>
+		/// <param name="data">The bytes to hash.</param>
+		/// <param name="length">The number of bytes to hash.</param>
+		/// <param name="seed">Changes every hash that is produced.</param>
+		/// <returns>uint64_t</returns>
+		inline std::uint64_t HashBytes(const void* data, std::size_t length, std::uint64_t seed = 0)
+		{
+			const std::uint8_t* bytes{ static_cast<const std::uint8_t*>(data) };
+			seed ^= Mix(seed ^ Secret[0], Secret[1]);
+			std::uint64_t a{ 0 };
+			std::uint64_t b{ 0 };
+
+			if (length <= 16)
+			{
+				if (length >= 4)
+				{
+					const std::size_t offset{ (length >> 3) << 2 };
+					a = (Read4(bytes) << 32) | Read4(bytes + offset);
+					b = (Read4(bytes + length - 4) << 32) | Read4(bytes + length - 4 - offset);
+				}
+				else if (length > 0)
+				{
+					a = (static_cast<std::uint64_t>(bytes[0]) << 16) | (static_cast<std::uint64_t>(bytes[length >> 1]) << 8) | bytes[length - 1];
+				}
+			}
+			else
+			{
+				std::size_t remaining{ length };
+				if (remaining > 48)
+				{
+					std::uint64_t first{ seed };
+					std::uint64_t second{ seed };
+					do
+					{
+						seed = Mix(Read8(bytes) ^ Secret[1], Read8(bytes + 8) ^ seed);
+						first = Mix(Read8(bytes + 16) ^ Secret[2], Read8(bytes + 24) ^ first);
+						second = Mix(Read8(bytes + 32) ^ Secret[3], Read8(bytes + 40) ^ second);
+						bytes += 48;
+						remaining -= 48;
+					} while (remaining > 48);
+					seed ^= first ^ second;
+				}
+
+				while (remaining > 16)
+				{
+					seed = Mix(Read8(bytes) ^ Secret[1], Read8(bytes + 8) ^ seed);
+					bytes += 16;
+					remaining -= 16;
+				}
+
+				a = Read8(bytes + remaining - 16);
+				b = Read8(bytes + remaining - 8);
+			}
+
+			a ^= Secret[1];
+			b ^= seed;
+			Multiply(a, b);
+			return Mix(a ^ Secret[0] ^ length, b ^ Secret[1]);
+		}
+
+		/// <summary>
+		/// Hashes a single integer with one wide multiply, which is much cheaper than running it through HashBytes.
+		/// </summary>
+		/// <param name="value"></param>
+		/// <returns>uint64_t</returns>
+		inline std::uint64_t HashInteger(std::uint64_t value)
+		{
+			return Mix(value ^ Secret[0], Secret[1]);
+		}
+	}
+
+	/// <summary>
+	/// The hash used by HashMap and OpenHashMap when none is supplied. Integral, enum and pointer keys are mixed by value, strings by their characters,
+	/// and every other type by the bytes of its object representation, which is only meaningful for types without padding or owned memory.
+	/// </summary>
+	/// <typeparam name="T"></typeparam>
 	template <typename T>
 	struct DefaultHash final
 	{
@@ -15,46 +150,80 @@ namespace FieaGameEngine
 	template<typename T>
 	inline std::size_t DefaultHash<T>::operator()(const T& t) const
 	{
-		const auto hashPrime{ 7 };
-		std::size_t hash{};
-		const std::byte* data = reinterpret_cast<const std::byte*>(&t);
-		auto size = sizeof(T);
-		for (std::size_t index{ 0 }; index < size; ++index)
+		if constexpr (std::is_integral_v<T> || std::is_enum_v<T>)
+		{
+			return static_cast<std::size_t>(Hashing::HashInteger(static_cast<std::uint64_t>(t)));
+		}
+		else if constexpr (std::is_pointer_v<T>)
 		{
-			hash += (static_cast<std::size_t>(static_cast<std::size_t>(data[index]) * hashPrime));
+			return static_cast<std::size_t>(Hashing::HashInteger(reinterpret_cast<std::uintptr_t>(t)));
+		}
+		else
+		{
+			return static_cast<std::size_t>(Hashing::HashBytes(&t, sizeof(T)));
 		}
-		return hash;
 	}
 
 	template<>
-	inline std::size_t DefaultHash<int>::operator()(const int& t) const
+	inline std::size_t DefaultHash<char>::operator()(const char* t) const
 	{
-		return static_cast<std::size_t>(t);
+		assert(t != nullptr);
+		return static_cast<std::size_t>(Hashing::HashBytes(t, std::strlen(t)));
 	}
 
 	template<>
-	inline std::size_t DefaultHash<char>::operator()(const char* t) const
+	inline std::size_t DefaultHash<const char*>::operator()(const char* const& t) const
 	{
 		assert(t != nullptr);
-		std::size_t total{};
-		const char* temp = t;
-		while (*t != '\0')
-		{
-			total += static_cast<std::size_t>(*t);
-			++t;
-		}
-		t = temp;
-		return total;
+		return static_cast<std::size_t>(Hashing::HashBytes(t, std::strlen(t)));
 	}
 
 	template<>
+	inline std::size_t DefaultHash<char*>::operator()(char* const& t) const
+	{
+		assert(t != nullptr);
+		return static_cast<std::size_t>(Hashing::HashBytes(t, std::strlen(t)));
+	}
+
+	/// <summary>
+	/// Hashes std::string keys by their characters. Strings, string views and C strings with the same characters hash to the same value,
+	/// and is_transparent lets HashMap and OpenHashMap look up std::string keys using any of those types.
+	/// </summary>
+	template<>
+	struct DefaultHash<std::string> final
+	{
+		using is_transparent = void;
+
+		std::size_t operator()(const std::string&) const;
+		std::size_t operator()(std::string_view) const;
+		std::size_t operator()(const char*) const;
+	};
+
 	inline std::size_t DefaultHash<std::string>::operator()(const std::string& t) const
 	{
-		std::size_t total{};
-		for (auto& character : t)
-		{
-			total += static_cast<std::size_t>(character);
-		}
-		return total;
+		return static_cast<std::size_t>(Hashing::HashBytes(t.data(), t.size()));
+	}
+
+	inline std::size_t DefaultHash<std::string>::operator()(std::string_view t) const
+	{
+		return static_cast<std::size_t>(Hashing::HashBytes(t.data(), t.size()));
 	}
- }
\ No newline at end of file
+
+	inline std::size_t DefaultHash<std::string>::operator()(const char* t) const
+	{
+		assert(t != nullptr);
+		return static_cast<std::size_t>(Hashing::HashBytes(t, std::strlen(t)));
+	}
+
+	/// <summary>
+	/// Satisfied when a map keyed on TKey can be searched with a TLookup directly: both DefaultHash and DefaultEquality for TKey are transparent and accept it.
+	/// </summary>
+	template <typename TKey, typename TLookup>
+	concept TransparentLookup = !std::is_same_v<std::remove_cvref_t<TLookup>, TKey>
+		&& requires { typename DefaultHash<TKey>::is_transparent; typename DefaultEquality<TKey>::is_transparent; }
+		&& requires(const TKey& key, const TLookup& lookup)
+		{
+			{ DefaultHash<TKey>{}(lookup) } -> std::convertible_to<std::size_t>;
+			{ DefaultEquality<TKey>{}(key, lookup) } -> std::convertible_to<bool>;
+		};
+ }
@@ -4,6 +4,10 @@
 
 namespace FieaGameEngine
 {
+	/// <summary>
+	/// The growth policy used by Vector. Grows geometrically by half the current capacity, starting from a small minimum,
+	/// so a run of insertions costs amortized constant time and reallocates only a logarithmic number of times.
+	/// </summary>
 	template <typename T>
 	struct DefaultIncrement final
 	{
@@ -15,7 +19,8 @@ namespace FieaGameEngine
 	inline std::size_t DefaultIncrement<T>::operator()(std::size_t capacity, std::size_t size) const
 	{
 		size;
-		return capacity + 5;
+		constexpr std::size_t minimumCapacity{ 4 };
+		return capacity < minimumCapacity ? minimumCapacity : capacity + capacity / 2;
 	}
 	template<typename T>
 	inline std::size_t DefaultIncrement<T>::operator()(const T& t) const
@@ -40,11 +40,11 @@ namespace FieaGameEngine
 		/// </summary>
 		static void Subscribe(Subscriber subscriber);
 		/// <summary>
-		/// Static method that unsubscribes a given Subscriber from the list of active subscribers.
+		/// Static method that unsubscribes a given Subscriber from the list of active subscribers. Releases the lists' memory once the last subscriber leaves.
 		/// </summary>
 		static void Unsubscribe(Subscriber subscriber);
 		/// <summary>
-		/// Static method that unsubscribes all Subscribers from the list of active subscribers.
+		/// Static method that unsubscribes all Subscribers from the list of active subscribers and releases the lists' memory.
 		/// </summary>
 		static void UnsubscribeAll();
 		/// <summary>
@@ -31,6 +31,14 @@ namespace FieaGameEngine
 			if (callback._id == subscriber._id)
 			{
 				_subscribers.Remove(position, position + 1);
+				if (_subscribers.IsEmpty())
+				{
+					_subscribers.ShrinkToFit();
+					if (_pendingSubscribers.IsEmpty())
+					{
+						_pendingSubscribers.ShrinkToFit();
+					}
+				}
 				return;
 			}
 		}
@@ -40,7 +48,9 @@ namespace FieaGameEngine
 	inline void Event<T>::UnsubscribeAll()
 	{
 		_subscribers.Clear();
+		_subscribers.ShrinkToFit();
 		_pendingSubscribers.Clear();
+		_pendingSubscribers.ShrinkToFit();
 	}
 	template<typename T>
 	inline void Event<T>::Deliver()
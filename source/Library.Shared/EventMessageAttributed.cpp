@@ -9,9 +9,9 @@ namespace FieaGameEngine
 	{
 	}
 
-	Vector<Signature> EventMessageAttributed::Signatures()
+	SignatureList EventMessageAttributed::Signatures()
     {
-		return Vector<Signature>
+		return SignatureList
 		{
 			FieaGameEngine::Signature{ "SubType", Datum::DatumTypes::String, 1, offsetof(EventMessageAttributed, _subtype) }
 		};
@@ -28,6 +28,6 @@ namespace FieaGameEngine
 		/// Returns the Signature of prescribed attributes of the class.
 		/// </summary>
 		/// <returns>A Vector of Signatures describing the prescribed attributes.</returns>
-		static Vector<Signature> Signatures();
+		static SignatureList Signatures();
 	};
 }
\ No newline at end of file
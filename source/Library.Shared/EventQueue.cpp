@@ -36,7 +36,9 @@ namespace FieaGameEngine
 	{
 		assert(!_isUpdating);
 		_pendingEvents.Clear();
+		_pendingEvents.ShrinkToFit();
 		_events.Clear();
+		_events.ShrinkToFit();
 	}
 
 	bool EventQueue::IsEmpty()
@@ -42,7 +42,7 @@ namespace FieaGameEngine
 		/// <param name="gameTime"> Reference to an instance of a GameTime </param>
 		void Update(const GameTime& gameTime);
 		/// <summary>
-		/// Clears all events from the event list, effectively cancelling them.
+		/// Clears all events from the event list, effectively cancelling them, and releases the queue's memory.
 		/// </summary>
 		void Clear();
 		/// <summary>
@@ -2,8 +2,23 @@
 
 namespace FieaGameEngine
 {
-	ExpressionParser::Token::Token(const std::string& token, int precendence, bool isVariable, bool isOperator, Datum::DatumTypes type) :
-		_token{ token }, _precedence{ precendence }, _isVariable{ isVariable }, _isOperator{ isOperator }, _type{ type }
+	namespace
+	{
+		/// <summary>
+		/// Reads the value of a literal token in the form Datum::ToString writes it.
+		/// </summary>
+		template <typename T>
+		T ParseLiteral(const std::string& token)
+		{
+			T value{};
+			[[maybe_unused]] const std::from_chars_result result{ Datum::Parse(token.data(), token.data() + token.size(), value) };
+			assert(result.ec == std::errc{});
+			return value;
+		}
+	}
+
+	ExpressionParser::Token::Token(std::string_view token, int precendence, bool isVariable, bool isOperator, Datum::DatumTypes type) :
+		_token{ token }, _binding{ isVariable ? Symbol{ token } : Symbol{} }, _precedence{ precendence }, _isVariable{ isVariable }, _isOperator{ isOperator }, _type{ type }
 	{
 
 	}
@@ -12,7 +27,7 @@ namespace FieaGameEngine
 	{
 		if (_isVariable)
 		{
-			Datum* variable = action.Search(_token);
+			Datum* variable = action.Search(_binding);
 			assert(variable != nullptr);
 			assert(variable->Type() == Datum::DatumTypes::String);
 			return variable->GetAsString();
@@ -25,80 +40,149 @@ namespace FieaGameEngine
 	{
 		if (_isVariable)
 		{
-			Datum* variable = action.Search(_token);
+			Datum* variable = action.Search(_binding);
 			assert(variable != nullptr);
 			assert(variable->Type() == Datum::DatumTypes::Integer);
 			return variable->GetAsInt();
 		}
 
 		assert(_type == Datum::DatumTypes::Integer);
-		return std::stoi(_token);
+		return ParseLiteral<int>(_token);
 	}
 
 	float ExpressionParser::Token::GetAsFloat(Action& action)
 	{
 		if (_isVariable)
 		{
-			Datum* variable = action.Search(_token);
+			Datum* variable = action.Search(_binding);
 			assert(variable != nullptr);
 			assert(variable->Type() == Datum::DatumTypes::Float);
 			return variable->GetAsFloat();
 		}
 
 		assert(_type == Datum::DatumTypes::Float);
-		return std::stof(_token);
+		return ParseLiteral<float>(_token);
 	}
 
 	glm::vec4 ExpressionParser::Token::GetAsVector(Action& action)
 	{
 		if (_isVariable)
 		{
-			Datum* variable = action.Search(_token);
+			Datum* variable = action.Search(_binding);
 			assert(variable != nullptr);
 			assert(variable->Type() == Datum::DatumTypes::Vector);
 			return variable->GetAsVector();
 		}
 
-		glm::vec4 vec{};
-		int result = sscanf_s(_token.c_str(), " vec4(%f, %f, %f, %f) ", &vec.x, &vec.y, &vec.z, &vec.w);
-		assert(result == 4);
-		result;
-		return vec;
+		assert(_type == Datum::DatumTypes::Vector);
+		return ParseLiteral<glm::vec4>(_token);
 	}
 
 	glm::mat4 ExpressionParser::Token::GetAsMatrix(Action& action)
 	{
 		if (_isVariable)
 		{
-			Datum* variable = action.Search(_token);
+			Datum* variable = action.Search(_binding);
 			assert(variable != nullptr);
 			assert(variable->Type() == Datum::DatumTypes::Matrix);
 			return variable->GetAsMatrix();
 		}
 
-		glm::vec4 vec1{};
-		glm::vec4 vec2{};
-		glm::vec4 vec3{};
-		glm::vec4 vec4{};
-		int result = sscanf_s(_token.c_str(), " mat4x4((%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f)) ",
-			&vec1.x, &vec1.y, &vec1.z, &vec1.w,
-			&vec2.x, &vec2.y, &vec2.z, &vec2.w,
-			&vec3.x, &vec3.y, &vec3.z, &vec3.w,
-			&vec4.x, &vec4.y, &vec4.z, &vec4.w
-		);
-		assert(result == 16);
-		result;
-		return glm::mat4{ vec1, vec2, vec3, vec4 };
+		assert(_type == Datum::DatumTypes::Matrix);
+		return ParseLiteral<glm::mat4>(_token);
+	}
+
+	std::int64_t ExpressionParser::Token::GetAsInt64(Action& action)
+	{
+		if (_isVariable)
+		{
+			Datum* variable = action.Search(_binding);
+			assert(variable != nullptr);
+			assert(variable->Type() == Datum::DatumTypes::Int64);
+			return variable->GetAsInt64();
+		}
+
+		assert(_type == Datum::DatumTypes::Int64);
+		return ParseLiteral<std::int64_t>(_token);
+	}
+
+	double ExpressionParser::Token::GetAsDouble(Action& action)
+	{
+		if (_isVariable)
+		{
+			Datum* variable = action.Search(_binding);
+			assert(variable != nullptr);
+			assert(variable->Type() == Datum::DatumTypes::Double);
+			return variable->GetAsDouble();
+		}
+
+		assert(_type == Datum::DatumTypes::Double);
+		return ParseLiteral<double>(_token);
+	}
+
+	bool ExpressionParser::Token::GetAsBool(Action& action)
+	{
+		if (_isVariable)
+		{
+			Datum* variable = action.Search(_binding);
+			assert(variable != nullptr);
+			assert(variable->Type() == Datum::DatumTypes::Bool);
+			return variable->GetAsBool();
+		}
+
+		assert(_type == Datum::DatumTypes::Bool);
+		return ParseLiteral<bool>(_token);
+	}
+
+	glm::vec2 ExpressionParser::Token::GetAsVector2(Action& action)
+	{
+		if (_isVariable)
+		{
+			Datum* variable = action.Search(_binding);
+			assert(variable != nullptr);
+			assert(variable->Type() == Datum::DatumTypes::Vector2);
+			return variable->GetAsVector2();
+		}
+
+		assert(_type == Datum::DatumTypes::Vector2);
+		return ParseLiteral<glm::vec2>(_token);
+	}
+
+	glm::vec3 ExpressionParser::Token::GetAsVector3(Action& action)
+	{
+		if (_isVariable)
+		{
+			Datum* variable = action.Search(_binding);
+			assert(variable != nullptr);
+			assert(variable->Type() == Datum::DatumTypes::Vector3);
+			return variable->GetAsVector3();
+		}
+
+		assert(_type == Datum::DatumTypes::Vector3);
+		return ParseLiteral<glm::vec3>(_token);
+	}
+
+	glm::quat ExpressionParser::Token::GetAsQuaternion(Action& action)
+	{
+		if (_isVariable)
+		{
+			Datum* variable = action.Search(_binding);
+			assert(variable != nullptr);
+			assert(variable->Type() == Datum::DatumTypes::Quaternion);
+			return variable->GetAsQuaternion();
+		}
+
+		assert(_type == Datum::DatumTypes::Quaternion);
+		return ParseLiteral<glm::quat>(_token);
 	}
 
-	void ExpressionParser::ParseExpression(const std::string& expression, Action* action)
+	void ExpressionParser::ParseExpression(std::string_view expression, Action* action)
 	{
 		std::size_t position = expression.find(" ");
-		std::string token = expression.substr(0, position);
-		ParseToken(token, action);
+		ParseToken(expression.substr(0, position), action);
 		if (position != expression.npos)
 		{
-			std::string remainingExpression = expression.substr(position + 1, expression.npos);
+			std::string_view remainingExpression = expression.substr(position + 1, expression.npos);
 			if (remainingExpression.empty())
 			{
 				while (!_operators.IsEmpty())
@@ -128,12 +212,12 @@ namespace FieaGameEngine
 		_operators.Clear();
 	}
 
-	Vector<ExpressionParser::Token> ExpressionParser::Output()
+	ExpressionParser::TokenList ExpressionParser::Output()
 	{
 		return _output;
 	}
 	
-	void ExpressionParser::ParseToken(std::string& token, Action* action)
+	void ExpressionParser::ParseToken(std::string_view token, Action* action)
 	{
 		auto position = _operatorDefinitions.Find(token);
 		if (position != _operatorDefinitions.end())
@@ -189,7 +273,7 @@ namespace FieaGameEngine
 		}
 	}
 
-	Datum::DatumTypes ExpressionParser::ParseType(std::string& token)
+	Datum::DatumTypes ExpressionParser::ParseType(std::string_view& token)
 	{
 		for (auto& check : _typeChecks)
 		{
@@ -202,7 +286,7 @@ namespace FieaGameEngine
 		return Datum::DatumTypes::Unknown;
 	}
 
-	Datum::DatumTypes ExpressionParser::CheckVector(std::string& token)
+	Datum::DatumTypes ExpressionParser::CheckVector(std::string_view& token)
 	{
 		auto type = Datum::DatumTypes::Unknown;
 		auto position = token.find("vec4");
@@ -213,7 +297,40 @@ namespace FieaGameEngine
 		return type;
 	}
 
-	Datum::DatumTypes ExpressionParser::CheckMatrix(std::string& token)
+	Datum::DatumTypes ExpressionParser::CheckVector2(std::string_view& token)
+	{
+		auto type = Datum::DatumTypes::Unknown;
+		auto position = token.find("vec2");
+		if (position != token.npos)
+		{
+			type = Datum::DatumTypes::Vector2;
+		}
+		return type;
+	}
+
+	Datum::DatumTypes ExpressionParser::CheckVector3(std::string_view& token)
+	{
+		auto type = Datum::DatumTypes::Unknown;
+		auto position = token.find("vec3");
+		if (position != token.npos)
+		{
+			type = Datum::DatumTypes::Vector3;
+		}
+		return type;
+	}
+
+	Datum::DatumTypes ExpressionParser::CheckQuaternion(std::string_view& token)
+	{
+		auto type = Datum::DatumTypes::Unknown;
+		auto position = token.find("quat");
+		if (position != token.npos)
+		{
+			type = Datum::DatumTypes::Quaternion;
+		}
+		return type;
+	}
+
+	Datum::DatumTypes ExpressionParser::CheckMatrix(std::string_view& token)
 	{
 		auto type = Datum::DatumTypes::Unknown;
 		auto position = token.find("mat4x4");
@@ -224,7 +341,12 @@ namespace FieaGameEngine
 		return type;
 	}
 
-	Datum::DatumTypes ExpressionParser::CheckInt(std::string& token)
+	Datum::DatumTypes ExpressionParser::CheckBool(std::string_view& token)
+	{
+		return token == "true" || token == "false" ? Datum::DatumTypes::Bool : Datum::DatumTypes::Unknown;
+	}
+
+	Datum::DatumTypes ExpressionParser::CheckInt(std::string_view& token)
 	{
 		for (auto& character : token)
 		{
@@ -236,25 +358,49 @@ namespace FieaGameEngine
 		return Datum::DatumTypes::Integer;
 	}
 
-	Datum::DatumTypes ExpressionParser::CheckFloat(std::string& token)
+	Datum::DatumTypes ExpressionParser::CheckInt64(std::string_view& token)
+	{
+		auto type = Datum::DatumTypes::Unknown;
+		auto position = token.find("_l");
+		if (position != token.npos)
+		{
+			token.remove_suffix(token.size() - position);
+			type = Datum::DatumTypes::Int64;
+		}
+		return type;
+	}
+
+	Datum::DatumTypes ExpressionParser::CheckFloat(std::string_view& token)
 	{
 		auto type = Datum::DatumTypes::Unknown;
 		auto position = token.find("_f");
 		if (position != token.npos)
 		{
-			token.erase(position);
+			token.remove_suffix(token.size() - position);
 			type = Datum::DatumTypes::Float;
 		}
 		return type;
 	}
 
-	Datum::DatumTypes ExpressionParser::CheckString(std::string& token)
+	Datum::DatumTypes ExpressionParser::CheckDouble(std::string_view& token)
+	{
+		auto type = Datum::DatumTypes::Unknown;
+		auto position = token.find("_d");
+		if (position != token.npos)
+		{
+			token.remove_suffix(token.size() - position);
+			type = Datum::DatumTypes::Double;
+		}
+		return type;
+	}
+
+	Datum::DatumTypes ExpressionParser::CheckString(std::string_view& token)
 	{
 		auto type = Datum::DatumTypes::Unknown;
 		auto position = token.find("_s");
 		if (position != token.npos)
 		{
-			token.erase(position);
+			token.remove_suffix(token.size() - position);
 			type = Datum::DatumTypes::String;
 		}
 		return type;
@@ -1,8 +1,10 @@
 #pragma once
+#include <string_view>
 #include "Datum.h"
 #include "Stack.h"
 #include "Vector.h"
 #include "HashMap.h"
+#include "Symbol.h"
 #include "Action.h"
 
 namespace FieaGameEngine
@@ -13,24 +15,35 @@ namespace FieaGameEngine
 		struct Token final
 		{
 			std::string _token{};
-			Datum* _value { nullptr };
+			Scope::Binding _binding{};
 			int _precedence{};
 			bool _isOperator{ false };
 			bool _isVariable{ false };
 			Datum::DatumTypes _type{ Datum::DatumTypes::Unknown };
 
 			Token() = delete;
-			Token(const std::string& token, int precendence, bool isVariable, bool isOperator, Datum::DatumTypes type = Datum::DatumTypes::Unknown);
+			Token(std::string_view token, int precendence, bool isVariable, bool isOperator, Datum::DatumTypes type = Datum::DatumTypes::Unknown);
 
 			const std::string& GetAsString(Action& action);
 			int GetAsInt(Action& action);
 			float GetAsFloat(Action& action);
 			glm::vec4 GetAsVector(Action& action);
 			glm::mat4 GetAsMatrix(Action& action);
+			std::int64_t GetAsInt64(Action& action);
+			double GetAsDouble(Action& action);
+			bool GetAsBool(Action& action);
+			glm::vec2 GetAsVector2(Action& action);
+			glm::vec3 GetAsVector3(Action& action);
+			glm::quat GetAsQuaternion(Action& action);
 		};
 
+		/// <summary>
+		/// The postfix output of one expression. Expressions in scripts are short, so their tokens are usually kept inline.
+		/// </summary>
+		using TokenList = SmallVector<Token, 8>;
+
 	private:
-		Vector<Token> _output{};
+		TokenList _output{};
 		Stack<Token> _operators{};
 
 		inline static HashMap<std::string, ExpressionParser::Token> _operatorDefinitions
@@ -54,27 +67,39 @@ namespace FieaGameEngine
 
 	public:
 
-		void ParseExpression(const std::string& expression, Action* action);
+		void ParseExpression(std::string_view expression, Action* action);
 		void Reset();
-		Vector<Token> Output();
+		TokenList Output();
 
 	private:
-		void ParseToken(std::string& token, Action* action);
-		Datum::DatumTypes ParseType(std::string& token);
-		Datum::DatumTypes CheckVector(std::string& token);
-		Datum::DatumTypes CheckMatrix(std::string& token);
-		Datum::DatumTypes CheckInt(std::string& token);
-		Datum::DatumTypes CheckFloat(std::string& token);
-		Datum::DatumTypes CheckString(std::string& token);
+		void ParseToken(std::string_view token, Action* action);
+		Datum::DatumTypes ParseType(std::string_view& token);
+		Datum::DatumTypes CheckVector(std::string_view& token);
+		Datum::DatumTypes CheckVector2(std::string_view& token);
+		Datum::DatumTypes CheckVector3(std::string_view& token);
+		Datum::DatumTypes CheckQuaternion(std::string_view& token);
+		Datum::DatumTypes CheckMatrix(std::string_view& token);
+		Datum::DatumTypes CheckBool(std::string_view& token);
+		Datum::DatumTypes CheckInt(std::string_view& token);
+		Datum::DatumTypes CheckInt64(std::string_view& token);
+		Datum::DatumTypes CheckFloat(std::string_view& token);
+		Datum::DatumTypes CheckDouble(std::string_view& token);
+		Datum::DatumTypes CheckString(std::string_view& token);
 
-		using TypeCheck = Datum::DatumTypes(ExpressionParser::*)(std::string&);
+		using TypeCheck = Datum::DatumTypes(ExpressionParser::*)(std::string_view&);
 
-		inline static const std::array<TypeCheck, 5> _typeChecks
+		inline static const std::array<TypeCheck, 11> _typeChecks
 		{
 			&ExpressionParser::CheckVector,
+			&ExpressionParser::CheckVector2,
+			&ExpressionParser::CheckVector3,
+			&ExpressionParser::CheckQuaternion,
 			&ExpressionParser::CheckMatrix,
+			&ExpressionParser::CheckBool,
 			&ExpressionParser::CheckString,
 			&ExpressionParser::CheckFloat,
+			&ExpressionParser::CheckDouble,
+			&ExpressionParser::CheckInt64,
 			&ExpressionParser::CheckInt
 		};
 	};
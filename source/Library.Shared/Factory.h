@@ -19,13 +19,13 @@ namespace FieaGameEngine
 		/// </summary>
 		/// <param name="className">The name of the class the found factory should handle.</param>
 		/// <returns>A pointer to a Factory of a given family type.</returns>
-		static const Factory* Find(const std::string& className);
+		static const Factory* Find(std::string_view className);
 		/// <summary>
 		/// Attempts to create an object of the given class name. Will return nullptr if not possible.
 		/// </summary>
 		/// <param name="className">The name of the class to insantiate.</param>
 		/// <returns>A unique_ptr to the instantiated class.</returns>
-		static std::unique_ptr<T> Create(const std::string& className);
+		static std::unique_ptr<T> Create(std::string_view className);
 		/// <summary>
 		/// Clears the added factories, thus deleting them.
 		/// </summary>
@@ -40,6 +40,12 @@ namespace FieaGameEngine
 		/// </summary>
 		/// <returns>The name of the class associated with the given factory.</returns>
 		virtual const std::string& ClassName() const = 0;
+		/// <summary>
+		/// Returns whether the objects this factory creates start out with a template's values, such as instances of a Prefab,
+		/// so that values given for one while parsing replace the ones it has instead of being added to them.
+		/// </summary>
+		/// <returns>False unless a concrete factory says otherwise.</returns>
+		virtual bool CreatesFromTemplate() const;
 		virtual ~Factory() = default;
 		/// <summary>
 		/// Adds a given concrete factory.
@@ -50,7 +56,7 @@ namespace FieaGameEngine
 		/// Removes a given concrete factory.
 		/// </summary>
 		/// <param name="concreteFactory">Factory to remove.</param>
-		static void Remove(const std::string& className);
+		static void Remove(std::string_view className);
 	};
 }
 
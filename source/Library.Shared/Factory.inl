@@ -5,7 +5,7 @@
 namespace FieaGameEngine
 {
 	template <typename T>
-	inline const Factory<T>* Factory<T>::Find(const std::string& className)
+	inline const Factory<T>* Factory<T>::Find(std::string_view className)
 	{
 		auto position = _factories.Find(className);
 		if (position != _factories.end())
@@ -19,7 +19,13 @@ namespace FieaGameEngine
 	}
 
 	template<typename T>
-	inline std::unique_ptr<T> Factory<T>::Create(const std::string& className)
+	inline bool Factory<T>::CreatesFromTemplate() const
+	{
+		return false;
+	}
+
+	template<typename T>
+	inline std::unique_ptr<T> Factory<T>::Create(std::string_view className)
 	{
 		auto factory = Find(className);
 		if (factory != nullptr)
@@ -48,7 +54,7 @@ namespace FieaGameEngine
 	}
 
 	template<typename T>
-	inline void Factory<T>::Remove(const std::string& className)
+	inline void Factory<T>::Remove(std::string_view className)
 	{
 		_factories.Remove(className);
 	}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "TriviallyRelocatable.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// A standard allocator that keeps single objects it is given back in an intrusive free list and hands them out again before asking the heap for more.
+	/// A node based container that pushes and pops at a steady rate stops allocating once its free list holds as many nodes as it ever needs at once.
+	/// The free list belongs to the allocator instance, so there is no shared or global state; copies start with an empty free list, moves take it along,
+	/// and the destructor returns everything that is still cached to the heap.
+	/// Every instance allocates from the same heap, so any instance may free memory obtained from any other and all of them compare equal.
+	/// </summary>
+	/// <typeparam name="T">The type of object allocated.</typeparam>
+	template <typename T>
+	class FreeListAllocator final
+	{
+		template <typename U>
+		friend class FreeListAllocator;
+
+	public:
+		using value_type = T;
+		using size_type = std::size_t;
+		using propagate_on_container_copy_assignment = std::false_type;
+		using propagate_on_container_move_assignment = std::true_type;
+		using propagate_on_container_swap = std::true_type;
+		using is_always_equal = std::true_type;
+
+		FreeListAllocator() noexcept = default;
+		FreeListAllocator(const FreeListAllocator&) noexcept;
+		FreeListAllocator(FreeListAllocator&&) noexcept;
+		template <typename U>
+		FreeListAllocator(const FreeListAllocator<U>&) noexcept;
+		FreeListAllocator& operator=(const FreeListAllocator&) noexcept;
+		FreeListAllocator& operator=(FreeListAllocator&&) noexcept;
+		~FreeListAllocator();
+
+		/// <summary>
+		/// Allocates uninitialized storage for count objects. A single object is taken from the free list when it is not empty.
+		/// </summary>
+		/// <param name="count">The number of objects to allocate storage for.</param>
+		/// <returns>Pointer to the storage.</returns>
+		[[nodiscard]] T* allocate(size_type count);
+		/// <summary>
+		/// Returns storage obtained from allocate. A single object is kept in the free list for reuse, anything else goes straight back to the heap.
+		/// </summary>
+		/// <param name="pointer">The storage to return.</param>
+		/// <param name="count">The number of objects it was allocated for.</param>
+		void deallocate(T* pointer, size_type count) noexcept;
+
+		/// <summary>
+		/// Returns every object held in the free list to the heap.
+		/// </summary>
+		void Release() noexcept;
+		/// <summary>
+		/// Returns how many objects are waiting in the free list.
+		/// </summary>
+		[[nodiscard]] size_type CachedCount() const;
+
+		template <typename U>
+		bool operator==(const FreeListAllocator<U>&) const noexcept;
+
+	private:
+		/// <summary>
+		/// The link written over a cached object's storage.
+		/// </summary>
+		struct Block final
+		{
+			Block* next{ nullptr };
+		};
+
+		/// <summary>
+		/// Objects smaller than, or less aligned than, a link are too small to be threaded onto the free list and always go to the heap.
+		/// </summary>
+		static constexpr bool IsRecyclable{ sizeof(T) >= sizeof(Block) && alignof(T) >= alignof(Block) };
+		static constexpr bool IsOverAligned{ alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__ };
+
+		static T* AllocateFromHeap(size_type count);
+		static void DeallocateToHeap(T* pointer, size_type count) noexcept;
+
+		Block* _free{ nullptr };
+		size_type _cachedCount{ 0 };
+	};
+
+	/// <summary>
+	/// The free list is reached only through the allocator's own pointer, so moving the allocator's bytes moves the whole cache with it.
+	/// </summary>
+	template <typename T>
+	struct IsTriviallyRelocatable<FreeListAllocator<T>> : std::true_type
+	{
+	};
+}
+
+#include "FreeListAllocator.inl"
@@ -0,0 +1,130 @@
+#include "FreeListAllocator.h"
+#pragma once
+
+namespace FieaGameEngine
+{
+	template <typename T>
+	inline FreeListAllocator<T>::FreeListAllocator(const FreeListAllocator&) noexcept
+	{
+	}
+
+	template <typename T>
+	inline FreeListAllocator<T>::FreeListAllocator(FreeListAllocator&& other) noexcept :
+		_free{ std::exchange(other._free, nullptr) }, _cachedCount{ std::exchange(other._cachedCount, 0) }
+	{
+	}
+
+	template <typename T>
+	template <typename U>
+	inline FreeListAllocator<T>::FreeListAllocator(const FreeListAllocator<U>&) noexcept
+	{
+	}
+
+	template <typename T>
+	inline FreeListAllocator<T>& FreeListAllocator<T>::operator=(const FreeListAllocator&) noexcept
+	{
+		return *this;
+	}
+
+	template <typename T>
+	inline FreeListAllocator<T>& FreeListAllocator<T>::operator=(FreeListAllocator&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Release();
+			_free = std::exchange(other._free, nullptr);
+			_cachedCount = std::exchange(other._cachedCount, 0);
+		}
+		return *this;
+	}
+
+	template <typename T>
+	inline FreeListAllocator<T>::~FreeListAllocator()
+	{
+		Release();
+	}
+
+	template <typename T>
+	inline T* FreeListAllocator<T>::allocate(size_type count)
+	{
+		if constexpr (IsRecyclable)
+		{
+			if (count == 1 && _free != nullptr)
+			{
+				Block* block{ _free };
+				_free = block->next;
+				--_cachedCount;
+				return reinterpret_cast<T*>(block);
+			}
+		}
+
+		return AllocateFromHeap(count);
+	}
+
+	template <typename T>
+	inline void FreeListAllocator<T>::deallocate(T* pointer, size_type count) noexcept
+	{
+		if constexpr (IsRecyclable)
+		{
+			if (count == 1)
+			{
+				_free = new (pointer) Block{ _free };
+				++_cachedCount;
+				return;
+			}
+		}
+
+		DeallocateToHeap(pointer, count);
+	}
+
+	template <typename T>
+	inline void FreeListAllocator<T>::Release() noexcept
+	{
+		while (_free != nullptr)
+		{
+			Block* block{ _free };
+			_free = block->next;
+			DeallocateToHeap(reinterpret_cast<T*>(block), 1);
+		}
+		_cachedCount = 0;
+	}
+
+	template <typename T>
+	inline typename FreeListAllocator<T>::size_type FreeListAllocator<T>::CachedCount() const
+	{
+		return _cachedCount;
+	}
+
+	template <typename T>
+	template <typename U>
+	inline bool FreeListAllocator<T>::operator==(const FreeListAllocator<U>&) const noexcept
+	{
+		return true;
+	}
+
+	template <typename T>
+	inline T* FreeListAllocator<T>::AllocateFromHeap(size_type count)
+	{
+		if constexpr (IsOverAligned)
+		{
+			return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t{ alignof(T) }));
+		}
+		else
+		{
+			return static_cast<T*>(::operator new(count * sizeof(T)));
+		}
+	}
+
+	template <typename T>
+	inline void FreeListAllocator<T>::DeallocateToHeap(T* pointer, size_type count) noexcept
+	{
+		if constexpr (IsOverAligned)
+		{
+			::operator delete(pointer, count * sizeof(T), std::align_val_t{ alignof(T) });
+		}
+		else
+		{
+			::operator delete(pointer, count * sizeof(T));
+		}
+	}
+}
@@ -66,9 +66,9 @@ namespace FieaGameEngine
 		return reinterpret_cast<GameObject*>(gameObject);
 	}
 
-	Vector<Signature> GameObject::Signatures()
+	SignatureList GameObject::Signatures()
 	{
-		return Vector<Signature>
+		return SignatureList
 		{
 			{ "Name", Datum::DatumTypes::String, 1, offsetof(GameObject, _name) },
 			{ "Position", Datum::DatumTypes::Vector, 1, offsetof(GameObject, _position) },
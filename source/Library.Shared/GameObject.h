@@ -50,7 +50,7 @@ namespace FieaGameEngine
 		bool Equals(const RTTI* rhs) const override;
 		std::string ToString() const override;
 
-		static Vector<Signature> Signatures();
+		static SignatureList Signatures();
 	};
 
 	ConcreteFactory(GameObject, Scope);
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <cstddef>
+#include <cmath>
 #include <stdexcept>
 #include <functional>
+#include <memory>
 #include "DefaultHash.h"
 #include "DefaultEquality.h"
 #include "Vector.h"
@@ -20,7 +22,10 @@ namespace FieaGameEngine
 	{
 	public:
 		using PairType = std::pair<const TKey, TData>;
-		using ChainType = SList<PairType>;
+		/// <summary>
+		/// Chains allocate straight from the heap. A node removed from one chain could only be reused by that same chain, so a free list per chain would mostly hold memory.
+		/// </summary>
+		using ChainType = SList<PairType, std::allocator<PairType>>;
 		using size_type = std::size_t;
 	private:
 		Vector<ChainType> _map{};
@@ -28,6 +33,8 @@ namespace FieaGameEngine
 		std::function<std::size_t(const TKey&)> hashMethod{ DefaultHash<TKey>{} };
 		size_type _size{ 0 };
 		size_type _chainCount{ 11 };
+		float _maxLoadFactor{ 1.0f };
+		bool _transparent{ true };
 	public:
 
 		/// <summary>
@@ -157,28 +164,28 @@ namespace FieaGameEngine
 		};
 
 		/// <summary>
-		/// A constructor for a HashMap that takes the Hash Functor to use when hashing keys.
+		/// A constructor for a HashMap that takes the Hash Functor to use when hashing keys. An empty functor selects DefaultHash.
 		/// </summary>
 		/// <param name="HashMethod"></param>
-		explicit HashMap(std::function<std::size_t(const TKey&)> = DefaultHash<TKey>{});
+		explicit HashMap(std::function<std::size_t(const TKey&)> = {});
 		/// <summary>
 		/// A constructor for a HashMap that takes the Hash Functor to use when hashing keys, and an equality method for comparing keys.
 		/// </summary>
 		/// <param name="EqualityMethod"></param>
 		/// <param name="HashMethod"></param>
-		explicit HashMap(std::function<bool(const TKey&, const TKey&)>, std::function<std::size_t(const TKey&)> = DefaultHash<TKey>{});
+		explicit HashMap(std::function<bool(const TKey&, const TKey&)>, std::function<std::size_t(const TKey&)> = {});
 		/// <summary>
 		/// A constructor for a HashMap that takes the Hash Functor to use when hashing keys, and the amount of chains to make.
 		/// </summary>
 		/// <param name="ChainCount"></param>
 		/// <param name="HashMethod"></param>
-		explicit HashMap(std::size_t, std::function<std::size_t(const TKey&)> = DefaultHash<TKey>{});
+		explicit HashMap(std::size_t, std::function<std::size_t(const TKey&)> = {});
 		/// <summary>
 		/// A constructor for a HashMap that takes the Hash Functor to use when hashing keys, the amount of chains to make, and the equality method to use when comparing keys.
 		/// </summary>
 		/// <param name="ChainCount"></param>
 		/// <param name="HashMethod"></param>
-		explicit HashMap(std::size_t, std::function<bool(const TKey&, const TKey&)>, std::function<std::size_t(const TKey&)> = DefaultHash<TKey>{});
+		explicit HashMap(std::size_t, std::function<bool(const TKey&, const TKey&)>, std::function<std::size_t(const TKey&)> = {});
 		explicit HashMap(std::initializer_list<PairType> pairs);
 		HashMap(const HashMap&) = default;
 		HashMap& operator=(const HashMap&) = default;
@@ -208,18 +215,39 @@ namespace FieaGameEngine
 		/// <returns>TData</returns>
 		TData& At(const TKey&);
 		/// <summary>
+		/// Retrieves the data at a key equal to the given lookup value, such as a string view into a std::string keyed HashMap, without building a TKey.
+		/// </summary>
+		/// <param name="TLookup">key</param>
+		/// <returns>TData</returns>
+		template <typename TLookup> requires TransparentLookup<TKey, TLookup>
+		TData& At(const TLookup&);
+		/// <summary>
 		/// Retrieves the data at a given key by const reference.
 		/// </summary>
 		/// <param name="TKey">other</param>
 		/// <returns>TData</returns>
 		const TData& At(const TKey&) const;
 		/// <summary>
+		/// Retrieves the data at a key equal to the given lookup value by const reference, without building a TKey.
+		/// </summary>
+		/// <param name="TLookup">key</param>
+		/// <returns>TData</returns>
+		template <typename TLookup> requires TransparentLookup<TKey, TLookup>
+		const TData& At(const TLookup&) const;
+		/// <summary>
 		/// Checks whether or not the HashMap already contains a given key.
 		/// </summary>
 		/// <param name="TKey"></param>
 		/// <returns>TData</returns>
 		bool ContainsKey(const TKey&) const;
 		/// <summary>
+		/// Checks whether or not the HashMap contains a key equal to the given lookup value, without building a TKey.
+		/// </summary>
+		/// <param name="TLookup"></param>
+		/// <returns>bool</returns>
+		template <typename TLookup> requires TransparentLookup<TKey, TLookup>
+		bool ContainsKey(const TLookup&) const;
+		/// <summary>
 		/// Clears all items out of the HashMap;
 		/// </summary>
 		void Clear();
@@ -234,6 +262,12 @@ namespace FieaGameEngine
 		/// <param name="Iterator"></typeparam>
 		void Remove(const TKey&);
 		/// <summary>
+		/// Removes the pair whose key is equal to the given lookup value, without building a TKey.
+		/// </summary>
+		/// <param name="TLookup"></typeparam>
+		template <typename TLookup> requires TransparentLookup<TKey, TLookup>
+		void Remove(const TLookup&);
+		/// <summary>
 		/// Returns the size of the HashMap.
 		/// </summary>
 		/// <returns>size</returns>
@@ -279,25 +313,55 @@ namespace FieaGameEngine
 		/// <returns>ConstIterator</returns>
 		ConstIterator Find(const TKey&) const;
 		/// <summary>
+		/// Returns an Iterator that points to the pair whose key is equal to the given lookup value, or end() if there is none.
+		/// When both the hash and equality are the defaults, the lookup value is hashed and compared directly, so a std::string keyed HashMap
+		/// can be searched with a string view or C string without allocating. Otherwise the lookup value is converted to a TKey first.
+		/// </summary>
+		/// <returns>Iterator</returns>
+		template <typename TLookup> requires TransparentLookup<TKey, TLookup>
+		Iterator Find(const TLookup&);
+		/// <summary>
+		/// Returns a ConstIterator that points to the pair whose key is equal to the given lookup value, or end() if there is none.
+		/// </summary>
+		/// <returns>ConstIterator</returns>
+		template <typename TLookup> requires TransparentLookup<TKey, TLookup>
+		ConstIterator Find(const TLookup&) const;
+		/// <summary>
 		/// Returns the a reference to the TData item of the associated pair and creates one if none are found.
 		/// </summary>
 		/// <returns>TData</returns>
 		TData& operator[](const TKey&);
 		/// <summary>
-		/// Resizes the hashmap to have the desired number of chains.
+		/// Resizes the hashmap to have the desired number of chains. Nodes are relinked into their new chains rather than copied, so references to pairs remain valid.
 		/// </summary>
 		/// <param name="size"></param>
 		void Rehash(std::size_t);
 		/// <summary>
+		/// Makes sure the given number of pairs can be held without exceeding the maximum load factor, so inserting them will not trigger a rehash.
+		/// </summary>
+		/// <param name="count"></param>
+		void Reserve(std::size_t);
+		/// <summary>
 		/// Divides the size of the HashMap by the total number of chians to give a rough estimate of total usage. Not completely accurate.
 		/// </summary>
 		/// <returns>float</returns>
 		float GetLoadFactor();
+		/// <summary>
+		/// Returns the load factor that an insertion may not exceed. When it would, the chain count is roughly doubled first. Defaults to 1.
+		/// </summary>
+		/// <returns>float</returns>
+		float max_load_factor() const;
+		/// <summary>
+		/// Sets the load factor that an insertion may not exceed, rehashing right away if the HashMap is already above it.
+		/// </summary>
+		/// <param name="factor">Must be greater than zero.</param>
+		void max_load_factor(float);
 
 	private:
-		bool ContainsKey(const TKey&, std::size_t) const;
-		Iterator Find(const TKey&, std::size_t);
-		ConstIterator Find(const TKey&, std::size_t) const;
+		template <typename TLookup, typename TEquality>
+		Iterator Find(const TLookup&, std::size_t, const TEquality&);
+		template <typename TLookup, typename TEquality>
+		ConstIterator Find(const TLookup&, std::size_t, const TEquality&) const;
 	};
 }
 
@@ -6,7 +6,7 @@ namespace FieaGameEngine
 #pragma region HashMap
 	template <typename TKey, typename TData>
 	HashMap<TKey, TData>::HashMap(std::function<std::size_t(const TKey&)> method) :
-		hashMethod{ method }
+		hashMethod{ method ? method : DefaultHash<TKey>{} }, _transparent{ !method }
 	{
 		_map.Reserve(_chainCount);
 		for (std::size_t position{ 0 }; position != _chainCount; ++position)
@@ -17,7 +17,7 @@ namespace FieaGameEngine
 
 	template <typename TKey, typename TData>
 	HashMap<TKey, TData>::HashMap(std::size_t size, std::function<std::size_t(const TKey&)> method) :
-		_chainCount{ size }, hashMethod{ method }
+		hashMethod{ method ? method : DefaultHash<TKey>{} }, _chainCount{ size }, _transparent{ !method }
 	{
 		_map.Reserve(_chainCount);
 		for (std::size_t position{ 0 }; position != _chainCount; ++position)
@@ -28,7 +28,7 @@ namespace FieaGameEngine
 
 	template <typename TKey, typename TData>
 	HashMap<TKey, TData>::HashMap(std::function<bool(const TKey&, const TKey&)> equalityMethod, std::function<std::size_t(const TKey&)> hash) :
-		equality{ equalityMethod }, hashMethod{ hash }
+		equality{ equalityMethod }, hashMethod{ hash ? std::move(hash) : DefaultHash<TKey>{} }, _transparent{ false }
 	{
 		_map.Reserve(_chainCount);
 		for (std::size_t position{ 0 }; position != _chainCount; ++position)
@@ -39,7 +39,7 @@ namespace FieaGameEngine
 
 	template <typename TKey, typename TData>
 	HashMap<TKey, TData>::HashMap(std::size_t size, std::function<bool(const TKey&, const TKey&)> equalityMethod, std::function<std::size_t(const TKey&)> hash) :
-		_chainCount{ size }, equality{ equalityMethod }, hashMethod{ hash }
+		equality{ equalityMethod }, hashMethod{ hash ? std::move(hash) : DefaultHash<TKey>{} }, _chainCount{ size }, _transparent{ false }
 	{
 		_map.Reserve(_chainCount);
 		for (std::size_t position{ 0 }; position != _chainCount; ++position)
@@ -76,13 +76,17 @@ namespace FieaGameEngine
 	{
 		auto pair{ PairType{std::forward<Args>(args)...} };
 		auto keyHash = hashMethod(pair.first) % _chainCount;
-		auto iterator = Find(pair.first,keyHash);
-		auto first{ pair.first };
+		auto iterator = Find(pair.first, keyHash, equality);
 		if (iterator == end())
 		{
-			_map[keyHash].EmplaceBack(std::move(pair));
+			if (static_cast<float>(_size + 1) > static_cast<float>(_chainCount) * _maxLoadFactor)
+			{
+				Rehash(_chainCount * 2 + 1);
+				keyHash = hashMethod(pair.first) % _chainCount;
+			}
+			auto position{ _map[keyHash].EmplaceBack(std::move(pair)) };
 			++_size;
-			return Find(first, keyHash);
+			return Iterator{ *this, _map.begin() + keyHash, position };
 		}
 		return iterator;
 	}
@@ -94,6 +98,15 @@ namespace FieaGameEngine
 		return (*iterator._chainPosition).second;
 	}
 
+	template<typename TKey, typename TData>
+	template<typename TLookup> requires TransparentLookup<TKey, TLookup>
+	inline TData& HashMap<TKey, TData>::At(const TLookup& key)
+	{
+		Iterator iterator{ Find(key) };
+		assert(iterator != end());
+		return (*iterator._chainPosition).second;
+	}
+
 	template<typename TKey, typename TData>
 	inline const TData& HashMap<TKey, TData>::At(const TKey& key) const
 	{
@@ -103,28 +116,25 @@ namespace FieaGameEngine
 	}
 
 	template<typename TKey, typename TData>
-	inline bool HashMap<TKey, TData>::ContainsKey(const TKey& key) const
+	template<typename TLookup> requires TransparentLookup<TKey, TLookup>
+	inline const TData& HashMap<TKey, TData>::At(const TLookup& key) const
 	{
-		return ContainsKey(key, hashMethod(key) % _chainCount);
+		ConstIterator iterator{ Find(key) };
+		assert(iterator != end());
+		return (*iterator._chainPosition).second;
 	}
 
 	template<typename TKey, typename TData>
-	inline bool HashMap<TKey, TData>::ContainsKey(const TKey& key, std::size_t hash) const
+	inline bool HashMap<TKey, TData>::ContainsKey(const TKey& key) const
 	{
-		bool result{ false };
-		auto& chain{ _map[hash] };
+		return Find(key) != end();
+	}
 
-		if (!(chain.IsEmpty()))
-		{
-			for (auto& value : chain)
-			{
-				if (equality(value.first, key))
-				{
-					result = true;
-				}
-			}
-		}
-		return result;
+	template<typename TKey, typename TData>
+	template<typename TLookup> requires TransparentLookup<TKey, TLookup>
+	inline bool HashMap<TKey, TData>::ContainsKey(const TLookup& key) const
+	{
+		return Find(key) != end();
 	}
 
 	template<typename TKey, typename TData>
@@ -156,6 +166,13 @@ namespace FieaGameEngine
 		Remove(Find(key));
 	}
 
+	template<typename TKey, typename TData>
+	template<typename TLookup> requires TransparentLookup<TKey, TLookup>
+	inline void HashMap<TKey, TData>::Remove(const TLookup& key)
+	{
+		Remove(Find(key));
+	}
+
 	template<typename TKey, typename TData>
 	inline std::size_t HashMap<TKey, TData>::Size() const
 	{
@@ -178,11 +195,23 @@ namespace FieaGameEngine
 	template<typename TKey, typename TData>
 	inline typename HashMap<TKey, TData>::Iterator HashMap<TKey, TData>::Find(const TKey& key)
 	{
-		return Find(key, (hashMethod(key) % _chainCount));
+		return Find(key, (hashMethod(key) % _chainCount), equality);
 	}
 
 	template<typename TKey, typename TData>
-	inline typename HashMap<TKey, TData>::Iterator HashMap<TKey, TData>::Find(const TKey& key, std::size_t hash)
+	template<typename TLookup> requires TransparentLookup<TKey, TLookup>
+	inline typename HashMap<TKey, TData>::Iterator HashMap<TKey, TData>::Find(const TLookup& key)
+	{
+		if (!_transparent)
+		{
+			return Find(TKey{ key });
+		}
+		return Find(key, (DefaultHash<TKey>{}(key) % _chainCount), DefaultEquality<TKey>{});
+	}
+
+	template<typename TKey, typename TData>
+	template<typename TLookup, typename TEquality>
+	inline typename HashMap<TKey, TData>::Iterator HashMap<TKey, TData>::Find(const TLookup& key, std::size_t hash, const TEquality& equal)
 	{
 		auto vecIterator{ _map.begin() + hash };
 		auto pairIterator{ _map[hash].begin() };
@@ -195,7 +224,7 @@ namespace FieaGameEngine
 		{
 			while (pairIterator != (_map[hash]).end())
 			{
-				if (equality((*pairIterator).first, key))
+				if (equal((*pairIterator).first, key))
 				{
 					return Iterator{ *this, vecIterator, pairIterator };
 				}
@@ -208,11 +237,23 @@ namespace FieaGameEngine
 	template<typename TKey, typename TData>
 	inline typename HashMap<TKey, TData>::ConstIterator HashMap<TKey, TData>::Find(const TKey& key) const
 	{
-		return Find(key, (hashMethod(key) % _chainCount));
+		return Find(key, (hashMethod(key) % _chainCount), equality);
+	}
+
+	template<typename TKey, typename TData>
+	template<typename TLookup> requires TransparentLookup<TKey, TLookup>
+	inline typename HashMap<TKey, TData>::ConstIterator HashMap<TKey, TData>::Find(const TLookup& key) const
+	{
+		if (!_transparent)
+		{
+			return Find(TKey{ key });
+		}
+		return Find(key, (DefaultHash<TKey>{}(key) % _chainCount), DefaultEquality<TKey>{});
 	}
 
 	template<typename TKey, typename TData>
-	inline typename HashMap<TKey, TData>::ConstIterator HashMap<TKey, TData>::Find(const TKey& key, std::size_t hash) const
+	template<typename TLookup, typename TEquality>
+	inline typename HashMap<TKey, TData>::ConstIterator HashMap<TKey, TData>::Find(const TLookup& key, std::size_t hash, const TEquality& equal) const
 	{
 		auto vecIterator{ _map.begin() + hash };
 		auto pairIterator{ _map[hash].begin() };
@@ -225,7 +266,7 @@ namespace FieaGameEngine
 		{
 			while (pairIterator != (_map[hash]).end())
 			{
-				if (equality((*pairIterator).first, key))
+				if (equal((*pairIterator).first, key))
 				{
 					return ConstIterator{ *this, vecIterator, pairIterator };
 				}
@@ -273,29 +314,36 @@ namespace FieaGameEngine
 	template<typename TKey, typename TData>
 	inline void HashMap<TKey, TData>::Rehash(std::size_t size)
 	{
-		Vector < std::pair<std::size_t, PairType>> items{};
 		if (size > 1)
 		{
+			Vector<ChainType> map{};
+			map.Reserve(size);
 
-			for (auto& item : *this)
+			for (std::size_t position{ 0 }; position < size; ++position)
 			{
-				items.PushBack(std::pair{ (hashMethod(item.first) % size), item});
+				map.EmplaceBack();
 			}
 
-			_map.Clear();
-			_map.Reserve(size);
-
-			for (std::size_t position{ 0 }; position < size; ++position)
+			for (auto& chain : _map)
 			{
-				_map.EmplaceBack();
+				while (!chain.IsEmpty())
+				{
+					map[hashMethod(chain.Front().first) % size].SpliceFront(chain);
+				}
 			}
 
+			_map = std::move(map);
 			_chainCount = size;
-				
-			for (auto& pair : items)
-			{
-				(_map[pair.first]).PushBack(pair.second);
-			}
+		}
+	}
+
+	template<typename TKey, typename TData>
+	inline void HashMap<TKey, TData>::Reserve(std::size_t count)
+	{
+		auto required{ static_cast<std::size_t>(std::ceil(static_cast<float>(count) / _maxLoadFactor)) };
+		if (required > _chainCount)
+		{
+			Rehash(required);
 		}
 	}
 
@@ -305,6 +353,20 @@ namespace FieaGameEngine
 		return float{ (static_cast<float>(_size) / static_cast<float>(_chainCount)) };
 	}
 
+	template<typename TKey, typename TData>
+	inline float HashMap<TKey, TData>::max_load_factor() const
+	{
+		return _maxLoadFactor;
+	}
+
+	template<typename TKey, typename TData>
+	inline void HashMap<TKey, TData>::max_load_factor(float factor)
+	{
+		assert(factor > 0.0f);
+		_maxLoadFactor = factor;
+		Reserve(_size);
+	}
+
 #pragma endregion
 
 #pragma region Iterator
@@ -367,7 +429,7 @@ namespace FieaGameEngine
 
 			if (_chain == _owner->_map.end())
 			{
-				_chainPosition = ChainType::Iterator();
+				_chainPosition = typename ChainType::Iterator();
 			}
 		}
 		return *this;
@@ -474,7 +536,7 @@ namespace FieaGameEngine
 
 			if (_chain == _owner->_map.end())
 			{
-				_chainPosition = ChainType::ConstIterator();
+				_chainPosition = typename ChainType::ConstIterator();
 			}
 		}
 		return *this;
@@ -8,6 +8,29 @@
 
 namespace FieaGameEngine
 {
+    namespace
+    {
+        /// <summary>
+        /// Views the text of a string value in place, rather than copying it as asString does.
+        /// </summary>
+        std::string_view StringOf(const Json::Value& value)
+        {
+            const char* begin{ nullptr };
+            const char* end{ nullptr };
+            [[maybe_unused]] const bool isString{ value.getString(&begin, &end) };
+            assert(isString);
+            return std::string_view{ begin, static_cast<std::size_t>(end - begin) };
+        }
+
+        /// <summary>
+        /// Whether the value is a string holding the given text, such as the name of the type a vector or matrix is written with.
+        /// </summary>
+        bool Contains(const Json::Value& value, std::string_view text)
+        {
+            return value.isString() && StringOf(value).find(text) != std::string_view::npos;
+        }
+    }
+
     RTTI_DEFINITIONS(JsonTableParseHelper);
 
     RTTI_DEFINITIONS(JsonTableParseHelper::Wrapper);
@@ -68,13 +91,13 @@ namespace FieaGameEngine
         return false;
     }
 
-    void JsonTableParseHelper::HandleIntegers(FieaGameEngine::JsonParseCoordinator::Wrapper& wrapper, const std::string& key, Json::Value& value, bool isArray)
+    template <typename T>
+    void JsonTableParseHelper::Store(Datum& datum, T value)
     {
-        auto& datum = PrimitiveHandler(wrapper, key, isArray, Datum::DatumTypes::Integer);
         if (datum._isExternal)
         {
             Context& currentContext = _contexts.Top();
-            datum.Set(value.asInt(), currentContext._index);
+            datum.Set(value, currentContext._index);
 
             if (currentContext._arraySize != 0)
             {
@@ -83,30 +106,59 @@ namespace FieaGameEngine
         }
         else
         {
-            datum.PushBack(value.asInt());
+            datum.PushBack(value);
         }
     }
 
-    void JsonTableParseHelper::HandleFloats(FieaGameEngine::JsonParseCoordinator::Wrapper& wrapper, const std::string& key, Json::Value& value, bool isArray)
+    void JsonTableParseHelper::HandleIntegers(FieaGameEngine::JsonParseCoordinator::Wrapper& wrapper, const std::string& key, Json::Value& value, bool isArray)
     {
+        // Json does not say how wide a number is, so a datum that already holds a wider type, such as a prescribed attribute, keeps it.
+        auto& datum = PrimitiveHandler(wrapper, key, isArray, Datum::DatumTypes::Integer);
+        switch (datum.Type())
+        {
+        case Datum::DatumTypes::Int64:
+            Store<std::int64_t>(datum, value.asInt64());
+            break;
+        case Datum::DatumTypes::Double:
+            Store(datum, value.asDouble());
+            break;
+        default:
+            Store(datum, value.asInt());
+        }
+    }
 
-        auto& datum = PrimitiveHandler(wrapper, key, isArray, Datum::DatumTypes::Float);
-        if (datum._isExternal)
+    void JsonTableParseHelper::HandleInt64s(FieaGameEngine::JsonParseCoordinator::Wrapper& wrapper, const std::string& key, Json::Value& value, bool isArray)
+    {
+        auto& datum = PrimitiveHandler(wrapper, key, isArray, Datum::DatumTypes::Int64);
+        if (datum.Type() == Datum::DatumTypes::Double)
         {
-            Context& currentContext = _contexts.Top();
-            datum.Set(value.asFloat(), currentContext._index);
+            Store(datum, value.asDouble());
+        }
+        else
+        {
+            Store<std::int64_t>(datum, value.asInt64());
+        }
+    }
 
-            if (currentContext._arraySize != 0)
-            {
-                ++currentContext._index;
-            }
+    void JsonTableParseHelper::HandleFloats(FieaGameEngine::JsonParseCoordinator::Wrapper& wrapper, const std::string& key, Json::Value& value, bool isArray)
+    {
+        auto& datum = PrimitiveHandler(wrapper, key, isArray, Datum::DatumTypes::Float);
+        if (datum.Type() == Datum::DatumTypes::Double)
+        {
+            Store(datum, value.asDouble());
         }
         else
         {
-            datum.PushBack(value.asFloat());
+            Store(datum, value.asFloat());
         }
     }
 
+    void JsonTableParseHelper::HandleBooleans(FieaGameEngine::JsonParseCoordinator::Wrapper& wrapper, const std::string& key, Json::Value& value, bool isArray)
+    {
+        auto& datum = PrimitiveHandler(wrapper, key, isArray, Datum::DatumTypes::Bool);
+        Store(datum, value.asBool());
+    }
+
     void JsonTableParseHelper::HandleStrings(FieaGameEngine::JsonParseCoordinator::Wrapper& wrapper, const std::string& key, Json::Value& value, bool isArray)
     {
         auto& datum = PrimitiveHandler(wrapper, key, isArray, Datum::DatumTypes::String);
@@ -135,30 +187,30 @@ namespace FieaGameEngine
 
     void JsonTableParseHelper::HandleVectors(FieaGameEngine::JsonParseCoordinator::Wrapper& wrapper, const std::string& key, Json::Value& value, bool isArray)
     {
-        Context & currentContext = _contexts.Top();
-        if ((key == "Expression" && currentContext._className == "ActionExpression"))
-        {
-            HandleStrings(wrapper, key, value, isArray);
-            return;
-        }
+        HandleFormatted(wrapper, key, value, isArray, Datum::DatumTypes::Vector);
+    }
 
-        auto& datum = PrimitiveHandler(wrapper, key, isArray, Datum::DatumTypes::Vector);
-        if (datum._isExternal)
-        {
-            datum.SetFromString(value.asString(), currentContext._index);
+    void JsonTableParseHelper::HandleVector2s(FieaGameEngine::JsonParseCoordinator::Wrapper& wrapper, const std::string& key, Json::Value& value, bool isArray)
+    {
+        HandleFormatted(wrapper, key, value, isArray, Datum::DatumTypes::Vector2);
+    }
 
-            if (currentContext._arraySize != 0)
-            {
-                ++currentContext._index;
-            }
-        }
-        else
-        {
-            datum.PushBackFromString(value.asString());
-        }
+    void JsonTableParseHelper::HandleVector3s(FieaGameEngine::JsonParseCoordinator::Wrapper& wrapper, const std::string& key, Json::Value& value, bool isArray)
+    {
+        HandleFormatted(wrapper, key, value, isArray, Datum::DatumTypes::Vector3);
+    }
+
+    void JsonTableParseHelper::HandleQuaternions(FieaGameEngine::JsonParseCoordinator::Wrapper& wrapper, const std::string& key, Json::Value& value, bool isArray)
+    {
+        HandleFormatted(wrapper, key, value, isArray, Datum::DatumTypes::Quaternion);
     }
 
     void JsonTableParseHelper::HandleMatrices(FieaGameEngine::JsonParseCoordinator::Wrapper& wrapper, const std::string& key, Json::Value& value, bool isArray)
+    {
+        HandleFormatted(wrapper, key, value, isArray, Datum::DatumTypes::Matrix);
+    }
+
+    void JsonTableParseHelper::HandleFormatted(FieaGameEngine::JsonParseCoordinator::Wrapper& wrapper, const std::string& key, Json::Value& value, bool isArray, Datum::DatumTypes type)
     {
         Context& currentContext = _contexts.Top();
         if ((key == "Expression" && currentContext._className == "ActionExpression"))
@@ -167,10 +219,10 @@ namespace FieaGameEngine
             return;
         }
 
-        auto& datum = PrimitiveHandler(wrapper, key, isArray, Datum::DatumTypes::Matrix);
+        auto& datum = PrimitiveHandler(wrapper, key, isArray, type);
         if (datum._isExternal)
         {
-            datum.SetFromString(value.asString(), currentContext._index);
+            datum.SetFromString(StringOf(value), currentContext._index);
 
             if (currentContext._arraySize != 0)
             {
@@ -179,7 +231,7 @@ namespace FieaGameEngine
         }
         else
         {
-            datum.PushBackFromString(value.asString());
+            datum.PushBackFromString(StringOf(value));
         }
     }
 
@@ -194,7 +246,14 @@ namespace FieaGameEngine
         }
 
         assert(!_contexts.IsEmpty());
-        return _contexts.Top()._currentScope->Append(key, type);
+        Context& currentContext = _contexts.Top();
+        Datum& datum = currentContext._currentScope->Append(key, type);
+        if (currentContext._replacesValues && !datum._isExternal && datum.Type() != Datum::DatumTypes::Table)
+        {
+            // Appending to an instance of a prefab copies in the prefab's value, which the one given for the instance replaces.
+            datum.Clear();
+        }
+        return datum;
     }
 
     void JsonTableParseHelper::HandleObject(FieaGameEngine::JsonParseCoordinator::Wrapper& wrapper, const std::string& key, [[maybe_unused]] Json::Value& value, [[maybe_unused]] bool isArray)
@@ -214,20 +273,39 @@ namespace FieaGameEngine
 
         Scope* scope{ nullptr };
         std::unique_ptr<Scope> product{ nullptr };
-        std::string variableName{key};
+        std::string_view variableName{ key };
         std::size_t iterator = key.find(" ");
         std::string parsedClassName{ "NA" };
+        bool replacesValues{ false };
         if (iterator != key.npos)
         {
-            std::string className{ key.substr(0, iterator)};
-            variableName = std::string{ key.substr(iterator + 1, key.npos) };
-            product = Factory<Scope>::Create(className);
+            std::string_view className{ variableName.substr(0, iterator) };
+            variableName.remove_prefix(iterator + 1);
+            const Factory<Scope>* factory{ Factory<Scope>::Find(className) };
+            if (factory != nullptr)
+            {
+                product = factory->Create();
+                replacesValues = factory->CreatesFromTemplate();
+            }
             parsedClassName = className;
         }
 
-        if (product == nullptr)
+        const bool isProduct{ product != nullptr };
+        if (!isProduct && !isEmpty && _contexts.Top()._replacesValues)
         {
-            scope = new Scope{};
+            // A table the instance holds or inherits is copied into it and overridden there, rather than gaining a second scope under the same name.
+            Datum* existing{ _contexts.Top()._currentScope->Find(variableName) };
+            if (existing != nullptr && existing->Type() == Datum::DatumTypes::Table && existing->Size() > 0)
+            {
+                _contexts.Push(Context{ existing->GetAsScope(), key, parsedClassName, 0, false, true });
+                return;
+            }
+        }
+
+        if (!isProduct)
+        {
+            // Plain tables are allocated from the memory resource of the scope they are nested in.
+            scope = isEmpty ? new Scope{} : _contexts.Top()._currentScope->NewChild();
         }
         else
         {
@@ -237,20 +315,20 @@ namespace FieaGameEngine
         if (!isEmpty && _contexts.Top()._isInArray)
         {
             _contexts.Top()._currentScope->Adopt(*scope, _contexts.Top()._contextName);
-            _contexts.Push(Context{ scope, key, parsedClassName, 0});
+            _contexts.Push(Context{ scope, key, parsedClassName, 0, false, replacesValues });
             return;
         }
 
         if (_contexts.IsEmpty() && rawWrapper->_scope == nullptr)
         {
             rawWrapper->_scope = std::shared_ptr<Scope>{ scope };
-            _contexts.Push(Context{ rawWrapper->_scope.get(),variableName, parsedClassName, 0 });
+            _contexts.Push(Context{ rawWrapper->_scope.get(), std::string{ variableName }, parsedClassName, 0, false, replacesValues });
         }
         else
         {
             assert(!_contexts.IsEmpty());
             _contexts.Top()._currentScope->Adopt(*scope, variableName);
-            _contexts.Push(Context{ scope, key, parsedClassName, 0 });
+            _contexts.Push(Context{ scope, key, parsedClassName, 0, false, replacesValues });
         }
     }
 
@@ -266,13 +344,30 @@ namespace FieaGameEngine
 
         assert(!_contexts.IsEmpty());
         Scope* currentScope = _contexts.Top()._currentScope;
-        if (value[0].isObject())
+        Datum::DatumTypes type{ Datum::DatumTypes::Unknown };
+        for (std::size_t index{ 0 }; index < _typeChecks.size(); ++index)
         {
-            currentScope->Append(key, Datum::DatumTypes::Table);
+            if ((this->*_typeChecks[index])(value[0]))
+            {
+                type = _elementTypes[index];
+                break;
+            }
         }
-        else
+        if (key == "Expression" && _contexts.Top()._className == "ActionExpression")
+        {
+            type = Datum::DatumTypes::String;
+        }
+
+        // Every element is pushed on its own as it is parsed, so the whole array is reserved up front to fill it with a single allocation.
+        Datum& datum = currentScope->Append(key, type);
+        datum.SetType(type);
+        if (_contexts.Top()._replacesValues && !datum._isExternal && datum.Type() != Datum::DatumTypes::Table)
+        {
+            datum.Clear();
+        }
+        if (!datum._isExternal && datum.Type() != Datum::DatumTypes::Unknown)
         {
-            currentScope->Append(key);
+            datum.Reserve(datum.Size() + value.size());
         }
         _contexts.Push(Context{ currentScope, key, "NA", value.size()});
     }
@@ -287,30 +382,39 @@ namespace FieaGameEngine
         return value.isInt();
     }
 
+    bool JsonTableParseHelper::IsInt64(Json::Value& value)
+    {
+        return value.isInt64() && !value.isInt();
+    }
+
+    bool JsonTableParseHelper::IsBoolean(Json::Value& value)
+    {
+        return value.isBool();
+    }
+
     bool JsonTableParseHelper::IsVector(Json::Value& value)
     {
-        if (value.isString())
-        {
-            std::string string{ value.asString() };
-            if (string.find("vec4") != string.npos)
-            {
-                return true;
-            }
-        }
-        return false;
+        return Contains(value, "vec4");
+    }
+
+    bool JsonTableParseHelper::IsVector2(Json::Value& value)
+    {
+        return Contains(value, "vec2");
+    }
+
+    bool JsonTableParseHelper::IsVector3(Json::Value& value)
+    {
+        return Contains(value, "vec3");
+    }
+
+    bool JsonTableParseHelper::IsQuaternion(Json::Value& value)
+    {
+        return Contains(value, "quat(");
     }
 
     bool JsonTableParseHelper::IsMatrix(Json::Value& value)
     {
-        if (value.isString())
-        {
-            std::string string{ value.asString() };
-            if (string.find("mat4x4") != string.npos)
-            {
-                return true;
-            }
-        }
-        return false;
+        return Contains(value, "mat4x4");
     }
 
     bool JsonTableParseHelper::IsString(Json::Value& value)
@@ -340,8 +444,8 @@ namespace FieaGameEngine
             currentHelper->_contexts.Pop();
         }
     }
-    JsonTableParseHelper::Context::Context(Scope* scope, const std::string& name, const std::string& className, std::size_t arraySize, bool isInArray) :
-        _currentScope{ scope }, _contextName{ name }, _className{ className }, _arraySize { arraySize }, _isInArray{ isInArray }
+    JsonTableParseHelper::Context::Context(Scope* scope, const std::string& name, const std::string& className, std::size_t arraySize, bool isInArray, bool replacesValues) :
+        _currentScope{ scope }, _contextName{ name }, _className{ className }, _arraySize { arraySize }, _isInArray{ isInArray }, _replacesValues{ replacesValues }
     {
     }
 }
\ No newline at end of file
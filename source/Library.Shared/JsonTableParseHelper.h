@@ -65,12 +65,17 @@ namespace FieaGameEngine
 			std::size_t _index{ 0 };
 			bool _isInArray{ false };
 			/// <summary>
+			/// Whether the scope is a prefab instance, or a table nested in one, so that values given for attributes it holds or inherits replace them instead of being appended.
+			/// </summary>
+			bool _replacesValues{ false };
+			/// <summary>
 			/// Primary Constructor for a Context.
 			/// </summary>
 			/// <param name="scope">The scope at this context.</param>
 			/// <param name="name">The name of the context.</param>
 			/// <param name="arraySize">The size of the array, if the object is one.</param>
-			Context(Scope* scope, const std::string& name, const std::string& className, std::size_t arraySize, bool isInArray = false);
+			/// <param name="replacesValues">Whether values replace the ones already held.</param>
+			Context(Scope* scope, const std::string& name, const std::string& className, std::size_t arraySize, bool isInArray = false, bool replacesValues = false);
 		};
 		/// <summary>
 		/// A Stack of Context objects used to contexualize data as it is parsed.
@@ -164,6 +169,62 @@ namespace FieaGameEngine
 		/// <param name="isArray"></param>
 		void HandleMatrices(FieaGameEngine::JsonParseCoordinator::Wrapper& wrapper, const std::string& key, Json::Value& value, bool isArray);
 		/// <summary>
+		/// Attempts to handle the value as an integer too large for an int.
+		/// </summary>
+		/// <param name="wrapper"></param>
+		/// <param name="key"></param>
+		/// <param name="value"></param>
+		/// <param name="isArray"></param>
+		void HandleInt64s(FieaGameEngine::JsonParseCoordinator::Wrapper& wrapper, const std::string& key, Json::Value& value, bool isArray);
+		/// <summary>
+		/// Attempts to handle the value as a bool.
+		/// </summary>
+		/// <param name="wrapper"></param>
+		/// <param name="key"></param>
+		/// <param name="value"></param>
+		/// <param name="isArray"></param>
+		void HandleBooleans(FieaGameEngine::JsonParseCoordinator::Wrapper& wrapper, const std::string& key, Json::Value& value, bool isArray);
+		/// <summary>
+		/// Attempts to handle the value as a vec2.
+		/// </summary>
+		/// <param name="wrapper"></param>
+		/// <param name="key"></param>
+		/// <param name="value"></param>
+		/// <param name="isArray"></param>
+		void HandleVector2s(FieaGameEngine::JsonParseCoordinator::Wrapper& wrapper, const std::string& key, Json::Value& value, bool isArray);
+		/// <summary>
+		/// Attempts to handle the value as a vec3.
+		/// </summary>
+		/// <param name="wrapper"></param>
+		/// <param name="key"></param>
+		/// <param name="value"></param>
+		/// <param name="isArray"></param>
+		void HandleVector3s(FieaGameEngine::JsonParseCoordinator::Wrapper& wrapper, const std::string& key, Json::Value& value, bool isArray);
+		/// <summary>
+		/// Attempts to handle the value as a quaternion.
+		/// </summary>
+		/// <param name="wrapper"></param>
+		/// <param name="key"></param>
+		/// <param name="value"></param>
+		/// <param name="isArray"></param>
+		void HandleQuaternions(FieaGameEngine::JsonParseCoordinator::Wrapper& wrapper, const std::string& key, Json::Value& value, bool isArray);
+		/// <summary>
+		/// Handles a value written as text in the form Datum::ToString writes the given type, such as a vector or matrix.
+		/// </summary>
+		/// <param name="wrapper"></param>
+		/// <param name="key"></param>
+		/// <param name="value"></param>
+		/// <param name="isArray"></param>
+		/// <param name="type">The type the text is parsed as.</param>
+		void HandleFormatted(FieaGameEngine::JsonParseCoordinator::Wrapper& wrapper, const std::string& key, Json::Value& value, bool isArray, Datum::DatumTypes type);
+		/// <summary>
+		/// Writes a parsed value into the datum, at the current index of the context if the datum wraps external storage, otherwise at its end.
+		/// </summary>
+		/// <param name="datum">The datum being populated.</param>
+		/// <param name="value">The value to store, of the type the datum holds.</param>
+		template <typename T>
+		void Store(Datum& datum, T value);
+		/// <summary>
 		/// Performs the neccesary steps for setting up a fresh datum for a given value.
 		/// </summary>
 		/// <param name="wrapper"></param>
@@ -175,11 +236,16 @@ namespace FieaGameEngine
 
 		using HandleFunctor = void(JsonTableParseHelper::*)(FieaGameEngine::JsonParseCoordinator::Wrapper&, const std::string&, Json::Value&, bool);
 
-		inline static const std::array<HandleFunctor, 7> _handleFunctions
+		inline static const std::array<HandleFunctor, 12> _handleFunctions
 		{
 			&JsonTableParseHelper::HandleArray,
 			&JsonTableParseHelper::HandleIntegers,
+			&JsonTableParseHelper::HandleInt64s,
+			&JsonTableParseHelper::HandleBooleans,
 			&JsonTableParseHelper::HandleVectors,
+			&JsonTableParseHelper::HandleVector2s,
+			&JsonTableParseHelper::HandleVector3s,
+			&JsonTableParseHelper::HandleQuaternions,
 			&JsonTableParseHelper::HandleMatrices,
 			&JsonTableParseHelper::HandleStrings,
 			&JsonTableParseHelper::HandleObject,
@@ -188,23 +254,52 @@ namespace FieaGameEngine
 
 		bool IsArray(Json::Value& value);
 		bool IsInteger(Json::Value& value);
+		bool IsInt64(Json::Value& value);
+		bool IsBoolean(Json::Value& value);
 		bool IsFloat(Json::Value& value);
 		bool IsVector(Json::Value& value);
+		bool IsVector2(Json::Value& value);
+		bool IsVector3(Json::Value& value);
+		bool IsQuaternion(Json::Value& value);
 		bool IsMatrix(Json::Value& value);
 		bool IsString(Json::Value& value);
 		bool IsObject(Json::Value& value);
 
 		using TypeCheck = bool(JsonTableParseHelper::*)(Json::Value&);
 
-		inline static const std::array<TypeCheck, 7> _typeChecks
+		inline static const std::array<TypeCheck, 12> _typeChecks
 		{
 			&JsonTableParseHelper::IsArray,
 			&JsonTableParseHelper::IsInteger,
+			&JsonTableParseHelper::IsInt64,
+			&JsonTableParseHelper::IsBoolean,
 			&JsonTableParseHelper::IsVector,
+			&JsonTableParseHelper::IsVector2,
+			&JsonTableParseHelper::IsVector3,
+			&JsonTableParseHelper::IsQuaternion,
 			&JsonTableParseHelper::IsMatrix,
 			&JsonTableParseHelper::IsString,
 			&JsonTableParseHelper::IsObject,
 			&JsonTableParseHelper::IsFloat
 		};
+
+		/// <summary>
+		/// The type of Datum that holds a value accepted by the type check at the same position. Arrays and unrecognized values have no type.
+		/// </summary>
+		inline static const std::array<Datum::DatumTypes, 12> _elementTypes
+		{
+			Datum::DatumTypes::Unknown,
+			Datum::DatumTypes::Integer,
+			Datum::DatumTypes::Int64,
+			Datum::DatumTypes::Bool,
+			Datum::DatumTypes::Vector,
+			Datum::DatumTypes::Vector2,
+			Datum::DatumTypes::Vector3,
+			Datum::DatumTypes::Quaternion,
+			Datum::DatumTypes::Matrix,
+			Datum::DatumTypes::String,
+			Datum::DatumTypes::Table,
+			Datum::DatumTypes::Float
+		};
 	};
 }
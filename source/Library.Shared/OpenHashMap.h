@@ -0,0 +1,410 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <functional>
+#include <initializer_list>
+#include <memory_resource>
+#include "DefaultHash.h"
+#include "DefaultEquality.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// An associative container that uses open addressing instead of chaining. Every slot has a one byte control value that marks it as empty, deleted,
+	/// or full, and full slots also keep seven bits of the key's hash. A lookup walks the contiguous control bytes and only touches a pair when those bits match.
+	/// Pairs are allocated individually so references to them stay valid when the table is rehashed. Pairs and slot arrays come from the global heap unless a memory resource is set.
+	/// </summary>
+	/// <typeparam name="TKey"></typeparam>
+	/// <typeparam name="TData"></typeparam>
+	template <typename TKey, typename TData>
+	class OpenHashMap final
+	{
+	public:
+		using PairType = std::pair<const TKey, TData>;
+		using size_type = std::size_t;
+		using control_type = std::int8_t;
+
+	private:
+		static constexpr control_type Empty{ -128 };
+		static constexpr control_type Deleted{ -2 };
+		static constexpr size_type MinimumCapacity{ 16 };
+
+		control_type* _controls{ nullptr };
+		PairType** _slots{ nullptr };
+		std::function<bool(const TKey&, const TKey&)> equality{ DefaultEquality<TKey>{} };
+		std::function<std::size_t(const TKey&)> hashMethod{ DefaultHash<TKey>{} };
+		size_type _size{ 0 };
+		size_type _tombstones{ 0 };
+		size_type _capacity{ 0 };
+		float _maxLoadFactor{ 0.875f };
+		bool _transparent{ true };
+		std::pmr::memory_resource* _resource{ nullptr };
+
+	public:
+		/// <summary>
+		/// An Iterator used to traverse all elements of a given OpenHashMap. It is a Forward Iterator.
+		/// </summary>
+		struct Iterator final
+		{
+			friend OpenHashMap;
+			friend struct ConstIterator;
+		private:
+			OpenHashMap* _owner{ nullptr };
+			size_type _slot{ 0 };
+
+		public:
+			/// <summary>
+			/// Creates a default Iterator that points to no item in the OpenHashMap.
+			/// </summary>
+			Iterator() = default;
+			/// <summary>
+			/// Creates an Iterator that is owned by the passed OpenHashMap and points to the first full slot.
+			/// </summary>
+			/// <param name="OpenHashMap"></param>
+			Iterator(OpenHashMap&);
+			/// <summary>
+			/// Increments the Iterator to the next full slot in the OpenHashMap.
+			/// </summary>
+			/// <returns>Iterator</returns>
+			Iterator& operator++();
+			/// <summary>
+			/// Increments the Iterator to the next full slot in the OpenHashMap. Returns a copy of the Iterator before incrementing.
+			/// </summary>
+			/// <param name=""></param>
+			/// <returns>Iterator</returns>
+			Iterator operator++(int);
+			/// <summary>
+			/// Compares Iterators by comparing their owner and the slot they point to.
+			/// </summary>
+			/// <param name="other"></param>
+			/// <returns>bool</returns>
+			bool operator!=(const Iterator&) const;
+			/// <summary>
+			/// Compares Iterators by comparing their owner and the slot they point to.
+			/// </summary>
+			/// <param name="other"></param>
+			/// <returns>bool</returns>
+			bool operator==(const Iterator&) const;
+			/// <summary>
+			/// Returns a reference to the PairType pointed to by the Iterator.
+			/// </summary>
+			/// <returns>PairType</returns>
+			PairType& operator*();
+			/// <summary>
+			/// Returns a pointer to the PairType pointed to by the Iterator.
+			/// </summary>
+			/// <returns>PairType</returns>
+			PairType* operator->();
+
+		private:
+			Iterator(OpenHashMap&, size_type);
+		};
+
+		/// <summary>
+		/// A ConstIterator used to traverse all elements of a given OpenHashMap. It is a Forward Iterator.
+		/// </summary>
+		struct ConstIterator final
+		{
+			friend OpenHashMap;
+		private:
+			const OpenHashMap* _owner{ nullptr };
+			size_type _slot{ 0 };
+
+		public:
+			/// <summary>
+			/// Creates a default ConstIterator that points to no item in the OpenHashMap.
+			/// </summary>
+			ConstIterator() = default;
+			/// <summary>
+			/// Creates a ConstIterator that is owned by the passed OpenHashMap and points to the first full slot.
+			/// </summary>
+			/// <param name="OpenHashMap"></param>
+			ConstIterator(const OpenHashMap&);
+			/// <summary>
+			/// Constructs a ConstIterator based off of the provided Iterator.
+			/// </summary>
+			/// <returns>Iterator</returns>
+			ConstIterator(const Iterator&);
+			/// <summary>
+			/// Increments the ConstIterator to the next full slot in the OpenHashMap.
+			/// </summary>
+			/// <returns>ConstIterator</returns>
+			ConstIterator& operator++();
+			/// <summary>
+			/// Increments the ConstIterator to the next full slot in the OpenHashMap. Returns a copy of the ConstIterator before incrementing.
+			/// </summary>
+			/// <param name="">other</param>
+			/// <returns>ConstIterator</returns>
+			ConstIterator operator++(int);
+			/// <summary>
+			/// Compares ConstIterators by comparing their owner and the slot they point to.
+			/// </summary>
+			/// <param name="other"></param>
+			/// <returns>bool</returns>
+			bool operator!=(const ConstIterator&) const;
+			/// <summary>
+			/// Compares ConstIterators by comparing their owner and the slot they point to.
+			/// </summary>
+			/// <param name="other"></param>
+			/// <returns>bool</returns>
+			bool operator==(const ConstIterator&) const;
+			/// <summary>
+			/// Returns a const reference to the PairType pointed to by the ConstIterator.
+			/// </summary>
+			/// <returns>const PairType</returns>
+			const PairType& operator*();
+			/// <summary>
+			/// Returns a const pointer to the PairType pointed to by the ConstIterator.
+			/// </summary>
+			/// <returns>const PairType</returns>
+			const PairType* operator->();
+
+		private:
+			ConstIterator(const OpenHashMap&, size_type);
+		};
+
+		/// <summary>
+		/// A constructor for an OpenHashMap that takes the Hash Functor to use when hashing keys. No slots are allocated until the first insertion.
+		/// </summary>
+		/// <param name="HashMethod"></param>
+		explicit OpenHashMap(std::function<std::size_t(const TKey&)> = {});
+		/// <summary>
+		/// A constructor for an OpenHashMap that takes an equality method for comparing keys and the Hash Functor to use when hashing keys.
+		/// </summary>
+		/// <param name="EqualityMethod"></param>
+		/// <param name="HashMethod"></param>
+		explicit OpenHashMap(std::function<bool(const TKey&, const TKey&)>, std::function<std::size_t(const TKey&)> = {});
+		/// <summary>
+		/// A constructor for an OpenHashMap that takes the amount of slots to make and the Hash Functor to use when hashing keys. The slot count is rounded up to a power of two.
+		/// </summary>
+		/// <param name="SlotCount"></param>
+		/// <param name="HashMethod"></param>
+		explicit OpenHashMap(std::size_t, std::function<std::size_t(const TKey&)> = {});
+		/// <summary>
+		/// A constructor for an OpenHashMap that takes the amount of slots to make, the equality method to use when comparing keys, and the Hash Functor to use when hashing keys.
+		/// </summary>
+		/// <param name="SlotCount"></param>
+		/// <param name="EqualityMethod"></param>
+		/// <param name="HashMethod"></param>
+		explicit OpenHashMap(std::size_t, std::function<bool(const TKey&, const TKey&)>, std::function<std::size_t(const TKey&)> = {});
+		explicit OpenHashMap(std::initializer_list<PairType> pairs);
+		OpenHashMap(const OpenHashMap&);
+		OpenHashMap& operator=(const OpenHashMap&);
+		OpenHashMap(OpenHashMap&&) noexcept;
+		OpenHashMap& operator=(OpenHashMap&&) noexcept;
+		~OpenHashMap();
+		/// <summary>
+		/// Attempts to insert the given pair within the hashmap, if the key has already been used then it returns an iterator pointing to that pair.
+		/// </summary>
+		/// <typeparam name="PairType reference"></typeparam>
+		Iterator Insert(const PairType&);
+		/// <summary>
+		/// Attempts to insert the given pair within the hashmap, if the key has already been used then it returns an iterator pointing to that pair.
+		/// </summary>
+		/// <typeparam name="PairType rvalue"></typeparam>
+		Iterator Insert(PairType&&);
+		/// <summary>
+		/// Takes values to construct a pair and does so in place, then claims a slot for it. Grows the table first if the maximum load factor would be exceeded.
+		/// A key and a value, or a whole pair, are looked up before anything is allocated, so emplacing a key that is already present allocates nothing.
+		/// </summary>
+		/// <param name="Args"></param>
+		template <typename...Args>
+		Iterator Emplace(Args&&...);
+		/// <summary>
+		/// Looks the key up and, only if it is not present, allocates a pair whose data is constructed in place from the remaining arguments.
+		/// If the key is already present, nothing is constructed and the arguments are left untouched.
+		/// </summary>
+		/// <param name="key">The key, or a value a key can be constructed from.</param>
+		/// <param name="args">The arguments to construct the data from.</param>
+		/// <returns>An iterator to the inserted pair, or to the pair already holding the key.</returns>
+		template <typename TKeyArg, typename...Args>
+		Iterator TryEmplace(TKeyArg&& key, Args&&... args);
+		/// <summary>
+		/// Retrieves the data at a given key.
+		/// </summary>
+		/// <param name="TKey">other</param>
+		/// <returns>TData</returns>
+		TData& At(const TKey&);
+		/// <summary>
+		/// Retrieves the data at a key equal to the given lookup value, such as a string view into a std::string keyed OpenHashMap, without building a TKey.
+		/// </summary>
+		/// <param name="TLookup">key</param>
+		/// <returns>TData</returns>
+		template <typename TLookup> requires TransparentLookup<TKey, TLookup>
+		TData& At(const TLookup&);
+		/// <summary>
+		/// Retrieves the data at a given key by const reference.
+		/// </summary>
+		/// <param name="TKey">other</param>
+		/// <returns>TData</returns>
+		const TData& At(const TKey&) const;
+		/// <summary>
+		/// Retrieves the data at a key equal to the given lookup value by const reference, without building a TKey.
+		/// </summary>
+		/// <param name="TLookup">key</param>
+		/// <returns>TData</returns>
+		template <typename TLookup> requires TransparentLookup<TKey, TLookup>
+		const TData& At(const TLookup&) const;
+		/// <summary>
+		/// Checks whether or not the OpenHashMap already contains a given key.
+		/// </summary>
+		/// <param name="TKey"></param>
+		/// <returns>bool</returns>
+		bool ContainsKey(const TKey&) const;
+		/// <summary>
+		/// Checks whether or not the OpenHashMap contains a key equal to the given lookup value, without building a TKey.
+		/// </summary>
+		/// <param name="TLookup"></param>
+		/// <returns>bool</returns>
+		template <typename TLookup> requires TransparentLookup<TKey, TLookup>
+		bool ContainsKey(const TLookup&) const;
+		/// <summary>
+		/// Clears all items out of the OpenHashMap. The slots remain allocated.
+		/// </summary>
+		void Clear();
+		/// <summary>
+		/// Removes the pair at the given Iterator.
+		/// </summary>
+		/// <param name="Iterator"></typeparam>
+		void Remove(Iterator);
+		/// <summary>
+		/// Removes the pair associated with the given key.
+		/// </summary>
+		/// <param name="Iterator"></typeparam>
+		void Remove(const TKey&);
+		/// <summary>
+		/// Removes the pair whose key is equal to the given lookup value, without building a TKey.
+		/// </summary>
+		/// <param name="TLookup"></typeparam>
+		template <typename TLookup> requires TransparentLookup<TKey, TLookup>
+		void Remove(const TLookup&);
+		/// <summary>
+		/// Returns the size of the OpenHashMap.
+		/// </summary>
+		/// <returns>size</returns>
+		std::size_t Size() const;
+		/// <summary>
+		/// Returns an Iterator pointing to the first item held in the OpenHashMap.
+		/// </summary>
+		/// <returns>Iterator</returns>
+		Iterator begin();
+		/// <summary>
+		/// Returns an Iterator pointing to the end of the OpenHashMap.
+		/// </summary>
+		/// <returns>Iterator</returns>
+		Iterator end();
+		/// <summary>
+		/// Returns a ConstIterator pointing to the first item held in the OpenHashMap.
+		/// </summary>
+		/// <returns>ConstIterator</returns>
+		ConstIterator begin() const;
+		/// <summary>
+		/// Returns a ConstIterator pointing to the end of the OpenHashMap.
+		/// </summary>
+		/// <returns>ConstIterator</returns>
+		ConstIterator end() const;
+		/// <summary>
+		/// Returns a ConstIterator pointing to the first item held in the OpenHashMap.
+		/// </summary>
+		/// <returns>ConstIterator</returns>
+		ConstIterator cbegin() const;
+		/// <summary>
+		/// Returns a ConstIterator pointing to the end of the OpenHashMap.
+		/// </summary>
+		/// <returns>ConstIterator</returns>
+		ConstIterator cend() const;
+		/// <summary>
+		/// Returns an Iterator that points to the pair associated with the given key, if no pair is found end() is returned.
+		/// </summary>
+		/// <returns>Iterator</returns>
+		Iterator Find(const TKey&);
+		/// <summary>
+		/// Returns a ConstIterator that points to the pair associated with the given key, if no pair is found end() is returned.
+		/// </summary>
+		/// <returns>ConstIterator</returns>
+		ConstIterator Find(const TKey&) const;
+		/// <summary>
+		/// Returns an Iterator that points to the pair whose key is equal to the given lookup value, or end() if there is none.
+		/// When both the hash and equality are the defaults, the lookup value is hashed and compared directly, so a std::string keyed OpenHashMap
+		/// can be searched with a string view or C string without allocating. Otherwise the lookup value is converted to a TKey first.
+		/// </summary>
+		/// <returns>Iterator</returns>
+		template <typename TLookup> requires TransparentLookup<TKey, TLookup>
+		Iterator Find(const TLookup&);
+		/// <summary>
+		/// Returns a ConstIterator that points to the pair whose key is equal to the given lookup value, or end() if there is none.
+		/// </summary>
+		/// <returns>ConstIterator</returns>
+		template <typename TLookup> requires TransparentLookup<TKey, TLookup>
+		ConstIterator Find(const TLookup&) const;
+		/// <summary>
+		/// Returns the a reference to the TData item of the associated pair and creates one if none are found.
+		/// </summary>
+		/// <returns>TData</returns>
+		TData& operator[](const TKey&);
+		/// <summary>
+		/// Resizes the table to hold at least the desired number of slots, rounded up to a power of two. Never shrinks below what the current size requires.
+		/// Only the pair pointers move, so references to pairs remain valid.
+		/// </summary>
+		/// <param name="size"></param>
+		void Rehash(std::size_t);
+		/// <summary>
+		/// Makes sure the given number of pairs can be held without exceeding the maximum load factor, so inserting them will not trigger a rehash.
+		/// </summary>
+		/// <param name="count"></param>
+		void Reserve(std::size_t);
+		/// <summary>
+		/// Divides the size of the OpenHashMap by the total number of slots.
+		/// </summary>
+		/// <returns>float</returns>
+		float GetLoadFactor();
+		/// <summary>
+		/// Returns the load factor that an insertion may not exceed, counting deleted slots as used. Defaults to 0.875.
+		/// </summary>
+		/// <returns>float</returns>
+		float max_load_factor() const;
+		/// <summary>
+		/// Sets the load factor that an insertion may not exceed, rehashing right away if the OpenHashMap is already above it.
+		/// </summary>
+		/// <param name="factor">Must be greater than zero and less than one, since at least one slot has to stay empty.</param>
+		void max_load_factor(float);
+		/// <summary>
+		/// Sets the memory resource that pairs and slot arrays are allocated from. Only allowed before any slots are allocated. The resource must outlive the OpenHashMap,
+		/// and moves take it along with the pairs, while copies allocate from the global heap.
+		/// </summary>
+		/// <param name="resource">The memory resource, or nullptr for the global heap.</param>
+		void SetResource(std::pmr::memory_resource*);
+		/// <summary>
+		/// Returns the memory resource pairs and slot arrays are allocated from.
+		/// </summary>
+		/// <returns>The memory resource, or nullptr for the global heap.</returns>
+		std::pmr::memory_resource* Resource() const;
+
+	private:
+		static std::size_t Mix(std::size_t hash);
+		static control_type Tag(std::size_t hash);
+		static bool IsFull(control_type control);
+		std::size_t RequiredCapacity(std::size_t count) const;
+		template <typename TLookup, typename TEquality>
+		std::size_t FindSlot(const TLookup&, std::size_t hash, const TEquality&) const;
+		template <typename TLookup>
+		std::size_t FindTransparentSlot(const TLookup&) const;
+		std::size_t FindInsertSlot(std::size_t hash) const;
+		template <typename...Args>
+		Iterator InsertNew(std::size_t hash, Args&&...);
+		void GrowIfNeeded();
+		void Allocate(std::size_t capacity);
+		void Release();
+		template <typename...Args>
+		PairType* NewPair(Args&&...);
+		void DeletePair(PairType*);
+		template <typename T>
+		T* NewArray(std::size_t count);
+		template <typename T>
+		void DeleteArray(T* array, std::size_t count);
+	};
+}
+
+#include "OpenHashMap.inl"
@@ -0,0 +1,733 @@
+#include "OpenHashMap.h"
+#pragma once
+
+namespace FieaGameEngine
+{
+#pragma region OpenHashMap
+	template <typename TKey, typename TData>
+	OpenHashMap<TKey, TData>::OpenHashMap(std::function<std::size_t(const TKey&)> method) :
+		hashMethod{ method ? method : DefaultHash<TKey>{} }, _transparent{ !method }
+	{
+	}
+
+	template <typename TKey, typename TData>
+	OpenHashMap<TKey, TData>::OpenHashMap(std::function<bool(const TKey&, const TKey&)> equalityMethod, std::function<std::size_t(const TKey&)> hash) :
+		equality{ equalityMethod }, hashMethod{ hash ? std::move(hash) : DefaultHash<TKey>{} }, _transparent{ false }
+	{
+	}
+
+	template <typename TKey, typename TData>
+	OpenHashMap<TKey, TData>::OpenHashMap(std::size_t size, std::function<std::size_t(const TKey&)> method) :
+		hashMethod{ method ? method : DefaultHash<TKey>{} }, _transparent{ !method }
+	{
+		Rehash(size);
+	}
+
+	template <typename TKey, typename TData>
+	OpenHashMap<TKey, TData>::OpenHashMap(std::size_t size, std::function<bool(const TKey&, const TKey&)> equalityMethod, std::function<std::size_t(const TKey&)> hash) :
+		equality{ equalityMethod }, hashMethod{ hash ? std::move(hash) : DefaultHash<TKey>{} }, _transparent{ false }
+	{
+		Rehash(size);
+	}
+
+	template<typename TKey, typename TData>
+	inline OpenHashMap<TKey, TData>::OpenHashMap(std::initializer_list<PairType> pairs) :
+		OpenHashMap<TKey, TData>(pairs.size())
+	{
+		for (auto& pair : pairs)
+		{
+			Emplace(pair);
+		}
+	}
+
+	template<typename TKey, typename TData>
+	inline OpenHashMap<TKey, TData>::OpenHashMap(const OpenHashMap& other) :
+		equality{ other.equality }, hashMethod{ other.hashMethod }, _size{ other._size }, _tombstones{ other._tombstones }, _maxLoadFactor{ other._maxLoadFactor }, _transparent{ other._transparent }
+	{
+		if (other._capacity > 0)
+		{
+			Allocate(other._capacity);
+			for (std::size_t slot{ 0 }; slot < _capacity; ++slot)
+			{
+				_controls[slot] = other._controls[slot];
+				if (IsFull(_controls[slot]))
+				{
+					_slots[slot] = NewPair(*other._slots[slot]);
+				}
+			}
+		}
+	}
+
+	template<typename TKey, typename TData>
+	inline OpenHashMap<TKey, TData>& OpenHashMap<TKey, TData>::operator=(const OpenHashMap& other)
+	{
+		if (this != &other)
+		{
+			OpenHashMap copy{ other };
+			*this = std::move(copy);
+		}
+		return *this;
+	}
+
+	template<typename TKey, typename TData>
+	inline OpenHashMap<TKey, TData>::OpenHashMap(OpenHashMap&& other) noexcept :
+		_controls{ other._controls }, _slots{ other._slots }, equality{ std::move(other.equality) }, hashMethod{ std::move(other.hashMethod) },
+		_size{ other._size }, _tombstones{ other._tombstones }, _capacity{ other._capacity }, _maxLoadFactor{ other._maxLoadFactor }, _transparent{ other._transparent },
+		_resource{ other._resource }
+	{
+		other._controls = nullptr;
+		other._slots = nullptr;
+		other._size = 0;
+		other._tombstones = 0;
+		other._capacity = 0;
+	}
+
+	template<typename TKey, typename TData>
+	inline OpenHashMap<TKey, TData>& OpenHashMap<TKey, TData>::operator=(OpenHashMap&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Release();
+			_controls = other._controls;
+			_slots = other._slots;
+			equality = std::move(other.equality);
+			hashMethod = std::move(other.hashMethod);
+			_size = other._size;
+			_tombstones = other._tombstones;
+			_capacity = other._capacity;
+			_maxLoadFactor = other._maxLoadFactor;
+			_transparent = other._transparent;
+			_resource = other._resource;
+
+			other._controls = nullptr;
+			other._slots = nullptr;
+			other._size = 0;
+			other._tombstones = 0;
+			other._capacity = 0;
+		}
+		return *this;
+	}
+
+	template<typename TKey, typename TData>
+	inline OpenHashMap<TKey, TData>::~OpenHashMap()
+	{
+		Release();
+	}
+
+	template<typename TKey, typename TData>
+	inline typename OpenHashMap<TKey, TData>::Iterator OpenHashMap<TKey, TData>::Insert(const PairType& kvPair)
+	{
+		return Emplace(kvPair);
+	}
+
+	template<typename TKey, typename TData>
+	inline typename OpenHashMap<TKey, TData>::Iterator OpenHashMap<TKey, TData>::Insert(PairType&& kvPair)
+	{
+		return Emplace(std::forward<PairType>(kvPair));
+	}
+
+	template<typename TKey, typename TData>
+	template<typename ...Args>
+	inline typename OpenHashMap<TKey, TData>::Iterator OpenHashMap<TKey, TData>::Emplace(Args && ...args)
+	{
+		if constexpr (sizeof...(Args) == 2)
+		{
+			return TryEmplace(std::forward<Args>(args)...);
+		}
+		else if constexpr (sizeof...(Args) == 1 && (std::is_same_v<std::remove_cvref_t<Args>, PairType> && ...))
+		{
+			const PairType& pair{ args... };
+			const std::size_t hash{ Mix(hashMethod(pair.first)) };
+			const std::size_t slot{ FindSlot(pair.first, hash, equality) };
+			if (slot != _capacity)
+			{
+				return Iterator{ *this, slot };
+			}
+			return InsertNew(hash, std::forward<Args>(args)...);
+		}
+		else
+		{
+			PairType pair{ std::forward<Args>(args)... };
+			return Emplace(std::move(pair));
+		}
+	}
+
+	template<typename TKey, typename TData>
+	template<typename TKeyArg, typename ...Args>
+	inline typename OpenHashMap<TKey, TData>::Iterator OpenHashMap<TKey, TData>::TryEmplace(TKeyArg&& key, Args && ...args)
+	{
+		if constexpr (!std::is_same_v<std::remove_cvref_t<TKeyArg>, TKey>)
+		{
+			return TryEmplace(TKey(std::forward<TKeyArg>(key)), std::forward<Args>(args)...);
+		}
+		else
+		{
+			const std::size_t hash{ Mix(hashMethod(key)) };
+			const std::size_t slot{ FindSlot(key, hash, equality) };
+			if (slot != _capacity)
+			{
+				return Iterator{ *this, slot };
+			}
+			return InsertNew(hash, std::piecewise_construct, std::forward_as_tuple(std::forward<TKeyArg>(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+		}
+	}
+
+	template<typename TKey, typename TData>
+	inline TData& OpenHashMap<TKey, TData>::At(const TKey& key)
+	{
+		Iterator iterator{ Find(key) };
+		assert(iterator != end());
+		return iterator->second;
+	}
+
+	template<typename TKey, typename TData>
+	template<typename TLookup> requires TransparentLookup<TKey, TLookup>
+	inline TData& OpenHashMap<TKey, TData>::At(const TLookup& key)
+	{
+		Iterator iterator{ Find(key) };
+		assert(iterator != end());
+		return iterator->second;
+	}
+
+	template<typename TKey, typename TData>
+	inline const TData& OpenHashMap<TKey, TData>::At(const TKey& key) const
+	{
+		ConstIterator iterator{ Find(key) };
+		assert(iterator != end());
+		return iterator->second;
+	}
+
+	template<typename TKey, typename TData>
+	template<typename TLookup> requires TransparentLookup<TKey, TLookup>
+	inline const TData& OpenHashMap<TKey, TData>::At(const TLookup& key) const
+	{
+		ConstIterator iterator{ Find(key) };
+		assert(iterator != end());
+		return iterator->second;
+	}
+
+	template<typename TKey, typename TData>
+	inline bool OpenHashMap<TKey, TData>::ContainsKey(const TKey& key) const
+	{
+		return FindSlot(key, Mix(hashMethod(key)), equality) != _capacity;
+	}
+
+	template<typename TKey, typename TData>
+	template<typename TLookup> requires TransparentLookup<TKey, TLookup>
+	inline bool OpenHashMap<TKey, TData>::ContainsKey(const TLookup& key) const
+	{
+		return FindTransparentSlot(key) != _capacity;
+	}
+
+	template<typename TKey, typename TData>
+	inline void OpenHashMap<TKey, TData>::Clear()
+	{
+		for (std::size_t slot{ 0 }; slot < _capacity; ++slot)
+		{
+			if (IsFull(_controls[slot]))
+			{
+				DeletePair(_slots[slot]);
+			}
+			_controls[slot] = Empty;
+		}
+		_size = 0;
+		_tombstones = 0;
+	}
+
+	template<typename TKey, typename TData>
+	inline void OpenHashMap<TKey, TData>::Remove(Iterator iterator)
+	{
+		if (iterator._owner == this && iterator._slot < _capacity && IsFull(_controls[iterator._slot]))
+		{
+			DeletePair(_slots[iterator._slot]);
+			_slots[iterator._slot] = nullptr;
+
+			// A probe sequence can only pass through this slot if the next one is in use, otherwise it can go straight back to empty.
+			if (_controls[(iterator._slot + 1) & (_capacity - 1)] == Empty)
+			{
+				_controls[iterator._slot] = Empty;
+			}
+			else
+			{
+				_controls[iterator._slot] = Deleted;
+				++_tombstones;
+			}
+			--_size;
+		}
+	}
+
+	template<typename TKey, typename TData>
+	inline void OpenHashMap<TKey, TData>::Remove(const TKey& key)
+	{
+		Remove(Find(key));
+	}
+
+	template<typename TKey, typename TData>
+	template<typename TLookup> requires TransparentLookup<TKey, TLookup>
+	inline void OpenHashMap<TKey, TData>::Remove(const TLookup& key)
+	{
+		Remove(Find(key));
+	}
+
+	template<typename TKey, typename TData>
+	inline std::size_t OpenHashMap<TKey, TData>::Size() const
+	{
+		return _size;
+	}
+
+	template<typename TKey, typename TData>
+	inline TData& OpenHashMap<TKey, TData>::operator[](const TKey& key)
+	{
+		return TryEmplace(key)->second;
+	}
+
+	template<typename TKey, typename TData>
+	inline typename OpenHashMap<TKey, TData>::Iterator OpenHashMap<TKey, TData>::Find(const TKey& key)
+	{
+		return Iterator{ *this, FindSlot(key, Mix(hashMethod(key)), equality) };
+	}
+
+	template<typename TKey, typename TData>
+	inline typename OpenHashMap<TKey, TData>::ConstIterator OpenHashMap<TKey, TData>::Find(const TKey& key) const
+	{
+		return ConstIterator{ *this, FindSlot(key, Mix(hashMethod(key)), equality) };
+	}
+
+	template<typename TKey, typename TData>
+	template<typename TLookup> requires TransparentLookup<TKey, TLookup>
+	inline typename OpenHashMap<TKey, TData>::Iterator OpenHashMap<TKey, TData>::Find(const TLookup& key)
+	{
+		return Iterator{ *this, FindTransparentSlot(key) };
+	}
+
+	template<typename TKey, typename TData>
+	template<typename TLookup> requires TransparentLookup<TKey, TLookup>
+	inline typename OpenHashMap<TKey, TData>::ConstIterator OpenHashMap<TKey, TData>::Find(const TLookup& key) const
+	{
+		return ConstIterator{ *this, FindTransparentSlot(key) };
+	}
+
+	template<typename TKey, typename TData>
+	inline typename OpenHashMap<TKey, TData>::Iterator OpenHashMap<TKey, TData>::begin()
+	{
+		return Iterator{ *this };
+	}
+
+	template<typename TKey, typename TData>
+	inline typename OpenHashMap<TKey, TData>::Iterator OpenHashMap<TKey, TData>::end()
+	{
+		return Iterator{ *this, _capacity };
+	}
+
+	template<typename TKey, typename TData>
+	inline typename OpenHashMap<TKey, TData>::ConstIterator OpenHashMap<TKey, TData>::begin() const
+	{
+		return ConstIterator{ *this };
+	}
+
+	template<typename TKey, typename TData>
+	inline typename OpenHashMap<TKey, TData>::ConstIterator OpenHashMap<TKey, TData>::end() const
+	{
+		return ConstIterator{ *this, _capacity };
+	}
+
+	template<typename TKey, typename TData>
+	inline typename OpenHashMap<TKey, TData>::ConstIterator OpenHashMap<TKey, TData>::cbegin() const
+	{
+		return ConstIterator{ *this };
+	}
+
+	template<typename TKey, typename TData>
+	inline typename OpenHashMap<TKey, TData>::ConstIterator OpenHashMap<TKey, TData>::cend() const
+	{
+		return ConstIterator{ *this, _capacity };
+	}
+
+	template<typename TKey, typename TData>
+	inline void OpenHashMap<TKey, TData>::Rehash(std::size_t size)
+	{
+		std::size_t required{ RequiredCapacity(_size) };
+		std::size_t capacity{ MinimumCapacity };
+		while (capacity < size || capacity < required)
+		{
+			capacity <<= 1;
+		}
+
+		control_type* oldControls{ _controls };
+		PairType** oldSlots{ _slots };
+		std::size_t oldCapacity{ _capacity };
+
+		Allocate(capacity);
+		for (std::size_t slot{ 0 }; slot < oldCapacity; ++slot)
+		{
+			if (IsFull(oldControls[slot]))
+			{
+				std::size_t hash{ Mix(hashMethod(oldSlots[slot]->first)) };
+				std::size_t position{ FindInsertSlot(hash) };
+				_controls[position] = Tag(hash);
+				_slots[position] = oldSlots[slot];
+			}
+		}
+		_tombstones = 0;
+
+		DeleteArray(oldControls, oldCapacity);
+		DeleteArray(oldSlots, oldCapacity);
+	}
+
+	template<typename TKey, typename TData>
+	inline void OpenHashMap<TKey, TData>::Reserve(std::size_t count)
+	{
+		if (RequiredCapacity(count) > _capacity)
+		{
+			Rehash(RequiredCapacity(count));
+		}
+	}
+
+	template<typename TKey, typename TData>
+	inline float OpenHashMap<TKey, TData>::GetLoadFactor()
+	{
+		return _capacity == 0 ? 0.0f : float{ (static_cast<float>(_size) / static_cast<float>(_capacity)) };
+	}
+
+	template<typename TKey, typename TData>
+	inline float OpenHashMap<TKey, TData>::max_load_factor() const
+	{
+		return _maxLoadFactor;
+	}
+
+	template<typename TKey, typename TData>
+	inline void OpenHashMap<TKey, TData>::max_load_factor(float factor)
+	{
+		assert(factor > 0.0f && factor < 1.0f);
+		_maxLoadFactor = factor;
+		if (_capacity > 0)
+		{
+			Reserve(_size + _tombstones);
+		}
+	}
+
+	template<typename TKey, typename TData>
+	inline void OpenHashMap<TKey, TData>::SetResource(std::pmr::memory_resource* resource)
+	{
+		assert(_capacity == 0);
+		_resource = resource;
+	}
+
+	template<typename TKey, typename TData>
+	inline std::pmr::memory_resource* OpenHashMap<TKey, TData>::Resource() const
+	{
+		return _resource;
+	}
+
+	template<typename TKey, typename TData>
+	inline std::size_t OpenHashMap<TKey, TData>::Mix(std::size_t hash)
+	{
+		std::uint64_t mixed{ static_cast<std::uint64_t>(hash) * 0x9E3779B97F4A7C15ull };
+		return static_cast<std::size_t>(mixed ^ (mixed >> 32));
+	}
+
+	template<typename TKey, typename TData>
+	inline typename OpenHashMap<TKey, TData>::control_type OpenHashMap<TKey, TData>::Tag(std::size_t hash)
+	{
+		return static_cast<control_type>(hash & 0x7F);
+	}
+
+	template<typename TKey, typename TData>
+	inline bool OpenHashMap<TKey, TData>::IsFull(control_type control)
+	{
+		return control >= 0;
+	}
+
+	template<typename TKey, typename TData>
+	inline std::size_t OpenHashMap<TKey, TData>::RequiredCapacity(std::size_t count) const
+	{
+		return static_cast<std::size_t>(static_cast<float>(count) / _maxLoadFactor) + 1;
+	}
+
+	template<typename TKey, typename TData>
+	template<typename TLookup, typename TEquality>
+	inline std::size_t OpenHashMap<TKey, TData>::FindSlot(const TLookup& key, std::size_t hash, const TEquality& equal) const
+	{
+		if (_size == 0)
+		{
+			return _capacity;
+		}
+
+		const std::size_t mask{ _capacity - 1 };
+		const control_type tag{ Tag(hash) };
+		std::size_t slot{ (hash >> 7) & mask };
+		while (_controls[slot] != Empty)
+		{
+			if (_controls[slot] == tag && equal(_slots[slot]->first, key))
+			{
+				return slot;
+			}
+			slot = (slot + 1) & mask;
+		}
+		return _capacity;
+	}
+
+	template<typename TKey, typename TData>
+	template<typename TLookup>
+	inline std::size_t OpenHashMap<TKey, TData>::FindTransparentSlot(const TLookup& key) const
+	{
+		if (!_transparent)
+		{
+			TKey converted{ key };
+			return FindSlot(converted, Mix(hashMethod(converted)), equality);
+		}
+		return FindSlot(key, Mix(DefaultHash<TKey>{}(key)), DefaultEquality<TKey>{});
+	}
+
+	template<typename TKey, typename TData>
+	inline std::size_t OpenHashMap<TKey, TData>::FindInsertSlot(std::size_t hash) const
+	{
+		const std::size_t mask{ _capacity - 1 };
+		std::size_t slot{ (hash >> 7) & mask };
+		while (IsFull(_controls[slot]))
+		{
+			slot = (slot + 1) & mask;
+		}
+		return slot;
+	}
+
+	template<typename TKey, typename TData>
+	template<typename ...Args>
+	inline typename OpenHashMap<TKey, TData>::Iterator OpenHashMap<TKey, TData>::InsertNew(std::size_t hash, Args && ...args)
+	{
+		GrowIfNeeded();
+		const std::size_t slot{ FindInsertSlot(hash) };
+		if (_controls[slot] == Deleted)
+		{
+			--_tombstones;
+		}
+		_controls[slot] = Tag(hash);
+		_slots[slot] = NewPair(std::forward<Args>(args)...);
+		++_size;
+		return Iterator{ *this, slot };
+	}
+
+	template<typename TKey, typename TData>
+	inline void OpenHashMap<TKey, TData>::GrowIfNeeded()
+	{
+		if (RequiredCapacity(_size + _tombstones + 1) > _capacity)
+		{
+			// When tombstones are the reason the table is full, rebuilding at the same capacity is enough.
+			Rehash(RequiredCapacity(_size + 1) * 2 > _capacity ? _capacity * 2 : _capacity);
+		}
+	}
+
+	template<typename TKey, typename TData>
+	inline void OpenHashMap<TKey, TData>::Allocate(std::size_t capacity)
+	{
+		_controls = NewArray<control_type>(capacity);
+		_slots = NewArray<PairType*>(capacity);
+		_capacity = capacity;
+		for (std::size_t slot{ 0 }; slot < _capacity; ++slot)
+		{
+			_controls[slot] = Empty;
+		}
+	}
+
+	template<typename TKey, typename TData>
+	inline void OpenHashMap<TKey, TData>::Release()
+	{
+		Clear();
+		DeleteArray(_controls, _capacity);
+		DeleteArray(_slots, _capacity);
+		_controls = nullptr;
+		_slots = nullptr;
+		_capacity = 0;
+	}
+
+	template<typename TKey, typename TData>
+	template<typename ...Args>
+	inline typename OpenHashMap<TKey, TData>::PairType* OpenHashMap<TKey, TData>::NewPair(Args && ...args)
+	{
+		if (_resource == nullptr)
+		{
+			return new PairType{ std::forward<Args>(args)... };
+		}
+		void* memory{ _resource->allocate(sizeof(PairType), alignof(PairType)) };
+		return new (memory) PairType{ std::forward<Args>(args)... };
+	}
+
+	template<typename TKey, typename TData>
+	inline void OpenHashMap<TKey, TData>::DeletePair(PairType* pair)
+	{
+		if (_resource == nullptr)
+		{
+			delete pair;
+			return;
+		}
+		pair->~PairType();
+		_resource->deallocate(pair, sizeof(PairType), alignof(PairType));
+	}
+
+	template<typename TKey, typename TData>
+	template<typename T>
+	inline T* OpenHashMap<TKey, TData>::NewArray(std::size_t count)
+	{
+		if (_resource == nullptr)
+		{
+			return new T[count];
+		}
+		return static_cast<T*>(_resource->allocate(count * sizeof(T), alignof(T)));
+	}
+
+	template<typename TKey, typename TData>
+	template<typename T>
+	inline void OpenHashMap<TKey, TData>::DeleteArray(T* array, std::size_t count)
+	{
+		if (_resource == nullptr)
+		{
+			delete[] array;
+		}
+		else if (array != nullptr)
+		{
+			_resource->deallocate(array, count * sizeof(T), alignof(T));
+		}
+	}
+
+#pragma endregion
+
+#pragma region Iterator
+
+	template <typename TKey, typename TData>
+	inline OpenHashMap<TKey, TData>::Iterator::Iterator(OpenHashMap& owner) :
+		_owner{ &owner }
+	{
+		while (_slot < _owner->_capacity && !IsFull(_owner->_controls[_slot]))
+		{
+			++_slot;
+		}
+	}
+
+	template <typename TKey, typename TData>
+	inline OpenHashMap<TKey, TData>::Iterator::Iterator(OpenHashMap& owner, size_type slot) :
+		_owner{ &owner }, _slot{ slot }
+	{
+	}
+
+	template <typename TKey, typename TData>
+	inline typename OpenHashMap<TKey, TData>::Iterator& OpenHashMap<TKey, TData>::Iterator::operator++()
+	{
+		if (_owner != nullptr && _slot < _owner->_capacity)
+		{
+			do
+			{
+				++_slot;
+			} while (_slot < _owner->_capacity && !IsFull(_owner->_controls[_slot]));
+		}
+		return *this;
+	}
+
+	template <typename TKey, typename TData>
+	inline typename OpenHashMap<TKey, TData>::Iterator OpenHashMap<TKey, TData>::Iterator::operator++(int)
+	{
+		Iterator iterator{ *this };
+		operator++();
+		return iterator;
+	}
+
+	template <typename TKey, typename TData>
+	inline bool OpenHashMap<TKey, TData>::Iterator::operator!=(const Iterator& other) const
+	{
+		return _owner != other._owner || _slot != other._slot;
+	}
+
+	template <typename TKey, typename TData>
+	inline bool OpenHashMap<TKey, TData>::Iterator::operator==(const Iterator& other) const
+	{
+		return !(*this != other);
+	}
+
+	template<typename TKey, typename TData>
+	inline typename OpenHashMap<TKey, TData>::PairType& OpenHashMap<TKey, TData>::Iterator::operator*()
+	{
+		assert(_owner != nullptr && _slot < _owner->_capacity);
+		return *_owner->_slots[_slot];
+	}
+
+	template<typename TKey, typename TData>
+	inline typename OpenHashMap<TKey, TData>::PairType* OpenHashMap<TKey, TData>::Iterator::operator->()
+	{
+		assert(_owner != nullptr && _slot < _owner->_capacity);
+		return _owner->_slots[_slot];
+	}
+
+#pragma endregion
+
+#pragma region ConstIterator
+
+	template <typename TKey, typename TData>
+	inline OpenHashMap<TKey, TData>::ConstIterator::ConstIterator(const OpenHashMap& owner) :
+		_owner{ &owner }
+	{
+		while (_slot < _owner->_capacity && !IsFull(_owner->_controls[_slot]))
+		{
+			++_slot;
+		}
+	}
+
+	template <typename TKey, typename TData>
+	inline OpenHashMap<TKey, TData>::ConstIterator::ConstIterator(const OpenHashMap& owner, size_type slot) :
+		_owner{ &owner }, _slot{ slot }
+	{
+	}
+
+	template <typename TKey, typename TData>
+	inline OpenHashMap<TKey, TData>::ConstIterator::ConstIterator(const Iterator& other) :
+		_owner{ other._owner }, _slot{ other._slot }
+	{
+	}
+
+	template <typename TKey, typename TData>
+	inline typename OpenHashMap<TKey, TData>::ConstIterator& OpenHashMap<TKey, TData>::ConstIterator::operator++()
+	{
+		if (_owner != nullptr && _slot < _owner->_capacity)
+		{
+			do
+			{
+				++_slot;
+			} while (_slot < _owner->_capacity && !IsFull(_owner->_controls[_slot]));
+		}
+		return *this;
+	}
+
+	template <typename TKey, typename TData>
+	inline typename OpenHashMap<TKey, TData>::ConstIterator OpenHashMap<TKey, TData>::ConstIterator::operator++(int)
+	{
+		ConstIterator iterator{ *this };
+		operator++();
+		return iterator;
+	}
+
+	template <typename TKey, typename TData>
+	inline bool OpenHashMap<TKey, TData>::ConstIterator::operator!=(const ConstIterator& other) const
+	{
+		return _owner != other._owner || _slot != other._slot;
+	}
+
+	template <typename TKey, typename TData>
+	inline bool OpenHashMap<TKey, TData>::ConstIterator::operator==(const ConstIterator& other) const
+	{
+		return !(*this != other);
+	}
+
+	template<typename TKey, typename TData>
+	inline const typename OpenHashMap<TKey, TData>::PairType& OpenHashMap<TKey, TData>::ConstIterator::operator*()
+	{
+		assert(_owner != nullptr && _slot < _owner->_capacity);
+		return *_owner->_slots[_slot];
+	}
+
+	template<typename TKey, typename TData>
+	inline const typename OpenHashMap<TKey, TData>::PairType* OpenHashMap<TKey, TData>::ConstIterator::operator->()
+	{
+		assert(_owner != nullptr && _slot < _owner->_capacity);
+		return _owner->_slots[_slot];
+	}
+
+#pragma endregion
+}
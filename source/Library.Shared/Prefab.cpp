@@ -0,0 +1,36 @@
+#include "pch.h"
+#include "Prefab.h"
+
+namespace FieaGameEngine
+{
+	Prefab::Prefab(std::string name, std::unique_ptr<Scope> prototype) :
+		_name{ std::move(name) }, _prototype{ std::move(prototype) }, _shell{ _prototype != nullptr ? _prototype->Clone() : nullptr }
+	{
+		assert(_prototype != nullptr);
+		assert(_prototype->GetParent() == nullptr);
+		_prototype->SetCopyOnWrite(true);
+		_shell->Clear();
+	}
+
+	std::unique_ptr<Scope> Prefab::Create() const
+	{
+		std::unique_ptr<Scope> instance{ _shell->Clone() };
+		instance->SetPrototype(*_prototype);
+		return instance;
+	}
+
+	const std::string& Prefab::ClassName() const
+	{
+		return _name;
+	}
+
+	bool Prefab::CreatesFromTemplate() const
+	{
+		return true;
+	}
+
+	const Scope& Prefab::Prototype() const
+	{
+		return *_prototype;
+	}
+}
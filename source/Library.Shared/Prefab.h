@@ -0,0 +1,63 @@
+#pragma once
+#include <memory>
+#include <string>
+#include "Factory.h"
+#include "Scope.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// A scope registered under a name as a template, along with the factory that stamps out instances of it. Once handed to a Prefab the template is never written to again.
+	/// An instance is an object of the template's class whose prototype is the template, so it stores only what it writes: its prescribed attributes, which wrap its own
+	/// members, clones of the scopes in its prescribed tables, such as its Actions, which search upward from it, and any entry it has written. Everything else is
+	/// read from the template, and an entry copied into the instance on its first write shares the template's heap payloads until it is written to itself.
+	/// Added to Factory&lt;Scope&gt;, a prefab is created by name like any other class, including from Json. There the values given for an instance replace the template's,
+	/// and a plain nested object naming a table the template holds is applied to the instance's copy of the first scope in that table the same way. Arrays of objects,
+	/// and objects created by class name, are added alongside the ones from the template.
+	/// </summary>
+	class Prefab final : public Factory<Scope>
+	{
+	public:
+		/// <summary>
+		/// Takes ownership of a template and turns on copy-on-write for every Datum in it and in the scopes nested in it. The template must outlive every instance.
+		/// </summary>
+		/// <param name="name">The name instances are created by.</param>
+		/// <param name="prototype">The template, which must not have a parent.</param>
+		Prefab(std::string name, std::unique_ptr<Scope> prototype);
+		Prefab(const Prefab&) = delete;
+		Prefab(Prefab&&) = delete;
+		Prefab& operator=(const Prefab&) = delete;
+		Prefab& operator=(Prefab&&) = delete;
+		~Prefab() = default;
+
+		/// <summary>
+		/// Creates an instance of the template, holding only its prescribed attributes and the clones of the scopes in its prescribed tables.
+		/// </summary>
+		/// <returns>A unique_ptr to the new instance.</returns>
+		std::unique_ptr<Scope> Create() const override;
+		/// <summary>
+		/// Returns the name instances are created by.
+		/// </summary>
+		/// <returns>The name of the prefab.</returns>
+		const std::string& ClassName() const override;
+		/// <summary>
+		/// Instances start out with the template's values, so values parsed for one replace them.
+		/// </summary>
+		/// <returns>True.</returns>
+		bool CreatesFromTemplate() const override;
+		/// <summary>
+		/// Returns the template instances read from.
+		/// </summary>
+		/// <returns>A const reference to the template.</returns>
+		[[nodiscard]] const Scope& Prototype() const;
+
+	private:
+		const std::string _name;
+		const std::unique_ptr<Scope> _prototype;
+		/// <summary>
+		/// The template cleared of everything an instance inherits, leaving an object of its class with the template's member values and, if it is Attributed,
+		/// its prescribed attributes with empty tables. Every instance is a copy of it.
+		/// </summary>
+		const std::unique_ptr<Scope> _shell;
+	};
+}
@@ -9,7 +9,7 @@ namespace FieaGameEngine
 	{
 		if (_subtype == message.SubType())
 		{
-			Datum& actions = _orderVector.At(2)->second;
+			Datum& actions = PairAt(2).second;
 			for (std::size_t index{ 0 }; index < actions.Size(); ++index)
 			{
 				Scope* scope = actions.GetAsScope(index);
@@ -24,34 +24,17 @@ namespace FieaGameEngine
 						switch (variable.Type())
 						{
 						case Datum::DatumTypes::Integer:
-							for (std::size_t position{ 0 }; position < variable.Size(); ++position)
-							{
-								variable.Set(payload->GetAsInt(position), position);
-							}
-							break;
 						case Datum::DatumTypes::Float:
-							for (std::size_t position{ 0 }; position < variable.Size(); ++position)
-							{
-								variable.Set(payload->GetAsFloat(position), position);
-							}
-							break;
 						case Datum::DatumTypes::String:
-							for (std::size_t position{ 0 }; position < variable.Size(); ++position)
-							{
-								variable.Set(payload->GetAsString(position), position);
-							}
-							break;
 						case Datum::DatumTypes::Vector:
-							for (std::size_t position{ 0 }; position < variable.Size(); ++position)
-							{
-								variable.Set(payload->GetAsVector(position), position);
-							}
-							break;
 						case Datum::DatumTypes::Matrix:
-							for (std::size_t position{ 0 }; position < variable.Size(); ++position)
-							{
-								variable.Set(payload->GetAsMatrix(position), position);
-							}
+						case Datum::DatumTypes::Int64:
+						case Datum::DatumTypes::Double:
+						case Datum::DatumTypes::Bool:
+						case Datum::DatumTypes::Vector2:
+						case Datum::DatumTypes::Vector3:
+						case Datum::DatumTypes::Quaternion:
+							payload->CopyTo(variable);
 							break;
 						case Datum::DatumTypes::Table:
 							variable = *payload;
@@ -70,14 +53,25 @@ namespace FieaGameEngine
 		Event<EventMessageAttributed>::Subscribe(_subscriber);
 	}
 
+	ReactionAttributed::ReactionAttributed(const ReactionAttributed& other) :
+		Reaction(other), _subtype{ other._subtype }
+	{
+		Event<EventMessageAttributed>::Subscribe(_subscriber);
+	}
+
+	gsl::owner<ReactionAttributed*> ReactionAttributed::Clone() const
+	{
+		return new ReactionAttributed(*this);
+	}
+
 	ReactionAttributed::~ReactionAttributed()
 	{
 		Event<EventMessageAttributed>::Unsubscribe(_subscriber);
 	}
 
-	Vector<Signature> ReactionAttributed::Signatures()
+	SignatureList ReactionAttributed::Signatures()
 	{
-		Vector<Signature> signatures
+		SignatureList signatures
 		{
 			Signature{ "SubType", Datum::DatumTypes::String, 1, offsetof(ReactionAttributed, _subtype) }
 		};
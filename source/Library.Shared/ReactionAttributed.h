@@ -23,12 +23,22 @@ namespace FieaGameEngine
 		/// Public constructor that calls Reactions constructor.
 		/// </summary>
 		ReactionAttributed();
+		/// <summary>
+		/// Copies the reaction and subscribes the copy to the same events.
+		/// </summary>
+		/// <param name="other">The reaction to copy.</param>
+		ReactionAttributed(const ReactionAttributed& other);
 		virtual ~ReactionAttributed();
 		/// <summary>
+		/// Creates a copy of the reaction on the heap, subscribed to the same events.
+		/// </summary>
+		/// <returns>A pointer to the newly allocated copy.</returns>
+		gsl::owner<ReactionAttributed*> Clone() const override;
+		/// <summary>
 		/// Returns the Signature of prescribed attributes of the class.
 		/// </summary>
 		/// <returns>A Vector of Signatures describing the prescribed attributes.</returns>
-		static Vector<Signature> Signatures();
+		static SignatureList Signatures();
 	};
 
 	ConcreteFactory(ReactionAttributed, Scope);
@@ -1,7 +1,11 @@
 #pragma once
 
+#include <cassert>
 #include <cstddef>
+#include <memory>
 #include <stdexcept>
+#include "FreeListAllocator.h"
+#include "TriviallyRelocatable.h"
 
 
 namespace FieaGameEngine
@@ -10,7 +14,9 @@ namespace FieaGameEngine
 	/// A singly-linked list that stores items of type T.
 	/// </summary>
 	/// <typeparam name="T"></typeparam>
-	template <typename T>
+	/// <typeparam name="TAllocator">The standard allocator nodes are allocated from, rebound to the node type. The default keeps removed nodes in a free list owned by the list
+	/// and reuses them for later insertions, so a list that grows and shrinks around a steady size stops allocating.</typeparam>
+	template <typename T, typename TAllocator = FreeListAllocator<T>>
 	class SList final
 	{
 
@@ -32,14 +38,21 @@ namespace FieaGameEngine
 			Node* next{nullptr};
 
 			Node() = delete;
-			explicit Node(const_reference, Node* = nullptr);
-			explicit Node(rvalue_reference, Node* = nullptr);
+			template <typename...Args>
+			explicit Node(Node*, Args&&...);
 		};
 
+		using NodeAllocator = typename std::allocator_traits<TAllocator>::template rebind_alloc<Node>;
+		using NodeTraits = std::allocator_traits<NodeAllocator>;
 
 		Node* _front{ nullptr };
 		Node* _back{ nullptr };
 		size_t _size{ 0 };
+		NodeAllocator _allocator{};
+
+		template <typename...Args>
+		Node* CreateNode(Node*, Args&&...);
+		void DestroyNode(Node*) noexcept;
 
 	public:
 		/// <summary>
@@ -159,7 +172,14 @@ namespace FieaGameEngine
 
 	public:
 
+		using allocator_type = TAllocator;
+
 		explicit SList() = default;
+		/// <summary>
+		/// Constructs an empty list whose nodes come from a copy of the given allocator.
+		/// </summary>
+		/// <param name="allocator">The allocator to copy.</param>
+		explicit SList(const allocator_type&);
 		explicit SList(std::initializer_list<value_type>);
 		explicit SList(const SList&);
 		explicit SList(SList&&) noexcept;
@@ -192,14 +212,28 @@ namespace FieaGameEngine
 		/// </summary>
 		void PopFront();
 		/// <summary>
+		/// Unlinks the node at the front of the other list and links it to the front of this list. The item is neither copied nor moved, so references to it stay valid.
+		/// The two lists must use allocators that compare equal, since this list will eventually free the node.
+		/// </summary>
+		/// <param name="SList& other"> The list to take the front node from. Nothing happens if it is empty.</param>
+		void SpliceFront(SList&);
+		/// <summary>
 		/// Removes the item located at the back of the list.
 		/// </summary>
 		void PopBack();
 		/// <summary>
-		/// Removes all elements from the list and frees all memory that has been allocated by the list.
+		/// Removes all elements from the list and returns their nodes to the allocator, which may keep them for reuse. See ShrinkToFit.
 		/// </summary>
 		void Clear();
 		/// <summary>
+		/// Asks the allocator to return any nodes it is keeping for reuse to the heap, if it keeps any.
+		/// </summary>
+		void ShrinkToFit();
+		/// <summary>
+		/// Returns a copy of the allocator the list was constructed with, rebound to the item type.
+		/// </summary>
+		[[nodiscard]] allocator_type GetAllocator() const;
+		/// <summary>
 		/// Finds a given item in the list and removes it.
 		/// </summary>
 		/// <param name="const T& itemToRemove"> item that will be removed if found in list.</param>
@@ -276,6 +310,14 @@ namespace FieaGameEngine
 		/// <returns> Returns SList::ConstIterator pointing to the given item. </returns>
 		[[nodiscard]] ConstIterator Find(const_reference) const;
 	};
+
+	/// <summary>
+	/// Nodes never point back at the list that owns them, so an SList can be relocated whatever it contains, as long as its allocator can.
+	/// </summary>
+	template <typename T, typename TAllocator>
+	struct IsTriviallyRelocatable<SList<T, TAllocator>> : IsTriviallyRelocatable<TAllocator>
+	{
+	};
 }
 
 #include "SList.inl" 
\ No newline at end of file
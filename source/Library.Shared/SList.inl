@@ -3,30 +3,30 @@
 namespace FieaGameEngine
 {
 #pragma region Iterator
-	template <typename value_type>
-	SList<value_type>::Iterator::Iterator(const SList& other, Node* node) :
+	template <typename value_type, typename TAllocator>
+	SList<value_type, TAllocator>::Iterator::Iterator(const SList& other, Node* node) :
 		_owner{ &other }, _currentNode{ node }
 	{
 
 	}
 
-	template <typename value_type>
-	inline typename SList<value_type>::Iterator& SList<value_type>::Iterator::operator++()
+	template <typename value_type, typename TAllocator>
+	inline typename SList<value_type, TAllocator>::Iterator& SList<value_type, TAllocator>::Iterator::operator++()
 	{
 		_currentNode != nullptr ? _currentNode = _currentNode->next :_currentNode;
 		return *this;
 	}
 
-	template <typename value_type>
-	inline typename SList<value_type>::Iterator SList<value_type>::Iterator::operator++(int)
+	template <typename value_type, typename TAllocator>
+	inline typename SList<value_type, TAllocator>::Iterator SList<value_type, TAllocator>::Iterator::operator++(int)
 	{
 		Iterator iterator{ *this };
 		operator++();
 		return iterator;
 	}
 
-	template<typename value_type>
-	inline bool SList<value_type>::Iterator::operator!=(const Iterator& other) const
+	template <typename value_type, typename TAllocator>
+	inline bool SList<value_type, TAllocator>::Iterator::operator!=(const Iterator& other) const
 	{
 		if ((_currentNode == other._currentNode) && (_owner == other._owner))
 		{
@@ -36,8 +36,8 @@ namespace FieaGameEngine
 	}
 
 
-	template<typename value_type>
-	inline bool SList<value_type>::Iterator::operator==(const Iterator& other) const
+	template <typename value_type, typename TAllocator>
+	inline bool SList<value_type, TAllocator>::Iterator::operator==(const Iterator& other) const
 	{
 		if((_currentNode == other._currentNode) && (_owner == other._owner))
 		{
@@ -46,8 +46,8 @@ namespace FieaGameEngine
 		return false;
 	}
 
-	template<typename value_type>
-	inline typename SList<value_type>::reference SList<value_type>::Iterator::operator*() const
+	template <typename value_type, typename TAllocator>
+	inline typename SList<value_type, TAllocator>::reference SList<value_type, TAllocator>::Iterator::operator*() const
 	{
 #ifdef _DEBUG
 		if (_currentNode == nullptr)
@@ -61,85 +61,114 @@ namespace FieaGameEngine
 #pragma endregion Iterator
 
 #pragma region ConstIterator
-	template <typename value_type>
-	SList<value_type>::ConstIterator::ConstIterator(const SList& other, Node* node) :
+	template <typename value_type, typename TAllocator>
+	SList<value_type, TAllocator>::ConstIterator::ConstIterator(const SList& other, Node* node) :
 		_owner{ &other }, _currentNode{ node }
 	{
 
 	}
 
-	template <typename value_type>
-	SList<value_type>::ConstIterator::ConstIterator(Iterator other) :
+	template <typename value_type, typename TAllocator>
+	SList<value_type, TAllocator>::ConstIterator::ConstIterator(Iterator other) :
 		_owner{ other._owner }, _currentNode{ other._currentNode }
 	{
 
 	}
 
-	template <typename value_type>
-	inline typename SList<value_type>::ConstIterator& SList<value_type>::ConstIterator::operator++()
+	template <typename value_type, typename TAllocator>
+	inline typename SList<value_type, TAllocator>::ConstIterator& SList<value_type, TAllocator>::ConstIterator::operator++()
 	{
 		_currentNode != nullptr ? _currentNode = _currentNode->next : _currentNode;
 		return *this;
 	}
 
-	template <typename value_type>
-	inline typename SList<value_type>::ConstIterator SList<value_type>::ConstIterator::operator++(int)
+	template <typename value_type, typename TAllocator>
+	inline typename SList<value_type, TAllocator>::ConstIterator SList<value_type, TAllocator>::ConstIterator::operator++(int)
 	{
 		ConstIterator iterator{ *this };
 		operator++();
 		return iterator;
 	}
 
-	template<typename value_type>
-	inline bool SList<value_type>::ConstIterator::operator!=(const ConstIterator& other) const
+	template <typename value_type, typename TAllocator>
+	inline bool SList<value_type, TAllocator>::ConstIterator::operator!=(const ConstIterator& other) const
 	{
 		return _currentNode != other._currentNode || _owner != other._owner;
 	}
 
-	template<typename value_type>
-	inline bool SList<value_type>::ConstIterator::operator==(const ConstIterator& other) const
+	template <typename value_type, typename TAllocator>
+	inline bool SList<value_type, TAllocator>::ConstIterator::operator==(const ConstIterator& other) const
 	{
 		return !(operator!=(other));
 	}
 
-	template<typename value_type>
-	inline typename SList<value_type>::const_reference SList<value_type>::ConstIterator::operator*() const
+	template <typename value_type, typename TAllocator>
+	inline typename SList<value_type, TAllocator>::const_reference SList<value_type, TAllocator>::ConstIterator::operator*() const
 	{
 #ifdef _DEBUG
 		if (_currentNode == nullptr)
 		{
 			throw std::runtime_error("Attempting to dereference a null pointer. SList::ConstIterator does not point to a valid SList item.");
 		}
-#endif _DEBUG
+#endif
 		return _currentNode->item;
 	}
 #pragma endregion ConstIterator
 
 #pragma region SList
 
-	template<typename value_type>
-	inline SList<value_type>::Node::Node(const_reference itemToAdd, Node* nextNode) :
-		item{ itemToAdd }, next {nextNode }
+	template <typename value_type, typename TAllocator>
+	template <typename...Args>
+	inline SList<value_type, TAllocator>::Node::Node(Node* nextNode, Args&&...args) :
+		item{ std::forward<Args>(args)... }, next{ nextNode }
 	{
 	}
 
-	template<typename value_type>
-	inline SList<value_type>::Node::Node(rvalue_reference itemToAdd, Node* nextNode) :
-		item{ std::forward<value_type>(itemToAdd) }, next{ nextNode }
+	template <typename value_type, typename TAllocator>
+	template <typename...Args>
+	inline typename SList<value_type, TAllocator>::Node* SList<value_type, TAllocator>::CreateNode(Node* nextNode, Args&&...args)
 	{
+		Node* node{ NodeTraits::allocate(_allocator, 1) };
+#ifdef USING_EXCEPTIONS
+		try
+		{
+			NodeTraits::construct(_allocator, node, nextNode, std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			NodeTraits::deallocate(_allocator, node, 1);
+			throw;
+		}
+#else
+		NodeTraits::construct(_allocator, node, nextNode, std::forward<Args>(args)...);
+#endif
+		return node;
+	}
 
+	template <typename value_type, typename TAllocator>
+	inline void SList<value_type, TAllocator>::DestroyNode(Node* node) noexcept
+	{
+		NodeTraits::destroy(_allocator, node);
+		NodeTraits::deallocate(_allocator, node, 1);
+	}
+
+	template <typename value_type, typename TAllocator>
+	inline SList<value_type, TAllocator>::SList(const allocator_type& allocator) :
+		_allocator{ allocator }
+	{
 	}
 
-	template<typename value_type>
-	inline SList<value_type>::SList(std::initializer_list<value_type> list)
+	template <typename value_type, typename TAllocator>
+	inline SList<value_type, TAllocator>::SList(std::initializer_list<value_type> list)
 	{
 		for (auto& item : list)
 		{
 			EmplaceBack(item);
 		}
 	}
-	template <typename value_type>
-	SList<value_type>::SList(const SList& other)
+	template <typename value_type, typename TAllocator>
+	SList<value_type, TAllocator>::SList(const SList& other) :
+		_allocator{ NodeTraits::select_on_container_copy_construction(other._allocator) }
 	{
 		for (auto& item : other)
 		{
@@ -147,40 +176,51 @@ namespace FieaGameEngine
 		}
 	}
 
-	template<typename value_type>
-	inline SList<value_type>::SList(SList&& other) noexcept :
-		_front{ other._front }, _back{ other._back }, _size{ other._size }
+	template <typename value_type, typename TAllocator>
+	inline SList<value_type, TAllocator>::SList(SList&& other) noexcept :
+		_front{ other._front }, _back{ other._back }, _size{ other._size }, _allocator{ std::move(other._allocator) }
 	{
 		other._front = nullptr;
 		other._back = nullptr;
 		other._size = 0;
 	}
 
-	template <typename value_type>
-	SList<value_type>& SList<value_type>::operator=(const SList& other)
+	template <typename value_type, typename TAllocator>
+	SList<value_type, TAllocator>& SList<value_type, TAllocator>::operator=(const SList& other)
 	{
 		if (this != &other)
 		{
 			Clear();
-
-			Node* currentNode{ other._front };
-
-			while (currentNode->next != nullptr)
+			if constexpr (NodeTraits::propagate_on_container_copy_assignment::value)
 			{
-				PushBack(currentNode->item);
-				currentNode = currentNode->next;
+				ShrinkToFit();
+				_allocator = other._allocator;
 			}
 
-			PushBack(currentNode->item);
+			for (const auto& item : other)
+			{
+				PushBack(item);
+			}
 		}
 
 		return *this;
 	}
 
-	template<typename value_type>
-	inline SList<value_type>& SList<value_type>::operator=(SList&& other) noexcept
+	template <typename value_type, typename TAllocator>
+	inline SList<value_type, TAllocator>& SList<value_type, TAllocator>::operator=(SList&& other) noexcept
 	{
+		static_assert(NodeTraits::propagate_on_container_move_assignment::value || NodeTraits::is_always_equal::value, "Moving nodes between lists requires allocators that propagate or always compare equal.");
+
+		if (this == &other)
+		{
+			return *this;
+		}
+
 		Clear();
+		if constexpr (NodeTraits::propagate_on_container_move_assignment::value)
+		{
+			_allocator = std::move(other._allocator);
+		}
 		_front = other._front;
 		_back = other._back;
 		_size = other._size;
@@ -191,14 +231,14 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template <typename value_type>
-	inline typename SList<value_type>::size_type SList<value_type>::Size() const
+	template <typename value_type, typename TAllocator>
+	inline typename SList<value_type, TAllocator>::size_type SList<value_type, TAllocator>::Size() const
 	{
 		return _size;
 	}
 
-	template <typename value_type>
-	[[nodiscard]] inline typename SList<value_type>::reference SList<value_type>::At(size_type location) const
+	template <typename value_type, typename TAllocator>
+	[[nodiscard]] inline typename SList<value_type, TAllocator>::reference SList<value_type, TAllocator>::At(size_type location) const
 	{
 		if (location <= (_size - 1) && _size > 0)
 		{
@@ -213,59 +253,59 @@ namespace FieaGameEngine
 		throw std::runtime_error("Out of bounds! Element does not exist!");
 	}
 
-	template<typename value_type>
-	inline typename SList<value_type>::Iterator SList<value_type>::begin()
+	template <typename value_type, typename TAllocator>
+	inline typename SList<value_type, TAllocator>::Iterator SList<value_type, TAllocator>::begin()
 	{
 		return Iterator(*this, _front);
 	}
 
-	template<typename value_type>
-	inline typename SList<value_type>::Iterator SList<value_type>::end()
+	template <typename value_type, typename TAllocator>
+	inline typename SList<value_type, TAllocator>::Iterator SList<value_type, TAllocator>::end()
 	{
 		return Iterator(*this, nullptr);
 	}
 
-	template<typename value_type>
-	inline typename SList<value_type>::ConstIterator SList<value_type>::begin() const
+	template <typename value_type, typename TAllocator>
+	inline typename SList<value_type, TAllocator>::ConstIterator SList<value_type, TAllocator>::begin() const
 	{
 		return ConstIterator(*this, _front);
 	}
 
-	template<typename value_type>
-	inline typename SList<value_type>::ConstIterator SList<value_type>::end() const
+	template <typename value_type, typename TAllocator>
+	inline typename SList<value_type, TAllocator>::ConstIterator SList<value_type, TAllocator>::end() const
 	{
 		return ConstIterator( *this, nullptr );
 	}
 
-	template<typename value_type>
-	inline typename SList<value_type>::ConstIterator SList<value_type>::cbegin() const
+	template <typename value_type, typename TAllocator>
+	inline typename SList<value_type, TAllocator>::ConstIterator SList<value_type, TAllocator>::cbegin() const
 	{
 		return ConstIterator(*this, _front);
 	}
 
-	template<typename value_type>
-	inline typename SList<value_type>::ConstIterator SList<value_type>::cend() const
+	template <typename value_type, typename TAllocator>
+	inline typename SList<value_type, TAllocator>::ConstIterator SList<value_type, TAllocator>::cend() const
 	{
 		return ConstIterator(*this, nullptr);
 	}
 
-	template <typename value_type>
-	inline  SList<value_type>::Iterator SList<value_type>::PushBack(const_reference itemToAdd)
+	template <typename value_type, typename TAllocator>
+	inline  SList<value_type, TAllocator>::Iterator SList<value_type, TAllocator>::PushBack(const_reference itemToAdd)
 	{
 		return EmplaceBack(itemToAdd);
 	}
 
-	template<typename value_type>
-	inline  SList<value_type>::Iterator SList<value_type>::PushBack(rvalue_reference itemToAdd)
+	template <typename value_type, typename TAllocator>
+	inline  SList<value_type, TAllocator>::Iterator SList<value_type, TAllocator>::PushBack(rvalue_reference itemToAdd)
 	{
 		return EmplaceBack(std::forward<value_type>(itemToAdd));
 	}
 
-	template<typename value_type>
+	template <typename value_type, typename TAllocator>
 	template<typename ...Args>
-	inline SList<value_type>::Iterator SList<value_type>::EmplaceBack(Args && ...args)
+	inline SList<value_type, TAllocator>::Iterator SList<value_type, TAllocator>::EmplaceBack(Args && ...args)
 	{
-		Node* node = new Node{ value_type{std::forward<Args>(args)...}, nullptr };
+		Node* node = CreateNode(nullptr, std::forward<Args>(args)...);
 
 		if (_size == 0)
 		{
@@ -285,23 +325,23 @@ namespace FieaGameEngine
 	}
 
 
-	template <typename value_type>
-	inline void SList<value_type>::PushFront(const_reference itemToAdd)
+	template <typename value_type, typename TAllocator>
+	inline void SList<value_type, TAllocator>::PushFront(const_reference itemToAdd)
 	{
 		EmplaceFront(itemToAdd);
 	}
 
-	template<typename T>
-	inline void SList<T>::PushFront(rvalue_reference itemToAdd)
+	template <typename value_type, typename TAllocator>
+	inline void SList<value_type, TAllocator>::PushFront(rvalue_reference itemToAdd)
 	{
 		EmplaceFront(std::forward<value_type>(itemToAdd));
 	}
 
-	template<typename value_type>
+	template <typename value_type, typename TAllocator>
 	template<typename ...Args>
-	inline void SList<value_type>::EmplaceFront(Args && ...args)
+	inline void SList<value_type, TAllocator>::EmplaceFront(Args && ...args)
 	{
-		_front = new Node{ value_type{std::forward<Args>(args)...}, _front };
+		_front = CreateNode(_front, std::forward<Args>(args)...);
 		if (_size == 0)
 		{
 			_back = _front;
@@ -309,8 +349,8 @@ namespace FieaGameEngine
 		++_size;
 	}
 
-	template <typename value_type>
-	inline void SList<value_type>::PopFront()
+	template <typename value_type, typename TAllocator>
+	inline void SList<value_type, TAllocator>::PopFront()
 	{
 		if (_size == 0)
 		{
@@ -324,12 +364,38 @@ namespace FieaGameEngine
 		else
 		{
 			_front = nullptr;
+			_back = nullptr;
 		}
-		delete node;
+		DestroyNode(node);
 		--_size;
 	}
-	template <typename value_type>
-	inline void SList<value_type>::PopBack()
+
+	template <typename value_type, typename TAllocator>
+	inline void SList<value_type, TAllocator>::SpliceFront(SList& other)
+	{
+		assert(_allocator == other._allocator);
+		if (other._size == 0)
+		{
+			return;
+		}
+
+		Node* node = other._front;
+		other._front = node->next;
+		if (--other._size == 0)
+		{
+			other._back = nullptr;
+		}
+
+		node->next = _front;
+		_front = node;
+		if (_size == 0)
+		{
+			_back = node;
+		}
+		++_size;
+	}
+	template <typename value_type, typename TAllocator>
+	inline void SList<value_type, TAllocator>::PopBack()
 	{
 
 		if (_size == 0)
@@ -346,7 +412,7 @@ namespace FieaGameEngine
 			currentNode = currentNode->next;
 		}
 
-		delete currentNode;
+		DestroyNode(currentNode);
 
 		if(_size ==1)
 		{
@@ -362,15 +428,15 @@ namespace FieaGameEngine
 		--_size;
 	}
 
-	template <typename value_type>
-	inline void SList<value_type>::Clear()
+	template <typename value_type, typename TAllocator>
+	inline void SList<value_type, TAllocator>::Clear()
 	{
 		Node* currentNode = _front;
 		while(currentNode != nullptr)
 		{
 			Node* node = currentNode;
 			currentNode = currentNode->next;
-			delete node;
+			DestroyNode(node);
 		}
 
 		_front = nullptr;
@@ -378,14 +444,29 @@ namespace FieaGameEngine
 		_size = 0;
 	}
 
-	template <typename value_type>
-	[[nodiscard]] inline bool SList<value_type>::IsEmpty() const
+	template <typename value_type, typename TAllocator>
+	inline void SList<value_type, TAllocator>::ShrinkToFit()
+	{
+		if constexpr (requires(NodeAllocator& allocator) { allocator.Release(); })
+		{
+			_allocator.Release();
+		}
+	}
+
+	template <typename value_type, typename TAllocator>
+	inline typename SList<value_type, TAllocator>::allocator_type SList<value_type, TAllocator>::GetAllocator() const
+	{
+		return allocator_type{ _allocator };
+	}
+
+	template <typename value_type, typename TAllocator>
+	[[nodiscard]] inline bool SList<value_type, TAllocator>::IsEmpty() const
 	{
 		return _size == 0;
 	}
 
-	template <typename value_type>
-	[[nodiscard]] inline typename SList<value_type>::reference SList<value_type>::Front() const
+	template <typename value_type, typename TAllocator>
+	[[nodiscard]] inline typename SList<value_type, TAllocator>::reference SList<value_type, TAllocator>::Front() const
 	{
 #ifdef _DEBUG
 		if (_front == nullptr)
@@ -396,8 +477,8 @@ namespace FieaGameEngine
 		return _front->item;
 	}
 
-	template <typename value_type>
-	[[nodiscard]] inline typename SList<value_type>::reference SList<value_type>::Back() const
+	template <typename value_type, typename TAllocator>
+	[[nodiscard]] inline typename SList<value_type, TAllocator>::reference SList<value_type, TAllocator>::Back() const
 	{
 #ifdef _DEBUG
 		if (_back == nullptr)
@@ -408,8 +489,8 @@ namespace FieaGameEngine
 		return _back->item;
 	}
 
-	template <typename value_type>
-	[[nodiscard]] inline typename SList<value_type>::Iterator SList<value_type>::Find(const_reference value)
+	template <typename value_type, typename TAllocator>
+	[[nodiscard]] inline typename SList<value_type, TAllocator>::Iterator SList<value_type, TAllocator>::Find(const_reference value)
 	{
 		auto iterator{ begin() };
 		while (iterator != end())
@@ -423,8 +504,8 @@ namespace FieaGameEngine
 		return iterator;
 	}
 
-	template <typename value_type>
-	[[nodiscard]] inline typename SList<value_type>::ConstIterator SList<value_type>::Find(const_reference value) const
+	template <typename value_type, typename TAllocator>
+	[[nodiscard]] inline typename SList<value_type, TAllocator>::ConstIterator SList<value_type, TAllocator>::Find(const_reference value) const
 	{
 		auto iterator{ cbegin() };
 		while (iterator != cend())
@@ -438,8 +519,8 @@ namespace FieaGameEngine
 		return iterator;
 	}
 
-	template <typename value_type>
-	inline void SList<value_type>::Remove(const_reference value)
+	template <typename value_type, typename TAllocator>
+	inline void SList<value_type, TAllocator>::Remove(const_reference value)
 	{
 		SList::Iterator previous{ begin() };
 		SList::Iterator iterator{ begin() };
@@ -451,14 +532,18 @@ namespace FieaGameEngine
 				if (_front == iterator._currentNode)
 				{
 					_front = iterator._currentNode->next;
-					delete iterator._currentNode;
+					if (_front == nullptr)
+					{
+						_back = nullptr;
+					}
+					DestroyNode(iterator._currentNode);
 					--_size;
 				}
 
 				else
 				{
 					previous._currentNode->next = iterator._currentNode->next;
-					delete iterator._currentNode;
+					DestroyNode(iterator._currentNode);
 					if (previous._currentNode->next == nullptr)
 					{
 						_back = previous._currentNode;
@@ -473,8 +558,8 @@ namespace FieaGameEngine
 		}
 	}
 
-	template<typename value_type>
-	inline void SList<value_type>::Remove(Iterator position)
+	template <typename value_type, typename TAllocator>
+	inline void SList<value_type, TAllocator>::Remove(Iterator position)
 	{
 		if (position._owner != this)
 		{
@@ -494,25 +579,22 @@ namespace FieaGameEngine
 				position._currentNode->item.~value_type();
 				new (&position._currentNode->item)value_type(std::move(node->item));
 
-				if (position._currentNode->next == nullptr)
+				position._currentNode->next = node->next;
+				if (node == _back)
 				{
 					_back = position._currentNode;
 				}
 
-				else
-				{
-					position._currentNode->next = (position._currentNode->next)->next;
-				}
-
-				delete node;
+				DestroyNode(node);
+				--_size;
 			}
 		}
 
 
 	}
 
-	template <typename value_type>
-	inline typename SList<value_type>::Iterator SList<value_type>::InsertAfter(const_reference itemToAdd, SList<value_type>::Iterator position)
+	template <typename value_type, typename TAllocator>
+	inline typename SList<value_type, TAllocator>::Iterator SList<value_type, TAllocator>::InsertAfter(const_reference itemToAdd, SList<value_type, TAllocator>::Iterator position)
 	{
 		if (this != position._owner)
 		{
@@ -528,7 +610,7 @@ namespace FieaGameEngine
 		else
 		{
 			Node* nextNode = position._currentNode->next;
-			Node* node = new Node{ itemToAdd, nextNode };
+			Node* node = CreateNode(nextNode, itemToAdd);
 
 			position._currentNode->next = node;
 			++_size;
@@ -536,8 +618,8 @@ namespace FieaGameEngine
 		}
 	}
 
-	template <typename value_type>
-	SList<value_type>::~SList()
+	template <typename value_type, typename TAllocator>
+	SList<value_type, TAllocator>::~SList()
 	{
 		Clear();
 	}
@@ -6,18 +6,24 @@ namespace FieaGameEngine
 
 	Scope::Scope(std::size_t size) 
 	{
-		_orderVector.Reserve(size);
+		RebuildIndex(std::bit_ceil(std::max(MinimumIndexCapacity, size * 2)));
 	}
 
-	Scope::Scope(const Scope& other)
+	Scope::Scope(std::pmr::memory_resource* resource) :
+		_resource{ resource }
+	{
+	}
+
+	Scope::Scope(const Scope& other) :
+		_prototype{ other._prototype }
 	{
 		CopyHelper(other, *this);
 	}
 
 	Scope::Scope(Scope&& other) noexcept :
-		_orderVector{ std::move(other._orderVector) }, _table{ std::move(other._table) }, _size{ other._size }
+		_resource{ other._resource }, _prototype{ other._prototype }
 	{
-		other._size = 0;
+		StealStorage(other);
 		if (other._parent != nullptr)
 		{
 			Scope* original = other.Orphan();
@@ -32,6 +38,7 @@ namespace FieaGameEngine
 		if (this != &other && !IsDescendantOf(&other) && !IsAncestorOf(&other))
 		{
 			Clear();
+			_prototype = other._prototype;
 			CopyHelper(other, *this);
 		}
 		return *this;
@@ -48,11 +55,11 @@ namespace FieaGameEngine
 			{
 				original = otherParent->Orphan(&other);
 			}
-			Clear();
-			_orderVector = std::move(other._orderVector);
-			_table = std::move(other._table);
-			_size = other._size;
-			other._size = 0;
+			Scope::Clear();
+			ReleaseStorage();
+			_resource = other._resource;
+			_prototype = other._prototype;
+			StealStorage(other);
 			ReparentImmediateFamily();
 			delete original;
 		}
@@ -70,17 +77,16 @@ namespace FieaGameEngine
 		{
 			if (_size == rhs._size)
 			{
-				std::size_t position{ 0 };
-				for (auto& pair : _orderVector)
+				for (std::size_t position{ 0 }; position < _size; ++position)
 				{
-					if (pair->first != "this")
+					const Pair_Type& pair{ PairAt(position) };
+					if (pair.first != "this")
 					{
-						if (*pair != *rhs._orderVector[position])
+						if (pair != rhs.PairAt(position))
 						{
 							return false;
 						}
 					}
-					++position;
 				}
 			}
 
@@ -126,10 +132,133 @@ namespace FieaGameEngine
 		return new Scope{ *this };
 	}
 
-	Scope::Scope(Scope* parent) :
-		_parent{ parent }
+	void Scope::SetCopyOnWrite(bool copyOnWrite)
+	{
+		for (std::size_t position{ 0 }; position < _size; ++position)
+		{
+			Datum& datum{ PairAt(position).second };
+			if (datum.Type() != Datum::DatumTypes::Table)
+			{
+				datum.SetCopyOnWrite(copyOnWrite);
+			}
+			else
+			{
+				for (std::size_t index{ 0 }; index < datum.Size(); ++index)
+				{
+					datum.GetAsScope(index)->SetCopyOnWrite(copyOnWrite);
+				}
+			}
+		}
+	}
+
+	void Scope::SetPrototype(const Scope& prototype)
+	{
+		assert(&prototype != this && !prototype.IsDescendantOf(this));
+		_prototype = &prototype;
+		for (std::size_t position{ 0 }; position < _size; ++position)
+		{
+			auto& [name, datum] = PairAt(position);
+			const Datum* source{ prototype.Find(name) };
+			if (datum.Type() == Datum::DatumTypes::Table && source != nullptr && source->Type() == Datum::DatumTypes::Table)
+			{
+				datum.Reserve(datum.Size() + source->Size());
+				for (std::size_t index{ 0 }; index < source->Size(); ++index)
+				{
+					datum.PushBack(source->GetAsScope(index)->Clone());
+					datum.GetAsScope(datum.Size() - 1)->Reparent(this, &datum, datum.Size() - 1);
+				}
+			}
+		}
+	}
+
+	const Scope* Scope::Prototype() const
+	{
+		return _prototype;
+	}
+
+	std::pmr::memory_resource* Scope::Resource() const
+	{
+		return _resource;
+	}
+
+	void* Scope::operator new(std::size_t size)
+	{
+		return operator new(size, nullptr);
+	}
+
+	void* Scope::operator new(std::size_t size, std::pmr::memory_resource* resource)
+	{
+		const std::size_t bytes{ sizeof(AllocationHeader) + size };
+		void* block{ resource != nullptr ? resource->allocate(bytes, alignof(AllocationHeader)) : ::operator new(bytes) };
+		new (block) AllocationHeader{ resource, bytes };
+		return static_cast<std::byte*>(block) + sizeof(AllocationHeader);
+	}
+
+	void Scope::operator delete(void* pointer) noexcept
+	{
+		if (pointer != nullptr)
+		{
+			AllocationHeader* header{ reinterpret_cast<AllocationHeader*>(static_cast<std::byte*>(pointer) - sizeof(AllocationHeader)) };
+			if (header->_resource != nullptr)
+			{
+				header->_resource->deallocate(header, header->_bytes, alignof(AllocationHeader));
+			}
+			else
+			{
+				::operator delete(header);
+			}
+		}
+	}
+
+	void Scope::operator delete(void* pointer, std::pmr::memory_resource*) noexcept
+	{
+		operator delete(pointer);
+	}
+
+	gsl::owner<Scope*> Scope::NewChild() const
+	{
+		return new (_resource) Scope{ _resource };
+	}
+
+	std::uint64_t Scope::NextGeneration()
+	{
+		return ++_latestGeneration;
+	}
+
+	Scope::Binding::Binding(Symbol name) :
+		_name{ std::move(name) }
+	{
+	}
+
+	const Symbol& Scope::Binding::Name() const
 	{
+		return _name;
+	}
+
+	Scope* Scope::Binding::FoundScope() const
+	{
+		return _scope;
+	}
 
+	bool Scope::Binding::IsCurrent() const
+	{
+		if (_generation == _latestGeneration)
+		{
+			return true;
+		}
+
+		for (const Scope* scope = _origin; scope != nullptr; scope = scope->_parent)
+		{
+			if (scope->_generation > _generation)
+			{
+				return false;
+			}
+			if (scope == _scope)
+			{
+				break;
+			}
+		}
+		return true;
 	}
 
 	Scope::~Scope()
@@ -140,77 +269,266 @@ namespace FieaGameEngine
 		}
 
 		Clear();
+		ReleaseStorage();
 	}
 
-	Datum* Scope::Search(const std::string& name)
+	Datum* Scope::Search(std::string_view name)
 	{
-		Datum* foundDatum = Find(name);
-		if (foundDatum == nullptr)
+		Symbol symbol{ Symbol::Find(name) };
+		if (symbol.IsNull() && !name.empty())
 		{
-			Scope* parent = _parent;
-			while (parent != nullptr)
+			return nullptr;
+		}
+		return Search(symbol);
+	}
+
+	Datum* Scope::Search(const Symbol& name)
+	{
+		Scope* foundScope;
+		return Search(name, foundScope);
+	}
+
+	Datum* Scope::Search(std::string_view name, Scope*& foundScope)
+	{
+		Symbol symbol{ Symbol::Find(name) };
+		if (symbol.IsNull() && !name.empty())
+		{
+			foundScope = nullptr;
+			return nullptr;
+		}
+		return Search(symbol, foundScope);
+	}
+
+	Datum* Scope::Search(const Symbol& name, Scope*& foundScope)
+	{
+		for (Scope* scope = this; scope != nullptr; scope = scope->GetParent())
+		{
+			Datum* foundDatum = scope->Find(name);
+			if (foundDatum != nullptr)
 			{
-				foundDatum = parent->Search(name);
-				if (foundDatum != nullptr)
-				{
-					break;
-				}
-				parent = parent->GetParent();
+				foundScope = scope;
+				return foundDatum;
 			}
 		}
-		return foundDatum;
+		foundScope = nullptr;
+		return nullptr;
 	}
 
-	Datum* Scope::Search(const std::string& name, Scope*& foundScope)
+	Datum* Scope::Search(Binding& binding)
 	{
-		Datum* foundDatum = Find(name);
-		Scope* parent = _parent;
-		foundScope = this;
-		if (foundDatum == nullptr)
+		if (binding._origin != this || !binding.IsCurrent())
 		{
-			foundScope = nullptr;
-			while (parent != nullptr)
+			binding._origin = this;
+			binding._datum = Search(binding._name, binding._scope);
+		}
+		binding._generation = _latestGeneration;
+		return binding._datum;
+	}
+
+	Datum& Scope::Append(std::string_view name, Datum::DatumTypes type)
+	{
+		const std::size_t index{ IndexOf(name, DefaultHash<Symbol>{}(name)) };
+		if (index == _size)
+		{
+			Symbol symbol{ name };
+			Datum* inherited{ _prototype != nullptr ? Inherit(symbol) : nullptr };
+			return inherited != nullptr ? *inherited : Insert(std::move(symbol), type);
+		}
+		else
+		{
+			return PairAt(index).second;
+		}
+	}
+
+	Datum& Scope::Append(const Symbol& name, Datum::DatumTypes type)
+	{
+		const std::size_t index{ IndexOf(name, name.Hash()) };
+		if (index == _size)
+		{
+			Datum* inherited{ _prototype != nullptr ? Inherit(name) : nullptr };
+			return inherited != nullptr ? *inherited : Insert(name, type);
+		}
+		else
+		{
+			return PairAt(index).second;
+		}
+	}
+
+	Datum& Scope::Insert(Symbol name, Datum::DatumTypes type)
+	{
+		ReserveSegments(_size + 1);
+		const std::size_t hash{ name.Hash() };
+		Pair_Type* pair{ new (SlotAt(_size)) Pair_Type{ std::move(name), Datum{ type, _resource } } };
+		AddToIndex(hash, _size);
+		++_size;
+		BumpGeneration();
+		return pair->second;
+	}
+
+	Datum* Scope::Inherit(const Symbol& name)
+	{
+		assert(_prototype != nullptr);
+		const Datum* inherited{ _prototype->Find(name) };
+		// An external Datum wraps a member of the prototype itself, so an instance holds its own in its place, as Attributed does for prescribed attributes.
+		if (inherited == nullptr || inherited->_isExternal)
+		{
+			return nullptr;
+		}
+
+		Datum& datum{ Insert(name, inherited->Type()) };
+		if (inherited->Type() != Datum::DatumTypes::Table)
+		{
+			datum = *inherited;
+		}
+		else
+		{
+			datum.Reserve(inherited->Size());
+			for (std::size_t index{ 0 }; index < inherited->Size(); ++index)
+			{
+				datum.PushBack(inherited->GetAsScope(index)->Clone());
+				datum.GetAsScope(index)->Reparent(this, &datum, index);
+			}
+		}
+		return &datum;
+	}
+
+	void Scope::ReserveSegments(std::size_t size)
+	{
+		while ((FirstSegmentSize << _segments.Size()) - FirstSegmentSize < size)
+		{
+			const std::size_t bytes{ sizeof(Pair_Type) * (FirstSegmentSize << _segments.Size()) };
+			_segments.PushBack(static_cast<Pair_Type*>(Allocate(bytes, alignof(Pair_Type))));
+		}
+	}
+
+	template <typename TName>
+	std::size_t Scope::IndexOf(const TName& name, std::size_t hash) const
+	{
+		if (_size > 0)
+		{
+			const std::size_t mask{ _indexCapacity - 1 };
+			for (std::size_t slot{ hash & mask }; _index[slot] != EmptySlot; slot = (slot + 1) & mask)
 			{
-				foundDatum = parent->Find(name);
-				if (foundDatum != nullptr)
+				if (PairAt(_index[slot]).first == name)
 				{
-					foundScope = parent;
-					break;
+					return _index[slot];
 				}
-				parent = parent->GetParent();
 			}
 		}
-		return foundDatum;
+		return _size;
 	}
 
-	Datum& Scope::Append(const std::string& name, Datum::DatumTypes type)
+	void Scope::AddToIndex(std::size_t hash, std::size_t index)
 	{
-		auto position{ _table.Find(name) };
-		if (position == _table.end())
+		if ((_size + 1) * 2 > _indexCapacity)
 		{
-			auto newPosition = _table.Emplace(name, Datum{ type });
-			_orderVector.EmplaceBack(&(*newPosition));
-			++_size;
-			return _orderVector.Back()->second;
+			RebuildIndex(std::max(MinimumIndexCapacity, _indexCapacity * 2));
+		}
+
+		const std::size_t mask{ _indexCapacity - 1 };
+		std::size_t slot{ hash & mask };
+		while (_index[slot] != EmptySlot)
+		{
+			slot = (slot + 1) & mask;
+		}
+		_index[slot] = static_cast<std::uint32_t>(index);
+	}
+
+	void Scope::RebuildIndex(std::size_t capacity)
+	{
+		assert(std::has_single_bit(capacity));
+		if (_index != nullptr)
+		{
+			Deallocate(_index, sizeof(std::uint32_t) * _indexCapacity, alignof(std::uint32_t));
+		}
+		_index = static_cast<std::uint32_t*>(Allocate(sizeof(std::uint32_t) * capacity, alignof(std::uint32_t)));
+		_indexCapacity = capacity;
+		std::fill_n(_index, capacity, EmptySlot);
+
+		const std::size_t mask{ capacity - 1 };
+		for (std::size_t index{ 0 }; index < _size; ++index)
+		{
+			std::size_t slot{ PairAt(index).first.Hash() & mask };
+			while (_index[slot] != EmptySlot)
+			{
+				slot = (slot + 1) & mask;
+			}
+			_index[slot] = static_cast<std::uint32_t>(index);
+		}
+	}
+
+	void Scope::DestroyPairs()
+	{
+		for (std::size_t index{ _size }; index > 0; --index)
+		{
+			PairAt(index - 1).~Pair_Type();
+		}
+		_size = 0;
+		if (_index != nullptr)
+		{
+			std::fill_n(_index, _indexCapacity, EmptySlot);
+		}
+	}
+
+	void Scope::ReleaseStorage()
+	{
+		assert(_size == 0);
+		for (std::size_t segment{ 0 }; segment < _segments.Size(); ++segment)
+		{
+			Deallocate(_segments[segment], sizeof(Pair_Type) * (FirstSegmentSize << segment), alignof(Pair_Type));
+		}
+		_segments.Clear();
+		if (_index != nullptr)
+		{
+			Deallocate(_index, sizeof(std::uint32_t) * _indexCapacity, alignof(std::uint32_t));
+			_index = nullptr;
+			_indexCapacity = 0;
+		}
+	}
+
+	void Scope::StealStorage(Scope& other)
+	{
+		_segments = std::move(other._segments);
+		other._segments.Clear();
+		_index = std::exchange(other._index, nullptr);
+		_indexCapacity = std::exchange(other._indexCapacity, 0);
+		_size = std::exchange(other._size, 0);
+		other.BumpGeneration();
+	}
+
+	void* Scope::Allocate(std::size_t bytes, std::size_t alignment) const
+	{
+		return _resource != nullptr ? _resource->allocate(bytes, alignment) : ::operator new(bytes);
+	}
+
+	void Scope::Deallocate(void* pointer, std::size_t bytes, std::size_t alignment) const
+	{
+		if (_resource != nullptr)
+		{
+			_resource->deallocate(pointer, bytes, alignment);
 		}
 		else
 		{
-			return position->second;
+			::operator delete(pointer);
 		}
 	}
 
-	Datum& Scope::operator[](const std::string& name)
+	Datum& Scope::operator[](std::string_view name)
+	{
+		return Append(name);
+	}
+
+	Datum& Scope::operator[](const Symbol& name)
 	{
 		return Append(name);
 	}
 
-	Datum& Scope::operator[](std::size_t index)
+	void Scope::Adopt(Scope& child, std::string_view name)
 	{
-		assert(index < _orderVector.Size());
-		return _orderVector[index]->second;
+		Adopt(child, Symbol{ name });
 	}
 
-	void Scope::Adopt(Scope& child, const std::string& name)
+	void Scope::Adopt(Scope& child, const Symbol& name)
 	{
 		assert(!IsDescendantOf(&child));
 		if (!IsDescendantOf(&child))
@@ -226,7 +544,7 @@ namespace FieaGameEngine
 
 			item.PushBack(&child);
 
-			child.Reparent(this);
+			child.Reparent(this, &item, item.Size() - 1);
 		}
 	}
 
@@ -250,8 +568,19 @@ namespace FieaGameEngine
 
 		if (result.first != nullptr)
 		{
-			temp = result.first->GetAsScope(result.second);
-			result.first->RemoveAt(result.second);
+			Datum& siblings = *result.first;
+			const std::size_t last{ siblings.Size() - 1 };
+			if (result.second != last)
+			{
+				Scope* moved = siblings.GetAsScope(last);
+				siblings.Set(moved, result.second);
+				siblings.Set(child, last);
+				moved->_parentIndex = result.second;
+			}
+			// Popping the child off the end clears its parent.
+			siblings.PopBack();
+
+			temp = child;
 		}
 
 		return temp;
@@ -283,91 +612,179 @@ namespace FieaGameEngine
 	}
 	std::pair<Datum*, std::size_t> Scope::FindContainedScope(const Scope* scope)
 	{
-		for (auto& item : _orderVector)
+		if (scope != nullptr && scope->_parent == this)
 		{
-			Datum& currentDatum = item->second;
-			if (currentDatum.Type() == Datum::DatumTypes::Table)
-			{
-				for (std::size_t position{ 0 }; position < currentDatum.Size(); ++position)
-				{
-					if (scope == currentDatum.GetAsScope(position))
-					{
-						return std::pair(&currentDatum, position);
-					}
-				}
-			}
+			assert(scope->_parentDatum->GetAsScope(scope->_parentIndex) == scope);
+			return std::pair(scope->_parentDatum, scope->_parentIndex);
 		}
 		return std::pair(nullptr, 0);
 	}
 
-	Scope& Scope::AppendScope(const std::string& name)
+	Scope& Scope::AppendScope(std::string_view name)
+	{
+		return AppendScope(Symbol{ name });
+	}
+
+	Scope& Scope::AppendScope(const Symbol& name)
 	{
 		Datum& item = Append(name, Datum::DatumTypes::Table);
 
 		assert(item.Type() == Datum::DatumTypes::Table);
 
-		Scope* scope = new Scope{ this };
+		Scope* scope = NewChild();
 		item.PushBack(scope);
+		scope->Reparent(this, &item, item.Size() - 1);
 		return *scope;
 	}
 
-	Datum* Scope::Find(const std::string& name)
+	Datum* Scope::Find(std::string_view name)
 	{
-		auto position = _table.Find(name);
-		return position == _table.end() ? nullptr : &(position->second);
+		const std::size_t index{ IndexOf(name, DefaultHash<Symbol>{}(name)) };
+		if (index == _size)
+		{
+			if (_prototype == nullptr)
+			{
+				return nullptr;
+			}
+			// Every name the prototype holds has been interned, so a name that was not cannot be inherited.
+			Symbol symbol{ Symbol::Find(name) };
+			return symbol.IsNull() && !name.empty() ? nullptr : Inherit(symbol);
+		}
+		return &PairAt(index).second;
+	}
+
+	Datum* Scope::Find(const Symbol& name)
+	{
+		const std::size_t index{ IndexOf(name, name.Hash()) };
+		if (index == _size)
+		{
+			return _prototype != nullptr ? Inherit(name) : nullptr;
+		}
+		return &PairAt(index).second;
+	}
+
+	const Datum* Scope::Find(std::string_view name) const
+	{
+		const std::size_t index{ IndexOf(name, DefaultHash<Symbol>{}(name)) };
+		if (index == _size)
+		{
+			return _prototype != nullptr ? _prototype->Find(name) : nullptr;
+		}
+		return &PairAt(index).second;
+	}
+
+	const Datum* Scope::Find(const Symbol& name) const
+	{
+		const std::size_t index{ IndexOf(name, name.Hash()) };
+		if (index == _size)
+		{
+			return _prototype != nullptr ? _prototype->Find(name) : nullptr;
+		}
+		return &PairAt(index).second;
 	}
 
 	void Scope::Clear()
 	{
-		for (auto& item : _orderVector)
+		for (std::size_t index{ 0 }; index < _size; ++index)
 		{
-			Datum& currentDatum = item->second;
+			Datum& currentDatum = PairAt(index).second;
 			if (currentDatum.Type() == Datum::DatumTypes::Table)
 			{
-				for (std::size_t position{ currentDatum.Size() }; position > 0; --position)
+				while (currentDatum.Size() > 0)
 				{
-					currentDatum.GetAsScope(position - 1)->_parent = nullptr;
-					delete currentDatum.GetAsScope(position - 1);
+					Scope* child{ currentDatum.GetAsScope(currentDatum.Size() - 1) };
+					currentDatum.PopBack();
+					delete child;
 				}
 			}
 		}
 
-		_orderVector.Clear();
-		_table.Clear();
-		_size = 0;
+		DestroyPairs();
+		BumpGeneration();
 	}
 
 	inline void Scope::CopyHelper(const Scope& sourceScope, Scope& destinationScope)
 	{
-		for (auto& item : sourceScope._orderVector)
+		if (destinationScope._size == 0)
+		{
+			destinationScope.CloneFrom(sourceScope);
+			return;
+		}
+
+		for (std::size_t position{ 0 }; position < sourceScope._size; ++position)
 		{
-			Datum& currentDatum = item->second;
-			if (item->second.Type() != Datum::DatumTypes::Table)
+			const Pair_Type& item = sourceScope.PairAt(position);
+			const Datum& currentDatum = item.second;
+			if (currentDatum.Type() != Datum::DatumTypes::Table)
 			{
-				Datum& addedDatum = destinationScope.Append(item->first, currentDatum.Type());
+				Datum& addedDatum = destinationScope.Append(item.first, currentDatum.Type());
 				addedDatum = currentDatum;
 			}
 			else
 			{
-				Datum& addedDatum{ destinationScope.Append(item->first, Datum::DatumTypes::Table) };
+				Datum& addedDatum{ destinationScope.Append(item.first, Datum::DatumTypes::Table) };
 				for (std::size_t index{ 0 }; index < currentDatum.Size(); ++index)
 				{
+					// The destination may already hold scopes under this name, so the clone lands after them.
 					addedDatum.PushBack(currentDatum.GetAsScope(index)->Clone());
-					addedDatum.GetAsScope(index)->Reparent(this);
+					addedDatum.GetAsScope(addedDatum.Size() - 1)->Reparent(&destinationScope, &addedDatum, addedDatum.Size() - 1);
+				}
+			}
+		}
+	}
+
+	void Scope::CloneFrom(const Scope& other)
+	{
+		assert(_size == 0);
+		if (other._size == 0)
+		{
+			return;
+		}
+
+		ReserveSegments(other._size);
+		if (_indexCapacity != other._indexCapacity)
+		{
+			if (_index != nullptr)
+			{
+				Deallocate(_index, sizeof(std::uint32_t) * _indexCapacity, alignof(std::uint32_t));
+			}
+			_index = static_cast<std::uint32_t*>(Allocate(sizeof(std::uint32_t) * other._indexCapacity, alignof(std::uint32_t)));
+			_indexCapacity = other._indexCapacity;
+		}
+		std::copy_n(other._index, _indexCapacity, _index);
+
+		for (std::size_t position{ 0 }; position < other._size; ++position)
+		{
+			const auto& [name, source] = other.PairAt(position);
+			Datum& datum{ (new (SlotAt(position)) Pair_Type{ name, Datum{ source.Type(), _resource } })->second };
+			++_size;
+			if (source.Type() != Datum::DatumTypes::Table)
+			{
+				datum = source;
+			}
+			else
+			{
+				datum.Reserve(source.Size());
+				for (std::size_t index{ 0 }; index < source.Size(); ++index)
+				{
+					datum.PushBack(source.GetAsScope(index)->Clone());
+					datum.GetAsScope(index)->Reparent(this, &datum, index);
 				}
 			}
 		}
+		BumpGeneration();
 	}
 
 	void Scope::ReparentImmediateFamily()
 	{
-		for (auto& pair : _orderVector)
+		for (std::size_t position{ 0 }; position < _size; ++position)
 		{
-			if (pair->second.Type() == Datum::DatumTypes::Table)
+			Datum& datum = PairAt(position).second;
+			if (datum.Type() == Datum::DatumTypes::Table)
 			{
-				for (std::size_t index{ 0 }; index < pair->second.Size(); ++index)
+				for (std::size_t index{ 0 }; index < datum.Size(); ++index)
 				{
-					pair->second.GetAsScope(index)->Reparent(this);
+					datum.GetAsScope(index)->Reparent(this, &datum, index);
 				}
 			}
 		}
@@ -1,6 +1,12 @@
 #pragma once
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <string_view>
+#include <utility>
 #include "Vector.h"
-#include "HashMap.h"
+#include "Symbol.h"
 #include "Datum.h"
 #include "Factory.h"
 #include "gsl/gsl"
@@ -14,16 +20,97 @@ namespace FieaGameEngine
 	class Scope : public FieaGameEngine::RTTI
 	{
 		friend JsonTableParseHelper;
+		friend Datum;
 		RTTI_DECLARATIONS(Scope, FieaGameEngine::RTTI);
 	public:
-		using Pair_Type = std::pair<const std::string, Datum>;
+		using Pair_Type = std::pair<const Symbol, Datum>;
+
+		/// <summary>
+		/// A name resolved by Search, remembering the scope it was searched from, the scope and Datum it resolved to, and the generation at which that answer was last known to hold.
+		/// Searching with the same Binding again returns the remembered Datum without any hash lookups until a scope on the path between the two gains or loses entries or is moved to another parent.
+		/// </summary>
+		class Binding final
+		{
+			friend Scope;
+
+		public:
+			/// <summary>
+			/// Creates a Binding for the null Symbol.
+			/// </summary>
+			Binding() = default;
+			/// <summary>
+			/// Creates an unresolved Binding for the given name. It is resolved by the first Search it is passed to.
+			/// </summary>
+			/// <param name="name">The Symbol to look for.</param>
+			explicit Binding(Symbol name);
+			/// <summary>
+			/// Returns the name the Binding looks for.
+			/// </summary>
+			/// <returns>The Symbol of the name.</returns>
+			[[nodiscard]] const Symbol& Name() const;
+			/// <summary>
+			/// Returns the scope the name was found in by the last Search, or nullptr if it was not found or has not been searched for.
+			/// </summary>
+			/// <returns>A pointer to the owning Scope.</returns>
+			[[nodiscard]] Scope* FoundScope() const;
+
+		private:
+			[[nodiscard]] bool IsCurrent() const;
+
+			Symbol _name{};
+			Scope* _origin{ nullptr };
+			Scope* _scope{ nullptr };
+			Datum* _datum{ nullptr };
+			std::uint64_t _generation{ 0 };
+		};
 
-	protected:
-		Vector<Pair_Type*> _orderVector{};
-		HashMap<std::string, Datum> _table{};
 	private:
+		/// <summary>
+		/// The first segment of pairs holds this many, and each one after it twice as many as the one before.
+		/// </summary>
+		static constexpr std::size_t FirstSegmentShift{ 2 };
+		static constexpr std::size_t FirstSegmentSize{ std::size_t{ 1 } << FirstSegmentShift };
+		static constexpr std::uint32_t EmptySlot{ UINT32_MAX };
+		static constexpr std::size_t MinimumIndexCapacity{ 8 };
+
+		/// <summary>
+		/// The pairs, stored contiguously in insertion order across segments that double in size. A segment never moves once allocated, so references to Datums
+		/// stay valid as the scope grows. The segment pointers of scopes with up to 60 entries are stored in the Scope itself.
+		/// </summary>
+		SmallVector<Pair_Type*, 4> _segments{};
+		/// <summary>
+		/// An open addressed table of the positions of the pairs, probed linearly from the hash of each name and kept at most half full. Empty slots hold EmptySlot.
+		/// </summary>
+		std::uint32_t* _index{ nullptr };
+		std::size_t _indexCapacity{ 0 };
 		std::size_t _size{ 0 };
 		Scope* _parent{ nullptr };
+		/// <summary>
+		/// The table Datum in the parent that holds this scope, and the index it is held at, so that removing it from the parent needs no search.
+		/// </summary>
+		Datum* _parentDatum{ nullptr };
+		std::size_t _parentIndex{ 0 };
+		std::pmr::memory_resource* _resource{ nullptr };
+		/// <summary>
+		/// The scope this one is an instance of, which is read from for every name this scope does not hold, or nullptr.
+		/// </summary>
+		const Scope* _prototype{ nullptr };
+		/// <summary>
+		/// When this scope was created or last gained or lost entries or a parent, taken from a counter shared by every scope. A Binding stamped with a later generation
+		/// than every scope on its path is still correct.
+		/// </summary>
+		std::uint64_t _generation{ NextGeneration() };
+
+		inline static std::uint64_t _latestGeneration{ 0 };
+
+		/// <summary>
+		/// Sits in front of every Scope allocated with new, recording the memory resource it came from and its size so that delete can hand it back.
+		/// </summary>
+		struct alignas(std::max_align_t) AllocationHeader final
+		{
+			std::pmr::memory_resource* _resource{ nullptr };
+			std::size_t _bytes{ 0 };
+		};
 
 	public:
 		/// <summary>
@@ -31,6 +118,14 @@ namespace FieaGameEngine
 		/// </summary>
 		Scope() = default;
 		/// <summary>
+		/// Constructs an empty root scope that allocates from the given memory resource. Every scope created beneath it with AppendScope, the entries of their tables
+		/// and the storage of their Datums come from the same resource, so a level loaded into it can be thrown away with one release of the resource once the root
+		/// has been destroyed. The resource must outlive the scope. Strings, the list of segments of very large scopes, and scopes that are adopted rather than appended
+		/// still use the global heap. Copies of the scope use the global heap, and moves keep the resource.
+		/// </summary>
+		/// <param name="resource">The memory resource to allocate from, or nullptr for the global heap.</param>
+		explicit Scope(std::pmr::memory_resource* resource);
+		/// <summary>
 		/// The Scope destructor. This destructor is virtual so that it can be overridden by inherited classes.
 		/// </summary>
 		virtual ~Scope();
@@ -87,6 +182,55 @@ namespace FieaGameEngine
 		/// <returns>A pointer to the newly allocated scope.</returns>
 		virtual gsl::owner<Scope*> Clone() const;
 		/// <summary>
+		/// Turns copy-on-write on or off for every Datum in this scope and the scopes nested in it, so that copies share their heap storage until written to.
+		/// Tables are never shared, since every copy clones the scopes it holds.
+		/// </summary>
+		/// <param name="copyOnWrite">Whether copies should share storage.</param>
+		void SetCopyOnWrite(bool copyOnWrite);
+		/// <summary>
+		/// Makes this scope an instance of the given prototype, which must outlive it and is never written through it. A name this scope does not hold is read from
+		/// the prototype by the const Find, and copied into this scope by the first Append, non-const Find or Search that reaches it, so an instance only stores the
+		/// entries it has written. Each table this scope already holds receives clones of the scopes the prototype holds under the same name, since those scopes
+		/// search upward from the scope holding them. Size, ordered access and comparison only cover the entries this scope holds. Copies share the prototype,
+		/// and Clear keeps it.
+		/// </summary>
+		/// <param name="prototype">The scope to read from.</param>
+		void SetPrototype(const Scope& prototype);
+		/// <summary>
+		/// Returns the scope this one is an instance of.
+		/// </summary>
+		/// <returns>A pointer to the prototype, or nullptr if this scope is not an instance.</returns>
+		[[nodiscard]] const Scope* Prototype() const;
+		/// <summary>
+		/// Returns the memory resource the scope's table, Datums and appended scopes are allocated from.
+		/// </summary>
+		/// <returns>The memory resource, or nullptr for the global heap.</returns>
+		[[nodiscard]] std::pmr::memory_resource* Resource() const;
+		/// <summary>
+		/// Allocates a scope, or any class derived from it, from the global heap.
+		/// </summary>
+		/// <param name="size">The size of the object.</param>
+		/// <returns>The memory for the object.</returns>
+		static void* operator new(std::size_t size);
+		/// <summary>
+		/// Allocates a scope, or any class derived from it, from the given memory resource. Deleting it hands the memory back to the same resource.
+		/// </summary>
+		/// <param name="size">The size of the object.</param>
+		/// <param name="resource">The memory resource to allocate from, or nullptr for the global heap.</param>
+		/// <returns>The memory for the object.</returns>
+		static void* operator new(std::size_t size, std::pmr::memory_resource* resource);
+		/// <summary>
+		/// Returns the memory of a scope to wherever it was allocated from.
+		/// </summary>
+		/// <param name="pointer">The memory of the object.</param>
+		static void operator delete(void* pointer) noexcept;
+		/// <summary>
+		/// Returns the memory of a scope whose constructor threw to the memory resource it was allocated from.
+		/// </summary>
+		/// <param name="pointer">The memory of the object.</param>
+		/// <param name="resource">The memory resource it was allocated from.</param>
+		static void operator delete(void* pointer, std::pmr::memory_resource* resource) noexcept;
+		/// <summary>
 		/// Allocates memory for the scope if scope size is already known.
 		/// </summary>
 		/// <param name="size">The number of entries in the scope table.</param>
@@ -98,37 +242,82 @@ namespace FieaGameEngine
 		/// <param name="name">The string to search for.</param>
 		/// <param name="type">The type that you wish for any newly created datum to be.</param>
 		/// <returns>A reference to the found or newly created Datum.</returns>
-		Datum& Append(const std::string& name, Datum::DatumTypes type = Datum::DatumTypes::Unknown);
+		Datum& Append(std::string_view name, Datum::DatumTypes type = Datum::DatumTypes::Unknown);
+		/// <summary>
+		/// Append keyed on an interned name. Finding an existing entry only compares the Symbol's precomputed hash and identity.
+		/// </summary>
+		/// <param name="name">The Symbol to search for.</param>
+		/// <param name="type">The type that you wish for any newly created datum to be.</param>
+		/// <returns>A reference to the found or newly created Datum.</returns>
+		Datum& Append(const Symbol& name, Datum::DatumTypes type = Datum::DatumTypes::Unknown);
 		/// <summary>
 		/// Searches the scope in order to find a string,Datum pair that corresponds to said string. If none is found, then nullptr is returned.
+		/// The name is looked up as a view, so searching with a literal or substring does not allocate a std::string.
 		/// </summary>
 		/// <param name="name">The string to search for.</param>
 		/// <returns>A Datum pointer.</returns>
-		[[nodiscard]] Datum* Find(const std::string& name);
+		[[nodiscard]] Datum* Find(std::string_view name);
+		/// <summary>
+		/// Find keyed on an interned name, which never hashes or compares characters.
+		/// </summary>
+		/// <param name="name">The Symbol to search for.</param>
+		/// <returns>A Datum pointer.</returns>
+		[[nodiscard]] Datum* Find(const Symbol& name);
+		/// <summary>
+		/// Find that never changes the scope. A name an instance does not hold is found in its prototype, without being copied.
+		/// </summary>
+		/// <param name="name">The string to search for.</param>
+		/// <returns>A const Datum pointer.</returns>
+		[[nodiscard]] const Datum* Find(std::string_view name) const;
+		/// <summary>
+		/// Const Find keyed on an interned name.
+		/// </summary>
+		/// <param name="name">The Symbol to search for.</param>
+		/// <returns>A const Datum pointer.</returns>
+		[[nodiscard]] const Datum* Find(const Symbol& name) const;
 		/// <summary>
 		/// Does the same work as Append, but also populates the Datum with a heap allocated scope.
 		/// </summary>
 		/// <param name="name">The string you wish to associate with the new scope.</param>
 		/// <returns>A reference to the newly created scope.</returns>
-		Scope& AppendScope(const std::string& name);
+		Scope& AppendScope(std::string_view name);
+		/// <summary>
+		/// AppendScope keyed on an interned name.
+		/// </summary>
+		/// <param name="name">The Symbol you wish to associate with the new scope.</param>
+		/// <returns>A reference to the newly created scope.</returns>
+		Scope& AppendScope(const Symbol& name);
 		/// <summary>
 		/// Serves as a convenient wrapper to Append.
 		/// </summary>
 		/// <param name="name">The string you wish to create a new pair for.</param>
 		/// <returns>A reference to the found or newly created Datum.</returns>
-		Datum& operator[](const std::string& name);
+		Datum& operator[](std::string_view name);
+		/// <summary>
+		/// Serves as a convenient wrapper to Append keyed on an interned name.
+		/// </summary>
+		/// <param name="name">The Symbol you wish to create a new pair for.</param>
+		/// <returns>A reference to the found or newly created Datum.</returns>
+		Datum& operator[](const Symbol& name);
 		/// <summary>
 		/// Returns a Datum corresponding to the order in which it was added.
 		/// </summary>
 		/// <param name="index">The index at which to grab from.</param>
 		/// <returns>A Datum reference.</returns>
-		[[nodiscard]] Datum& operator[](std::size_t index);
+		[[nodiscard]] inline Datum& operator[](std::size_t index);
 		/// <summary>
 		/// Search looks up the hierarchy of scopes for the most closely nested Datum. Returns nullptr if not found.
+		/// The name is resolved to a Symbol once, and a name that was never interned cannot be in any scope, so it returns right away.
 		/// </summary>
 		/// <param name="name">The string to look for.</param>
 		/// <returns>A pointer to a the found Datum.</returns>
-		[[nodiscard]] Datum* Search(const std::string& name);
+		[[nodiscard]] Datum* Search(std::string_view name);
+		/// <summary>
+		/// Search keyed on an interned name. Each scope up the hierarchy is checked without hashing the name again.
+		/// </summary>
+		/// <param name="name">The Symbol to look for.</param>
+		/// <returns>A pointer to a the found Datum.</returns>
+		[[nodiscard]] Datum* Search(const Symbol& name);
 		/// <summary>
 		/// Search looks up the hierarchy of scopes for the most closely nested Datum. Returns nullptr if not found.
 		/// An output parameter of type Scope*& can be passed in to find the owning Scope.
@@ -136,7 +325,22 @@ namespace FieaGameEngine
 		/// <param name="name">The string to look for.</param>
 		/// <param name="foundScope">The Scope pointer reference to put the found scope pointer into.</param>
 		/// <returns>A pointer to the Datum that was found.</returns>
-		[[nodiscard]] Datum* Search(const std::string& name, Scope*& foundScope);
+		[[nodiscard]] Datum* Search(std::string_view name, Scope*& foundScope);
+		/// <summary>
+		/// Search keyed on an interned name, with an output parameter for the owning Scope.
+		/// </summary>
+		/// <param name="name">The Symbol to look for.</param>
+		/// <param name="foundScope">The Scope pointer reference to put the found scope pointer into.</param>
+		/// <returns>A pointer to the Datum that was found.</returns>
+		[[nodiscard]] Datum* Search(const Symbol& name, Scope*& foundScope);
+		/// <summary>
+		/// Search that remembers its answer in the given Binding. While no scope between this one and the one the name was found in has changed shape since,
+		/// and this is the scope the Binding was last searched from, the remembered Datum is returned without walking the hierarchy. Names that were not found are
+		/// remembered too, until a scope anywhere up to the root changes.
+		/// </summary>
+		/// <param name="binding">The Binding to resolve and update.</param>
+		/// <returns>A pointer to the found Datum.</returns>
+		[[nodiscard]] Datum* Search(Binding& binding);
 		/// <summary>
 		/// Returns the pointer to the owning parent. Returns nullptr if there is none.
 		/// </summary>
@@ -147,14 +351,22 @@ namespace FieaGameEngine
 		/// </summary>
 		/// <param name="child">Scope that will be adopted.</param>
 		/// <param name="name">The string to associate the scope with.</param>
-		void Adopt(Scope& child, const std::string& name);
+		void Adopt(Scope& child, std::string_view name);
 		/// <summary>
-		/// Attempts to remove the calling scope from its parent.
+		/// Adopt keyed on an interned name.
+		/// </summary>
+		/// <param name="child">Scope that will be adopted.</param>
+		/// <param name="name">The Symbol to associate the scope with.</param>
+		void Adopt(Scope& child, const Symbol& name);
+		/// <summary>
+		/// Attempts to remove the calling scope from its parent. The last scope in the same Datum of the parent takes its place, so this takes constant time
+		/// but does not keep the order of the remaining siblings.
 		/// </summary>
 		/// <returns>Returns a pointer to the parent.</returns>
 		Scope* Orphan();
 		/// <summary>
-		/// Removes the passed in child from the scope.
+		/// Removes the passed in child from the scope. The last scope in the same Datum takes its place, so this takes constant time but does not keep the
+		/// order of the remaining siblings. Returns nullptr if the scope is not a child of this one.
 		/// </summary>
 		/// <param name="child">The scope to be orphaned.</param>
 		/// <returns>A pointer to the owning scope.</returns>
@@ -175,15 +387,15 @@ namespace FieaGameEngine
 		/// Returns the size of the scope.
 		/// </summary>
 		/// <returns>The number of entries in the scope.</returns>
-		[[nodiscard]] inline std::size_t Size();
+		[[nodiscard]] inline std::size_t Size() const;
 		/// <summary>
 		/// Checks whether or not the scope is empty.
 		/// </summary>
 		/// <returns>Whether or not the scope's size is set to 0;</returns>
-		[[nodiscard]] inline bool IsEmpty();
+		[[nodiscard]] inline bool IsEmpty() const;
 		/// <summary>
 		/// Returns a std::pair that contains a Datum* and std::size_t of the scope contained within the current scope.
-		/// If it is not found nullptr,0 are returned.
+		/// If it is not found nullptr,0 are returned. Every child records where it is held, so this takes constant time.
 		/// </summary>
 		/// <param name="scope">The scope to search for.</param>
 		/// <returns>A pair of a Datum pointer and a std::size_t representing the location of the found scope.</returns>
@@ -193,10 +405,86 @@ namespace FieaGameEngine
 		/// </summary>
 		virtual void Clear();
 
+	protected:
+		/// <summary>
+		/// Returns the name and Datum at the given position in the order they were added.
+		/// </summary>
+		/// <param name="index">The position of the pair.</param>
+		/// <returns>A reference to the pair.</returns>
+		[[nodiscard]] inline Pair_Type& PairAt(std::size_t index);
+		[[nodiscard]] inline const Pair_Type& PairAt(std::size_t index) const;
+
 	private:
-		Scope(Scope* parent);
-		inline void Reparent(Scope* parent);
+		/// <summary>
+		/// Creates an empty scope with no parent, allocated from and allocating from this scope's memory resource.
+		/// </summary>
+		/// <returns>A pointer to the newly allocated scope.</returns>
+		gsl::owner<Scope*> NewChild() const;
+		/// <summary>
+		/// Advances the shared generation counter and returns its new value.
+		/// </summary>
+		/// <returns>A generation later than every one handed out before.</returns>
+		static std::uint64_t NextGeneration();
+		/// <summary>
+		/// Marks this scope as having changed shape, which invalidates every Binding whose path runs through it.
+		/// </summary>
+		inline void BumpGeneration();
+		/// <summary>
+		/// Records the scope's new parent and where in it the scope is held.
+		/// </summary>
+		/// <param name="parent">The new parent, or nullptr.</param>
+		/// <param name="datum">The table Datum of the parent holding the scope, or nullptr.</param>
+		/// <param name="index">The index the scope is held at.</param>
+		inline void Reparent(Scope* parent, Datum* datum, std::size_t index);
+		Datum& Insert(Symbol name, Datum::DatumTypes type);
+		/// <summary>
+		/// Copies the entry the prototype holds under the given name into this scope. Payloads are shared where the prototype's Datums allow it, and nested scopes are cloned.
+		/// </summary>
+		/// <param name="name">The name to look for in the prototype.</param>
+		/// <returns>A pointer to the copied Datum, or nullptr if the prototype does not hold the name either or it wraps external storage.</returns>
+		Datum* Inherit(const Symbol& name);
+		/// <summary>
+		/// Returns where the pair at the given position is stored, whether or not one has been constructed there yet.
+		/// </summary>
+		[[nodiscard]] inline Pair_Type* SlotAt(std::size_t index) const;
+		/// <summary>
+		/// Allocates segments until the scope can hold the given number of pairs.
+		/// </summary>
+		void ReserveSegments(std::size_t size);
+		/// <summary>
+		/// Returns the position of the pair with the given name, or the size of the scope if there is none.
+		/// </summary>
+		template <typename TName>
+		[[nodiscard]] std::size_t IndexOf(const TName& name, std::size_t hash) const;
+		/// <summary>
+		/// Records the position of a newly added pair in the index, growing the index first if it would become more than half full.
+		/// </summary>
+		void AddToIndex(std::size_t hash, std::size_t index);
+		/// <summary>
+		/// Reallocates the index with the given capacity, a power of two, and places every pair in it again.
+		/// </summary>
+		void RebuildIndex(std::size_t capacity);
+		/// <summary>
+		/// Destroys every pair, keeping the segments and index for reuse.
+		/// </summary>
+		void DestroyPairs();
+		/// <summary>
+		/// Returns the segments and index to the memory resource they came from.
+		/// </summary>
+		void ReleaseStorage();
+		/// <summary>
+		/// Takes the pairs, segments and index of another scope, leaving it empty.
+		/// </summary>
+		void StealStorage(Scope& other);
+		void* Allocate(std::size_t bytes, std::size_t alignment) const;
+		void Deallocate(void* pointer, std::size_t bytes, std::size_t alignment) const;
 		inline void CopyHelper(const Scope& sourceScope, Scope& destinationScope);
+		/// <summary>
+		/// Copies every pair of another scope into this empty one in a single pass, sized up front. The pairs land at the same positions as in the source,
+		/// so its index is copied as is instead of hashing every name again. Nested scopes are cloned.
+		/// </summary>
+		/// <param name="other">The scope to copy.</param>
+		void CloneFrom(const Scope& other);
 		void ReparentImmediateFamily();
 	};
 	ConcreteFactory(Scope, Scope);
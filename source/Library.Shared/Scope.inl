@@ -6,17 +6,48 @@ inline FieaGameEngine::Scope* FieaGameEngine::Scope::GetParent()
 	return _parent;
 }
 
-inline std::size_t FieaGameEngine::Scope::Size()
+inline std::size_t FieaGameEngine::Scope::Size() const
 {
 	return _size;
 }
 
-inline bool FieaGameEngine::Scope::IsEmpty()
+inline bool FieaGameEngine::Scope::IsEmpty() const
 {
 	return _size == 0;
 }
 
-inline void FieaGameEngine::Scope::Reparent(Scope* parent)
+inline FieaGameEngine::Datum& FieaGameEngine::Scope::operator[](std::size_t index)
+{
+	return PairAt(index).second;
+}
+
+inline FieaGameEngine::Scope::Pair_Type& FieaGameEngine::Scope::PairAt(std::size_t index)
+{
+	return const_cast<Pair_Type&>(std::as_const(*this).PairAt(index));
+}
+
+inline const FieaGameEngine::Scope::Pair_Type& FieaGameEngine::Scope::PairAt(std::size_t index) const
+{
+	assert(index < _size);
+	return *SlotAt(index);
+}
+
+inline FieaGameEngine::Scope::Pair_Type* FieaGameEngine::Scope::SlotAt(std::size_t index) const
+{
+	const std::size_t biased{ index + FirstSegmentSize };
+	const std::size_t segment{ static_cast<std::size_t>(std::bit_width(biased)) - 1 - FirstSegmentShift };
+	return _segments[segment] + (biased - (FirstSegmentSize << segment));
+}
+
+inline void FieaGameEngine::Scope::BumpGeneration()
+{
+	_generation = NextGeneration();
+}
+
+inline void FieaGameEngine::Scope::Reparent(Scope* parent, Datum* datum, std::size_t index)
 {
 	_parent = parent;
+	_parentDatum = datum;
+	_parentIndex = index;
+	BumpGeneration();
 }
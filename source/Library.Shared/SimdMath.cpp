@@ -0,0 +1,935 @@
+#include "pch.h"
+#include "SimdMath.h"
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+
+#if defined(_M_X64) || defined(__x86_64__) || defined(_M_IX86) || defined(__i386__)
+#define FIEA_SIMD_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(FIEA_SIMD_X86) && (defined(__GNUC__) || defined(__clang__))
+#define FIEA_SIMD_AVX2 __attribute__((target("avx2,fma")))
+#else
+#define FIEA_SIMD_AVX2
+#endif
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// One implementation of every kernel, all working on raw arrays. vec4 arrays are passed as four floats per vector and mat4s as sixteen, column by column.
+	/// The find kernels return the index of the first match, or count when there is none.
+	/// </summary>
+	struct SimdMath::Kernels final
+	{
+		InstructionSet _instructionSet;
+		void(*_add)(const float* lhs, const float* rhs, float* result, std::size_t count);
+		void(*_subtract)(const float* lhs, const float* rhs, float* result, std::size_t count);
+		void(*_multiply)(const float* lhs, const float* rhs, float* result, std::size_t count);
+		void(*_multiplyAdd)(const float* lhs, const float* rhs, const float* addend, float* result, std::size_t count);
+		void(*_scale)(const float* values, float scale, float* result, std::size_t count);
+		void(*_lerp)(const float* from, const float* to, float t, float* result, std::size_t count);
+		float(*_dot)(const float* lhs, const float* rhs, std::size_t count);
+		void(*_dot4)(const float* lhs, const float* rhs, float* result, std::size_t count);
+		void(*_transform)(const float* matrix, const float* values, float* result, std::size_t count);
+		void(*_transformEach)(const float* matrices, const float* values, float* result, std::size_t count);
+		std::size_t(*_findInt)(const int* values, int value, std::size_t count);
+		std::size_t(*_findFloat)(const float* values, float value, std::size_t count);
+		std::size_t(*_find4)(const float* values, const float* value, std::size_t count);
+		std::size_t(*_find16)(const float* values, const float* value, std::size_t count);
+		std::size_t(*_findPointer)(const void* const* values, const void* value, std::size_t count);
+	};
+
+	namespace
+	{
+		static_assert(sizeof(glm::vec4) == 4 * sizeof(float), "vec4 arrays are processed as packed floats.");
+		static_assert(sizeof(glm::mat4) == 16 * sizeof(float), "mat4 arrays are processed as packed floats.");
+
+		const float* Floats(const glm::vec4* values)
+		{
+			return reinterpret_cast<const float*>(values);
+		}
+
+		float* Floats(glm::vec4* values)
+		{
+			return reinterpret_cast<float*>(values);
+		}
+
+		const float* Floats(const glm::mat4* values)
+		{
+			return reinterpret_cast<const float*>(values);
+		}
+
+		namespace Scalar
+		{
+			void Add(const float* lhs, const float* rhs, float* result, std::size_t count)
+			{
+				for (std::size_t index{ 0 }; index < count; ++index)
+				{
+					result[index] = lhs[index] + rhs[index];
+				}
+			}
+
+			void Subtract(const float* lhs, const float* rhs, float* result, std::size_t count)
+			{
+				for (std::size_t index{ 0 }; index < count; ++index)
+				{
+					result[index] = lhs[index] - rhs[index];
+				}
+			}
+
+			void Multiply(const float* lhs, const float* rhs, float* result, std::size_t count)
+			{
+				for (std::size_t index{ 0 }; index < count; ++index)
+				{
+					result[index] = lhs[index] * rhs[index];
+				}
+			}
+
+			void MultiplyAdd(const float* lhs, const float* rhs, const float* addend, float* result, std::size_t count)
+			{
+				for (std::size_t index{ 0 }; index < count; ++index)
+				{
+					result[index] = lhs[index] * rhs[index] + addend[index];
+				}
+			}
+
+			void Scale(const float* values, float scale, float* result, std::size_t count)
+			{
+				for (std::size_t index{ 0 }; index < count; ++index)
+				{
+					result[index] = values[index] * scale;
+				}
+			}
+
+			void Lerp(const float* from, const float* to, float t, float* result, std::size_t count)
+			{
+				for (std::size_t index{ 0 }; index < count; ++index)
+				{
+					result[index] = from[index] + (to[index] - from[index]) * t;
+				}
+			}
+
+			float Dot(const float* lhs, const float* rhs, std::size_t count)
+			{
+				float sum{ 0.0f };
+				for (std::size_t index{ 0 }; index < count; ++index)
+				{
+					sum += lhs[index] * rhs[index];
+				}
+
+				return sum;
+			}
+
+			void Dot4(const float* lhs, const float* rhs, float* result, std::size_t count)
+			{
+				for (std::size_t index{ 0 }; index < count; ++index)
+				{
+					result[index] = Dot(lhs + index * 4, rhs + index * 4, 4);
+				}
+			}
+
+			void TransformOne(const float* matrix, const float* value, float* result)
+			{
+				const float x{ value[0] }, y{ value[1] }, z{ value[2] }, w{ value[3] };
+				for (std::size_t row{ 0 }; row < 4; ++row)
+				{
+					result[row] = matrix[row] * x + matrix[4 + row] * y + matrix[8 + row] * z + matrix[12 + row] * w;
+				}
+			}
+
+			void Transform(const float* matrix, const float* values, float* result, std::size_t count)
+			{
+				for (std::size_t index{ 0 }; index < count; ++index)
+				{
+					TransformOne(matrix, values + index * 4, result + index * 4);
+				}
+			}
+
+			void TransformEach(const float* matrices, const float* values, float* result, std::size_t count)
+			{
+				for (std::size_t index{ 0 }; index < count; ++index)
+				{
+					TransformOne(matrices + index * 16, values + index * 4, result + index * 4);
+				}
+			}
+			std::size_t FindInt(const int* values, int value, std::size_t count)
+			{
+				std::size_t index{ 0 };
+				while (index < count && values[index] != value)
+				{
+					++index;
+				}
+
+				return index;
+			}
+
+			std::size_t FindFloat(const float* values, float value, std::size_t count)
+			{
+				std::size_t index{ 0 };
+				while (index < count && values[index] != value)
+				{
+					++index;
+				}
+
+				return index;
+			}
+
+			template <std::size_t Width>
+			bool Equal(const float* lhs, const float* rhs)
+			{
+				for (std::size_t component{ 0 }; component < Width; ++component)
+				{
+					if (lhs[component] != rhs[component])
+					{
+						return false;
+					}
+				}
+
+				return true;
+			}
+
+			std::size_t Find4(const float* values, const float* value, std::size_t count)
+			{
+				std::size_t index{ 0 };
+				while (index < count && !Equal<4>(values + index * 4, value))
+				{
+					++index;
+				}
+
+				return index;
+			}
+
+			std::size_t Find16(const float* values, const float* value, std::size_t count)
+			{
+				std::size_t index{ 0 };
+				while (index < count && !Equal<16>(values + index * 16, value))
+				{
+					++index;
+				}
+
+				return index;
+			}
+
+			std::size_t FindPointer(const void* const* values, const void* value, std::size_t count)
+			{
+				std::size_t index{ 0 };
+				while (index < count && values[index] != value)
+				{
+					++index;
+				}
+
+				return index;
+			}
+		}
+
+#if defined(FIEA_SIMD_X86)
+		namespace SSE
+		{
+			void Add(const float* lhs, const float* rhs, float* result, std::size_t count)
+			{
+				std::size_t index{ 0 };
+				for (; index + 4 <= count; index += 4)
+				{
+					_mm_storeu_ps(result + index, _mm_add_ps(_mm_loadu_ps(lhs + index), _mm_loadu_ps(rhs + index)));
+				}
+				Scalar::Add(lhs + index, rhs + index, result + index, count - index);
+			}
+
+			void Subtract(const float* lhs, const float* rhs, float* result, std::size_t count)
+			{
+				std::size_t index{ 0 };
+				for (; index + 4 <= count; index += 4)
+				{
+					_mm_storeu_ps(result + index, _mm_sub_ps(_mm_loadu_ps(lhs + index), _mm_loadu_ps(rhs + index)));
+				}
+				Scalar::Subtract(lhs + index, rhs + index, result + index, count - index);
+			}
+
+			void Multiply(const float* lhs, const float* rhs, float* result, std::size_t count)
+			{
+				std::size_t index{ 0 };
+				for (; index + 4 <= count; index += 4)
+				{
+					_mm_storeu_ps(result + index, _mm_mul_ps(_mm_loadu_ps(lhs + index), _mm_loadu_ps(rhs + index)));
+				}
+				Scalar::Multiply(lhs + index, rhs + index, result + index, count - index);
+			}
+
+			void MultiplyAdd(const float* lhs, const float* rhs, const float* addend, float* result, std::size_t count)
+			{
+				std::size_t index{ 0 };
+				for (; index + 4 <= count; index += 4)
+				{
+					const __m128 product{ _mm_mul_ps(_mm_loadu_ps(lhs + index), _mm_loadu_ps(rhs + index)) };
+					_mm_storeu_ps(result + index, _mm_add_ps(product, _mm_loadu_ps(addend + index)));
+				}
+				Scalar::MultiplyAdd(lhs + index, rhs + index, addend + index, result + index, count - index);
+			}
+
+			void Scale(const float* values, float scale, float* result, std::size_t count)
+			{
+				const __m128 factor{ _mm_set1_ps(scale) };
+				std::size_t index{ 0 };
+				for (; index + 4 <= count; index += 4)
+				{
+					_mm_storeu_ps(result + index, _mm_mul_ps(_mm_loadu_ps(values + index), factor));
+				}
+				Scalar::Scale(values + index, scale, result + index, count - index);
+			}
+
+			void Lerp(const float* from, const float* to, float t, float* result, std::size_t count)
+			{
+				const __m128 factor{ _mm_set1_ps(t) };
+				std::size_t index{ 0 };
+				for (; index + 4 <= count; index += 4)
+				{
+					const __m128 start{ _mm_loadu_ps(from + index) };
+					const __m128 delta{ _mm_sub_ps(_mm_loadu_ps(to + index), start) };
+					_mm_storeu_ps(result + index, _mm_add_ps(start, _mm_mul_ps(delta, factor)));
+				}
+				Scalar::Lerp(from + index, to + index, t, result + index, count - index);
+			}
+
+			float HorizontalSum(__m128 values)
+			{
+				const __m128 pairs{ _mm_add_ps(values, _mm_movehl_ps(values, values)) };
+				return _mm_cvtss_f32(_mm_add_ss(pairs, _mm_shuffle_ps(pairs, pairs, 0x55)));
+			}
+
+			float Dot(const float* lhs, const float* rhs, std::size_t count)
+			{
+				__m128 sum{ _mm_setzero_ps() };
+				std::size_t index{ 0 };
+				for (; index + 4 <= count; index += 4)
+				{
+					sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(lhs + index), _mm_loadu_ps(rhs + index)));
+				}
+
+				return HorizontalSum(sum) + Scalar::Dot(lhs + index, rhs + index, count - index);
+			}
+
+			/// <summary>
+			/// Multiplies four pairs of vectors, then transposes the products so that adding the four rows gives all four dot products at once.
+			/// </summary>
+			void Dot4(const float* lhs, const float* rhs, float* result, std::size_t count)
+			{
+				std::size_t index{ 0 };
+				for (; index + 4 <= count; index += 4)
+				{
+					const float* left{ lhs + index * 4 };
+					const float* right{ rhs + index * 4 };
+					__m128 first{ _mm_mul_ps(_mm_loadu_ps(left), _mm_loadu_ps(right)) };
+					__m128 second{ _mm_mul_ps(_mm_loadu_ps(left + 4), _mm_loadu_ps(right + 4)) };
+					__m128 third{ _mm_mul_ps(_mm_loadu_ps(left + 8), _mm_loadu_ps(right + 8)) };
+					__m128 fourth{ _mm_mul_ps(_mm_loadu_ps(left + 12), _mm_loadu_ps(right + 12)) };
+					_MM_TRANSPOSE4_PS(first, second, third, fourth);
+					_mm_storeu_ps(result + index, _mm_add_ps(_mm_add_ps(first, second), _mm_add_ps(third, fourth)));
+				}
+				Scalar::Dot4(lhs + index * 4, rhs + index * 4, result + index, count - index);
+			}
+
+			__m128 TransformOne(__m128 column0, __m128 column1, __m128 column2, __m128 column3, __m128 value)
+			{
+				__m128 result{ _mm_mul_ps(column0, _mm_shuffle_ps(value, value, 0x00)) };
+				result = _mm_add_ps(result, _mm_mul_ps(column1, _mm_shuffle_ps(value, value, 0x55)));
+				result = _mm_add_ps(result, _mm_mul_ps(column2, _mm_shuffle_ps(value, value, 0xAA)));
+				return _mm_add_ps(result, _mm_mul_ps(column3, _mm_shuffle_ps(value, value, 0xFF)));
+			}
+
+			void Transform(const float* matrix, const float* values, float* result, std::size_t count)
+			{
+				const __m128 column0{ _mm_loadu_ps(matrix) };
+				const __m128 column1{ _mm_loadu_ps(matrix + 4) };
+				const __m128 column2{ _mm_loadu_ps(matrix + 8) };
+				const __m128 column3{ _mm_loadu_ps(matrix + 12) };
+				for (std::size_t index{ 0 }; index < count; ++index)
+				{
+					_mm_storeu_ps(result + index * 4, TransformOne(column0, column1, column2, column3, _mm_loadu_ps(values + index * 4)));
+				}
+			}
+
+			void TransformEach(const float* matrices, const float* values, float* result, std::size_t count)
+			{
+				for (std::size_t index{ 0 }; index < count; ++index)
+				{
+					const float* matrix{ matrices + index * 16 };
+					const __m128 value{ _mm_loadu_ps(values + index * 4) };
+					_mm_storeu_ps(result + index * 4, TransformOne(_mm_loadu_ps(matrix), _mm_loadu_ps(matrix + 4), _mm_loadu_ps(matrix + 8), _mm_loadu_ps(matrix + 12), value));
+				}
+			}
+			std::size_t FirstSet(int mask)
+			{
+				return static_cast<std::size_t>(std::countr_zero(static_cast<unsigned int>(mask)));
+			}
+
+			std::size_t FindInt(const int* values, int value, std::size_t count)
+			{
+				const __m128i needle{ _mm_set1_epi32(value) };
+				std::size_t index{ 0 };
+				for (; index + 4 <= count; index += 4)
+				{
+					const __m128i equal{ _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(values + index)), needle) };
+					const int mask{ _mm_movemask_ps(_mm_castsi128_ps(equal)) };
+					if (mask != 0)
+					{
+						return index + FirstSet(mask);
+					}
+				}
+
+				return index + Scalar::FindInt(values + index, value, count - index);
+			}
+
+			std::size_t FindFloat(const float* values, float value, std::size_t count)
+			{
+				const __m128 needle{ _mm_set1_ps(value) };
+				std::size_t index{ 0 };
+				for (; index + 4 <= count; index += 4)
+				{
+					const int mask{ _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(values + index), needle)) };
+					if (mask != 0)
+					{
+						return index + FirstSet(mask);
+					}
+				}
+
+				return index + Scalar::FindFloat(values + index, value, count - index);
+			}
+
+			std::size_t Find4(const float* values, const float* value, std::size_t count)
+			{
+				const __m128 needle{ _mm_loadu_ps(value) };
+				for (std::size_t index{ 0 }; index < count; ++index)
+				{
+					if (_mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(values + index * 4), needle)) == 0xF)
+					{
+						return index;
+					}
+				}
+
+				return count;
+			}
+
+			std::size_t Find16(const float* values, const float* value, std::size_t count)
+			{
+				const __m128 column0{ _mm_loadu_ps(value) };
+				const __m128 column1{ _mm_loadu_ps(value + 4) };
+				const __m128 column2{ _mm_loadu_ps(value + 8) };
+				const __m128 column3{ _mm_loadu_ps(value + 12) };
+				for (std::size_t index{ 0 }; index < count; ++index)
+				{
+					const float* matrix{ values + index * 16 };
+					const __m128 equal01{ _mm_and_ps(_mm_cmpeq_ps(_mm_loadu_ps(matrix), column0), _mm_cmpeq_ps(_mm_loadu_ps(matrix + 4), column1)) };
+					const __m128 equal23{ _mm_and_ps(_mm_cmpeq_ps(_mm_loadu_ps(matrix + 8), column2), _mm_cmpeq_ps(_mm_loadu_ps(matrix + 12), column3)) };
+					if (_mm_movemask_ps(_mm_and_ps(equal01, equal23)) == 0xF)
+					{
+						return index;
+					}
+				}
+
+				return count;
+			}
+
+			/// <summary>
+			/// SSE2 has no 64-bit compare, so on 64-bit builds each pointer is compared as two 32-bit halves and a lane matches only when both halves do.
+			/// </summary>
+			std::size_t FindPointer(const void* const* values, const void* value, std::size_t count)
+			{
+				constexpr std::size_t lanes{ sizeof(__m128i) / sizeof(void*) };
+				const std::uintptr_t address{ reinterpret_cast<std::uintptr_t>(value) };
+				std::size_t index{ 0 };
+				if constexpr (lanes == 2)
+				{
+					const __m128i needle{ _mm_set1_epi64x(static_cast<long long>(address)) };
+					for (; index + lanes <= count; index += lanes)
+					{
+						const __m128i halves{ _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(values + index)), needle) };
+						const __m128i equal{ _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1))) };
+						const int mask{ _mm_movemask_pd(_mm_castsi128_pd(equal)) };
+						if (mask != 0)
+						{
+							return index + FirstSet(mask);
+						}
+					}
+				}
+				else
+				{
+					const __m128i needle{ _mm_set1_epi32(static_cast<int>(address)) };
+					for (; index + lanes <= count; index += lanes)
+					{
+						const __m128i equal{ _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(values + index)), needle) };
+						const int mask{ _mm_movemask_ps(_mm_castsi128_ps(equal)) };
+						if (mask != 0)
+						{
+							return index + FirstSet(mask);
+						}
+					}
+				}
+
+				return index + Scalar::FindPointer(values + index, value, count - index);
+			}
+		}
+
+		namespace AVX2
+		{
+			FIEA_SIMD_AVX2 void Add(const float* lhs, const float* rhs, float* result, std::size_t count)
+			{
+				std::size_t index{ 0 };
+				for (; index + 8 <= count; index += 8)
+				{
+					_mm256_storeu_ps(result + index, _mm256_add_ps(_mm256_loadu_ps(lhs + index), _mm256_loadu_ps(rhs + index)));
+				}
+				SSE::Add(lhs + index, rhs + index, result + index, count - index);
+			}
+
+			FIEA_SIMD_AVX2 void Subtract(const float* lhs, const float* rhs, float* result, std::size_t count)
+			{
+				std::size_t index{ 0 };
+				for (; index + 8 <= count; index += 8)
+				{
+					_mm256_storeu_ps(result + index, _mm256_sub_ps(_mm256_loadu_ps(lhs + index), _mm256_loadu_ps(rhs + index)));
+				}
+				SSE::Subtract(lhs + index, rhs + index, result + index, count - index);
+			}
+
+			FIEA_SIMD_AVX2 void Multiply(const float* lhs, const float* rhs, float* result, std::size_t count)
+			{
+				std::size_t index{ 0 };
+				for (; index + 8 <= count; index += 8)
+				{
+					_mm256_storeu_ps(result + index, _mm256_mul_ps(_mm256_loadu_ps(lhs + index), _mm256_loadu_ps(rhs + index)));
+				}
+				SSE::Multiply(lhs + index, rhs + index, result + index, count - index);
+			}
+
+			FIEA_SIMD_AVX2 void MultiplyAdd(const float* lhs, const float* rhs, const float* addend, float* result, std::size_t count)
+			{
+				std::size_t index{ 0 };
+				for (; index + 8 <= count; index += 8)
+				{
+					_mm256_storeu_ps(result + index, _mm256_fmadd_ps(_mm256_loadu_ps(lhs + index), _mm256_loadu_ps(rhs + index), _mm256_loadu_ps(addend + index)));
+				}
+				SSE::MultiplyAdd(lhs + index, rhs + index, addend + index, result + index, count - index);
+			}
+
+			FIEA_SIMD_AVX2 void Scale(const float* values, float scale, float* result, std::size_t count)
+			{
+				const __m256 factor{ _mm256_set1_ps(scale) };
+				std::size_t index{ 0 };
+				for (; index + 8 <= count; index += 8)
+				{
+					_mm256_storeu_ps(result + index, _mm256_mul_ps(_mm256_loadu_ps(values + index), factor));
+				}
+				SSE::Scale(values + index, scale, result + index, count - index);
+			}
+
+			FIEA_SIMD_AVX2 void Lerp(const float* from, const float* to, float t, float* result, std::size_t count)
+			{
+				const __m256 factor{ _mm256_set1_ps(t) };
+				std::size_t index{ 0 };
+				for (; index + 8 <= count; index += 8)
+				{
+					const __m256 start{ _mm256_loadu_ps(from + index) };
+					const __m256 delta{ _mm256_sub_ps(_mm256_loadu_ps(to + index), start) };
+					_mm256_storeu_ps(result + index, _mm256_fmadd_ps(delta, factor, start));
+				}
+				SSE::Lerp(from + index, to + index, t, result + index, count - index);
+			}
+
+			/// <summary>
+			/// Keeps two running sums so that each fused multiply-add does not wait on the one before it.
+			/// </summary>
+			FIEA_SIMD_AVX2 float Dot(const float* lhs, const float* rhs, std::size_t count)
+			{
+				__m256 first{ _mm256_setzero_ps() };
+				__m256 second{ _mm256_setzero_ps() };
+				std::size_t index{ 0 };
+				for (; index + 16 <= count; index += 16)
+				{
+					first = _mm256_fmadd_ps(_mm256_loadu_ps(lhs + index), _mm256_loadu_ps(rhs + index), first);
+					second = _mm256_fmadd_ps(_mm256_loadu_ps(lhs + index + 8), _mm256_loadu_ps(rhs + index + 8), second);
+				}
+				if (index + 8 <= count)
+				{
+					first = _mm256_fmadd_ps(_mm256_loadu_ps(lhs + index), _mm256_loadu_ps(rhs + index), first);
+					index += 8;
+				}
+
+				const __m256 sum{ _mm256_add_ps(first, second) };
+				const __m128 halves{ _mm_add_ps(_mm256_castps256_ps128(sum), _mm256_extractf128_ps(sum, 1)) };
+				return SSE::HorizontalSum(halves) + Scalar::Dot(lhs + index, rhs + index, count - index);
+			}
+
+			/// <summary>
+			/// Two horizontal adds reduce four products to their dot products, left as (0, 2) in the low half and (1, 3) in the high half, which one unpack puts back in order.
+			/// </summary>
+			FIEA_SIMD_AVX2 void Dot4(const float* lhs, const float* rhs, float* result, std::size_t count)
+			{
+				std::size_t index{ 0 };
+				for (; index + 4 <= count; index += 4)
+				{
+					const float* left{ lhs + index * 4 };
+					const float* right{ rhs + index * 4 };
+					const __m256 first{ _mm256_mul_ps(_mm256_loadu_ps(left), _mm256_loadu_ps(right)) };
+					const __m256 second{ _mm256_mul_ps(_mm256_loadu_ps(left + 8), _mm256_loadu_ps(right + 8)) };
+					__m256 sums{ _mm256_hadd_ps(first, second) };
+					sums = _mm256_hadd_ps(sums, sums);
+					_mm_storeu_ps(result + index, _mm_unpacklo_ps(_mm256_castps256_ps128(sums), _mm256_extractf128_ps(sums, 1)));
+				}
+				SSE::Dot4(lhs + index * 4, rhs + index * 4, result + index, count - index);
+			}
+
+			FIEA_SIMD_AVX2 __m256 TransformTwo(__m256 column0, __m256 column1, __m256 column2, __m256 column3, __m256 values)
+			{
+				__m256 result{ _mm256_mul_ps(column0, _mm256_permute_ps(values, 0x00)) };
+				result = _mm256_fmadd_ps(column1, _mm256_permute_ps(values, 0x55), result);
+				result = _mm256_fmadd_ps(column2, _mm256_permute_ps(values, 0xAA), result);
+				return _mm256_fmadd_ps(column3, _mm256_permute_ps(values, 0xFF), result);
+			}
+
+			/// <summary>
+			/// Transforms two vectors at a time, one in each half of the register, with the matrix repeated in both halves.
+			/// </summary>
+			FIEA_SIMD_AVX2 void Transform(const float* matrix, const float* values, float* result, std::size_t count)
+			{
+				const __m256 column0{ _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matrix)) };
+				const __m256 column1{ _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matrix + 4)) };
+				const __m256 column2{ _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matrix + 8)) };
+				const __m256 column3{ _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matrix + 12)) };
+				std::size_t index{ 0 };
+				for (; index + 2 <= count; index += 2)
+				{
+					_mm256_storeu_ps(result + index * 4, TransformTwo(column0, column1, column2, column3, _mm256_loadu_ps(values + index * 4)));
+				}
+				SSE::Transform(matrix, values + index * 4, result + index * 4, count - index);
+			}
+
+			FIEA_SIMD_AVX2 __m256 LoadColumns(const float* first, const float* second)
+			{
+				return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(first)), _mm_loadu_ps(second), 1);
+			}
+
+			FIEA_SIMD_AVX2 void TransformEach(const float* matrices, const float* values, float* result, std::size_t count)
+			{
+				std::size_t index{ 0 };
+				for (; index + 2 <= count; index += 2)
+				{
+					const float* first{ matrices + index * 16 };
+					const float* second{ first + 16 };
+					const __m256 column0{ LoadColumns(first, second) };
+					const __m256 column1{ LoadColumns(first + 4, second + 4) };
+					const __m256 column2{ LoadColumns(first + 8, second + 8) };
+					const __m256 column3{ LoadColumns(first + 12, second + 12) };
+					_mm256_storeu_ps(result + index * 4, TransformTwo(column0, column1, column2, column3, _mm256_loadu_ps(values + index * 4)));
+				}
+				SSE::TransformEach(matrices + index * 16, values + index * 4, result + index * 4, count - index);
+			}
+			FIEA_SIMD_AVX2 std::size_t FindInt(const int* values, int value, std::size_t count)
+			{
+				const __m256i needle{ _mm256_set1_epi32(value) };
+				std::size_t index{ 0 };
+				for (; index + 8 <= count; index += 8)
+				{
+					const __m256i equal{ _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + index)), needle) };
+					const int mask{ _mm256_movemask_ps(_mm256_castsi256_ps(equal)) };
+					if (mask != 0)
+					{
+						return index + SSE::FirstSet(mask);
+					}
+				}
+
+				return index + SSE::FindInt(values + index, value, count - index);
+			}
+
+			FIEA_SIMD_AVX2 std::size_t FindFloat(const float* values, float value, std::size_t count)
+			{
+				const __m256 needle{ _mm256_set1_ps(value) };
+				std::size_t index{ 0 };
+				for (; index + 8 <= count; index += 8)
+				{
+					const int mask{ _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(values + index), needle, _CMP_EQ_OQ)) };
+					if (mask != 0)
+					{
+						return index + SSE::FirstSet(mask);
+					}
+				}
+
+				return index + SSE::FindFloat(values + index, value, count - index);
+			}
+
+			/// <summary>
+			/// Compares two vectors at a time, one in each half of the register; the first is a match when the low four lanes all are, the second when the high four are.
+			/// </summary>
+			FIEA_SIMD_AVX2 std::size_t Find4(const float* values, const float* value, std::size_t count)
+			{
+				const __m256 needle{ _mm256_broadcast_ps(reinterpret_cast<const __m128*>(value)) };
+				std::size_t index{ 0 };
+				for (; index + 2 <= count; index += 2)
+				{
+					const int mask{ _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(values + index * 4), needle, _CMP_EQ_OQ)) };
+					if ((mask & 0x0F) == 0x0F)
+					{
+						return index;
+					}
+					if ((mask & 0xF0) == 0xF0)
+					{
+						return index + 1;
+					}
+				}
+
+				return index + SSE::Find4(values + index * 4, value, count - index);
+			}
+
+			FIEA_SIMD_AVX2 std::size_t Find16(const float* values, const float* value, std::size_t count)
+			{
+				const __m256 columns01{ _mm256_loadu_ps(value) };
+				const __m256 columns23{ _mm256_loadu_ps(value + 8) };
+				for (std::size_t index{ 0 }; index < count; ++index)
+				{
+					const float* matrix{ values + index * 16 };
+					const __m256 equal{ _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(matrix), columns01, _CMP_EQ_OQ), _mm256_cmp_ps(_mm256_loadu_ps(matrix + 8), columns23, _CMP_EQ_OQ)) };
+					if (_mm256_movemask_ps(equal) == 0xFF)
+					{
+						return index;
+					}
+				}
+
+				return count;
+			}
+
+			FIEA_SIMD_AVX2 std::size_t FindPointer(const void* const* values, const void* value, std::size_t count)
+			{
+				constexpr std::size_t lanes{ sizeof(__m256i) / sizeof(void*) };
+				const std::uintptr_t address{ reinterpret_cast<std::uintptr_t>(value) };
+				std::size_t index{ 0 };
+				if constexpr (lanes == 4)
+				{
+					const __m256i needle{ _mm256_set1_epi64x(static_cast<long long>(address)) };
+					for (; index + lanes <= count; index += lanes)
+					{
+						const __m256i equal{ _mm256_cmpeq_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + index)), needle) };
+						const int mask{ _mm256_movemask_pd(_mm256_castsi256_pd(equal)) };
+						if (mask != 0)
+						{
+							return index + SSE::FirstSet(mask);
+						}
+					}
+				}
+				else
+				{
+					const __m256i needle{ _mm256_set1_epi32(static_cast<int>(address)) };
+					for (; index + lanes <= count; index += lanes)
+					{
+						const __m256i equal{ _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + index)), needle) };
+						const int mask{ _mm256_movemask_ps(_mm256_castsi256_ps(equal)) };
+						if (mask != 0)
+						{
+							return index + SSE::FirstSet(mask);
+						}
+					}
+				}
+
+				return index + SSE::FindPointer(values + index, value, count - index);
+			}
+		}
+#endif
+	}
+
+	void SimdMath::Add(std::span<const float> lhs, std::span<const float> rhs, std::span<float> result)
+	{
+		assert(rhs.size() == lhs.size() && result.size() == lhs.size());
+		ActiveKernels()->_add(lhs.data(), rhs.data(), result.data(), lhs.size());
+	}
+
+	void SimdMath::Add(std::span<const glm::vec4> lhs, std::span<const glm::vec4> rhs, std::span<glm::vec4> result)
+	{
+		assert(rhs.size() == lhs.size() && result.size() == lhs.size());
+		ActiveKernels()->_add(Floats(lhs.data()), Floats(rhs.data()), Floats(result.data()), lhs.size() * 4);
+	}
+
+	void SimdMath::Subtract(std::span<const float> lhs, std::span<const float> rhs, std::span<float> result)
+	{
+		assert(rhs.size() == lhs.size() && result.size() == lhs.size());
+		ActiveKernels()->_subtract(lhs.data(), rhs.data(), result.data(), lhs.size());
+	}
+
+	void SimdMath::Subtract(std::span<const glm::vec4> lhs, std::span<const glm::vec4> rhs, std::span<glm::vec4> result)
+	{
+		assert(rhs.size() == lhs.size() && result.size() == lhs.size());
+		ActiveKernels()->_subtract(Floats(lhs.data()), Floats(rhs.data()), Floats(result.data()), lhs.size() * 4);
+	}
+
+	void SimdMath::Multiply(std::span<const float> lhs, std::span<const float> rhs, std::span<float> result)
+	{
+		assert(rhs.size() == lhs.size() && result.size() == lhs.size());
+		ActiveKernels()->_multiply(lhs.data(), rhs.data(), result.data(), lhs.size());
+	}
+
+	void SimdMath::Multiply(std::span<const glm::vec4> lhs, std::span<const glm::vec4> rhs, std::span<glm::vec4> result)
+	{
+		assert(rhs.size() == lhs.size() && result.size() == lhs.size());
+		ActiveKernels()->_multiply(Floats(lhs.data()), Floats(rhs.data()), Floats(result.data()), lhs.size() * 4);
+	}
+
+	void SimdMath::MultiplyAdd(std::span<const float> lhs, std::span<const float> rhs, std::span<const float> addend, std::span<float> result)
+	{
+		assert(rhs.size() == lhs.size() && addend.size() == lhs.size() && result.size() == lhs.size());
+		ActiveKernels()->_multiplyAdd(lhs.data(), rhs.data(), addend.data(), result.data(), lhs.size());
+	}
+
+	void SimdMath::MultiplyAdd(std::span<const glm::vec4> lhs, std::span<const glm::vec4> rhs, std::span<const glm::vec4> addend, std::span<glm::vec4> result)
+	{
+		assert(rhs.size() == lhs.size() && addend.size() == lhs.size() && result.size() == lhs.size());
+		ActiveKernels()->_multiplyAdd(Floats(lhs.data()), Floats(rhs.data()), Floats(addend.data()), Floats(result.data()), lhs.size() * 4);
+	}
+
+	void SimdMath::Scale(std::span<const float> values, float scale, std::span<float> result)
+	{
+		assert(result.size() == values.size());
+		ActiveKernels()->_scale(values.data(), scale, result.data(), values.size());
+	}
+
+	void SimdMath::Scale(std::span<const glm::vec4> values, float scale, std::span<glm::vec4> result)
+	{
+		assert(result.size() == values.size());
+		ActiveKernels()->_scale(Floats(values.data()), scale, Floats(result.data()), values.size() * 4);
+	}
+
+	void SimdMath::Lerp(std::span<const float> from, std::span<const float> to, float t, std::span<float> result)
+	{
+		assert(to.size() == from.size() && result.size() == from.size());
+		ActiveKernels()->_lerp(from.data(), to.data(), t, result.data(), from.size());
+	}
+
+	void SimdMath::Lerp(std::span<const glm::vec4> from, std::span<const glm::vec4> to, float t, std::span<glm::vec4> result)
+	{
+		assert(to.size() == from.size() && result.size() == from.size());
+		ActiveKernels()->_lerp(Floats(from.data()), Floats(to.data()), t, Floats(result.data()), from.size() * 4);
+	}
+
+	float SimdMath::Dot(std::span<const float> lhs, std::span<const float> rhs)
+	{
+		assert(rhs.size() == lhs.size());
+		return ActiveKernels()->_dot(lhs.data(), rhs.data(), lhs.size());
+	}
+
+	void SimdMath::Dot(std::span<const glm::vec4> lhs, std::span<const glm::vec4> rhs, std::span<float> result)
+	{
+		assert(rhs.size() == lhs.size() && result.size() == lhs.size());
+		ActiveKernels()->_dot4(Floats(lhs.data()), Floats(rhs.data()), result.data(), lhs.size());
+	}
+
+	void SimdMath::Transform(const glm::mat4& matrix, std::span<const glm::vec4> values, std::span<glm::vec4> result)
+	{
+		assert(result.size() == values.size());
+		ActiveKernels()->_transform(Floats(&matrix), Floats(values.data()), Floats(result.data()), values.size());
+	}
+
+	void SimdMath::Transform(std::span<const glm::mat4> matrices, std::span<const glm::vec4> values, std::span<glm::vec4> result)
+	{
+		assert(values.size() == matrices.size() && result.size() == matrices.size());
+		ActiveKernels()->_transformEach(Floats(matrices.data()), Floats(values.data()), Floats(result.data()), matrices.size());
+	}
+
+	std::size_t SimdMath::Find(std::span<const int> values, int value)
+	{
+		return ActiveKernels()->_findInt(values.data(), value, values.size());
+	}
+
+	std::size_t SimdMath::Find(std::span<const float> values, float value)
+	{
+		return ActiveKernels()->_findFloat(values.data(), value, values.size());
+	}
+
+	std::size_t SimdMath::Find(std::span<const glm::vec4> values, const glm::vec4& value)
+	{
+		return ActiveKernels()->_find4(Floats(values.data()), Floats(&value), values.size());
+	}
+
+	std::size_t SimdMath::Find(std::span<const glm::mat4> values, const glm::mat4& value)
+	{
+		return ActiveKernels()->_find16(Floats(values.data()), Floats(&value), values.size());
+	}
+
+	std::size_t SimdMath::Find(std::span<const void* const> values, const void* value)
+	{
+		return ActiveKernels()->_findPointer(values.data(), value, values.size());
+	}
+
+	SimdMath::InstructionSet SimdMath::Supported()
+	{
+		static const InstructionSet supported{ []()
+		{
+#if defined(FIEA_SIMD_X86) && defined(_MSC_VER)
+			int info[4];
+			__cpuid(info, 0);
+			if (info[0] < 7)
+			{
+				return InstructionSet::SSE;
+			}
+
+			__cpuid(info, 1);
+			const bool osSavesRegisters{ (info[2] & (1 << 27)) != 0 };
+			const bool hasAvx{ (info[2] & (1 << 28)) != 0 };
+			const bool hasFma{ (info[2] & (1 << 12)) != 0 };
+			if (!osSavesRegisters || !hasAvx || !hasFma || (_xgetbv(0) & 0x6) != 0x6)
+			{
+				return InstructionSet::SSE;
+			}
+
+			__cpuidex(info, 7, 0);
+			return (info[1] & (1 << 5)) != 0 ? InstructionSet::AVX2 : InstructionSet::SSE;
+#elif defined(FIEA_SIMD_X86)
+			__builtin_cpu_init();
+			return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") ? InstructionSet::AVX2 : InstructionSet::SSE;
+#else
+			return InstructionSet::Scalar;
+#endif
+		}() };
+
+		return supported;
+	}
+
+	SimdMath::InstructionSet SimdMath::Active()
+	{
+		return ActiveKernels()->_instructionSet;
+	}
+
+	void SimdMath::SetInstructionSet(InstructionSet instructionSet)
+	{
+		ActiveKernels() = &KernelsFor(std::min(instructionSet, Supported()));
+	}
+
+	const SimdMath::Kernels& SimdMath::KernelsFor(InstructionSet instructionSet)
+	{
+		static const Kernels scalar{ InstructionSet::Scalar, Scalar::Add, Scalar::Subtract, Scalar::Multiply, Scalar::MultiplyAdd, Scalar::Scale, Scalar::Lerp, Scalar::Dot, Scalar::Dot4, Scalar::Transform, Scalar::TransformEach, Scalar::FindInt, Scalar::FindFloat, Scalar::Find4, Scalar::Find16, Scalar::FindPointer };
+#if defined(FIEA_SIMD_X86)
+		static const Kernels sse{ InstructionSet::SSE, SSE::Add, SSE::Subtract, SSE::Multiply, SSE::MultiplyAdd, SSE::Scale, SSE::Lerp, SSE::Dot, SSE::Dot4, SSE::Transform, SSE::TransformEach, SSE::FindInt, SSE::FindFloat, SSE::Find4, SSE::Find16, SSE::FindPointer };
+		static const Kernels avx2{ InstructionSet::AVX2, AVX2::Add, AVX2::Subtract, AVX2::Multiply, AVX2::MultiplyAdd, AVX2::Scale, AVX2::Lerp, AVX2::Dot, AVX2::Dot4, AVX2::Transform, AVX2::TransformEach, AVX2::FindInt, AVX2::FindFloat, AVX2::Find4, AVX2::Find16, AVX2::FindPointer };
+
+		switch (instructionSet)
+		{
+		case InstructionSet::AVX2:
+			return avx2;
+		case InstructionSet::SSE:
+			return sse;
+		default:
+			return scalar;
+		}
+#else
+		UNREFERENCED_LOCAL(instructionSet);
+		return scalar;
+#endif
+	}
+
+	const SimdMath::Kernels*& SimdMath::ActiveKernels()
+	{
+		static const Kernels* active{ &KernelsFor(Supported()) };
+		return active;
+	}
+}
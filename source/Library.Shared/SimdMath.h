@@ -0,0 +1,141 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <glm/glm.hpp>
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Element-wise math over contiguous arrays of floats, vec4s and mat4s, and searches over those and int and pointer arrays, such as the views returned by Datum::AsSpan.
+	/// Every kernel has a scalar version and, on x86, SSE and AVX2 versions. The fastest set the processor supports is chosen the first time a kernel runs.
+	/// Every span passed to one call must have the same size, and the result may be the same span as one of the inputs.
+	/// </summary>
+	class SimdMath final
+	{
+	public:
+		/// <summary>
+		/// The sets of kernels available, from slowest to fastest.
+		/// </summary>
+		enum class InstructionSet
+		{
+			Scalar = 0,
+			SSE = 1,
+			AVX2 = 2
+		};
+
+		/// <summary>
+		/// Writes lhs + rhs into result.
+		/// </summary>
+		/// <param name="lhs">The left operands.</param>
+		/// <param name="rhs">The right operands.</param>
+		/// <param name="result">Where the sums are written.</param>
+		static void Add(std::span<const float> lhs, std::span<const float> rhs, std::span<float> result);
+		static void Add(std::span<const glm::vec4> lhs, std::span<const glm::vec4> rhs, std::span<glm::vec4> result);
+		/// <summary>
+		/// Writes lhs - rhs into result.
+		/// </summary>
+		/// <param name="lhs">The left operands.</param>
+		/// <param name="rhs">The right operands.</param>
+		/// <param name="result">Where the differences are written.</param>
+		static void Subtract(std::span<const float> lhs, std::span<const float> rhs, std::span<float> result);
+		static void Subtract(std::span<const glm::vec4> lhs, std::span<const glm::vec4> rhs, std::span<glm::vec4> result);
+		/// <summary>
+		/// Writes lhs * rhs into result, component by component for vec4s.
+		/// </summary>
+		/// <param name="lhs">The left operands.</param>
+		/// <param name="rhs">The right operands.</param>
+		/// <param name="result">Where the products are written.</param>
+		static void Multiply(std::span<const float> lhs, std::span<const float> rhs, std::span<float> result);
+		static void Multiply(std::span<const glm::vec4> lhs, std::span<const glm::vec4> rhs, std::span<glm::vec4> result);
+		/// <summary>
+		/// Writes lhs * rhs + addend into result, fused into a single rounding where the processor supports it.
+		/// </summary>
+		/// <param name="lhs">The left factors.</param>
+		/// <param name="rhs">The right factors.</param>
+		/// <param name="addend">The values added to each product.</param>
+		/// <param name="result">Where the results are written.</param>
+		static void MultiplyAdd(std::span<const float> lhs, std::span<const float> rhs, std::span<const float> addend, std::span<float> result);
+		static void MultiplyAdd(std::span<const glm::vec4> lhs, std::span<const glm::vec4> rhs, std::span<const glm::vec4> addend, std::span<glm::vec4> result);
+		/// <summary>
+		/// Writes values * scale into result.
+		/// </summary>
+		/// <param name="values">The values to scale.</param>
+		/// <param name="scale">The factor applied to every value.</param>
+		/// <param name="result">Where the scaled values are written.</param>
+		static void Scale(std::span<const float> values, float scale, std::span<float> result);
+		static void Scale(std::span<const glm::vec4> values, float scale, std::span<glm::vec4> result);
+		/// <summary>
+		/// Writes from + (to - from) * t into result.
+		/// </summary>
+		/// <param name="from">The values at t = 0.</param>
+		/// <param name="to">The values at t = 1.</param>
+		/// <param name="t">How far to interpolate.</param>
+		/// <param name="result">Where the interpolated values are written.</param>
+		static void Lerp(std::span<const float> from, std::span<const float> to, float t, std::span<float> result);
+		static void Lerp(std::span<const glm::vec4> from, std::span<const glm::vec4> to, float t, std::span<glm::vec4> result);
+		/// <summary>
+		/// Returns the sum of lhs * rhs over the whole array. The sum is accumulated in a different order by each instruction set, so results may differ in the last bits.
+		/// </summary>
+		/// <param name="lhs">The left operands.</param>
+		/// <param name="rhs">The right operands.</param>
+		/// <returns>The dot product of the two arrays.</returns>
+		static float Dot(std::span<const float> lhs, std::span<const float> rhs);
+		/// <summary>
+		/// Writes the dot product of each pair of vec4s into result.
+		/// </summary>
+		/// <param name="lhs">The left operands.</param>
+		/// <param name="rhs">The right operands.</param>
+		/// <param name="result">Where the dot products are written, one per pair.</param>
+		static void Dot(std::span<const glm::vec4> lhs, std::span<const glm::vec4> rhs, std::span<float> result);
+		/// <summary>
+		/// Writes matrix * value for every value into result.
+		/// </summary>
+		/// <param name="matrix">The transform applied to every value.</param>
+		/// <param name="values">The vectors to transform.</param>
+		/// <param name="result">Where the transformed vectors are written.</param>
+		static void Transform(const glm::mat4& matrix, std::span<const glm::vec4> values, std::span<glm::vec4> result);
+		/// <summary>
+		/// Writes matrices[i] * values[i] into result[i].
+		/// </summary>
+		/// <param name="matrices">The transform for each value.</param>
+		/// <param name="values">The vectors to transform.</param>
+		/// <param name="result">Where the transformed vectors are written.</param>
+		static void Transform(std::span<const glm::mat4> matrices, std::span<const glm::vec4> values, std::span<glm::vec4> result);
+		/// <summary>
+		/// Returns the index of the first value equal to the given one, or values.size() if there is none. Floats, vec4s and mat4s compare with ==,
+		/// so 0.0f matches -0.0f and NaN matches nothing. Pointers compare by address.
+		/// </summary>
+		/// <param name="values">The values to search.</param>
+		/// <param name="value">The value to search for.</param>
+		/// <returns>The index of the first match, or values.size().</returns>
+		static std::size_t Find(std::span<const int> values, int value);
+		static std::size_t Find(std::span<const float> values, float value);
+		static std::size_t Find(std::span<const glm::vec4> values, const glm::vec4& value);
+		static std::size_t Find(std::span<const glm::mat4> values, const glm::mat4& value);
+		static std::size_t Find(std::span<const void* const> values, const void* value);
+
+		/// <summary>
+		/// Returns the fastest instruction set this processor and build support.
+		/// </summary>
+		/// <returns>The best supported InstructionSet.</returns>
+		static InstructionSet Supported();
+		/// <summary>
+		/// Returns the instruction set the kernels currently run with.
+		/// </summary>
+		/// <returns>The active InstructionSet.</returns>
+		static InstructionSet Active();
+		/// <summary>
+		/// Chooses the instruction set the kernels run with, for tests and benchmarks that compare them. A set the processor does not support falls back to the best one it does.
+		/// Not safe to call while kernels run on other threads.
+		/// </summary>
+		/// <param name="instructionSet">The InstructionSet to use.</param>
+		static void SetInstructionSet(InstructionSet instructionSet);
+
+	private:
+		struct Kernels;
+
+		static const Kernels& KernelsFor(InstructionSet instructionSet);
+		static const Kernels*& ActiveKernels();
+	};
+}
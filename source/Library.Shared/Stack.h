@@ -1,8 +1,12 @@
 #pragma once
-#include "SList.h"
+#include "Vector.h"
 
 namespace FieaGameEngine
 {
+	/// <summary>
+	/// A last in, first out container stored in a contiguous array. Popping and clearing keep the array's capacity,
+	/// so a stack that is filled and drained every frame stops allocating once it has reached its largest size.
+	/// </summary>
 	template <typename T>
 	class Stack final
 	{
@@ -10,7 +14,7 @@ namespace FieaGameEngine
 		using size_type = std::size_t;
 		using value_type = T;
 		using reference = value_type&;
-		using const_reference = const reference;
+		using const_reference = const value_type&;
 		using rvalue_reference = value_type&&;
 
 		template <typename...Args>
@@ -23,12 +27,27 @@ namespace FieaGameEngine
 
 		[[nodiscard]] size_type Size() const;
 		[[nodiscard]] bool IsEmpty() const;
+		/// <summary>
+		/// Returns how many items the stack can hold before it has to grow.
+		/// </summary>
+		[[nodiscard]] size_type Capacity() const;
 
+		/// <summary>
+		/// Removes every item but keeps the memory they occupied for the next pushes.
+		/// </summary>
 		void Clear();
+		/// <summary>
+		/// Makes room for at least the given number of items.
+		/// </summary>
+		void Reserve(size_type capacity);
+		/// <summary>
+		/// Releases any memory the current items do not need.
+		/// </summary>
+		void ShrinkToFit();
 
 
 	private:
-		SList<value_type> _list{};
+		Vector<value_type> _items{};
 	};
 
 }
@@ -7,49 +7,72 @@ namespace FieaGameEngine
 		template <typename...Args>
 		inline void Stack<T>::Emplace(Args&&...args)
 		{
-			_list.EmplaceFront(std::forward<Args>(args)...);
+			_items.EmplaceBack(std::forward<Args>(args)...);
 		}
 
 		template <typename T>
 		inline void Stack<T>::Push(const_reference value)
 		{
-			_list.EmplaceFront(value);
+			_items.PushBack(value);
 		}
 
 		template <typename T>
 		inline void Stack<T>::Push(rvalue_reference value)
 		{
-			_list.EmplaceFront(std::move(value));
+			_items.PushBack(std::move(value));
 		}
 
 		template <typename T>
 		inline void Stack<T>::Pop()
 		{
-			_list.PopFront();
+			_items.PopBack();
 		}
 
 		template <typename T>
 		inline typename Stack<T>::reference Stack<T>::Top()
 		{
-			return _list.Front();
+			return _items.Back();
+		}
+
+		template <typename T>
+		inline typename Stack<T>::const_reference Stack<T>::Top() const
+		{
+			return _items.Back();
 		}
 
 		template <typename T>
 		inline typename Stack<T>::size_type Stack<T>::Size() const
 		{
-			return _list.Size();
+			return _items.Size();
 		}
 
 		template <typename T>
 		inline bool Stack<T>::IsEmpty() const
 		{
-			return _list.IsEmpty();
+			return _items.IsEmpty();
+		}
+
+		template <typename T>
+		inline typename Stack<T>::size_type Stack<T>::Capacity() const
+		{
+			return _items.Capacity();
 		}
 
 		template <typename T>
 		inline void Stack<T>::Clear()
 		{
-			_list.Clear();
+			_items.Clear();
 		}
-}
 
+		template <typename T>
+		inline void Stack<T>::Reserve(size_type capacity)
+		{
+			_items.Reserve(capacity);
+		}
+
+		template <typename T>
+		inline void Stack<T>::ShrinkToFit()
+		{
+			_items.ShrinkToFit();
+		}
+}
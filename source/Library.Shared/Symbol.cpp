@@ -0,0 +1,79 @@
+#include "Symbol.h"
+
+namespace FieaGameEngine
+{
+	namespace
+	{
+		struct SymbolTable final
+		{
+			OpenHashMap<std::string, Symbol::Entry> _entries{};
+			std::uint32_t _nextId{ 1 };
+		};
+
+		/// <summary>
+		/// The table is created on first use so Symbols can be made during static initialization.
+		/// </summary>
+		SymbolTable& Table()
+		{
+			static SymbolTable table;
+			return table;
+		}
+	}
+
+	Symbol::Symbol(std::string_view name)
+	{
+		// The empty name is represented by the null Symbol so that it never needs an entry.
+		if (!name.empty())
+		{
+			SymbolTable& table{ Table() };
+			auto position{ table._entries.Find(name) };
+			if (position == table._entries.end())
+			{
+				std::size_t hash{ DefaultHash<std::string>{}(name) };
+				position = table._entries.Emplace(std::string{ name }, Entry{ hash, table._nextId++, 0 });
+			}
+			_pair = &(*position);
+			++_pair->second._references;
+		}
+	}
+
+	Symbol::Symbol(PairType* pair) :
+		_pair{ pair }
+	{
+		if (_pair != nullptr)
+		{
+			++_pair->second._references;
+		}
+	}
+
+	Symbol Symbol::Find(std::string_view name)
+	{
+		SymbolTable& table{ Table() };
+		auto position{ table._entries.Find(name) };
+		return Symbol{ position == table._entries.end() ? nullptr : &(*position) };
+	}
+
+	std::size_t Symbol::Count()
+	{
+		return Table()._entries.Size();
+	}
+
+	void Symbol::Release()
+	{
+		if (_pair != nullptr)
+		{
+			if (--_pair->second._references == 0)
+			{
+				SymbolTable& table{ Table() };
+				table._entries.Remove(_pair->first);
+
+				// Give the slots back once nothing is interned, so an empty table holds no memory.
+				if (table._entries.Size() == 0)
+				{
+					table._entries = OpenHashMap<std::string, Entry>{};
+				}
+			}
+			_pair = nullptr;
+		}
+	}
+}
@@ -0,0 +1,135 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include "OpenHashMap.h"
+#include "TriviallyRelocatable.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// A handle to an interned string. Every Symbol made from the same characters shares a single entry in a global table, which stores the name once
+	/// along with its hash and an integer id, so comparing two Symbols is a pointer comparison and hashing one costs nothing.
+	/// Entries are reference counted and leave the table when the last Symbol using them is destroyed. The table is not thread safe.
+	/// </summary>
+	class Symbol final
+	{
+	public:
+		struct Entry final
+		{
+			std::size_t _hash{ 0 };
+			std::uint32_t _id{ 0 };
+			std::uint32_t _references{ 0 };
+		};
+
+		using PairType = OpenHashMap<std::string, Entry>::PairType;
+
+		/// <summary>
+		/// Creates the null Symbol, which has no entry and an empty name.
+		/// </summary>
+		Symbol() = default;
+		/// <summary>
+		/// Interns the given name, adding it to the table if no Symbol with those characters exists yet.
+		/// </summary>
+		/// <param name="name">The characters of the Symbol.</param>
+		explicit Symbol(std::string_view name);
+		Symbol(const Symbol& other);
+		Symbol& operator=(const Symbol& other);
+		Symbol(Symbol&& other) noexcept;
+		Symbol& operator=(Symbol&& other) noexcept;
+		~Symbol();
+
+		/// <summary>
+		/// Returns the Symbol for the given name if one has already been interned, or the null Symbol otherwise. Never adds to the table,
+		/// so a miss here also means no Scope can hold an entry with that name.
+		/// </summary>
+		/// <param name="name">The characters to look for.</param>
+		/// <returns>The existing Symbol or the null Symbol.</returns>
+		[[nodiscard]] static Symbol Find(std::string_view name);
+		/// <summary>
+		/// Returns how many distinct names are currently interned.
+		/// </summary>
+		/// <returns>The number of live entries in the table.</returns>
+		[[nodiscard]] static std::size_t Count();
+
+		/// <summary>
+		/// Returns the interned characters. The null Symbol returns an empty string.
+		/// </summary>
+		/// <returns>The name of the Symbol.</returns>
+		[[nodiscard]] const std::string& Name() const;
+		/// <summary>
+		/// Returns the hash of the name, which was computed once when it was interned. It matches DefaultHash of the same std::string.
+		/// </summary>
+		/// <returns>The hash of the name.</returns>
+		[[nodiscard]] std::size_t Hash() const;
+		/// <summary>
+		/// Returns the integer id of the Symbol. Ids are unique among live Symbols and are never reused. The null Symbol has id 0.
+		/// </summary>
+		/// <returns>The id of the Symbol.</returns>
+		[[nodiscard]] std::uint32_t Id() const;
+		/// <summary>
+		/// Checks whether or not this is the null Symbol.
+		/// </summary>
+		/// <returns>True if the Symbol has no entry.</returns>
+		[[nodiscard]] bool IsNull() const;
+
+		[[nodiscard]] bool operator==(const Symbol& rhs) const;
+		[[nodiscard]] bool operator==(std::string_view rhs) const;
+
+	private:
+		explicit Symbol(PairType* pair);
+		void Release();
+
+		PairType* _pair{ nullptr };
+	};
+
+	/// <summary>
+	/// Entries count references rather than tracking where each Symbol lives, so a Symbol can be moved by copying its pointer.
+	/// </summary>
+	template<>
+	struct IsTriviallyRelocatable<Symbol> : std::true_type
+	{
+	};
+
+	/// <summary>
+	/// Returns the hash a Symbol computed when it was interned. String views hash to the same value as a Symbol with the same characters,
+	/// so maps keyed on Symbols can be searched by name without interning it.
+	/// </summary>
+	template<>
+	struct DefaultHash<Symbol> final
+	{
+		using is_transparent = void;
+
+		std::size_t operator()(const Symbol& symbol) const
+		{
+			return symbol.Hash();
+		}
+
+		std::size_t operator()(std::string_view name) const
+		{
+			return DefaultHash<std::string>{}(name);
+		}
+	};
+}
+
+/// <summary>
+/// Compares Symbols by identity, and a Symbol with a name by its characters.
+/// </summary>
+template<>
+struct DefaultEquality<FieaGameEngine::Symbol> final
+{
+	using is_transparent = void;
+
+	bool operator()(const FieaGameEngine::Symbol& lhs, const FieaGameEngine::Symbol& rhs) const
+	{
+		return lhs == rhs;
+	}
+
+	bool operator()(const FieaGameEngine::Symbol& lhs, std::string_view rhs) const
+	{
+		return lhs == rhs;
+	}
+};
+
+#include "Symbol.inl"
@@ -0,0 +1,81 @@
+#include "Symbol.h"
+#pragma once
+
+namespace FieaGameEngine
+{
+	inline Symbol::Symbol(const Symbol& other) :
+		_pair{ other._pair }
+	{
+		if (_pair != nullptr)
+		{
+			++_pair->second._references;
+		}
+	}
+
+	inline Symbol& Symbol::operator=(const Symbol& other)
+	{
+		if (_pair != other._pair)
+		{
+			Release();
+			_pair = other._pair;
+			if (_pair != nullptr)
+			{
+				++_pair->second._references;
+			}
+		}
+		return *this;
+	}
+
+	inline Symbol::Symbol(Symbol&& other) noexcept :
+		_pair{ other._pair }
+	{
+		other._pair = nullptr;
+	}
+
+	inline Symbol& Symbol::operator=(Symbol&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Release();
+			_pair = other._pair;
+			other._pair = nullptr;
+		}
+		return *this;
+	}
+
+	inline Symbol::~Symbol()
+	{
+		Release();
+	}
+
+	inline const std::string& Symbol::Name() const
+	{
+		static const std::string empty{};
+		return _pair != nullptr ? _pair->first : empty;
+	}
+
+	inline std::size_t Symbol::Hash() const
+	{
+		return _pair != nullptr ? _pair->second._hash : DefaultHash<std::string>{}(std::string_view{});
+	}
+
+	inline std::uint32_t Symbol::Id() const
+	{
+		return _pair != nullptr ? _pair->second._id : 0;
+	}
+
+	inline bool Symbol::IsNull() const
+	{
+		return _pair == nullptr;
+	}
+
+	inline bool Symbol::operator==(const Symbol& rhs) const
+	{
+		return _pair == rhs._pair;
+	}
+
+	inline bool Symbol::operator==(std::string_view rhs) const
+	{
+		return std::string_view{ Name() } == rhs;
+	}
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <type_traits>
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Marks types whose objects can be moved to a new address by copying their bytes and forgetting the originals, which lets containers
+	/// grow with realloc and shift with memmove instead of move constructing and destroying every element.
+	/// Trivially copyable types qualify automatically. Any other type that holds no pointers into itself and is not registered anywhere
+	/// by address can opt in by specializing this trait to inherit from std::true_type.
+	/// Types such as std::string, std::function and std::shared_ptr must not opt in; their implementations are not guaranteed to survive a byte copy.
+	/// </summary>
+	template <typename T>
+	struct IsTriviallyRelocatable : std::bool_constant<std::is_trivially_copyable_v<T>>
+	{
+	};
+
+	template <typename T>
+	concept TriviallyRelocatable = IsTriviallyRelocatable<std::remove_cv_t<T>>::value;
+}
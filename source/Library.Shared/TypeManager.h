@@ -1,26 +1,44 @@
 #pragma once
 #include "Datum.h"
 #include "HashMap.h"
+#include "Vector.h"
+#include "Symbol.h"
 
 namespace FieaGameEngine
 {
 	struct Signature final
 	{
 		using Type = Datum::DatumTypes;
-		std::string _name{};
+		Symbol _name{};
 		Type _type{ Type::Unknown };
 		std::size_t _size{};
 		std::size_t _offset{};
 
-		Signature(const std::string& name, Type type, std::size_t size, std::size_t offset) :
+		Signature(std::string_view name, Type type, std::size_t size, std::size_t offset) :
 			_name{ name }, _type{ type }, _size{ size }, _offset{ offset }
 		{
 
 		}
 		~Signature() = default;
 		Signature(const Signature&) = default;
+		Signature(Signature&&) noexcept = default;
+		Signature& operator=(const Signature&) = default;
+		Signature& operator=(Signature&&) noexcept = default;
 	};
 
+	/// <summary>
+	/// A Signature is a Symbol and plain values, all of which can be moved by copying their bytes.
+	/// </summary>
+	template<>
+	struct IsTriviallyRelocatable<Signature> : std::true_type
+	{
+	};
+
+	/// <summary>
+	/// The prescribed attributes of one type. Most types declare only a handful, so they are kept inline rather than allocated.
+	/// </summary>
+	using SignatureList = SmallVector<Signature, 8>;
+
 	class TypeManager final
 	{
 	public:
@@ -56,7 +74,7 @@ namespace FieaGameEngine
 		/// </summary>
 		/// <param name="typeId">The RTTI TypeId you are searching for.</param>
 		/// <returns>The vector of signatures for the corresponding RTTI type.</returns>
-		inline [[nodiscard]] Vector<Signature>& GetSignatureForTypeID(RTTI::IdType typeId)
+		inline [[nodiscard]] SignatureList& GetSignatureForTypeID(RTTI::IdType typeId)
 		{
 			auto position = _signatures.Find(typeId);
 			assert(position != _signatures.end());
@@ -67,13 +85,13 @@ namespace FieaGameEngine
 		/// </summary>
 		/// <param name="typeId">The RTTI IdType for the class.</param>
 		/// <param name="signatures">A Vector of Signatures.</param>
-		inline void AddSignature(RTTI::IdType typeId, const Vector<Signature>& signatures)
+		inline void AddSignature(RTTI::IdType typeId, const SignatureList& signatures)
 		{
 			_signatures.Emplace(typeId, signatures);
 		}
 
 	private:
 		inline static TypeManager* _instance{ nullptr };
-		HashMap<std::size_t, Vector<Signature>> _signatures;
+		HashMap<std::size_t, SignatureList> _signatures;
 	};
 }
\ No newline at end of file
@@ -3,17 +3,47 @@
 #include <cstddef>
 #include <stdexcept>
 #include <initializer_list>
-#include <functional>
+#include <algorithm>
 #include "DefaultIncrement.h"
+#include "TriviallyRelocatable.h"
 
 namespace FieaGameEngine
 {
 	/// <summary>
-	/// A container that holds its members in a dynamic contiguous array.
+	/// Uninitialized space for a fixed number of elements, kept inside the object that owns it.
+	/// </summary>
+	template <typename T, std::size_t Capacity>
+	class InlineStorage
+	{
+	protected:
+		T* InlineData() { return reinterpret_cast<T*>(_buffer); }
+		const T* InlineData() const { return reinterpret_cast<const T*>(_buffer); }
+
+	private:
+		alignas(T) std::byte _buffer[Capacity * sizeof(T)];
+	};
+
+	/// <summary>
+	/// Without an inline capacity there is no buffer, so an empty base costs nothing.
 	/// </summary>
-	/// <typeparam name="T"></typeparam>
 	template <typename T>
-	class Vector final
+	class InlineStorage<T, 0>
+	{
+	protected:
+		T* InlineData() const { return nullptr; }
+	};
+
+	/// <summary>
+	/// A container that holds its members in a dynamic contiguous array. An empty vector owns no memory; the first insertion allocates,
+	/// and every time the array fills it is grown to the capacity returned by the growth policy.
+	/// Elements of trivially relocatable types are moved to a new array with realloc; all others are move constructed and then destroyed.
+	/// </summary>
+	/// <typeparam name="T">The type of the elements.</typeparam>
+	/// <typeparam name="TGrowth">A default constructible functor taking the current capacity and size and returning the next capacity.
+	/// It is resolved at compile time, so growing costs no indirect call and adds nothing to the size of the vector.</typeparam>
+	/// <typeparam name="InlineCapacity">How many elements are stored inside the vector itself before it spills to the heap. See SmallVector.</typeparam>
+	template <typename T, typename TGrowth = DefaultIncrement<T>, std::size_t InlineCapacity = 0>
+	class Vector final : private InlineStorage<T, InlineCapacity>
 	{
 	public:
 		using size_type = std::size_t;
@@ -23,10 +53,29 @@ namespace FieaGameEngine
 		using rvalue_reference = T&&;
 
 	private:
-		value_type* _vec;
-		size_type _capacity{ 5 };
+		value_type* _vec{ this->InlineData() };
+		size_type _capacity{ InlineCapacity };
 		size_type _size{ 0 };
-		std::function<std::size_t(std::size_t, std::size_t)> incrementFunctor{ DefaultIncrement<value_type> {} };
+
+		template<typename...Args>
+		void GrowAndEmplaceBack(Args&&...);
+		/// <summary>
+		/// Moves the elements to a heap array of the given capacity, using realloc when value_type is trivially relocatable and the elements are already on the heap.
+		/// </summary>
+		void Reallocate(size_type);
+		/// <summary>
+		/// Moves count elements from source into uninitialized destination memory, leaving source uninitialized. Frees nothing.
+		/// </summary>
+		static void Relocate(value_type* source, size_type count, value_type* destination);
+		/// <summary>
+		/// Frees the array unless it is the inline buffer.
+		/// </summary>
+		void Deallocate();
+		/// <summary>
+		/// Takes the elements of another vector, leaving it empty. This vector must be empty and using its inline buffer.
+		/// </summary>
+		void Steal(Vector& other) noexcept;
+		[[nodiscard]] bool IsInline() const;
 
 	public:
 
@@ -348,14 +397,14 @@ namespace FieaGameEngine
 		};
 
 		/// <summary>
-		/// Creates an empty vector with a capacity of 5.
+		/// Creates an empty vector with a capacity equal to its inline capacity. Does not allocate.
 		/// </summary>
-		explicit Vector(std::function<std::size_t(std::size_t, std::size_t)> = DefaultIncrement<value_type>{});
+		Vector() = default;
 		/// <summary>
 		/// Creates a Vector containing the provided elements and an equivalent size and capacity.
 		/// </summary>
 		/// <param name=""></param>
-		explicit Vector(std::initializer_list<value_type>, std::function<std::size_t(std::size_t, std::size_t)> = DefaultIncrement<value_type>{});
+		explicit Vector(std::initializer_list<value_type>);
 		/// <summary>
 		/// Copy Constructs a vector given another vector.
 		/// </summary>
@@ -383,16 +432,6 @@ namespace FieaGameEngine
 		/// </summary>
 		~Vector();
 		/// <summary>
-		/// Returns the functor currently used for increment.
-		/// </summary>
-		/// <returns>functor</returns>
-		std::function<std::size_t(std::size_t, std::size_t)> GetIncrementStrategy();
-		/// <summary>
-		/// Changes the current increment to the passed Functor. The functor must return a size_t and take two size_t's as parameters. 
-		/// </summary>
-		/// <param name="">functor</param>
-		void SetIncrementStrategy(std::function<std::size_t(std::size_t, std::size_t)>);
-		/// <summary>
 		/// Copies an item in the back of the vector. If there is not enough capacity, more memory will be allocated.
 		/// </summary>
 		void PushBack(const_reference);
@@ -415,7 +454,8 @@ namespace FieaGameEngine
 		/// <param name=""></param>
 		void Reserve(size_type);
 		/// <summary>
-		/// Relocates the items in the vector in order to take up less space in memory.
+		/// Relocates the items in the vector in order to take up less space in memory. If they fit in the inline buffer the heap array is released,
+		/// so an empty Vector gives up its memory entirely.
 		/// </summary>
 		void ShrinkToFit();
 		/// <summary>
@@ -521,6 +561,23 @@ namespace FieaGameEngine
 		/// <returns>ConstIterator</returns>
 		[[nodiscard]] ConstIterator Find(const_reference) const;
 	};
+
+	/// <summary>
+	/// A Vector without inline storage only holds a pointer to its elements, so it can be relocated whatever it contains.
+	/// With inline storage it may point into itself.
+	/// </summary>
+	template <typename T, typename TGrowth>
+	struct IsTriviallyRelocatable<Vector<T, TGrowth, 0>> : std::true_type
+	{
+	};
+
+	/// <summary>
+	/// A Vector that stores its first N elements inside itself and only allocates once it holds more, for the many containers that usually stay small.
+	/// It has the same interface as Vector, and shrinking back to N or fewer elements returns to the inline buffer.
+	/// Moving a SmallVector whose elements are inline moves each element rather than a pointer.
+	/// </summary>
+	template <typename T, std::size_t N, typename TGrowth = DefaultIncrement<T>>
+	using SmallVector = Vector<T, TGrowth, N>;
 }
 
 #include "Vector.inl"
\ No newline at end of file
@@ -1,61 +1,47 @@
 #include "Vector.h"
 #include <cassert>
+#include <cstring>
+#include <algorithm>
+#include <utility>
 
 namespace FieaGameEngine
 {
 #pragma region Vector
-	template <typename value_type>
-	Vector<value_type>::Vector(std::function<std::size_t(std::size_t, std::size_t)> functor) :
-		incrementFunctor{functor}
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline Vector<value_type, TGrowth, InlineCapacity>::Vector(std::initializer_list<value_type> list)
 	{
-		_vec = reinterpret_cast<value_type*>(malloc(_capacity * sizeof(value_type)));
-	}
-
-	template<typename value_type>
-	inline Vector<value_type>::Vector(std::initializer_list<value_type> list, std::function<std::size_t(std::size_t, std::size_t)> functor) :
-		_capacity{ list.size() }, incrementFunctor{functor}
-	{
-		_vec = reinterpret_cast<value_type*>(malloc(_capacity *sizeof(value_type)));
+		Reserve(list.size());
 		for (auto& item : list)
 		{
 			EmplaceBack(item);
 		}
 	}
 
-	template<typename value_type>
-	inline Vector<value_type>::Vector(const Vector& other) :
-		_capacity{ other._capacity }, _size{ other._size }, incrementFunctor{other.incrementFunctor}
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline Vector<value_type, TGrowth, InlineCapacity>::Vector(const Vector& other)
 	{
-		_vec = reinterpret_cast<value_type*>(malloc(_capacity * sizeof(value_type)));
-
-		for (size_type position{ 0 }; position < _size; ++position)
+		Reserve(other._capacity);
+		for (size_type position{ 0 }; position < other._size; ++position)
 		{
 			new (_vec + position)value_type{ other._vec[position] };
 		}
+		_size = other._size;
 	}
 
-	template<typename value_type>
-	inline Vector<value_type>::Vector(Vector&& other) noexcept :
-		_vec{ other._vec }, _size{ other._size }, _capacity{ other._capacity }, incrementFunctor{ other.incrementFunctor }
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline Vector<value_type, TGrowth, InlineCapacity>::Vector(Vector&& other) noexcept
 	{
-		other._vec = nullptr;
-		other._size = 0;
-		other._capacity = 0;
+		Steal(other);
 	}
 
-	template<typename value_type>
-	inline Vector<value_type>& Vector<value_type>::operator=(const Vector& other)
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline Vector<value_type, TGrowth, InlineCapacity>& Vector<value_type, TGrowth, InlineCapacity>::operator=(const Vector& other)
 	{
 		if(this != &other)
 		{
 			Clear();
+			Reserve(other._capacity);
 			_size = other._size;
-			incrementFunctor = other.incrementFunctor;
-
-			if(_capacity < other._capacity)
-			{
-				Reserve(other._capacity);
-			}
 
 			for (size_type position{ 0 }; position < other._size; ++position)
 			{
@@ -66,75 +52,182 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template<typename value_type>
-	inline Vector<value_type>& Vector<value_type>::operator=(Vector&& other) noexcept
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline Vector<value_type, TGrowth, InlineCapacity>& Vector<value_type, TGrowth, InlineCapacity>::operator=(Vector&& other) noexcept
 	{
 		if(this != &other)
 		{
 			Clear();
-			free(_vec);
-			_vec = other._vec;
-			_size = other._size;
-			_capacity = other._capacity;
-			incrementFunctor = other.incrementFunctor;
-
-			other._vec = nullptr;
-			other._size = 0;
-			other._capacity = 0;
+			Deallocate();
+			_vec = this->InlineData();
+			_capacity = InlineCapacity;
+			Steal(other);
 		}
 
 		return *this;
 	}
 
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline void Vector<value_type, TGrowth, InlineCapacity>::Steal(Vector& other) noexcept
+	{
+		if (other.IsInline())
+		{
+			// Inline elements cannot change owners with the pointer, so they are relocated into this vector's buffer instead.
+			Relocate(other._vec, other._size, _vec);
+		}
+		else
+		{
+			_vec = other._vec;
+			_capacity = other._capacity;
+			other._vec = other.InlineData();
+			other._capacity = InlineCapacity;
+		}
+		_size = other._size;
+		other._size = 0;
+	}
+
 
-	template <typename value_type>
-	inline void Vector<value_type>::PushBack(const_reference itemToAdd)
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline void Vector<value_type, TGrowth, InlineCapacity>::PushBack(const_reference itemToAdd)
 	{
 		EmplaceBack(itemToAdd);
 	}
 
-	template <typename value_type>
-	inline void Vector<value_type>::PushBack(rvalue_reference itemToAdd)
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline void Vector<value_type, TGrowth, InlineCapacity>::PushBack(rvalue_reference itemToAdd)
 	{
 		EmplaceBack(std::forward<rvalue_reference>(itemToAdd));
 	}
 
-	template <typename value_type>
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
 	template <typename...Args>
-	inline void Vector<value_type>::EmplaceBack(Args&&... args)
+	inline void Vector<value_type, TGrowth, InlineCapacity>::EmplaceBack(Args&&... args)
 	{
 		if ((_size + 1) > _capacity)
 		{
-			_capacity = std::max(incrementFunctor(_capacity, _size), _capacity + 1);
-			value_type* vec = reinterpret_cast<value_type*>(realloc(_vec, _capacity * sizeof(value_type)));
-			assert(vec != nullptr);
-			_vec = vec;
+			GrowAndEmplaceBack(std::forward<Args>(args)...);
+			return;
 		}
 		new (_vec + _size++)value_type{ std::forward<Args>(args)...};
 	}
 
-	template <typename value_type>
-	inline void Vector<value_type>::Reserve(size_type capacity)
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	template <typename...Args>
+	inline void Vector<value_type, TGrowth, InlineCapacity>::GrowAndEmplaceBack(Args&&... args)
 	{
-		if(capacity > _capacity)
+		// The arguments may refer to an element of this vector, so the new item is built before the old array is released.
+		size_type capacity{ std::max(TGrowth{}(_capacity, _size), _capacity + 1) };
+		if constexpr (TriviallyRelocatable<value_type>)
+		{
+			alignas(value_type) std::byte item[sizeof(value_type)];
+			new (item)value_type{ std::forward<Args>(args)... };
+			Reallocate(capacity);
+			std::memcpy(static_cast<void*>(_vec + _size), item, sizeof(value_type));
+		}
+		else
 		{
-			value_type* vec = reinterpret_cast<value_type*>(realloc(_vec, (capacity) * sizeof(value_type)));
+			value_type* vec = reinterpret_cast<value_type*>(malloc(capacity * sizeof(value_type)));
 			assert(vec != nullptr);
+			new (vec + _size)value_type{ std::forward<Args>(args)... };
+			Relocate(_vec, _size, vec);
+			Deallocate();
 			_vec = vec;
 			_capacity = capacity;
 		}
+		++_size;
 	}
 
-	template <typename value_type>
-	inline void Vector<value_type>::ShrinkToFit()
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline void Vector<value_type, TGrowth, InlineCapacity>::Reallocate(size_type capacity)
 	{
-		value_type* vec = reinterpret_cast<value_type*>(realloc(_vec, (_capacity = _size == 0 ?  1 : _size) * sizeof(value_type)));
+		if constexpr (TriviallyRelocatable<value_type>)
+		{
+			if (!IsInline())
+			{
+				value_type* vec = reinterpret_cast<value_type*>(realloc(_vec, capacity * sizeof(value_type)));
+				assert(vec != nullptr);
+				_vec = vec;
+				_capacity = capacity;
+				return;
+			}
+		}
+
+		value_type* vec = reinterpret_cast<value_type*>(malloc(capacity * sizeof(value_type)));
 		assert(vec != nullptr);
+		Relocate(_vec, _size, vec);
+		Deallocate();
 		_vec = vec;
+		_capacity = capacity;
 	}
 
-	template<typename value_type>
-	inline void Vector<value_type>::PopBack()
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline void Vector<value_type, TGrowth, InlineCapacity>::Relocate(value_type* source, size_type count, value_type* destination)
+	{
+		if constexpr (TriviallyRelocatable<value_type>)
+		{
+			if (count > 0)
+			{
+				std::memcpy(static_cast<void*>(destination), source, count * sizeof(value_type));
+			}
+		}
+		else
+		{
+			for (size_type position{ 0 }; position < count; ++position)
+			{
+				new (destination + position)value_type(std::move_if_noexcept(source[position]));
+				source[position].~value_type();
+			}
+		}
+	}
+
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline void Vector<value_type, TGrowth, InlineCapacity>::Deallocate()
+	{
+		if (!IsInline())
+		{
+			free(_vec);
+		}
+	}
+
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline bool Vector<value_type, TGrowth, InlineCapacity>::IsInline() const
+	{
+		return InlineCapacity > 0 && _vec == this->InlineData();
+	}
+
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline void Vector<value_type, TGrowth, InlineCapacity>::Reserve(size_type capacity)
+	{
+		if(capacity > _capacity)
+		{
+			Reallocate(capacity);
+		}
+	}
+
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline void Vector<value_type, TGrowth, InlineCapacity>::ShrinkToFit()
+	{
+		if (_size <= InlineCapacity)
+		{
+			// Everything fits in the inline buffer, which for a plain Vector means an empty vector gives up its memory entirely.
+			if (!IsInline())
+			{
+				Relocate(_vec, _size, this->InlineData());
+				free(_vec);
+				_vec = this->InlineData();
+				_capacity = InlineCapacity;
+			}
+			return;
+		}
+
+		if (_size < _capacity)
+		{
+			Reallocate(_size);
+		}
+	}
+
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline void Vector<value_type, TGrowth, InlineCapacity>::PopBack()
 	{
 		if(_size >= 1)
 		{
@@ -142,22 +235,22 @@ namespace FieaGameEngine
 		}
 	}
 
-	template <typename value_type>
-	inline typename Vector<value_type>::reference Vector<value_type>::operator[](size_t position)
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline typename Vector<value_type, TGrowth, InlineCapacity>::reference Vector<value_type, TGrowth, InlineCapacity>::operator[](size_t position)
 	{
 		assert(position < _size);
 		return _vec[position];
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::const_reference Vector<value_type>::operator[](size_t position) const
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline typename Vector<value_type, TGrowth, InlineCapacity>::const_reference Vector<value_type, TGrowth, InlineCapacity>::operator[](size_t position) const
 	{
 		assert(position < _size);
 		return _vec[position];
 	}
 
-	template <typename value_type>
-	inline void Vector<value_type>::Clear()
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline void Vector<value_type, TGrowth, InlineCapacity>::Clear()
 	{
 		for (size_type position{ 0 }; position < _size; ++position)
 		{
@@ -166,8 +259,8 @@ namespace FieaGameEngine
 		_size = 0;
 	}
 
-	template <typename value_type>
-	inline typename Vector<value_type>::reference Vector<value_type>::Front() const
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline typename Vector<value_type, TGrowth, InlineCapacity>::reference Vector<value_type, TGrowth, InlineCapacity>::Front() const
 	{
 #ifdef USING_EXCEPTIONS
 		if (_size == 0)
@@ -178,8 +271,8 @@ namespace FieaGameEngine
 		return _vec[0];
 	}
 
-	template <typename value_type>
-	inline typename Vector<value_type>::reference Vector<value_type>::Back() const
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline typename Vector<value_type, TGrowth, InlineCapacity>::reference Vector<value_type, TGrowth, InlineCapacity>::Back() const
 	{
 #ifdef USING_EXCEPTIONS
 		if (_size == 0)
@@ -190,8 +283,8 @@ namespace FieaGameEngine
 		return _vec[_size -1];
 	}
 
-	template <typename value_type>
-	inline typename Vector<value_type>::reference Vector<value_type>::At(size_t position)
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline typename Vector<value_type, TGrowth, InlineCapacity>::reference Vector<value_type, TGrowth, InlineCapacity>::At(size_t position)
 	{
 #ifdef USING_EXCEPTIONS
 		if (position >= _size)
@@ -202,8 +295,8 @@ namespace FieaGameEngine
 		return _vec[position];
 	}
 
-	template <typename value_type>
-	inline typename Vector<value_type>::const_reference Vector<value_type>::At(size_t position) const
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline typename Vector<value_type, TGrowth, InlineCapacity>::const_reference Vector<value_type, TGrowth, InlineCapacity>::At(size_t position) const
 	{
 #ifdef USING_EXCEPTIONS
 		if (position >= _size)
@@ -214,64 +307,64 @@ namespace FieaGameEngine
 		return _vec[position];
 	}
 
-	template <typename value_type>
-	inline size_t Vector<value_type>::Size() const
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline size_t Vector<value_type, TGrowth, InlineCapacity>::Size() const
 	{
 		return _size;
 	}
 
-	template <typename value_type>
-	size_t Vector<value_type>::Capacity() const
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	size_t Vector<value_type, TGrowth, InlineCapacity>::Capacity() const
 	{
 		return _capacity;
 	}
 
 
-	template <typename value_type>
-	bool Vector<value_type>::IsEmpty() const
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	bool Vector<value_type, TGrowth, InlineCapacity>::IsEmpty() const
 	{
 		return _size == 0;
 	}
 
 
-	template <typename value_type>
-	inline typename Vector<value_type>::Iterator Vector<value_type>::begin()
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline typename Vector<value_type, TGrowth, InlineCapacity>::Iterator Vector<value_type, TGrowth, InlineCapacity>::begin()
 	{
 		return Iterator(*this, _vec);
 	}
 
-	template <typename value_type>
-	inline typename Vector<value_type>::Iterator Vector<value_type>::end()
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline typename Vector<value_type, TGrowth, InlineCapacity>::Iterator Vector<value_type, TGrowth, InlineCapacity>::end()
 	{
 		return Iterator(*this, _vec + _size);
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::ConstIterator Vector<value_type>::begin() const
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline typename Vector<value_type, TGrowth, InlineCapacity>::ConstIterator Vector<value_type, TGrowth, InlineCapacity>::begin() const
 	{
 		return ConstIterator( *this, _vec);
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::ConstIterator Vector<value_type>::end() const
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline typename Vector<value_type, TGrowth, InlineCapacity>::ConstIterator Vector<value_type, TGrowth, InlineCapacity>::end() const
 	{
 		return ConstIterator(*this, _vec + _size);
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::ConstIterator Vector<value_type>::cbegin() const
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline typename Vector<value_type, TGrowth, InlineCapacity>::ConstIterator Vector<value_type, TGrowth, InlineCapacity>::cbegin() const
 	{
 		return ConstIterator(*this, _vec);
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::ConstIterator Vector<value_type>::cend() const
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline typename Vector<value_type, TGrowth, InlineCapacity>::ConstIterator Vector<value_type, TGrowth, InlineCapacity>::cend() const
 	{
 		return ConstIterator(*this, _vec + _size);
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::Iterator Vector<value_type>::Find(const_reference itemToFind)
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline typename Vector<value_type, TGrowth, InlineCapacity>::Iterator Vector<value_type, TGrowth, InlineCapacity>::Find(const_reference itemToFind)
 	{
 		Iterator position{ begin() };
 
@@ -286,8 +379,8 @@ namespace FieaGameEngine
 		return position;
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::ConstIterator Vector<value_type>::Find(const_reference itemToFind) const
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline typename Vector<value_type, TGrowth, InlineCapacity>::ConstIterator Vector<value_type, TGrowth, InlineCapacity>::Find(const_reference itemToFind) const
 	{
 		ConstIterator position{ begin() };
 
@@ -302,8 +395,8 @@ namespace FieaGameEngine
 		return position;
 	}
 
-	template<typename value_type>
-	inline void Vector<value_type>::Remove(Iterator first, Iterator last)
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline void Vector<value_type, TGrowth, InlineCapacity>::Remove(Iterator first, Iterator last)
 	{
 		if (first._owner != last._owner)
 		{
@@ -317,90 +410,91 @@ namespace FieaGameEngine
 
 		if ( last > first && first._owner == last._owner)
 		{
-			auto iterator{ first };
-			while(iterator != last)
+			size_type removed{ last - first };
+			if constexpr (TriviallyRelocatable<value_type>)
 			{
-				(*iterator).~value_type();
-				++iterator;
+				auto iterator{ first };
+				while(iterator != last)
+				{
+					(*iterator).~value_type();
+					++iterator;
+				}
+				std::memmove(static_cast<void*>(first._position), last._position, (end() - last)*sizeof(value_type));
 			}
-			memmove(first._position, last._position, (end() - last)*sizeof(value_type));
-			_size -= (last - first);
+			else
+			{
+				// Shift the survivors down by assignment, then destroy the moved-from objects left at the end.
+				value_type* position{ std::move(last._position, _vec + _size, first._position) };
+				for (; position != _vec + _size; ++position)
+				{
+					position->~value_type();
+				}
+			}
+			_size -= removed;
 		}
 	}
 
-	template<typename value_type>
-	inline void Vector<value_type>::Remove(const_reference value)
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline void Vector<value_type, TGrowth, InlineCapacity>::Remove(const_reference value)
 	{
 		auto iterator{ Find(value)};
 		Remove(iterator, iterator + 1);
 	}
 
-	template <typename value_type>
-	Vector<value_type>::~Vector()
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	Vector<value_type, TGrowth, InlineCapacity>::~Vector()
 	{
 		for (size_type position{ 0 }; position < _size; ++position )
 		{
 			_vec[position].~value_type();
 		}
-		free(_vec);
-	}
-
-	template<typename value_type>
-	inline std::function<std::size_t(std::size_t, std::size_t)> Vector<value_type>::GetIncrementStrategy()
-	{
-		return incrementFunctor;
-	}
-
-	template<typename value_type>
-	inline void Vector<value_type>::SetIncrementStrategy(std::function<std::size_t(std::size_t, std::size_t)> strategy)
-	{
-		incrementFunctor = strategy;
+		Deallocate();
 	}
 #pragma endregion Vector
 
 #pragma region Iterator
-	template <typename value_type>
-	inline bool Vector<value_type>::Iterator::operator!=(const Iterator& other) const
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline bool Vector<value_type, TGrowth, InlineCapacity>::Iterator::operator!=(const Iterator& other) const
 	{
 		return _position != other._position || _owner != other._owner;
 	}
 
-	template <typename value_type>
-	inline bool Vector<value_type>::Iterator::operator==(const Iterator& other) const
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline bool Vector<value_type, TGrowth, InlineCapacity>::Iterator::operator==(const Iterator& other) const
 	{
 		return !(*this != other);
 	}
 
-	template <typename value_type>
-	inline bool Vector<value_type>::Iterator::operator<(const Iterator& other) const
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline bool Vector<value_type, TGrowth, InlineCapacity>::Iterator::operator<(const Iterator& other) const
 	{
 		assert(_owner == other._owner);
 		return _position < other._position;
 	}
 
-	template <typename value_type>
-	inline bool Vector<value_type>::Iterator::operator<=(const Iterator& other) const
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline bool Vector<value_type, TGrowth, InlineCapacity>::Iterator::operator<=(const Iterator& other) const
 	{
 		assert(_owner == other._owner);
 		return _position <= other._position;
 	}
 
-	template <typename value_type>
-	inline bool Vector<value_type>::Iterator::operator>(const Iterator& other) const
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline bool Vector<value_type, TGrowth, InlineCapacity>::Iterator::operator>(const Iterator& other) const
 	{
 		assert(_owner == other._owner);
 		return _position > other._position;
 	}
 
-	template <typename value_type>
-	inline bool Vector<value_type>::Iterator::operator>=(const Iterator& other) const
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline bool Vector<value_type, TGrowth, InlineCapacity>::Iterator::operator>=(const Iterator& other) const
 	{
 		assert(_owner == other._owner);
 		return _position >= other._position;
 	}
 
-	template<typename value_type>
-	inline Vector<value_type>::reference Vector<value_type>::Iterator::operator[](std::size_t position) const
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline Vector<value_type, TGrowth, InlineCapacity>::reference Vector<value_type, TGrowth, InlineCapacity>::Iterator::operator[](std::size_t position) const
 	{
 #ifdef USING_EXCEPTIONS
 		if (_owner == nullptr)
@@ -411,8 +505,8 @@ namespace FieaGameEngine
 		return (*_owner)[position];
 	}
 
-	template <typename value_type>
-	inline typename Vector<value_type>::reference Vector<value_type>::Iterator::operator*() const
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline typename Vector<value_type, TGrowth, InlineCapacity>::reference Vector<value_type, TGrowth, InlineCapacity>::Iterator::operator*() const
 	{
 #ifdef USING_EXCEPTIONS
 		if ( _position >= _owner->_vec + _owner->_size || _position < _owner->_vec || _position == nullptr)
@@ -423,15 +517,15 @@ namespace FieaGameEngine
 		return *_position;
 	}
 
-	template <typename value_type>
-	Vector<value_type>::Iterator::Iterator(Vector& vector, value_type* position) :
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	Vector<value_type, TGrowth, InlineCapacity>::Iterator::Iterator(Vector& vector, value_type* position) :
 		_owner{ &vector }, _position{ position }
 	{
 
 	}
 
-	template <typename value_type>
-	typename Vector<value_type>::Iterator& Vector<value_type>::Iterator::operator++()
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	typename Vector<value_type, TGrowth, InlineCapacity>::Iterator& Vector<value_type, TGrowth, InlineCapacity>::Iterator::operator++()
 	{
 		if (_owner != nullptr)
 		{
@@ -440,16 +534,16 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template <typename value_type>
-	typename Vector<value_type>::Iterator Vector<value_type>::Iterator::operator++(int)
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	typename Vector<value_type, TGrowth, InlineCapacity>::Iterator Vector<value_type, TGrowth, InlineCapacity>::Iterator::operator++(int)
 	{
 		Iterator iterator{ *this };
 		operator++();
 		return iterator;
 	}
 
-	template <typename value_type>
-	typename Vector<value_type>::Iterator& Vector<value_type>::Iterator::operator--()
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	typename Vector<value_type, TGrowth, InlineCapacity>::Iterator& Vector<value_type, TGrowth, InlineCapacity>::Iterator::operator--()
 	{
 		if (_owner != nullptr)
 		{
@@ -458,23 +552,23 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template <typename value_type>
-	typename Vector<value_type>::Iterator Vector<value_type>::Iterator::operator--(int)
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	typename Vector<value_type, TGrowth, InlineCapacity>::Iterator Vector<value_type, TGrowth, InlineCapacity>::Iterator::operator--(int)
 	{
 		Iterator iterator{ *this };
 		operator--();
 		return iterator;
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::Iterator::Iterator& Vector<value_type>::Iterator::operator+=(size_type offset)
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline typename Vector<value_type, TGrowth, InlineCapacity>::Iterator::Iterator& Vector<value_type, TGrowth, InlineCapacity>::Iterator::operator+=(size_type offset)
 	{
 		_position += offset;
 		return *this;
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::Iterator::Iterator& Vector<value_type>::Iterator::operator-=(size_type offset)
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline typename Vector<value_type, TGrowth, InlineCapacity>::Iterator::Iterator& Vector<value_type, TGrowth, InlineCapacity>::Iterator::operator-=(size_type offset)
 	{
 		_position -= offset;
 		return *this;
@@ -482,62 +576,62 @@ namespace FieaGameEngine
 #pragma endregion Iterator
 
 #pragma region ConstIterator
-	template <typename value_type>
-	Vector<value_type>::ConstIterator::ConstIterator(const Vector& vector, const value_type* position) :
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	Vector<value_type, TGrowth, InlineCapacity>::ConstIterator::ConstIterator(const Vector& vector, const value_type* position) :
 		_owner{ &vector }, _position{ position }
 	{
 		
 	}
 
-	template <typename value_type>
-	Vector<value_type>::ConstIterator::ConstIterator(Iterator other) :
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	Vector<value_type, TGrowth, InlineCapacity>::ConstIterator::ConstIterator(Iterator other) :
 		_owner{ other._owner }, _position{ other._position }
 	{
 		
 	}
 
-	template <typename value_type>
-	inline bool Vector<value_type>::ConstIterator::operator!=(const ConstIterator& other) const
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline bool Vector<value_type, TGrowth, InlineCapacity>::ConstIterator::operator!=(const ConstIterator& other) const
 	{
 		return _position != other._position || _owner != other._owner;
 	}
 
-	template <typename value_type>
-	inline bool Vector<value_type>::ConstIterator::operator==(const ConstIterator& other) const
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline bool Vector<value_type, TGrowth, InlineCapacity>::ConstIterator::operator==(const ConstIterator& other) const
 	{
 		return !(*this != other);
 	}
 
-	template <typename value_type>
-	inline bool Vector<value_type>::ConstIterator::operator<(const ConstIterator& other) const
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline bool Vector<value_type, TGrowth, InlineCapacity>::ConstIterator::operator<(const ConstIterator& other) const
 	{
 		assert(_owner == other._owner);
 		return _position < other._position;
 	}
 
-	template<typename value_type>
-	inline bool Vector<value_type>::ConstIterator::operator<=(const ConstIterator& other) const
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline bool Vector<value_type, TGrowth, InlineCapacity>::ConstIterator::operator<=(const ConstIterator& other) const
 	{
 		assert(_owner == other._owner);
 		return _position <= other._position;
 	}
 
-	template <typename value_type>
-	inline bool Vector<value_type>::ConstIterator::operator>(const ConstIterator& other) const
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline bool Vector<value_type, TGrowth, InlineCapacity>::ConstIterator::operator>(const ConstIterator& other) const
 	{
 		assert(_owner == other._owner);
 		return _position > other._position;
 	}
 
-	template<typename value_type>
-	inline bool Vector<value_type>::ConstIterator::operator>=(const ConstIterator& other) const
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline bool Vector<value_type, TGrowth, InlineCapacity>::ConstIterator::operator>=(const ConstIterator& other) const
 	{
 		assert(_owner == other._owner);
 		return _position >= other._position;
 	}
 
-	template<typename value_type>
-	inline Vector<value_type>::const_reference Vector<value_type>::ConstIterator::operator[](std::size_t position) const
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline Vector<value_type, TGrowth, InlineCapacity>::const_reference Vector<value_type, TGrowth, InlineCapacity>::ConstIterator::operator[](std::size_t position) const
 	{
 #ifdef USING_EXCEPTIONS
 		if (_owner == nullptr)
@@ -548,8 +642,8 @@ namespace FieaGameEngine
 		return (*_owner)[position];
 	}
 
-	template <typename value_type>
-	inline typename Vector<value_type>::const_reference Vector<value_type>::ConstIterator::operator*() const
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline typename Vector<value_type, TGrowth, InlineCapacity>::const_reference Vector<value_type, TGrowth, InlineCapacity>::ConstIterator::operator*() const
 	{
 #ifdef USING_EXCEPTIONS
 		if(_position >= _owner->_vec + _owner->_size || _position < _owner->_vec || _position == nullptr)
@@ -560,8 +654,8 @@ namespace FieaGameEngine
 		return *_position;
 	}
 
-	template <typename value_type>
-	typename Vector<value_type>::ConstIterator& Vector<value_type>::ConstIterator::operator++()
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	typename Vector<value_type, TGrowth, InlineCapacity>::ConstIterator& Vector<value_type, TGrowth, InlineCapacity>::ConstIterator::operator++()
 	{
 		if (_owner != nullptr)
 		{
@@ -570,16 +664,16 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template <typename value_type>
-	typename Vector<value_type>::ConstIterator Vector<value_type>::ConstIterator::operator++(int)
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	typename Vector<value_type, TGrowth, InlineCapacity>::ConstIterator Vector<value_type, TGrowth, InlineCapacity>::ConstIterator::operator++(int)
 	{
 		ConstIterator iterator{ *this };
 		operator++();
 		return iterator;
 	}
 
-	template <typename value_type>
-	typename Vector<value_type>::ConstIterator& Vector<value_type>::ConstIterator::operator--()
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	typename Vector<value_type, TGrowth, InlineCapacity>::ConstIterator& Vector<value_type, TGrowth, InlineCapacity>::ConstIterator::operator--()
 	{
 		if (_owner != nullptr)
 		{
@@ -588,23 +682,23 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template <typename value_type>
-	typename Vector<value_type>::ConstIterator Vector<value_type>::ConstIterator::operator--(int)
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	typename Vector<value_type, TGrowth, InlineCapacity>::ConstIterator Vector<value_type, TGrowth, InlineCapacity>::ConstIterator::operator--(int)
 	{
 		ConstIterator iterator{ *this };
 		operator--();
 		return iterator;
 	}
 
-	template<typename value_type>
-	inline Vector<value_type>::ConstIterator& Vector<value_type>::ConstIterator::operator+=(size_type offset)
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline Vector<value_type, TGrowth, InlineCapacity>::ConstIterator& Vector<value_type, TGrowth, InlineCapacity>::ConstIterator::operator+=(size_type offset)
 	{
 		_position += offset;
 		return *this;
 	}
 
-	template<typename value_type>
-	inline Vector<value_type>::ConstIterator& Vector<value_type>::ConstIterator::operator-=(size_type offset)
+	template <typename value_type, typename TGrowth, std::size_t InlineCapacity>
+	inline Vector<value_type, TGrowth, InlineCapacity>::ConstIterator& Vector<value_type, TGrowth, InlineCapacity>::ConstIterator::operator-=(size_type offset)
 	{
 		_position -= offset;
 		return *this;